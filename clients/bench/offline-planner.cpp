@@ -0,0 +1,153 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Build plans for bench tokens without a GPU, using a device profile
+// to describe the device to plan for.  Prints the work buffer size of
+// each plan, and optionally writes the plan trees to a file.
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../../shared/CLI11.hpp"
+#include "../../shared/device_profile.h"
+#include "../../shared/device_properties.h"
+#include "../../shared/environment.h"
+#include "../../shared/rocfft_hip.h"
+#include "../../shared/rocfft_params.h"
+#include "rocfft/rocfft.h"
+
+// value of rocfft_layer_mode_log_plan in the library's log layers
+static const unsigned int layer_mode_log_plan = 8;
+
+// read tokens, one per line, skipping blank lines and comments
+static void read_tokens(std::istream& is, std::vector<std::string>& tokens)
+{
+    std::string line;
+    while(std::getline(is, line))
+    {
+        auto begin = line.find_first_not_of(" \t\r");
+        if(begin == std::string::npos || line[begin] == '#')
+            continue;
+        auto end = line.find_last_not_of(" \t\r");
+        tokens.push_back(line.substr(begin, end - begin + 1));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::string              profile_path;
+    std::string              write_profile_path;
+    std::string              plan_log_path;
+    std::string              token_file;
+    std::vector<std::string> tokens;
+    int                      deviceId{};
+
+    CLI::App app{"rocfft-offline-planner command line options"};
+
+    auto* opt_write_profile = app.add_option(
+        "--write-profile",
+        write_profile_path,
+        "Write a device profile describing the current device to this file, and exit");
+    app.add_option("--device", deviceId, "Device to write a profile for")->default_val(0);
+    app.add_option("--device-profile", profile_path, "Device profile to build plans for")
+        ->check(CLI::ExistingFile)
+        ->excludes(opt_write_profile);
+    app.add_option("--token", tokens, "Token describing a transform to plan (repeatable)");
+    app.add_option("--token-file",
+                   token_file,
+                   "File of tokens to plan, one per line.  Tokens are read from stdin if "
+                   "neither --token nor --token-file is given")
+        ->check(CLI::ExistingFile);
+    app.add_option("--plan-log",
+                   plan_log_path,
+                   "Write the tree, kernels and buffer assignments of each plan to this file");
+
+    CLI11_PARSE(app, argc, argv);
+
+    if(!write_profile_path.empty())
+    {
+        rocfft_scoped_device dev(deviceId);
+
+        std::ofstream os(write_profile_path);
+        if(!os)
+        {
+            std::cerr << "unable to open " << write_profile_path << std::endl;
+            return EXIT_FAILURE;
+        }
+        device_profile_write(os, get_curr_device_prop());
+        return EXIT_SUCCESS;
+    }
+
+    if(profile_path.empty())
+    {
+        std::cerr << "--device-profile or --write-profile is required" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if(!token_file.empty())
+    {
+        std::ifstream is(token_file);
+        read_tokens(is, tokens);
+    }
+    else if(tokens.empty())
+        read_tokens(std::cin, tokens);
+
+    // the library reads these during rocfft_setup
+    rocfft_setenv("ROCFFT_OFFLINE_DEVICE_PROFILE", profile_path.c_str());
+    if(!plan_log_path.empty())
+    {
+        auto layer_mode = std::strtoul(rocfft_getenv("ROCFFT_LAYER").c_str(), nullptr, 0);
+        rocfft_setenv("ROCFFT_LAYER", std::to_string(layer_mode | layer_mode_log_plan).c_str());
+        rocfft_setenv("ROCFFT_LOG_PLAN_PATH", plan_log_path.c_str());
+    }
+
+    if(rocfft_setup() != rocfft_status_success)
+    {
+        std::cerr << "rocfft_setup failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    size_t failures = 0;
+    std::cout << "token,work_buffer_bytes\n";
+    for(const auto& token : tokens)
+    {
+        try
+        {
+            rocfft_params params;
+            params.from_token(token);
+            params.validate();
+            params.setup_structs();
+            std::cout << token << "," << params.workbuffersize << "\n";
+        }
+        catch(std::exception& e)
+        {
+            std::cerr << token << ": " << e.what() << std::endl;
+            ++failures;
+        }
+    }
+    std::cout << std::flush;
+
+    rocfft_cleanup();
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
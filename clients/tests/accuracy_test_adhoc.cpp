@@ -49,7 +49,7 @@ std::vector<std::vector<size_t>> adhoc_sizes = {
     {25165813},
 
     // 2D single-kernel bluestein size combined with multi-kernel bluestein
-    {19, 2053},
+    {37, 2053},
 
     // TILE_UNALIGNED type of SBRC 3D ERC
     {98, 98, 98},
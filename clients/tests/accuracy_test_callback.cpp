@@ -37,9 +37,12 @@ std::vector<std::vector<size_t>> callback_sizes = {
     {8192},
     {10000},
 
-    // prime
+    // large prime radix
     {23},
-    {29},
+
+    // prime
+    {37},
+    {41},
 
     // 2D_SINGLE sizes, small and big
     {16, 8},
@@ -67,20 +70,24 @@ std::vector<std::vector<size_t>> callback_sizes = {
     {8192, 4},
     {4, 23},
     {23, 4},
+    {4, 37},
+    {37, 4},
 
     // 3D_TRTRTR, with complicated children
     {63, 5, 6},
     {6, 5, 63},
     {23, 5, 6},
     {6, 5, 23},
+    {37, 5, 6},
+    {6, 5, 37},
     {70, 5, 6},
     {6, 5, 70},
     {8192, 5, 6},
     {6, 5, 8192},
 
     // 3D_RTRT, with complicated children
-    {23, 4, 4},
-    {4, 4, 23},
+    {37, 4, 4},
+    {4, 4, 37},
     {70, 4, 4},
     {4, 4, 70},
     {8192, 4, 4},
@@ -0,0 +1,114 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests of the length index used to choose factors for large 1D
+// lengths.
+
+#include "function_pool.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    // the factor search as it was done before the length index, on
+    // the pool's lengths sorted largest to smallest
+    size_t reference_search(const std::vector<size_t>&         supported,
+                            size_t                             length,
+                            const std::function<bool(size_t)>& is_supported_factor)
+    {
+        auto comparison = std::greater<size_t>();
+
+        if(supported.empty())
+            return 0;
+
+        // start search slightly smaller than sqrt(length)
+        auto v     = (size_t)sqrt(length);
+        auto lower = std::lower_bound(supported.cbegin(), supported.cend(), v, comparison);
+        if((lower == supported.cend() || *lower < sqrt(length)) && lower != supported.cbegin())
+            lower--;
+
+        auto itr = std::find_if(lower, supported.cend(), is_supported_factor);
+        if(itr != supported.cend())
+            return *itr;
+
+        return 0;
+    }
+
+    // lengths to search: everything up to 64K, plus larger powers,
+    // products of kernel lengths and primes
+    std::vector<size_t> search_lengths()
+    {
+        std::vector<size_t> lengths;
+        for(size_t len = 1; len <= 65536; ++len)
+            lengths.push_back(len);
+        for(size_t len : {131072,
+                          262144,
+                          1048576,
+                          4194304,
+                          32256,
+                          43008,
+                          84000,
+                          100000,
+                          531441,
+                          390625,
+                          823543,
+                          65537,
+                          131071,
+                          524287,
+                          1000003})
+            lengths.push_back(len);
+        return lengths;
+    }
+}
+
+// searching the length index for factors finds the same factors as
+// searching a freshly sorted list of the pool's lengths
+TEST(rocfft_FunctionPoolTest, length_index_search)
+{
+    for(auto precision : {rocfft_precision_single, rocfft_precision_double})
+    {
+        auto index = function_pool::get_length_index(precision, CS_KERNEL_STOCKHAM);
+        ASSERT_FALSE(index->lengths.empty());
+
+        auto supported = function_pool::get_lengths(precision, CS_KERNEL_STOCKHAM);
+        std::sort(supported.begin(), supported.end(), std::greater<size_t>());
+
+        for(auto length : search_lengths())
+        {
+            // any factor
+            auto is_factor = [length](size_t factor) { return length % factor == 0; };
+            ASSERT_EQ(index->search(length, is_factor),
+                      reference_search(supported, length, is_factor))
+                << "length " << length << " precision " << precision;
+
+            // a factor whose cofactor also has a kernel
+            auto index_has_cofactor = [length, &index](size_t factor) {
+                return length % factor == 0 && index->has_default_kernel(length / factor);
+            };
+            auto pool_has_cofactor = [length, precision](size_t factor) {
+                return length % factor == 0
+                       && function_pool::has_function(FMKey(length / factor, precision));
+            };
+            ASSERT_EQ(index->search(length, index_has_cofactor),
+                      reference_search(supported, length, pool_has_cofactor))
+                << "length " << length << " precision " << precision;
+        }
+    }
+}
@@ -0,0 +1,442 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests of the passes that rewrite generated kernel functions.
+
+#include "generator.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    // count the declarations of hoisted expressions in a block
+    // (not including nested blocks)
+    size_t count_cse_declarations(const StatementList& block)
+    {
+        size_t count = 0;
+        for(const auto& stmt : block.statements)
+        {
+            auto decl = std::get_if<Declaration>(&stmt);
+            if(decl && decl->var.name.compare(0, 3, "cse") == 0)
+                ++count;
+        }
+        return count;
+    }
+
+    const If& get_if_stmt(const StatementList& block, size_t n = 0)
+    {
+        for(const auto& stmt : block.statements)
+        {
+            if(auto x = std::get_if<If>(&stmt))
+            {
+                if(n-- == 0)
+                    return *x;
+            }
+        }
+        throw std::runtime_error("no If statement");
+    }
+}
+
+TEST(rocfft_GeneratorTest, cse_hoists_repeated_expression)
+{
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += Assign{out[0], n * 2 + 1};
+    f.body += Assign{out[1], n * 2 + 1};
+    f.body += Assign{out[2], n * 2 + 1};
+
+    CSEReport report;
+    auto      g = make_cse(f, &report);
+    EXPECT_EQ(report.expressions, 1U);
+    EXPECT_EQ(report.evaluations, 2U);
+    EXPECT_EQ(count_cse_declarations(g.body), 1U);
+    EXPECT_EQ(g.render().find("n * 2 + 1"), g.render().rfind("n * 2 + 1"));
+}
+
+// copies of a Variable share their index expressions, so rewriting
+// a copy's index must leave the original alone
+TEST(rocfft_GeneratorTest, variable_copy_index_not_aliased)
+{
+    Variable n{"n", "unsigned int"};
+    Variable buf{"buf", "unsigned int", true};
+
+    auto       original = buf[n * 2 + 1];
+    const auto rendered = original.render();
+
+    Variable copy = original;
+    copy.index    = n * 3;
+    EXPECT_EQ(original.render(), rendered);
+    EXPECT_NE(copy.render(), rendered);
+    EXPECT_EQ(vrender(*original.index), "n * 2 + 1");
+
+    // CSE rewrites the index expressions of the variables it copies
+    // into the new function
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(buf);
+    f.body += Assign{original, n * 2 + 1};
+    f.body += Assign{original, n * 2 + 1};
+    const auto f_rendered = f.render();
+
+    auto g = make_cse(f);
+    EXPECT_NE(g.render(), f_rendered);
+    EXPECT_EQ(f.render(), f_rendered);
+    EXPECT_EQ(original.render(), rendered);
+}
+
+// an argument shadowed by a local in a nested block is a different
+// variable there, so expressions using it must not be shared
+TEST(rocfft_GeneratorTest, cse_argument_shadowed_in_nested_block)
+{
+    Variable a{"a", "unsigned int"};
+    Variable flag{"flag", "bool"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(a);
+    f.arguments.append(flag);
+    f.arguments.append(out);
+    f.body += Assign{out[0], a + 1};
+    f.body += Assign{out[2], a + 1};
+    f.body += If{flag,
+                 {Declaration{a, Literal{7}},
+                  Assign{out[1], a + 1},
+                  Assign{out[3], a + 1}}};
+
+    CSEReport report;
+    auto      g = make_cse(f, &report);
+    EXPECT_EQ(report.expressions, 0U);
+    EXPECT_EQ(g.render(), f.render());
+}
+
+// a local that's declared more than once might be different
+// variables in different blocks
+TEST(rocfft_GeneratorTest, cse_local_declared_twice)
+{
+    Variable b{"b", "unsigned int"};
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += If{n > 4, {Declaration{b, n * 3}, Assign{out[0], b + 1}}};
+    f.body += Declaration{b, n * 5};
+    f.body += Assign{out[1], b + 1};
+    f.body += Assign{out[2], b + 1};
+
+    CSEReport report;
+    auto      g = make_cse(f, &report);
+    EXPECT_EQ(report.expressions, 0U);
+    EXPECT_EQ(g.render(), f.render());
+}
+
+// expressions using a name declared in a nested block are hoisted
+// within that block, not into the enclosing one
+TEST(rocfft_GeneratorTest, cse_nested_block_locals)
+{
+    Variable b{"b", "unsigned int"};
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += If{n > 4,
+                 {Declaration{b, n * 3},
+                  Assign{out[0], b * 2 + 1},
+                  Assign{out[1], b * 2 + 1}}};
+    f.body += If{n > 8, {Assign{out[2], n * 2 + 1}, Assign{out[3], n * 2 + 1}}};
+
+    CSEReport report;
+    auto      g = make_cse(f, &report);
+    EXPECT_EQ(report.expressions, 2U);
+    EXPECT_EQ(count_cse_declarations(g.body), 0U);
+
+    // declared after b in the first block
+    const auto& first = get_if_stmt(g.body, 0);
+    ASSERT_EQ(count_cse_declarations(first.body), 1U);
+    EXPECT_TRUE(std::holds_alternative<Declaration>(first.body.statements[0]));
+    EXPECT_EQ(std::get<Declaration>(first.body.statements[0]).var.name, "b");
+
+    const auto& second = get_if_stmt(g.body, 1);
+    EXPECT_EQ(count_cse_declarations(second.body), 1U);
+}
+
+// expressions that are only evaluated conditionally aren't hoisted
+// out of their blocks
+TEST(rocfft_GeneratorTest, cse_conditional_uses)
+{
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += If{n > 4, {Assign{out[0], n * 2 + 1}}};
+    f.body += If{n > 8, {Assign{out[1], n * 2 + 1}}};
+
+    CSEReport report;
+    auto      g = make_cse(f, &report);
+    EXPECT_EQ(report.expressions, 0U);
+    EXPECT_EQ(g.render(), f.render());
+}
+
+// unsigned locals are folded with unsigned arithmetic, which wraps
+TEST(rocfft_GeneratorTest, simplify_unsigned_wraparound)
+{
+    Variable x{"x", "const unsigned int"};
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += Declaration{x, Literal{0}};
+    f.body += Assign{out[0], x - 1};
+    f.body += If{x - 1 > 5, {Assign{out[1], n}}};
+    f.body += If{x - 1 < 5, {Assign{out[2], n}}};
+
+    auto g = make_simplify(f);
+    EXPECT_NE(g.render().find("out[0] = 4294967295u;"), std::string::npos);
+    // the first branch is always taken, the second never is
+    EXPECT_THROW(get_if_stmt(g.body), std::runtime_error);
+    EXPECT_NE(g.render().find("out[1] = n;"), std::string::npos);
+    EXPECT_EQ(g.render().find("out[2]"), std::string::npos);
+}
+
+// int arithmetic that would overflow isn't folded, and mixed
+// comparisons convert the int to unsigned
+TEST(rocfft_GeneratorTest, simplify_int_overflow)
+{
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(out);
+    f.body += Assign{out[0], Literal{2147483647} + 1};
+    f.body += Assign{out[1], Literal{"2147483647u"} + 1};
+    f.body += Assign{out[2], Less{Literal{"-1"}, Literal{"1u"}}};
+    f.body += Assign{out[3], UnaryMinus{Literal{"1u"}}};
+
+    auto g = make_simplify(f);
+    EXPECT_NE(g.render().find("out[0] = 2147483647 + 1;"), std::string::npos);
+    EXPECT_NE(g.render().find("out[1] = 2147483648u;"), std::string::npos);
+    EXPECT_NE(g.render().find("out[2] = false;"), std::string::npos);
+    EXPECT_NE(g.render().find("out[3] = 4294967295u;"), std::string::npos);
+}
+
+// size_t globals and arguments are folded as 64-bit unsigned values
+TEST(rocfft_GeneratorTest, simplify_size_t_globals)
+{
+    Variable steps{"large_twiddle_steps", "size_t"};
+    Variable dim{"dim", "const size_t"};
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(dim);
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += Assign{out[0], steps - 1};
+    f.body += If{steps - 1 > 5, {Assign{out[1], n}}};
+    f.body += If{dim - 2 > 5, {Assign{out[2], n}}};
+    f.body += If{steps > 0, {Assign{out[3], n}}};
+
+    auto g = make_simplify(f, {{"large_twiddle_steps", "0ull"}, {"dim", "1"}});
+    EXPECT_NE(g.render().find("out[0] = 18446744073709551615ull;"), std::string::npos);
+    EXPECT_THROW(get_if_stmt(g.body), std::runtime_error);
+    EXPECT_NE(g.render().find("out[1] = n;"), std::string::npos);
+    EXPECT_NE(g.render().find("out[2] = n;"), std::string::npos);
+    EXPECT_EQ(g.render().find("out[3]"), std::string::npos);
+}
+
+// branches of if/else if/else chains whose conditions are known
+// are removed
+TEST(rocfft_GeneratorTest, simplify_prunes_branches)
+{
+    Variable k{"k", "const int"};
+    Variable n{"n", "unsigned int"};
+    Variable out{"out", "unsigned int", true};
+
+    Function f{"test"};
+    f.arguments.append(n);
+    f.arguments.append(out);
+    f.body += Declaration{k, Literal{3}};
+    f.body += If{k - 4 < 0, {Assign{out[0], n}}};
+    f.body += If{Equal{k, 2}, {Assign{out[1], n}}};
+    f.body += ElseIf{Equal{k, 3}, {Assign{out[2], n}}};
+    f.body += Else{{Assign{out[3], n}}};
+    f.body += If{n > 4, {Assign{out[4], n}}};
+    f.body += ElseIf{k > 2, {Assign{out[5], n}}};
+    f.body += ElseIf{k > 1, {Assign{out[6], n}}};
+
+    auto g = make_simplify(f);
+    auto s = g.render();
+    EXPECT_NE(s.find("out[0] = n;"), std::string::npos);
+    EXPECT_EQ(s.find("out[1]"), std::string::npos);
+    EXPECT_NE(s.find("out[2] = n;"), std::string::npos);
+    EXPECT_EQ(s.find("out[3]"), std::string::npos);
+
+    // the last chain keeps its unknown condition, and the branch
+    // that's always taken becomes the else
+    const auto& chain = get_if_stmt(g.body);
+    EXPECT_NE(s.find("out[4] = n;"), std::string::npos);
+    EXPECT_NE(s.find("else"), std::string::npos);
+    EXPECT_NE(s.find("out[5] = n;"), std::string::npos);
+    EXPECT_EQ(s.find("out[6]"), std::string::npos);
+    EXPECT_EQ(std::get<Variable>(std::get<Greater>(chain.condition).args[0]).name, "n");
+}
+
+// loops with literal bounds count every iteration, other loops count
+// once, and if/else chains count their most expensive branch
+TEST(rocfft_GeneratorTest, profile_function_counts)
+{
+    Variable in{"in", "scalar_type", true, true};
+    Variable out{"out", "scalar_type", true, true};
+    Variable lds{"lds_complex", "scalar_type", true, true};
+    Variable R{"R", "scalar_type", false, false, 4};
+    Variable i{"i", "unsigned int"};
+    Variable n{"n", "unsigned int"};
+
+    Function f{"test"};
+    f.arguments.append(in);
+    f.arguments.append(out);
+    f.arguments.append(n);
+    f.body += Declaration{R};
+    f.body += For{i, 0, i < 4, 1, {Assign{R[i], LoadGlobal{in, i}}}};
+    f.body += For{i, 0, i < 4, 1, {Assign{lds[i], R[i]}}};
+    f.body += SyncThreads{};
+    f.body += Butterfly{true, {R[0], R[1], R[2], R[3]}};
+    f.body += If{n > 4, {Assign{R[0], lds[n]}, SyncThreads{}}};
+    f.body += Else{{Assign{R[1], lds[n] + lds[n + 1]}}};
+    f.body += For{i, 0, i < n, 1, {StoreGlobal{out, i, R[0]}}};
+
+    auto p = profile_function(f);
+    // 5 N log2(N) for the radix-4 butterfly
+    EXPECT_EQ(p.flops, 40.0);
+    EXPECT_EQ(p.global_loads, 4U);
+    EXPECT_EQ(p.global_stores, 1U);
+    EXPECT_EQ(p.lds_writes, 4U);
+    EXPECT_EQ(p.lds_reads, 2U);
+    EXPECT_EQ(p.syncthreads, 2U);
+    EXPECT_EQ(p.registers, 4U);
+    EXPECT_EQ(p.lds_bytes, 0U);
+}
+
+// calls are counted as if the callee were inlined, and the callee's
+// registers are only live during the call
+TEST(rocfft_GeneratorTest, profile_function_callees)
+{
+    Variable in{"in", "scalar_type", true, true};
+    Variable out{"out", "scalar_type", true, true};
+    Variable t{"t", "scalar_type", false, false, 2};
+    Variable x{"x", "scalar_type"};
+
+    Function helper{"helper"};
+    helper.arguments.append(in);
+    helper.body += Declaration{t};
+    helper.body += Assign{t[0], LoadGlobal{in, 0}};
+    helper.body += Assign{t[1], LoadGlobal{in, 1}};
+    helper.body += Butterfly{true, {t[0], t[1]}};
+    helper.body += SyncThreads{};
+
+    Function f{"test"};
+    f.arguments.append(in);
+    f.arguments.append(out);
+    f.body += Declaration{x};
+    f.body += Call{"helper", {in}};
+    f.body += Call{"helper", {in}};
+    f.body += StoreGlobal{out, 0, x};
+
+    auto p = profile_function(f, {&helper});
+    EXPECT_EQ(p.flops, 20.0);
+    EXPECT_EQ(p.global_loads, 4U);
+    EXPECT_EQ(p.global_stores, 1U);
+    EXPECT_EQ(p.syncthreads, 2U);
+    EXPECT_EQ(p.registers, 3U);
+
+    // without the callee, the calls do nothing we count
+    auto uncounted = profile_function(f);
+    EXPECT_EQ(uncounted.flops, 0.0);
+    EXPECT_EQ(uncounted.registers, 1U);
+}
+
+namespace
+{
+    // worst LDS bank conflict degree of a threadblock where each
+    // thread writes a complex value to lds_complex[threadIdx.x *
+    // stride]
+    double strided_lds_write_degree(unsigned int stride, unsigned int real_bytes)
+    {
+        Variable lds{"lds_complex", "scalar_type", true, true};
+        Variable tid{"threadIdx.x", "unsigned int"};
+        Variable x{"x", "scalar_type"};
+
+        Function f{"test"};
+        f.body += Declaration{x};
+        f.body += Assign{lds[tid * stride], x};
+
+        LDSSimulation sim;
+        sim.block_size = 64;
+        sim.real_bytes = real_bytes;
+
+        auto report = simulate_lds_conflicts(f, {}, sim);
+        EXPECT_EQ(report.unresolved, 0U);
+        EXPECT_EQ(report.steps.size(), 1U);
+        return report.worst_degree();
+    }
+}
+
+// contiguous complex values spread across all banks, so unit stride
+// is conflict-free for either precision
+TEST(rocfft_GeneratorTest, lds_conflicts_unit_stride)
+{
+    EXPECT_EQ(strided_lds_write_degree(1, sizeof(float)), 1.0);
+    EXPECT_EQ(strided_lds_write_degree(1, sizeof(double)), 1.0);
+}
+
+// lanes are served 32 banks' worth at a time: 16 lanes of single
+// complex values or 8 lanes of double.  a power-of-2 stride puts
+// lanes that many dwords apart in the same banks, until every lane
+// of a group conflicts.
+TEST(rocfft_GeneratorTest, lds_conflicts_power_of_2_stride)
+{
+    EXPECT_EQ(strided_lds_write_degree(2, sizeof(float)), 2.0);
+    EXPECT_EQ(strided_lds_write_degree(2, sizeof(double)), 2.0);
+    EXPECT_EQ(strided_lds_write_degree(4, sizeof(float)), 4.0);
+    EXPECT_EQ(strided_lds_write_degree(4, sizeof(double)), 4.0);
+    EXPECT_EQ(strided_lds_write_degree(8, sizeof(float)), 8.0);
+    EXPECT_EQ(strided_lds_write_degree(8, sizeof(double)), 8.0);
+    EXPECT_EQ(strided_lds_write_degree(16, sizeof(float)), 16.0);
+    EXPECT_EQ(strided_lds_write_degree(16, sizeof(double)), 8.0);
+    EXPECT_EQ(strided_lds_write_degree(32, sizeof(float)), 16.0);
+    EXPECT_EQ(strided_lds_write_degree(32, sizeof(double)), 8.0);
+}
+
+// an odd stride maps the lanes of a group to distinct banks
+TEST(rocfft_GeneratorTest, lds_conflicts_odd_stride)
+{
+    EXPECT_EQ(strided_lds_write_degree(3, sizeof(float)), 1.0);
+    EXPECT_EQ(strided_lds_write_degree(3, sizeof(double)), 1.0);
+}
@@ -0,0 +1,275 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests of the memory-mapped flat file format for the system kernel
+// cache.
+
+#include "rtc_cache_flat.h"
+
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // byte offsets of fields in the file, as laid out by
+    // RTCFlatCache::write
+    const size_t version_offset                 = 8;
+    const size_t entry_count_offset             = 16;
+    const size_t index_offset_offset            = 24;
+    const size_t source_sum_count_offset        = 32;
+    const size_t source_sum_index_offset_offset = 40;
+    const size_t header_size                    = 48;
+    // offsets of fields within an index entry
+    const size_t entry_key_offset_offset  = 8;
+    const size_t entry_code_offset_offset = 24;
+    const size_t entry_size               = 40;
+
+    std::array<char, 32> make_sum(char c)
+    {
+        std::array<char, 32> sum;
+        sum.fill(c);
+        return sum;
+    }
+
+    std::vector<char> make_code(const std::string& s)
+    {
+        return std::vector<char>(s.begin(), s.end());
+    }
+
+    std::string read_file(const fs::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void write_file(const fs::path& path, const std::string& contents)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), contents.size());
+    }
+
+    void set_u64(std::string& contents, size_t offset, uint64_t value)
+    {
+        memcpy(&contents[offset], &value, sizeof(value));
+    }
+
+    uint64_t get_u64(const std::string& contents, size_t offset)
+    {
+        uint64_t value;
+        memcpy(&value, &contents[offset], sizeof(value));
+        return value;
+    }
+
+    // return the code object found for a key as a string, or an
+    // empty string on a miss
+    std::string lookup(const RTCFlatCache&         cache,
+                       const std::string&          kernel_name,
+                       const std::string&          gpu_arch,
+                       int64_t                     hip_version,
+                       const std::array<char, 32>& generator_sum)
+    {
+        size_t code_len = 0;
+        auto   code     = cache.lookup(kernel_name, gpu_arch, hip_version, generator_sum, code_len);
+        return code ? std::string(code, code_len) : std::string();
+    }
+
+    const std::vector<RTCFlatCache::entry> test_entries = {
+        {"fft_a", "gfx90a", 1, make_sum('a'), make_code("code shared by two kernels")},
+        {"fft_b", "gfx90a", 1, make_sum('b'), make_code("code shared by two kernels")},
+        {"fft_a", "gfx1100", 1, make_sum('a'), make_code("code for another arch")},
+    };
+    const std::vector<RTCFlatCache::source_sum_entry> test_source_sums = {
+        {"fft_a", make_sum('v'), make_sum('a')},
+        {"fft_b", make_sum('v'), make_sum('b')},
+    };
+}
+
+class rocfft_RTCFlatCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        path = fs::temp_directory_path()
+               / ("rocfft_flat_cache_test_"
+                  + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name())
+                  + ".kdb");
+        RTCFlatCache::write(path, test_entries, test_source_sums);
+    }
+    void TearDown() override
+    {
+        std::error_code err;
+        fs::remove(path, err);
+    }
+
+    fs::path path;
+};
+
+TEST_F(rocfft_RTCFlatCacheTest, lookup)
+{
+    auto cache = RTCFlatCache::open(path);
+    ASSERT_NE(cache, nullptr);
+
+    for(const auto& e : test_entries)
+    {
+        EXPECT_EQ(lookup(*cache, e.kernel_name, e.gpu_arch, e.hip_version, e.generator_sum),
+                  std::string(e.code.begin(), e.code.end()));
+    }
+
+    // every part of the key has to match
+    EXPECT_EQ(lookup(*cache, "fft_c", "gfx90a", 1, make_sum('a')), "");
+    EXPECT_EQ(lookup(*cache, "fft_a", "gfx908", 1, make_sum('a')), "");
+    EXPECT_EQ(lookup(*cache, "fft_a", "gfx90a", 2, make_sum('a')), "");
+    EXPECT_EQ(lookup(*cache, "fft_a", "gfx90a", 1, make_sum('b')), "");
+}
+
+// identical code objects are stored once
+TEST_F(rocfft_RTCFlatCacheTest, dedup)
+{
+    auto cache = RTCFlatCache::open(path);
+    ASSERT_NE(cache, nullptr);
+
+    size_t a_len = 0;
+    size_t b_len = 0;
+    auto   a     = cache->lookup("fft_a", "gfx90a", 1, make_sum('a'), a_len);
+    auto   b     = cache->lookup("fft_b", "gfx90a", 1, make_sum('b'), b_len);
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a_len, b_len);
+
+    size_t other_len = 0;
+    auto   other     = cache->lookup("fft_a", "gfx1100", 1, make_sum('a'), other_len);
+    ASSERT_NE(other, nullptr);
+    EXPECT_NE(a, other);
+
+    // a file with only one copy of the shared code is smaller
+    auto dedup_size = fs::file_size(path);
+    auto unshared   = test_entries;
+    unshared[1].code.back() = '!';
+    RTCFlatCache::write(path, unshared, test_source_sums);
+    EXPECT_GT(fs::file_size(path), dedup_size);
+}
+
+TEST_F(rocfft_RTCFlatCacheTest, source_sums)
+{
+    auto cache = RTCFlatCache::open(path);
+    ASSERT_NE(cache, nullptr);
+
+    std::array<char, 32> sum;
+    ASSERT_TRUE(cache->lookup_source_sum("fft_a", make_sum('v'), sum));
+    EXPECT_EQ(sum, make_sum('a'));
+    ASSERT_TRUE(cache->lookup_source_sum("fft_b", make_sum('v'), sum));
+    EXPECT_EQ(sum, make_sum('b'));
+
+    // digests from another generator, or of unknown kernels, miss
+    EXPECT_FALSE(cache->lookup_source_sum("fft_a", make_sum('w'), sum));
+    EXPECT_FALSE(cache->lookup_source_sum("fft_c", make_sum('v'), sum));
+}
+
+// rewriting the file doesn't disturb processes that have the old
+// one mapped
+TEST_F(rocfft_RTCFlatCacheTest, rewrite_while_open)
+{
+    auto old_cache = RTCFlatCache::open(path);
+    ASSERT_NE(old_cache, nullptr);
+
+    std::vector<RTCFlatCache::entry> new_entries = {
+        {"fft_a", "gfx90a", 1, make_sum('a'), make_code("new code")},
+    };
+    RTCFlatCache::write(path, new_entries, {});
+
+    EXPECT_EQ(lookup(*old_cache, "fft_a", "gfx90a", 1, make_sum('a')),
+              "code shared by two kernels");
+    EXPECT_EQ(lookup(*old_cache, "fft_b", "gfx90a", 1, make_sum('b')),
+              "code shared by two kernels");
+
+    auto new_cache = RTCFlatCache::open(path);
+    ASSERT_NE(new_cache, nullptr);
+    EXPECT_EQ(lookup(*new_cache, "fft_a", "gfx90a", 1, make_sum('a')), "new code");
+    EXPECT_EQ(lookup(*new_cache, "fft_b", "gfx90a", 1, make_sum('b')), "");
+
+    // no temporary files are left behind
+    for(const auto& f : fs::directory_iterator(path.parent_path()))
+        EXPECT_EQ(f.path().string().find(path.string() + ".tmp"), std::string::npos);
+}
+
+TEST_F(rocfft_RTCFlatCacheTest, reject_invalid)
+{
+    const auto valid = read_file(path);
+    ASSERT_GT(valid.size(), header_size);
+
+    EXPECT_EQ(RTCFlatCache::open(path.string() + ".missing"), nullptr);
+    EXPECT_EQ(RTCFlatCache::open(fs::path()), nullptr);
+
+    auto expect_rejected = [&](const std::string& contents) {
+        write_file(path, contents);
+        EXPECT_EQ(RTCFlatCache::open(path), nullptr);
+    };
+
+    // truncated in the header, and in the index
+    expect_rejected(valid.substr(0, header_size - 1));
+    expect_rejected(valid.substr(0, header_size + 8));
+
+    auto bad_magic = valid;
+    bad_magic[0]   = 'X';
+    expect_rejected(bad_magic);
+
+    auto bad_version = valid;
+    ++bad_version[version_offset];
+    expect_rejected(bad_version);
+
+    // index that's intact but isn't aligned for reading in place:
+    // move everything after the header along by 4 bytes
+    const size_t shift = 4;
+    auto         misaligned
+        = valid.substr(0, header_size) + std::string(shift, '\0') + valid.substr(header_size);
+    auto shift_u64 = [&](size_t offset) {
+        set_u64(misaligned, offset, get_u64(misaligned, offset) + shift);
+    };
+    shift_u64(index_offset_offset);
+    shift_u64(source_sum_index_offset_offset);
+    auto entries = get_u64(valid, entry_count_offset) + get_u64(valid, source_sum_count_offset);
+    for(size_t i = 0; i < entries; ++i)
+    {
+        auto entry = get_u64(misaligned, index_offset_offset) + i * entry_size;
+        shift_u64(entry + entry_key_offset_offset);
+        shift_u64(entry + entry_code_offset_offset);
+    }
+    expect_rejected(misaligned);
+
+    // index that starts past the end of the file
+    auto index_past_end = valid;
+    set_u64(index_past_end, index_offset_offset, valid.size() + 8);
+    expect_rejected(index_past_end);
+
+    // index entry pointing past the end of the file
+    auto entry_past_end = valid;
+    set_u64(entry_past_end,
+            get_u64(valid, index_offset_offset) + entry_code_offset_offset,
+            valid.size());
+    expect_rejected(entry_past_end);
+
+    // and the unmodified file is still accepted
+    write_file(path, valid);
+    EXPECT_NE(RTCFlatCache::open(path), nullptr);
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests of the thread pool that runtime compilation runs on.
+
+#include "rtc_compile_pool.h"
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+// destroying the pool finishes the critical work that's still
+// queued and cancels the speculative work, so that nothing waiting
+// on either sees a broken promise
+TEST(rocfft_RTCCompilePoolTest, drain_on_destroy)
+{
+    static const size_t num_threads = 2;
+    static const size_t num_items   = 32;
+
+    std::vector<std::shared_future<size_t>> results;
+    {
+        RTCCompilePool pool(num_threads);
+        for(size_t i = 0; i < num_items; ++i)
+        {
+            auto priority = i % 2 ? RTCCompilePriority::SPECULATIVE : RTCCompilePriority::CRITICAL;
+            results.push_back(pool.submit(priority, [i]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                return i;
+            }));
+        }
+        // more work was queued than there are threads to run it
+        EXPECT_GT(pool.queue_depth(), 0U);
+    }
+
+    size_t cancelled = 0;
+    for(size_t i = 0; i < num_items; ++i)
+    {
+        ASSERT_EQ(results[i].wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        // speculative work might have started before the pool was
+        // destroyed
+        if(i % 2)
+        {
+            try
+            {
+                EXPECT_EQ(results[i].get(), i);
+            }
+            catch(std::runtime_error&)
+            {
+                ++cancelled;
+            }
+        }
+        else
+            EXPECT_EQ(results[i].get(), i);
+    }
+    EXPECT_GT(cancelled, 0U);
+}
+
+// destroying the pool doesn't wait for a large backlog of
+// speculative work, like prefetches queued just before
+// rocfft_cleanup
+TEST(rocfft_RTCCompilePoolTest, cancel_speculative_on_destroy)
+{
+    static const size_t num_items = 1000;
+
+    std::atomic<size_t>                   started = 0;
+    std::vector<std::shared_future<void>> results;
+    auto                                  begin = std::chrono::steady_clock::now();
+    {
+        RTCCompilePool pool(1);
+        for(size_t i = 0; i < num_items; ++i)
+        {
+            results.push_back(pool.submit(RTCCompilePriority::SPECULATIVE, [&started]() {
+                ++started;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }));
+        }
+    }
+    // running all the work would take 10 seconds
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::seconds(5));
+
+    size_t cancelled = 0;
+    for(auto& result : results)
+    {
+        ASSERT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        try
+        {
+            result.get();
+        }
+        catch(std::runtime_error&)
+        {
+            ++cancelled;
+        }
+    }
+    EXPECT_EQ(cancelled + started, num_items);
+    EXPECT_GT(cancelled, 0U);
+}
@@ -0,0 +1,202 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests of the normalization done to runtime-compiled kernel source.
+
+#include "rtc_normalize.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    // true if the normalized source contains str
+    bool contains(const std::string& normalized, const std::string& str)
+    {
+        return normalized.find(str) != std::string::npos;
+    }
+}
+
+// comment markers inside string and character literals are not
+// comments
+TEST(rocfft_RTCNormalizeTest, comments_in_literals)
+{
+    auto out = rtc_normalize_source("const char* s = \"a // b /* c */\"; // comment\n"
+                                    "const char c = '/'; /* comment */ const char d = '*';\n");
+    EXPECT_EQ(out,
+              "const char*s= \"a // b /* c */\";\n"
+              "const char c= '/';\n"
+              "const char d= '*';\n");
+}
+
+// literals with encoding prefixes, and raw strings, end where their
+// quotes do
+TEST(rocfft_RTCNormalizeTest, prefixed_literals)
+{
+    auto out = rtc_normalize_source("auto a = u'\"'; // comment\n"
+                                    "auto b = L'\\''; /* comment */ auto c = U'x';\n"
+                                    "auto d = u8\"//\"; // comment\n"
+                                    "auto e = u8R\"x(/* \")x\"; auto f = LR\"(//)\";\n"
+                                    "auto g = u8'x'; // comment\n");
+    EXPECT_EQ(out,
+              "auto a=u'\"';\n"
+              "auto b=L'\\'';\n"
+              "auto c=U'x';\n"
+              "auto d=u8\"//\";\n"
+              "auto e=u8R\"x(/* \")x\";\n"
+              "auto f=LR\"(//)\";\n"
+              "auto g=u8'x';\n");
+}
+
+// a quote between digits separates them, and doesn't start a
+// character literal
+TEST(rocfft_RTCNormalizeTest, digit_separators)
+{
+    auto out = rtc_normalize_source("int n = 1'000'000; // comment\n");
+    EXPECT_EQ(out, "int n=1'000'000;\n");
+}
+
+// lines ending in a backslash continue on the next line, including
+// comments and macro definitions
+TEST(rocfft_RTCNormalizeTest, line_splices)
+{
+    auto out = rtc_normalize_source("#define ADD(a, b) \\\n"
+                                    "    ((a) + (b))\n"
+                                    "// comment \\\n"
+                                    "int spliced_comment;\n"
+                                    "int x = ADD(1, 2);\n");
+    EXPECT_EQ(out,
+              "#define ADD(a, b) ((a) + (b))\n"
+              "int x=ADD(1,2);\n");
+}
+
+// directives inside a function stay on their own lines, and keep
+// the function even if nothing calls it
+TEST(rocfft_RTCNormalizeTest, directives_in_functions)
+{
+    RTCNormalizeStats stats;
+
+    auto out = rtc_normalize_source("#define FEATURE 1\n"
+                                    "__device__ int helper()\n"
+                                    "{\n"
+                                    "#if FEATURE\n"
+                                    "    return 1;\n"
+                                    "#endif\n"
+                                    "}\n",
+                                    &stats);
+    EXPECT_EQ(out,
+              "#define FEATURE 1\n"
+              "__device__ int helper()\n"
+              "{\n"
+              "#if FEATURE\n"
+              "return 1;\n"
+              "#endif\n"
+              "}\n");
+    EXPECT_EQ(stats.removed_definitions, 0U);
+}
+
+// overloads share a name, so they're removed together, and only if
+// none of them is referred to
+TEST(rocfft_RTCNormalizeTest, remove_overloads)
+{
+    RTCNormalizeStats stats;
+
+    auto out = rtc_normalize_source("__device__ int used(int x) { return x; }\n"
+                                    "__device__ float used(float x) { return x; }\n"
+                                    "__device__ int unused(int x) { return x; }\n"
+                                    "__device__ float unused(float x) { return x; }\n"
+                                    "extern \"C\" __global__ void kernel(int* out)\n"
+                                    "{\n"
+                                    "    out[0] = used(1);\n"
+                                    "}\n",
+                                    &stats);
+    EXPECT_TRUE(contains(out, "__device__ int used(int x)"));
+    EXPECT_TRUE(contains(out, "__device__ float used(float x)"));
+    EXPECT_FALSE(contains(out, "unused"));
+    EXPECT_EQ(stats.removed_definitions, 2U);
+}
+
+// function templates are removed like other functions, and removing
+// one may leave the functions it calls unreferenced
+TEST(rocfft_RTCNormalizeTest, remove_templates)
+{
+    RTCNormalizeStats stats;
+
+    auto out = rtc_normalize_source("__device__ int leaf(int x) { return x; }\n"
+                                    "template <typename T>\n"
+                                    "__device__ T unused(T x)\n"
+                                    "{\n"
+                                    "    return leaf(x);\n"
+                                    "}\n"
+                                    "template <typename T, size_t N>\n"
+                                    "__device__ T used(T x)\n"
+                                    "{\n"
+                                    "    return x * N;\n"
+                                    "}\n"
+                                    "extern \"C\" __global__ void kernel(int* out)\n"
+                                    "{\n"
+                                    "    out[0] = used<int, 2>(1);\n"
+                                    "}\n",
+                                    &stats);
+    EXPECT_TRUE(contains(out, "__device__ T used(T x)"));
+    EXPECT_FALSE(contains(out, "unused"));
+    EXPECT_FALSE(contains(out, "leaf"));
+    EXPECT_EQ(stats.removed_definitions, 2U);
+}
+
+// extern "C" functions may be looked up by name, so they're kept
+// even if nothing in the source refers to them
+TEST(rocfft_RTCNormalizeTest, keep_extern_c)
+{
+    RTCNormalizeStats stats;
+
+    auto out = rtc_normalize_source("extern \"C\" __device__ int helper() { return 0; }\n"
+                                    "extern \"C\" {\n"
+                                    "__device__ int block_helper() { return 0; }\n"
+                                    "}\n",
+                                    &stats);
+    EXPECT_TRUE(contains(out, "int helper()"));
+    EXPECT_TRUE(contains(out, "block_helper()"));
+    EXPECT_EQ(stats.removed_definitions, 0U);
+}
+
+// macros that only later directives refer to are still used, and
+// macros defined before an include might be read by the included
+// header
+TEST(rocfft_RTCNormalizeTest, macros_used_by_directives)
+{
+    RTCNormalizeStats stats;
+
+    auto out = rtc_normalize_source("#define BEFORE_INCLUDE 1\n"
+                                    "#include <header.h>\n"
+                                    "#define UNUSED 1\n"
+                                    "#define FEATURE 1\n"
+                                    "#define FEATURE_LEVEL 2\n"
+                                    "#if FEATURE\n"
+                                    "int x;\n"
+                                    "#elif FEATURE_LEVEL > 1\n"
+                                    "int y;\n"
+                                    "#endif\n",
+                                    &stats);
+    EXPECT_TRUE(contains(out, "#define BEFORE_INCLUDE 1\n"));
+    EXPECT_TRUE(contains(out, "#define FEATURE 1\n"));
+    EXPECT_TRUE(contains(out, "#define FEATURE_LEVEL 2\n"));
+    EXPECT_FALSE(contains(out, "UNUSED"));
+    EXPECT_EQ(stats.removed_definitions, 1U);
+}
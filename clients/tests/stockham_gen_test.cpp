@@ -0,0 +1,365 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Tests of the code that generates stockham kernels.
+
+#include "../../shared/precision_type.h"
+#include "rtc_stockham_gen.h"
+
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+#else
+#include <experimental/filesystem>
+namespace std
+{
+    namespace filesystem = experimental::filesystem;
+}
+#endif
+
+namespace fs = std::filesystem;
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+    StockhamGeneratorSpecs make_specs(const std::vector<unsigned int>& factors,
+                                      unsigned int                     workgroup_size,
+                                      unsigned int                     threads_per_transform,
+                                      rocfft_precision                 precision)
+    {
+        StockhamGeneratorSpecs specs{factors,
+                                     {},
+                                     {static_cast<unsigned int>(precision)},
+                                     workgroup_size,
+                                     "CS_KERNEL_STOCKHAM"};
+        specs.threads_per_transform = threads_per_transform;
+        specs.wgs_is_derived        = true;
+        return specs;
+    }
+}
+
+// each thread of a 64-point kernel with 8 threads per transform
+// does one radix-8 butterfly per pass
+TEST(rocfft_StockhamGenTest, profile_radix8_kernel)
+{
+    for(auto precision : {rocfft_precision_single, rocfft_precision_double})
+    {
+        auto specs = make_specs({8, 8}, 64, 8, precision);
+        auto p     = stockham_rtc_profile(specs, specs, CS_KERNEL_STOCKHAM, precision);
+
+        // two radix-8 butterflies, and 7 twiddle multiplies between
+        // the passes
+        EXPECT_EQ(p.flops, 2 * 5.0 * 8 * 3 + 7 * 6.0);
+        EXPECT_EQ(p.global_loads, 8U);
+        EXPECT_EQ(p.global_stores, 8U);
+        EXPECT_GE(p.registers, 8U);
+        EXPECT_GT(p.syncthreads, 0U);
+        EXPECT_GT(p.lds_reads, 0U);
+        EXPECT_GT(p.lds_writes, 0U);
+        // 8 transforms per block
+        EXPECT_EQ(p.lds_bytes, 64U * 8 * complex_type_size(precision));
+        EXPECT_GT(p.lds_conflict_degree, 0.0);
+    }
+}
+
+// smaller radices mean less work per thread, but more passes, so
+// more barriers
+TEST(rocfft_StockhamGenTest, profile_radix4_kernel)
+{
+    auto specs8 = make_specs({8, 8}, 64, 8, rocfft_precision_single);
+    auto specs4 = make_specs({4, 4, 4}, 64, 16, rocfft_precision_single);
+    auto p8     = stockham_rtc_profile(specs8, specs8, CS_KERNEL_STOCKHAM, rocfft_precision_single);
+    auto p4     = stockham_rtc_profile(specs4, specs4, CS_KERNEL_STOCKHAM, rocfft_precision_single);
+
+    // three radix-4 butterflies, and 3 twiddle multiplies after each
+    // of the first two passes
+    EXPECT_EQ(p4.flops, 3 * 5.0 * 4 * 2 + 2 * 3 * 6.0);
+    EXPECT_EQ(p4.global_loads, 4U);
+    EXPECT_EQ(p4.global_stores, 4U);
+    EXPECT_LT(p4.registers, p8.registers);
+    EXPECT_GT(p4.syncthreads, p8.syncthreads);
+    // 4 transforms per block
+    EXPECT_EQ(p4.lds_bytes, 64U * 4 * complex_type_size(rocfft_precision_single));
+}
+
+namespace
+{
+    const double two_pi = 6.283185307179586476925286766559;
+
+    // signature of the extern "C" function in an out-of-place host
+    // kernel
+    typedef void (*host_kernel_t)(const void*   twiddles,
+                                  size_t        dim,
+                                  const size_t* lengths,
+                                  const size_t* stride_in,
+                                  const size_t* stride_out,
+                                  size_t        nbatch,
+                                  unsigned int  lds_padding,
+                                  void*         load_cb_fn,
+                                  void*         load_cb_data,
+                                  unsigned int  load_cb_lds_bytes,
+                                  void*         store_cb_fn,
+                                  void*         store_cb_data,
+                                  void*         buf_in,
+                                  void*         buf_out,
+                                  size_t        num_blocks);
+
+    // compiles host kernel source into a shared library and loads
+    // it, unloading it when destroyed
+    class HostKernelLib
+    {
+    public:
+        HostKernelLib(const std::string& src, const std::string& name)
+        {
+            auto base     = fs::temp_directory_path() / ("rocfft_host_kernel_" + name);
+            auto src_path = base.string() + ".cpp";
+#ifdef WIN32
+            lib_path              = base.string() + ".dll";
+            const char* lib_flags = "-shared";
+#else
+            lib_path              = base.string() + ".so";
+            const char* lib_flags = "-shared -fPIC";
+#endif
+            std::ofstream(src_path) << src;
+
+            // the kernels run once, so don't spend time optimizing
+            const std::string command = std::string("amdclang++ -x c++ -std=c++17 -O0 ")
+                                        + lib_flags + " -o " + lib_path + " " + src_path;
+            if(std::system(command.c_str()) != 0)
+                throw std::runtime_error("failed to compile " + src_path);
+            fs::remove(src_path);
+
+#ifdef WIN32
+            handle = LoadLibraryA(lib_path.c_str());
+#else
+            handle = dlopen(lib_path.c_str(), RTLD_NOW);
+#endif
+            if(!handle)
+                throw std::runtime_error("failed to load " + lib_path);
+        }
+        ~HostKernelLib()
+        {
+#ifdef WIN32
+            FreeLibrary(handle);
+#else
+            dlclose(handle);
+#endif
+            fs::remove(lib_path);
+        }
+        HostKernelLib(const HostKernelLib&) = delete;
+        HostKernelLib& operator=(const HostKernelLib&) = delete;
+
+        host_kernel_t symbol(const std::string& name)
+        {
+#ifdef WIN32
+            auto sym = GetProcAddress(handle, name.c_str());
+#else
+            auto sym = dlsym(handle, name.c_str());
+#endif
+            if(!sym)
+                throw std::runtime_error("no symbol " + name + " in " + lib_path);
+            return reinterpret_cast<host_kernel_t>(sym);
+        }
+
+    private:
+        std::string lib_path;
+#ifdef WIN32
+        HMODULE handle = nullptr;
+#else
+        void* handle = nullptr;
+#endif
+    };
+
+    // twiddle table for a stockham kernel, laid out the way the
+    // library's radices twiddle kernel builds it (which uses a
+    // negative angle, so forward transforms multiply by the values
+    // as they are)
+    template <typename Tfloat>
+    std::vector<std::complex<Tfloat>> stockham_twiddles(const std::vector<unsigned int>& radices)
+    {
+        std::vector<size_t> radices_prod;
+        std::vector<size_t> radices_sum_prod = {0};
+
+        size_t prod      = 1;
+        size_t prod_next = radices.front();
+        size_t sum       = 0;
+        for(size_t i = 0; i + 1 < radices.size(); ++i)
+        {
+            prod *= radices[i];
+            prod_next *= radices[i + 1];
+            sum += prod * (radices[i + 1] - 1);
+            radices_sum_prod.push_back(sum);
+            radices_prod.push_back(prod_next);
+        }
+
+        std::vector<std::complex<Tfloat>> table(sum + prod_next);
+        for(size_t i = 0; i + 1 < radices.size(); ++i)
+        {
+            auto L     = radices_prod[i];
+            auto radix = radices[i + 1];
+            for(size_t k = 0; k < L / radix; ++k)
+            {
+                double theta = -two_pi * k / L;
+                auto   index = radices_sum_prod[i] + k * (radix - 1);
+                for(size_t j = 1; j < radix; ++j)
+                    table.at(index++) = {static_cast<Tfloat>(std::cos(j * theta)),
+                                         static_cast<Tfloat>(std::sin(j * theta))};
+            }
+        }
+        return table;
+    }
+
+    // largest difference between a batch of host kernel outputs and
+    // a reference DFT of the inputs, relative to the largest
+    // reference value
+    template <typename Tfloat>
+    double host_kernel_error(host_kernel_t                    kernel,
+                             const std::vector<unsigned int>& factors,
+                             int                              direction)
+    {
+        size_t length = 1;
+        for(auto f : factors)
+            length *= f;
+        const size_t nbatch = 3;
+
+        std::vector<std::complex<Tfloat>> input(length * nbatch);
+        for(size_t i = 0; i < input.size(); ++i)
+            input[i] = {static_cast<Tfloat>(std::sin(0.37 * i + 0.1)),
+                        static_cast<Tfloat>(std::cos(0.91 * i))};
+        std::vector<std::complex<Tfloat>> output(input.size());
+
+        auto                twiddles = stockham_twiddles<Tfloat>(factors);
+        std::vector<size_t> lengths  = {length};
+        std::vector<size_t> strides  = {1, length};
+        kernel(twiddles.data(),
+               1,
+               lengths.data(),
+               strides.data(),
+               strides.data(),
+               nbatch,
+               0,
+               nullptr,
+               nullptr,
+               0,
+               nullptr,
+               nullptr,
+               input.data(),
+               output.data(),
+               nbatch);
+
+        double max_error = 0.0;
+        double max_value = 0.0;
+        for(size_t b = 0; b < nbatch; ++b)
+        {
+            for(size_t k = 0; k < length; ++k)
+            {
+                std::complex<double> ref;
+                for(size_t n = 0; n < length; ++n)
+                {
+                    // reduce the index first, to keep the angle accurate
+                    double theta = direction * two_pi * ((n * k) % length) / length;
+                    ref += std::complex<double>(input[b * length + n])
+                           * std::complex<double>(std::cos(theta), std::sin(theta));
+                }
+                auto out  = std::complex<double>(output[b * length + k]);
+                max_error = std::max(max_error, std::abs(out - ref));
+                max_value = std::max(max_value, std::abs(ref));
+            }
+        }
+        return max_error / max_value;
+    }
+}
+
+// compile host kernels for a few factorizations and check them
+// against a reference DFT in both directions
+TEST(rocfft_StockhamGenTest, host_kernels_match_dft)
+{
+    // the generated source is built with the same compiler as the
+    // RTC test harness
+#ifdef WIN32
+    static const char* test_command = "amdclang++ --version > NUL";
+#else
+    static const char* test_command = "amdclang++ --version > /dev/null";
+#endif
+    if(std::system(test_command) != 0)
+        GTEST_SKIP();
+
+    struct HostKernelCase
+    {
+        std::vector<unsigned int> factors;
+        bool                      split_radix;
+        rocfft_precision          precision;
+    };
+    const std::vector<HostKernelCase> cases = {
+        {{8, 8}, false, rocfft_precision_double},
+        {{8, 8}, true, rocfft_precision_double},
+        {{4, 4, 16}, false, rocfft_precision_double},
+        {{16, 16}, true, rocfft_precision_double},
+        {{7, 5, 3}, false, rocfft_precision_double},
+        {{8, 3, 5}, false, rocfft_precision_double},
+        {{8, 8, 8}, false, rocfft_precision_double},
+        {{23, 29}, false, rocfft_precision_double},
+        {{8, 8}, false, rocfft_precision_single},
+        {{7, 5, 3}, false, rocfft_precision_single},
+    };
+
+    for(const auto& c : cases)
+    {
+        auto specs        = make_specs(c.factors, 64, 1, c.precision);
+        specs.split_radix = c.split_radix;
+
+        std::string name = "len";
+        for(auto f : c.factors)
+            name += "_" + std::to_string(f);
+        if(c.split_radix)
+            name += "_sr";
+        name += c.precision == rocfft_precision_single ? "_sp" : "_dp";
+        SCOPED_TRACE(name);
+
+        for(int direction : {-1, 1})
+        {
+            auto kernel_name = name + (direction == -1 ? "_fwd" : "_back");
+            auto src         = stockham_host(specs,
+                                     kernel_name,
+                                     CS_KERNEL_STOCKHAM,
+                                     direction,
+                                     c.precision,
+                                     rocfft_placement_notinplace,
+                                     true);
+
+            HostKernelLib lib(src, kernel_name);
+            auto          kernel = lib.symbol(kernel_name);
+            if(c.precision == rocfft_precision_single)
+                EXPECT_LT(host_kernel_error<float>(kernel, c.factors, direction), 1e-5);
+            else
+                EXPECT_LT(host_kernel_error<double>(kernel, c.factors, direction), 1e-12);
+        }
+    }
+}
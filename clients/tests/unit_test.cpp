@@ -21,10 +21,12 @@
 #include "rocfft/rocfft.h"
 
 #include "../../shared/concurrency.h"
+#include "../../shared/device_profile.h"
 #include "../../shared/environment.h"
 #include "../../shared/gpubuf.h"
 #include "../../shared/rocfft_complex.h"
 #include "hip/hip_runtime_api.h"
+#include "sqlite3.h"
 #include <boost/scope_exit.hpp>
 #include <condition_variable>
 #include <cstdlib>
@@ -32,6 +34,7 @@
 #include <gtest/gtest.h>
 #include <mutex>
 #include <regex>
+#include <sstream>
 #include <thread>
 #include <vector>
 
@@ -254,6 +257,369 @@ TEST(rocfft_UnitTest, workmem_null)
     workmem_test([](size_t requested) { return requested; }, rocfft_status_success, true);
 }
 
+// plans for a problem that was already planned reuse the built plan,
+// and anything that changes the plan misses the plan cache
+TEST(rocfft_UnitTest, plan_cache)
+{
+    const std::string plan_log_path = std::tmpnam(nullptr);
+
+    BOOST_SCOPE_EXIT_ALL(=)
+    {
+        rocfft_cleanup();
+        remove(plan_log_path.c_str());
+        rocfft_setup();
+    };
+
+    // log plans, so we can tell when a cached plan was used
+    rocfft_cleanup();
+    EnvironmentSetTemp layer_env("ROCFFT_LAYER", "8");
+    EnvironmentSetTemp log_env("ROCFFT_LOG_PLAN_PATH", plan_log_path.c_str());
+
+    // 1D C2C problem, and ways of changing it
+    struct Problem
+    {
+        rocfft_result_placement placement    = rocfft_placement_notinplace;
+        rocfft_precision        precision    = rocfft_precision_single;
+        size_t                  length       = 64;
+        size_t                  batch        = 1;
+        double                  scale_factor = 1.0;
+        // give the default data layout explicitly
+        bool explicit_layout = false;
+    };
+
+    auto create_destroy_plan = [](const Problem& p) {
+        rocfft_plan_description desc = nullptr;
+        ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_description_set_scale_factor(desc, p.scale_factor),
+                  rocfft_status_success);
+        if(p.explicit_layout)
+        {
+            const size_t stride = 1;
+            ASSERT_EQ(rocfft_plan_description_set_data_layout(desc,
+                                                              rocfft_array_type_complex_interleaved,
+                                                              rocfft_array_type_complex_interleaved,
+                                                              nullptr,
+                                                              nullptr,
+                                                              1,
+                                                              &stride,
+                                                              p.length,
+                                                              1,
+                                                              &stride,
+                                                              p.length),
+                      rocfft_status_success);
+        }
+
+        rocfft_plan plan = nullptr;
+        ASSERT_EQ(rocfft_plan_create(&plan,
+                                     p.placement,
+                                     rocfft_transform_type_complex_forward,
+                                     p.precision,
+                                     1,
+                                     &p.length,
+                                     p.batch,
+                                     desc),
+                  rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_destroy(plan), rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_description_destroy(desc), rocfft_status_success);
+    };
+
+    // plan the default problem and then another one, and return how
+    // many times a cached plan was used
+    auto cached_plans = [&](const Problem& other) {
+        // setup truncates the log, and cleanup flushes it and
+        // empties the plan cache
+        rocfft_setup();
+        create_destroy_plan(Problem{});
+        create_destroy_plan(other);
+        rocfft_cleanup();
+
+        std::ifstream log(plan_log_path);
+        std::string   line;
+        size_t        hits = 0;
+        while(std::getline(log, line))
+        {
+            if(line == "using cached plan")
+                ++hits;
+        }
+        return hits;
+    };
+
+    // the same problem hits, however its layout is given
+    EXPECT_EQ(cached_plans(Problem{}), 1U);
+    Problem explicit_layout;
+    explicit_layout.explicit_layout = true;
+    EXPECT_EQ(cached_plans(explicit_layout), 1U);
+
+    // anything that changes the plan misses
+    Problem inplace;
+    inplace.placement = rocfft_placement_inplace;
+    EXPECT_EQ(cached_plans(inplace), 0U);
+    Problem double_precision;
+    double_precision.precision = rocfft_precision_double;
+    EXPECT_EQ(cached_plans(double_precision), 0U);
+    Problem longer;
+    longer.length = 128;
+    EXPECT_EQ(cached_plans(longer), 0U);
+    Problem batched;
+    batched.batch = 2;
+    EXPECT_EQ(cached_plans(batched), 0U);
+    Problem scaled;
+    scaled.scale_factor = 0.5;
+    EXPECT_EQ(cached_plans(scaled), 0U);
+}
+
+// buffer assignment chooses the same assignments as the exhaustive
+// search it replaced
+TEST(rocfft_UnitTest, buffer_assignment_exhaustive)
+{
+    const std::string plan_log_path = std::tmpnam(nullptr);
+
+    BOOST_SCOPE_EXIT_ALL(=)
+    {
+        rocfft_cleanup();
+        remove(plan_log_path.c_str());
+        rocfft_setup();
+    };
+
+    // log plans, which show each node's buffers and array types
+    rocfft_cleanup();
+    EnvironmentSetTemp layer_env("ROCFFT_LAYER", "8");
+    EnvironmentSetTemp log_env("ROCFFT_LOG_PLAN_PATH", plan_log_path.c_str());
+
+    struct Problem
+    {
+        rocfft_transform_type   type;
+        rocfft_result_placement placement;
+        rocfft_precision        precision;
+        std::vector<size_t>     length;
+        bool                    planar = false;
+    };
+
+    auto create_destroy_plan = [](const Problem& p) {
+        rocfft_plan_description desc = nullptr;
+        ASSERT_EQ(rocfft_plan_description_create(&desc), rocfft_status_success);
+        if(p.planar)
+        {
+            ASSERT_EQ(rocfft_plan_description_set_data_layout(desc,
+                                                              rocfft_array_type_complex_planar,
+                                                              rocfft_array_type_complex_planar,
+                                                              nullptr,
+                                                              nullptr,
+                                                              0,
+                                                              nullptr,
+                                                              0,
+                                                              0,
+                                                              nullptr,
+                                                              0),
+                      rocfft_status_success);
+        }
+
+        rocfft_plan plan = nullptr;
+        ASSERT_EQ(rocfft_plan_create(&plan,
+                                     p.placement,
+                                     p.type,
+                                     p.precision,
+                                     p.length.size(),
+                                     p.length.data(),
+                                     1,
+                                     desc),
+                  rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_destroy(plan), rocfft_status_success);
+        ASSERT_EQ(rocfft_plan_description_destroy(desc), rocfft_status_success);
+    };
+
+    // return the plan log for a problem, without the addresses of
+    // temp buffers
+    auto plan_log = [&](const Problem& p, bool exhaustive) {
+        EnvironmentSetTemp exhaustive_env("ROCFFT_INTERNAL_EXHAUSTIVE_ASSIGNMENT",
+                                          exhaustive ? "1" : "0");
+        // setup truncates the log, and cleanup flushes it and
+        // empties the plan cache
+        rocfft_setup();
+        create_destroy_plan(p);
+        rocfft_cleanup();
+
+        std::ifstream log(plan_log_path);
+        std::string   line;
+        std::string   contents;
+        while(std::getline(log, line))
+        {
+            if(line.compare(0, 11, "temp buffer") != 0)
+                contents += line + "\n";
+        }
+        return contents;
+    };
+
+    const auto C2C_fwd  = rocfft_transform_type_complex_forward;
+    const auto C2C_inv  = rocfft_transform_type_complex_inverse;
+    const auto R2C      = rocfft_transform_type_real_forward;
+    const auto C2R      = rocfft_transform_type_real_inverse;
+    const auto inplace  = rocfft_placement_inplace;
+    const auto outplace = rocfft_placement_notinplace;
+    const auto single   = rocfft_precision_single;
+    const auto dbl      = rocfft_precision_double;
+
+    const std::vector<Problem> problems = {
+        // single kernel
+        {C2C_fwd, inplace, single, {64}},
+        {C2C_fwd, outplace, single, {64}},
+        // multi-kernel 1D, including large 1D that can be fused
+        {C2C_fwd, inplace, single, {8192}},
+        {C2C_inv, outplace, dbl, {2304}},
+        {C2C_fwd, outplace, single, {1048576}},
+        {C2C_fwd, outplace, single, {8192}, true},
+        // bluestein
+        {C2C_fwd, outplace, single, {65537}},
+        {C2C_fwd, inplace, dbl, {65537}},
+        // real 1D, even and odd lengths
+        {R2C, inplace, single, {8192}},
+        {R2C, outplace, single, {8192}},
+        {C2R, outplace, dbl, {8192}},
+        {R2C, outplace, single, {2187}},
+        {C2R, inplace, single, {65537}},
+        // 2D and 3D
+        {C2C_fwd, outplace, single, {256, 256}},
+        {C2C_inv, inplace, dbl, {1024, 200}},
+        {C2C_fwd, outplace, single, {64, 64, 64}},
+        {C2C_fwd, inplace, single, {200, 128, 81}},
+        {C2C_fwd, outplace, single, {64, 64, 64}, true},
+        {R2C, outplace, single, {256, 256}},
+        {C2R, inplace, dbl, {256, 200}},
+        {R2C, inplace, single, {64, 64, 64}},
+        {C2R, outplace, single, {128, 96, 80}},
+    };
+
+    for(const auto& p : problems)
+    {
+        auto memoized   = plan_log(p, false);
+        auto exhaustive = plan_log(p, true);
+        EXPECT_FALSE(memoized.empty());
+        EXPECT_EQ(memoized, exhaustive);
+    }
+}
+
+// device profiles for offline planning
+TEST(rocfft_UnitTest, device_profile_parse)
+{
+    std::istringstream full("# profile of an MI210\n"
+                            "gcnArchName = gfx90a:sramecc+:xnack-\n"
+                            "\n"
+                            "name = AMD Instinct MI210   # trailing comment\n"
+                            "sharedMemPerBlock = 65536\n"
+                            "maxSharedMemoryPerMultiProcessor = 65536\n"
+                            "multiProcessorCount = 104\n"
+                            "  warpSize=64\r\n"
+                            "maxThreadsPerBlock = 1024\n"
+                            "maxThreadsDim = 1024 512 256\n"
+                            "maxGridSize = 2147483647 65536 32768\n"
+                            "totalGlobalMem = 68702699520\n");
+    auto               prop = device_profile_parse(full);
+    EXPECT_STREQ(prop.gcnArchName, "gfx90a:sramecc+:xnack-");
+    EXPECT_STREQ(prop.name, "AMD Instinct MI210");
+    EXPECT_EQ(prop.sharedMemPerBlock, 65536U);
+    EXPECT_EQ(prop.maxSharedMemoryPerMultiProcessor, 65536U);
+    EXPECT_EQ(prop.multiProcessorCount, 104);
+    EXPECT_EQ(prop.warpSize, 64);
+    EXPECT_EQ(prop.maxThreadsPerBlock, 1024);
+    EXPECT_EQ(prop.maxThreadsDim[0], 1024);
+    EXPECT_EQ(prop.maxThreadsDim[1], 512);
+    EXPECT_EQ(prop.maxThreadsDim[2], 256);
+    EXPECT_EQ(prop.maxGridSize[0], 2147483647);
+    EXPECT_EQ(prop.maxGridSize[1], 65536);
+    EXPECT_EQ(prop.maxGridSize[2], 32768);
+    EXPECT_EQ(prop.totalGlobalMem, 68702699520U);
+
+    // writing a profile and reading it back gives the same properties
+    std::stringstream written;
+    device_profile_write(written, prop);
+    auto reread = device_profile_parse(written);
+    EXPECT_STREQ(reread.gcnArchName, prop.gcnArchName);
+    EXPECT_STREQ(reread.name, prop.name);
+    EXPECT_EQ(reread.sharedMemPerBlock, prop.sharedMemPerBlock);
+    EXPECT_EQ(reread.multiProcessorCount, prop.multiProcessorCount);
+    EXPECT_EQ(reread.maxThreadsDim[1], prop.maxThreadsDim[1]);
+    EXPECT_EQ(reread.maxGridSize[2], prop.maxGridSize[2]);
+    EXPECT_EQ(reread.totalGlobalMem, prop.totalGlobalMem);
+
+    // only the arch is required
+    std::istringstream arch_only("gcnArchName = gfx942\n");
+    auto               defaults = device_profile_parse(arch_only);
+    EXPECT_STREQ(defaults.gcnArchName, "gfx942");
+    EXPECT_EQ(defaults.sharedMemPerBlock, 65536U);
+    EXPECT_EQ(defaults.warpSize, 64);
+    EXPECT_EQ(defaults.maxThreadsPerBlock, 1024);
+
+    // malformed profiles are rejected
+    for(const char* malformed : {
+            "",
+            "name = no arch\n",
+            "gcnArchName =\n",
+            "gcnArchName = gfx942\nwarpSize\n",
+            "gcnArchName = gfx942\nunknownKey = 1\n",
+            "gcnArchName = gfx942\nwarpSize = many\n",
+            "gcnArchName = gfx942\nwarpSize = 64abc\n",
+            "gcnArchName = gfx942\nmaxThreadsDim = 1024 1024\n",
+            "gcnArchName = gfx942\nmaxGridSize = 1 2 3 4\n",
+        })
+    {
+        std::istringstream is(malformed);
+        EXPECT_THROW(device_profile_parse(is), std::runtime_error) << malformed;
+    }
+    std::istringstream long_name("gcnArchName = gfx942\nname = " + std::string(1000, 'x') + "\n");
+    EXPECT_THROW(device_profile_parse(long_name), std::runtime_error);
+}
+
+// a bad offline device profile fails rocfft_setup, without leaving
+// behind the caches, compile pools and log files that setup would
+// otherwise create
+TEST(rocfft_UnitTest, offline_device_setup_failure)
+{
+    const std::string rtc_cache_path = std::tmpnam(nullptr);
+    const std::string trace_log_path = std::tmpnam(nullptr);
+    const std::string profile_path   = std::tmpnam(nullptr);
+
+    BOOST_SCOPE_EXIT_ALL(=)
+    {
+        rocfft_cleanup();
+        remove(rtc_cache_path.c_str());
+        remove(trace_log_path.c_str());
+        remove(profile_path.c_str());
+        rocfft_setup();
+    };
+
+    {
+        std::ofstream profile(profile_path);
+        profile << "name = no arch\n";
+    }
+
+    rocfft_cleanup();
+    {
+        EnvironmentSetTemp cache_env("ROCFFT_RTC_CACHE_PATH", rtc_cache_path.c_str());
+        EnvironmentSetTemp layer_env("ROCFFT_LAYER", "1");
+        EnvironmentSetTemp log_env("ROCFFT_LOG_TRACE_PATH", trace_log_path.c_str());
+        EnvironmentSetTemp profile_env("ROCFFT_OFFLINE_DEVICE_PROFILE", profile_path.c_str());
+        ASSERT_EQ(rocfft_setup(), rocfft_status_failure);
+
+        // no cache was opened and no log was written
+        void*  buf     = nullptr;
+        size_t buf_len = 0;
+        EXPECT_EQ(rocfft_cache_serialize(&buf, &buf_len), rocfft_status_failure);
+        EXPECT_FALSE(fs::exists(rtc_cache_path));
+        EXPECT_FALSE(fs::exists(trace_log_path));
+
+        // cleaning up after a failed setup is harmless
+        EXPECT_EQ(rocfft_cleanup(), rocfft_status_success);
+        EXPECT_FALSE(fs::exists(trace_log_path));
+    }
+
+    // the library can be set up again without the profile
+    ASSERT_EQ(rocfft_setup(), rocfft_status_success);
+    void*  buf     = nullptr;
+    size_t buf_len = 0;
+    ASSERT_EQ(rocfft_cache_serialize(&buf, &buf_len), rocfft_status_success);
+    rocfft_cache_buffer_free(buf);
+}
+
 static const size_t RTC_PROBLEM_SIZE = 2304;
 // runtime compilation cache tests
 TEST(rocfft_UnitTest, rtc_cache)
@@ -299,13 +665,13 @@ TEST(rocfft_UnitTest, rtc_cache)
     // END PRECONDITIONS
 
     // pick a length that's runtime compiled
-    auto build_plan = [&]() {
+    auto build_plan = [&](rocfft_precision precision = rocfft_precision_single) {
         rocfft_plan plan = nullptr;
         ASSERT_TRUE(rocfft_status_success
                     == rocfft_plan_create(&plan,
                                           rocfft_placement_inplace,
                                           rocfft_transform_type_complex_forward,
-                                          rocfft_precision_single,
+                                          precision,
                                           1,
                                           &RTC_PROBLEM_SIZE,
                                           1,
@@ -333,10 +699,38 @@ TEST(rocfft_UnitTest, rtc_cache)
         }
         return false;
     };
+    // check the RTC log to see if an FFT kernel's source was
+    // generated.  cache hits should find the kernel's source digest
+    // in the cache's index instead of generating the source.
+    auto fft_kernel_was_generated = [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        std::ifstream logfile(rtc_log_path);
+        std::string   line;
+        while(std::getline(logfile, line))
+        {
+            if(line.find("source generated") != std::string::npos
+               && line.find("fft_") != std::string::npos)
+                return true;
+        }
+        return false;
+    };
+
+    // the cache starts out empty
+    rocfft_cache_composition composition;
+    ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+    ASSERT_EQ(composition.kernels, 0U);
+    ASSERT_EQ(composition.code_objects, 0U);
+    ASSERT_EQ(composition.total_bytes, 0U);
 
     // build a plan that requires runtime compilation,
     // close logs and ensure a kernel was built
     build_plan();
+    ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+    ASSERT_GT(composition.kernels, 0U);
+    ASSERT_GT(composition.code_objects, 0U);
+    ASSERT_GT(composition.code_bytes, 0U);
+    ASSERT_GT(composition.total_bytes, composition.code_bytes);
+    const auto compiled_kernels = composition.kernels;
     ASSERT_EQ(rocfft_cache_serialize(&onekernel_cache, &onekernel_cache_bytes),
               rocfft_status_success);
     rocfft_cleanup();
@@ -359,22 +753,173 @@ TEST(rocfft_UnitTest, rtc_cache)
     ASSERT_GT(onekernel_cache_bytes, empty_cache_bytes);
 
     // re-init library without blowing away cache.  rebuild plan and
-    // check that the kernel was not recompiled.
+    // check that the kernel was not recompiled, and that the cache
+    // counted the lookups.
     rocfft_setup();
     build_plan();
+    ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+    ASSERT_EQ(composition.kernels, compiled_kernels);
+    ASSERT_LT(composition.unused_kernels, compiled_kernels);
+    ASSERT_GT(composition.hits, 0U);
+
+    // deserializing the same kernels over the cache must keep the
+    // usage recorded for them, or cleanup would evict them first
+    const auto recorded_hits   = composition.hits;
+    const auto recorded_unused = composition.unused_kernels;
+    ASSERT_EQ(rocfft_cache_deserialize(onekernel_cache, onekernel_cache_bytes),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+    ASSERT_EQ(composition.kernels, compiled_kernels);
+    ASSERT_EQ(composition.hits, recorded_hits);
+    ASSERT_EQ(composition.unused_kernels, recorded_unused);
     rocfft_cleanup();
     ASSERT_FALSE(fft_kernel_was_compiled());
+    ASSERT_FALSE(fft_kernel_was_generated());
 
     // blow away cache again, deserialize one-kernel cache.  re-init
     // library and rebuild plan - kernel should again not be
     // recompiled
     remove(rtc_cache_path.c_str());
     rocfft_setup();
+    // a failed deserialize doesn't prevent later ones
+    const std::string not_a_cache = "not a cache";
+    ASSERT_EQ(rocfft_cache_deserialize(not_a_cache.data(), not_a_cache.size()),
+              rocfft_status_failure);
     ASSERT_EQ(rocfft_cache_deserialize(onekernel_cache, onekernel_cache_bytes),
               rocfft_status_success);
     rocfft_cleanup();
     ASSERT_FALSE(fft_kernel_was_compiled());
 
+    rocfft_setup();
+    build_plan();
+    rocfft_cleanup();
+    ASSERT_FALSE(fft_kernel_was_compiled());
+    ASSERT_FALSE(fft_kernel_was_generated());
+
+    // serialize a filtered cache, blow away the cache and
+    // deserialize the filtered one.  rebuild plan - kernel should be
+    // recompiled only if the filter excluded it.
+    auto filtered_roundtrip = [&](const char* arch, const char* prefix) {
+        rocfft_setup();
+        rocfft_cache_filter filter = nullptr;
+        ASSERT_EQ(rocfft_cache_filter_create(&filter), rocfft_status_success);
+        if(arch)
+        {
+            ASSERT_EQ(rocfft_cache_filter_add_arch(filter, arch), rocfft_status_success);
+        }
+        if(prefix)
+        {
+            ASSERT_EQ(rocfft_cache_filter_add_kernel_prefix(filter, prefix),
+                      rocfft_status_success);
+        }
+        void*  filtered_cache       = nullptr;
+        size_t filtered_cache_bytes = 0;
+        ASSERT_EQ(rocfft_cache_serialize_filtered(
+                      filter, &filtered_cache, &filtered_cache_bytes, nullptr),
+                  rocfft_status_success);
+        rocfft_cache_filter_destroy(filter);
+        rocfft_cleanup();
+
+        remove(rtc_cache_path.c_str());
+        rocfft_setup();
+        ASSERT_EQ(rocfft_cache_deserialize(filtered_cache, filtered_cache_bytes),
+                  rocfft_status_success);
+        rocfft_cache_buffer_free(filtered_cache);
+        build_plan();
+        rocfft_cleanup();
+    };
+    filtered_roundtrip(nullptr, "fft_");
+    ASSERT_FALSE(fft_kernel_was_compiled());
+    ASSERT_FALSE(fft_kernel_was_generated());
+    filtered_roundtrip("gfx_no_such_arch", nullptr);
+    ASSERT_TRUE(fft_kernel_was_compiled());
+
+    // serialize the cache and keep the watermark, then compile a new
+    // kernel and serialize only what was added since.  deserialized
+    // into an empty cache, the delta should hold just the new kernel.
+    {
+        remove(rtc_cache_path.c_str());
+        rocfft_setup();
+        build_plan();
+        ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+        const auto old_kernels = composition.kernels;
+        rocfft_cleanup();
+
+        // timestamps have one-second resolution, and kernels stored
+        // at the watermark go into both buffers.  backdate the
+        // kernels already in the cache, so that only kernels compiled
+        // after the watermark are newer than it.
+        {
+            sqlite3* db = nullptr;
+            ASSERT_EQ(sqlite3_open(rtc_cache_path.c_str(), &db), SQLITE_OK);
+            auto rc = sqlite3_exec(
+                db, "UPDATE cache_v2 SET timestamp = timestamp - 10", nullptr, nullptr, nullptr);
+            sqlite3_close(db);
+            ASSERT_EQ(rc, SQLITE_OK);
+        }
+        rocfft_setup();
+
+        rocfft_cache_filter filter = nullptr;
+        ASSERT_EQ(rocfft_cache_filter_create(&filter), rocfft_status_success);
+        BOOST_SCOPE_EXIT_ALL(=)
+        {
+            rocfft_cache_filter_destroy(filter);
+        };
+        void*  full_cache       = nullptr;
+        size_t full_cache_bytes = 0;
+        size_t watermark        = 0;
+        ASSERT_EQ(
+            rocfft_cache_serialize_filtered(filter, &full_cache, &full_cache_bytes, &watermark),
+            rocfft_status_success);
+        rocfft_cache_buffer_free(full_cache);
+        ASSERT_GT(watermark, 0U);
+
+        build_plan(rocfft_precision_double);
+        ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+        ASSERT_GT(composition.kernels, old_kernels);
+        const auto new_kernels = composition.kernels - old_kernels;
+
+        void*  delta_cache       = nullptr;
+        size_t delta_cache_bytes = 0;
+        ASSERT_EQ(rocfft_cache_filter_set_watermark(filter, watermark), rocfft_status_success);
+        ASSERT_EQ(
+            rocfft_cache_serialize_filtered(filter, &delta_cache, &delta_cache_bytes, nullptr),
+            rocfft_status_success);
+        rocfft_cleanup();
+
+        remove(rtc_cache_path.c_str());
+        rocfft_setup();
+        ASSERT_EQ(rocfft_cache_deserialize(delta_cache, delta_cache_bytes),
+                  rocfft_status_success);
+        rocfft_cache_buffer_free(delta_cache);
+        ASSERT_EQ(rocfft_cache_get_composition(&composition), rocfft_status_success);
+        ASSERT_EQ(composition.kernels, new_kernels);
+        build_plan(rocfft_precision_double);
+        rocfft_cleanup();
+        ASSERT_FALSE(fft_kernel_was_compiled());
+
+        rocfft_setup();
+        build_plan();
+        rocfft_cleanup();
+        ASSERT_TRUE(fft_kernel_was_compiled());
+    }
+
+    // blow away cache, prefetch the plan's kernels and ensure they
+    // were compiled.  rebuild plan - kernel should not be recompiled.
+    remove(rtc_cache_path.c_str());
+    rocfft_setup();
+    ASSERT_EQ(rocfft_cache_prefetch(rocfft_placement_inplace,
+                                    rocfft_transform_type_complex_forward,
+                                    rocfft_precision_single,
+                                    1,
+                                    &RTC_PROBLEM_SIZE,
+                                    1,
+                                    nullptr),
+              rocfft_status_success);
+    ASSERT_EQ(rocfft_cache_prefetch_wait(), rocfft_status_success);
+    rocfft_cleanup();
+    ASSERT_TRUE(fft_kernel_was_compiled());
+
     rocfft_setup();
     build_plan();
     rocfft_cleanup();
@@ -388,6 +933,7 @@ TEST(rocfft_UnitTest, rtc_cache)
     build_plan();
     rocfft_cleanup();
     ASSERT_FALSE(fft_kernel_was_compiled());
+    ASSERT_FALSE(fft_kernel_was_generated());
 
     // check that the system cache is not written to, even if it's
     // writable by the current user.  after removing the cache, the
@@ -405,6 +951,46 @@ TEST(rocfft_UnitTest, rtc_cache)
 }
 
 // make sure cache API functions tolerate null pointers without crashing
+// rocfft_cleanup cancels prefetches that haven't started, instead of
+// waiting for all of them to compile
+TEST(rocfft_UnitTest, rtc_prefetch_cleanup)
+{
+    const std::string rtc_cache_path = std::tmpnam(nullptr);
+
+    BOOST_SCOPE_EXIT_ALL(=)
+    {
+        rocfft_cleanup();
+        remove(rtc_cache_path.c_str());
+        rocfft_setup();
+    };
+
+    // start from an empty cache, so that every prefetch has to
+    // compile its kernels
+    rocfft_cleanup();
+    EnvironmentSetTemp cache_env("ROCFFT_RTC_CACHE_PATH", rtc_cache_path.c_str());
+    EnvironmentSetTemp cache_sys_env("ROCFFT_RTC_SYS_CACHE_PATH", ":memory:");
+    rocfft_setup();
+
+    // queue many more prefetches than the prefetch pool runs at once
+    for(size_t length = 16; length <= 16 * 256; length += 16)
+    {
+        ASSERT_EQ(rocfft_cache_prefetch(rocfft_placement_inplace,
+                                        rocfft_transform_type_complex_forward,
+                                        rocfft_precision_single,
+                                        1,
+                                        &length,
+                                        1,
+                                        nullptr),
+                  rocfft_status_success);
+    }
+    rocfft_cleanup();
+
+    // the cancelled prefetches are reported as failures
+    ASSERT_EQ(rocfft_cache_prefetch_wait(), rocfft_status_failure);
+    // and there's nothing left to wait for
+    ASSERT_EQ(rocfft_cache_prefetch_wait(), rocfft_status_success);
+}
+
 TEST(rocfft_UnitTest, rtc_cache_null)
 {
     void*  buf     = nullptr;
@@ -414,6 +1000,42 @@ TEST(rocfft_UnitTest, rtc_cache_null)
     ASSERT_EQ(rocfft_cache_buffer_free(nullptr), rocfft_status_success);
     ASSERT_EQ(rocfft_cache_deserialize(nullptr, 12345), rocfft_status_invalid_arg_value);
     ASSERT_EQ(rocfft_cache_deserialize(&buf_len, 0), rocfft_status_invalid_arg_value);
+
+    rocfft_cache_filter filter = nullptr;
+    ASSERT_EQ(rocfft_cache_filter_create(nullptr), rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_filter_destroy(nullptr), rocfft_status_success);
+    ASSERT_EQ(rocfft_cache_filter_add_arch(nullptr, "gfx90a"), rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_filter_add_kernel_prefix(nullptr, "fft_"),
+              rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_filter_set_watermark(nullptr, 0), rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_serialize_filtered(nullptr, &buf, &buf_len, nullptr),
+              rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_filter_create(&filter), rocfft_status_success);
+    ASSERT_EQ(rocfft_cache_filter_add_arch(filter, nullptr), rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_serialize_filtered(filter, nullptr, &buf_len, nullptr),
+              rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_filter_destroy(filter), rocfft_status_success);
+
+    size_t length = 64;
+    ASSERT_EQ(rocfft_cache_prefetch(rocfft_placement_inplace,
+                                    rocfft_transform_type_complex_forward,
+                                    rocfft_precision_single,
+                                    1,
+                                    nullptr,
+                                    1,
+                                    nullptr),
+              rocfft_status_invalid_arg_value);
+    ASSERT_EQ(rocfft_cache_prefetch(rocfft_placement_inplace,
+                                    rocfft_transform_type_complex_forward,
+                                    rocfft_precision_single,
+                                    4,
+                                    &length,
+                                    1,
+                                    nullptr),
+              rocfft_status_invalid_dimensions);
+    ASSERT_EQ(rocfft_cache_prefetch_wait(), rocfft_status_success);
+
+    ASSERT_EQ(rocfft_cache_get_composition(nullptr), rocfft_status_invalid_arg_value);
 }
 
 // make sure RTC gracefully handles a helper process that crashes
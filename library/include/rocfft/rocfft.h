@@ -73,6 +73,34 @@ typedef struct rocfft_field_t* rocfft_field;
  *  */
 typedef struct rocfft_brick_t* rocfft_brick;
 
+/*! @brief Pointer type to a compiled kernel cache filter structure.
+ *
+ *  @details Cache filters select the kernels written by
+ *  ::rocfft_cache_serialize_filtered.  They are initialized with
+ *  ::rocfft_cache_filter_create.
+ *  */
+typedef struct rocfft_cache_filter_t* rocfft_cache_filter;
+
+/*! @brief Summary of the compiled kernel cache.
+ *
+ *  @details Filled in by ::rocfft_cache_get_composition.
+ *  */
+typedef struct rocfft_cache_composition_s
+{
+    //! number of kernels in the cache
+    size_t kernels;
+    //! number of kernels that have not been looked up since they were stored
+    size_t unused_kernels;
+    //! total number of times cached kernels have been looked up
+    size_t hits;
+    //! number of distinct code objects, which may be shared by several kernels
+    size_t code_objects;
+    //! total size of the code objects, in bytes
+    size_t code_bytes;
+    //! size of the cache in bytes, as compared against ROCFFT_RTC_CACHE_SIZE_LIMIT
+    size_t total_bytes;
+} rocfft_cache_composition;
+
 /*! @brief rocFFT status/error codes */
 typedef enum rocfft_status_e
 {
@@ -149,7 +177,12 @@ typedef enum rocfft_execution_mode_e
 ROCFFT_EXPORT rocfft_status rocfft_setup();
 
 /*! @brief Library cleanup function, called once in program after end of library
- * use */
+ * use
+ *
+ *  @details If ROCFFT_RTC_CACHE_SIZE_LIMIT is set to a number of
+ *  bytes, and the compiled kernel cache at ROCFFT_RTC_CACHE_PATH has
+ *  grown larger than that, the least used kernels are removed from
+ *  it.  By default, the cache is not trimmed. */
 ROCFFT_EXPORT rocfft_status rocfft_cleanup();
 
 /*! @brief Create an FFT plan
@@ -645,6 +678,126 @@ ROCFFT_EXPORT rocfft_status rocfft_cache_buffer_free(void* buffer);
  *  pointer or a zero length is passed. */
 ROCFFT_EXPORT rocfft_status rocfft_cache_deserialize(const void* buffer, size_t buffer_len_bytes);
 
+/*! @brief Create a compiled kernel cache filter.
+
+ *  @details A new filter matches every kernel in the cache.  Each
+ *  call to a ::rocfft_cache_filter_add_arch or
+ *  ::rocfft_cache_filter_add_kernel_prefix function narrows the
+ *  filter: a kernel must match one of the added architectures (if
+ *  any were added) and one of the added prefixes (if any were added).
+ */
+ROCFFT_EXPORT rocfft_status rocfft_cache_filter_create(rocfft_cache_filter* filter);
+
+/*! @brief Destroy a compiled kernel cache filter. */
+ROCFFT_EXPORT rocfft_status rocfft_cache_filter_destroy(rocfft_cache_filter filter);
+
+/*! @brief Add a GPU architecture to a cache filter.
+
+ *  @details Only kernels compiled for one of the filter's
+ *  architectures will be serialized.  Target feature flags, such as
+ *  ":xnack-", are ignored.
+ *
+ *  @param[in] filter cache filter handle
+ *  @param[in] arch architecture name, for example "gfx90a" */
+ROCFFT_EXPORT rocfft_status rocfft_cache_filter_add_arch(rocfft_cache_filter filter,
+                                                         const char*         arch);
+
+/*! @brief Add a kernel name prefix to a cache filter.
+
+ *  @details Only kernels whose names begin with one of the filter's
+ *  prefixes will be serialized.
+ *
+ *  @param[in] filter cache filter handle
+ *  @param[in] prefix kernel name prefix */
+ROCFFT_EXPORT rocfft_status rocfft_cache_filter_add_kernel_prefix(rocfft_cache_filter filter,
+                                                                  const char*         prefix);
+
+/*! @brief Set the watermark of a cache filter.
+
+ *  @details Only kernels added to the cache at or after the watermark
+ *  will be serialized.  Watermarks are returned by
+ *  ::rocfft_cache_serialize_filtered, so that a later call can
+ *  serialize just the kernels that were added since the earlier
+ *  one.  Kernels added at exactly the watermark may be serialized by
+ *  both calls.
+ *
+ *  @param[in] filter cache filter handle
+ *  @param[in] watermark watermark returned by an earlier call to ::rocfft_cache_serialize_filtered */
+ROCFFT_EXPORT rocfft_status rocfft_cache_filter_set_watermark(rocfft_cache_filter filter,
+                                                              size_t              watermark);
+
+/*! @brief Serialize part of the compiled kernel cache
+
+ *  @details Serialize the kernels in rocFFT's cache of compiled
+ *  kernels that match a filter into a buffer.  The buffer is
+ *  allocated by rocFFT and must be freed with a call to
+ *  ::rocfft_cache_buffer_free, and can be passed to
+ *  ::rocfft_cache_deserialize.
+ *
+ *  @param[in] filter cache filter handle
+ *  @param[out] buffer serialized cache
+ *  @param[out] buffer_len_bytes length of the serialized cache in bytes
+ *  @param[out] watermark if not null, receives the watermark to set on
+ *  a filter to serialize only kernels added after this call */
+ROCFFT_EXPORT rocfft_status rocfft_cache_serialize_filtered(rocfft_cache_filter filter,
+                                                            void**              buffer,
+                                                            size_t*             buffer_len_bytes,
+                                                            size_t*             watermark);
+
+/*! @brief Compile the kernels for an FFT problem into the compiled kernel cache
+
+ *  @details Queue the kernels that a plan with the given parameters
+ *  would need to be compiled in the background, so that a later call
+ *  to ::rocfft_plan_create does not need to wait for compilation.
+ *  Parameters are the same as for ::rocfft_plan_create, and kernels
+ *  are compiled for the current device.  No plan is created and no
+ *  device memory is allocated.
+ *
+ *  Kernels are compiled at a lower priority than kernels needed by
+ *  plans being created.  This function returns once the problem is
+ *  queued; use ::rocfft_cache_prefetch_wait to wait for compilation
+ *  to finish.  Prefetches that have not started by the time
+ *  ::rocfft_cleanup is called are cancelled.
+ *
+ *  Plan descriptions that specify fields or an MPI communicator are
+ *  not supported.
+ *
+ *  @param[in] placement placement of result
+ *  @param[in] transform_type type of transform
+ *  @param[in] precision precision
+ *  @param[in] dimensions dimensions
+ *  @param[in] lengths dimensions-sized array of transform lengths
+ *  @param[in] number_of_transforms number of transforms
+ *  @param[in] description description handle created by
+ *  rocfft_plan_description_create; can be null for simple transforms */
+ROCFFT_EXPORT rocfft_status
+    rocfft_cache_prefetch(const rocfft_result_placement placement,
+                          const rocfft_transform_type   transform_type,
+                          const rocfft_precision        precision,
+                          const size_t                  dimensions,
+                          const size_t*                 lengths,
+                          const size_t                  number_of_transforms,
+                          const rocfft_plan_description description);
+
+/*! @brief Wait for queued kernel prefetches to finish
+
+ *  @details Wait for the kernels queued by ::rocfft_cache_prefetch
+ *  to be compiled.  Returns ::rocfft_status_failure if any of the
+ *  queued problems could not be compiled, or were cancelled by
+ *  ::rocfft_cleanup. */
+ROCFFT_EXPORT rocfft_status rocfft_cache_prefetch_wait();
+
+/*! @brief Summarize the contents of the compiled kernel cache
+
+ *  @details Count the kernels and code objects in rocFFT's cache of
+ *  compiled kernels (the cache at ROCFFT_RTC_CACHE_PATH, or the
+ *  in-memory cache if that is not set), and how often the kernels
+ *  have been used.  Kernels in the read-only system cache are not
+ *  counted.
+ *
+ *  @param[out] composition summary of the cache */
+ROCFFT_EXPORT rocfft_status rocfft_cache_get_composition(rocfft_cache_composition* composition);
+
 #ifdef ROCFFT_BUILD_OFFLINE_TUNER
 /*! @brief Get a handler of offline-tuner
 
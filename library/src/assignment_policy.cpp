@@ -20,165 +20,154 @@
 
 #include "assignment_policy.h"
 #include "../../shared/arithmetic.h"
+#include "../../shared/environment.h"
 #include "../../shared/ptrdiff.h"
 #include "./device/kernels/array_format.h"
 #include "enum_printer.h"
 #include "logging.h"
 #include "node_factory.h"
+#include <bitset>
 #include <numeric>
 #include <optional>
+#include <queue>
 #include <set>
 
-void PlacementTrace::Print(rocfft_ostream& os)
+PlacementCost& PlacementCost::operator+=(const PlacementCost& other)
 {
-    if(parent->curNode)
-    {
-        parent->Print(os);
-        os << " --> ";
-    }
-
-    os << "[ " << PrintScheme(curNode->scheme).c_str();
-    os << ": " << PrintOperatingBufferCode(inBuf) << "->" << PrintOperatingBufferCode(outBuf);
-    os << " ]";
-
-    if(branches.empty())
-    {
-        os << ": num-fused-kernels= " << parent->numFusedNodes;
-        os << ", num-inplace-kernels= " << parent->numInplace;
-        os << std::endl;
-    }
+    numFusedNodes += other.numFusedNodes;
+    numUsedBuffers += other.numUsedBuffers;
+    numPaddableTempOps += other.numPaddableTempOps;
+    numInplace += other.numInplace;
+    numTypeSwitching += other.numTypeSwitching;
+    return *this;
 }
 
-size_t PlacementTrace::BackwardCalcFusions(ExecPlan&       execPlan,
-                                           int             curFuseShimID,
-                                           PlacementTrace* shimLastNode)
+bool PlacementCost::Better(const PlacementCost& other) const
 {
-    numFusedNodes = 0;
-    if(curFuseShimID < 0)
-        return 0;
-
-    auto& shim = execPlan.fuseShims[curFuseShimID];
+    // more fused kernels is better
+    if(numFusedNodes != other.numFusedNodes)
+        return numFusedNodes > other.numFusedNodes;
+
+    // if tie, we still choose the one with less buffers
+    if(numUsedBuffers != other.numUsedBuffers)
+        return numUsedBuffers < other.numUsedBuffers;
+
+    // once we do have temp buffers, more temp ops that have
+    // better opportunities for padding are generally better,
+    // since we can avoid more bad memory access patterns
+    if(numPaddableTempOps != other.numPaddableTempOps)
+        return numPaddableTempOps > other.numPaddableTempOps;
+
+    // if tie, we still choose the one with more inplace
+    if(numInplace != other.numInplace)
+        return numInplace > other.numInplace;
+
+    // if tie, compare numTypeSwitching (less is better)
+    return numTypeSwitching < other.numTypeSwitching;
+}
 
-    // if this node is the last node of the fuseShim, pass self as shimLastNode and continue going back...
-    if(curNode == shim->LastFuseNode())
-    {
-        // should not have shimLastNode set, and should not have a null parent
-        if(shimLastNode != nullptr || parent == nullptr)
-            throw std::runtime_error(
-                "Tracing FusedShimsNode error when backtracking assignment path");
-        numFusedNodes = parent->BackwardCalcFusions(execPlan, curFuseShimID, this);
-    }
-    // if this node is the first node of the fuseShim, check if fusion can be done with the placement
-    else if(curNode == shim->FirstFuseNode())
-    {
-        // we should already have a shimLastNode
-        if(!shimLastNode)
-            throw std::runtime_error(
-                "Tracing FusedShimsNode error when backtracking assignment path");
-        size_t numFusion
-            = shim->PlacementFusable(this->inBuf, this->outBuf, shimLastNode->outBuf) ? 1 : 0;
-        numFusedNodes
-            = parent ? parent->BackwardCalcFusions(execPlan, curFuseShimID - 1, nullptr) + numFusion
-                     : numFusion;
-    }
-    // this node is either outside of a shim (shimLastNode == nullptr)
-    // or inside of a shim(shimLastNode != nullptr), simply keep on going back...
-    else
-    {
-        numFusedNodes
-            = parent ? parent->BackwardCalcFusions(execPlan, curFuseShimID, shimLastNode) : 0;
-    }
+bool PlacementCost::operator==(const PlacementCost& other) const
+{
+    return !Better(other) && !other.Better(*this);
+}
 
-    return numFusedNodes;
+uint64_t PlacementState::Key() const
+{
+    // buffers are 5 bits each, array types fit in 8 bits
+    return (static_cast<uint64_t>(step) << 32) | (static_cast<uint64_t>(buf) << 24)
+           | (static_cast<uint64_t>(type) << 16) | (static_cast<uint64_t>(usedBuffers) << 10)
+           | (static_cast<uint64_t>(shimInBuf) << 5) | static_cast<uint64_t>(shimOutBuf);
 }
 
-size_t PlacementTrace::NumUsedBuffers() const
+static bool IsPaddableTempBuffer(OperatingBuffer buf)
 {
-    return usedBuffers.size();
+    // Non-Bluestein temp buffers are candidates for padding.
+    // Skip Bluestein because it has non-obvious rules around
+    // what size of data is actually in the buffer, and it's a
+    // slow fallback path anyway.
+    return buf == OB_TEMP || buf == OB_TEMP_CMPLX_FOR_REAL;
 }
 
-void PlacementTrace::Backtracking(ExecPlan& execPlan, int execSeqID)
+void AssignmentPolicy::ApplyPath(ExecPlan& execPlan, const std::vector<PlacementMove>& path)
 {
     const auto& execSeq = execPlan.execSeq;
 
-    if((execSeqID < 0) || (curNode != execSeq[execSeqID]))
-        throw std::runtime_error("Backtracking error: accessing invalid resource");
+    OperatingBuffer   inBuf = execPlan.rootPlan->obIn;
+    rocfft_array_type iType = is_complex_planar(execPlan.rootPlan->inArrayType)
+                                  ? rocfft_array_type_complex_planar
+                                  : rocfft_array_type_complex_interleaved;
 
-    auto node          = execSeq[execSeqID];
-    node->placement    = this->isInplace ? rocfft_placement_inplace : rocfft_placement_notinplace;
-    node->obIn         = this->inBuf;
-    node->obOut        = this->outBuf;
-    node->inArrayType  = this->iType;
-    node->outArrayType = this->oType;
-
-    // Even-length internal nodes have real data for input or output but
-    // child nodes treat it as complex interleaved
-    if(node->parent
-       && (node->parent->scheme == CS_REAL_TRANSFORM_EVEN || node->parent->scheme == CS_REAL_2D_EVEN
-           || node->parent->scheme == CS_REAL_3D_EVEN))
+    for(size_t i = 0; i < path.size(); ++i)
     {
-        // forward transform, first node (if it's a leaf) needs to treat real input as complex
-        if(node->direction == -1 && node == node->parent->childNodes.front().get()
-           && node->childNodes.empty())
-            node->inArrayType = rocfft_array_type_complex_interleaved;
-        // inverse transform, last node (if it's a leaf) needs to treat real output as complex
-        if(node->direction == 1 && node == node->parent->childNodes.back().get()
-           && node->childNodes.empty())
-            node->outArrayType = rocfft_array_type_complex_interleaved;
-    }
+        auto node          = execSeq[placementNodes[i]];
+        node->placement    = inBuf == path[i].outBuf ? rocfft_placement_inplace
+                                                     : rocfft_placement_notinplace;
+        node->obIn         = inBuf;
+        node->obOut        = path[i].outBuf;
+        node->inArrayType  = iType;
+        // set the last oType to its original type of RootPlan (for
+        // example, change internal-CP to HP)
+        node->outArrayType
+            = i == path.size() - 1 ? execPlan.rootPlan->outArrayType : path[i].oType;
+
+        inBuf = path[i].outBuf;
+        iType = path[i].oType;
+
+        // Even-length internal nodes have real data for input or output but
+        // child nodes treat it as complex interleaved
+        if(node->parent
+           && (node->parent->scheme == CS_REAL_TRANSFORM_EVEN
+               || node->parent->scheme == CS_REAL_2D_EVEN
+               || node->parent->scheme == CS_REAL_3D_EVEN))
+        {
+            // forward transform, first node (if it's a leaf) needs to treat real input as complex
+            if(node->direction == -1 && node == node->parent->childNodes.front().get()
+               && node->childNodes.empty())
+                node->inArrayType = rocfft_array_type_complex_interleaved;
+            // inverse transform, last node (if it's a leaf) needs to treat real output as complex
+            if(node->direction == 1 && node == node->parent->childNodes.back().get()
+               && node->childNodes.empty())
+                node->outArrayType = rocfft_array_type_complex_interleaved;
+        }
 
-    // Ensure that all nodes that take real input are declared as
-    // such.  This is particularly important for leaf nodes, since
-    // kernelio debugging depends on knowing the correct type of the
-    // array to print.
-    if(node->scheme == CS_KERNEL_COPY_R_TO_CMPLX)
-        node->inArrayType = rocfft_array_type_real;
+        // Ensure that all nodes that take real input are declared as
+        // such.  This is particularly important for leaf nodes, since
+        // kernelio debugging depends on knowing the correct type of the
+        // array to print.
+        if(node->scheme == CS_KERNEL_COPY_R_TO_CMPLX)
+            node->inArrayType = rocfft_array_type_real;
 
-    // for nodes that uses bluestein buffer
-    auto setBluesteinOffset = [node](size_t& offset) {
-        for(auto p = node->parent; p != nullptr; p = p->parent)
-        {
-            if(p->iOffset)
+        // for nodes that uses bluestein buffer
+        auto setBluesteinOffset = [node](size_t& offset) {
+            for(auto p = node->parent; p != nullptr; p = p->parent)
             {
-                offset = p->iOffset;
-                break;
-            }
-            else if(p->oOffset)
-            {
-                offset = p->oOffset;
-                break;
+                if(p->iOffset)
+                {
+                    offset = p->iOffset;
+                    break;
+                }
+                else if(p->oOffset)
+                {
+                    offset = p->oOffset;
+                    break;
+                }
             }
-        }
-    };
-    if(node->obIn == OB_TEMP_BLUESTEIN)
-        setBluesteinOffset(node->iOffset);
-    else
-        node->iOffset = 0;
-    if(node->obOut == OB_TEMP_BLUESTEIN)
-        setBluesteinOffset(node->oOffset);
-    else
-        node->oOffset = 0;
+        };
+        if(node->obIn == OB_TEMP_BLUESTEIN)
+            setBluesteinOffset(node->iOffset);
+        else
+            node->iOffset = 0;
+        if(node->obOut == OB_TEMP_BLUESTEIN)
+            setBluesteinOffset(node->oOffset);
+        else
+            node->oOffset = 0;
 
-    // keep going backward to next node, skipping over chirp setup nodes
-    int nextExecSeqID = execSeqID;
-    while(nextExecSeqID > 0)
-    {
-        --nextExecSeqID;
-        auto nextNode = execSeq[nextExecSeqID];
-        if(!nextNode->IsBluesteinChirpSetup() || execPlan.IsChirpPlan)
-        {
-            parent->Backtracking(execPlan, nextExecSeqID);
-            return;
-        }
+        // the first node (or the first after chirp setup nodes, which
+        // are disconnected from the rest of the data flow) needs to
+        // use root input type
+        if(i == 0 && node->parent && node != node->parent->childNodes.front().get())
+            node->inArrayType = execPlan.rootPlan->inArrayType;
     }
-
-    // if we're here, then 'node' must have already been the first
-    // node (and had its input set properly), or it's preceded only
-    // by chirp setup nodes.  in that case, we'll need to use root
-    // input type since the setup nodes are disconnected from the
-    // rest of the data flow.
-    if(node->parent && node != node->parent->childNodes.front().get())
-        node->inArrayType = execPlan.rootPlan->inArrayType;
 }
 
 // test if rootArrayType == testArrayType,
@@ -391,104 +380,606 @@ bool AssignmentPolicy::CheckAssignmentValid(ExecPlan& execPlan)
                                    node->batch,
                                    node->oDist);
         }
-    };
+    };
+
+    size_t sizeBufIn  = 0;
+    size_t sizeBufOut = 0;
+    if(execPlan.rootPlan->placement == rocfft_placement_notinplace)
+    {
+        sizeBufIn  = getBufSize(execPlan.rootPlan.get(), true);
+        sizeBufOut = getBufSize(execPlan.rootPlan.get(), false);
+    }
+    else
+        sizeBufOut = std::max(getBufSize(execPlan.rootPlan.get(), true),
+                              getBufSize(execPlan.rootPlan.get(), false));
+
+    for(auto& curr : execPlan.execSeq)
+    {
+        auto currSizeBufOut = getBufSize(curr, false);
+        if((curr->obOut == OB_USER_IN && currSizeBufOut > sizeBufIn)
+           || (curr->obOut == OB_USER_OUT && currSizeBufOut > sizeBufOut))
+        {
+            // std::cout << "buffer access violation, re-assign" << std::endl;
+            return false;
+        }
+
+        if(curr->placement == rocfft_placement_inplace)
+        {
+            const int infact  = curr->inArrayType == rocfft_array_type_real ? 1 : 2;
+            const int outfact = curr->outArrayType == rocfft_array_type_real ? 1 : 2;
+            for(size_t i = 0; i < curr->inStride.size(); i++)
+            {
+                if(outfact * curr->inStride[i] != infact * curr->outStride[i])
+                {
+                    return false;
+                }
+            }
+        }
+
+        // assignment already respects allowInplace and
+        // allowOutofplace flags on leaf nodes.  now, check that
+        // internal nodes also respect those flags.
+        //
+        // we're only iterating over leaf nodes in execSeq.  to
+        // ensure we only check parent flags once, check the parent's
+        // flags for any node that's the last child of its parent.
+        auto isLastChildOfParent = [](TreeNode* node) {
+            return node->parent && node->parent->childNodes.back().get() == node;
+        };
+        auto ptr = curr;
+        while(isLastChildOfParent(ptr))
+        {
+            auto parent = ptr->parent;
+            if(!parent->isPlacementAllowed(parent->placement))
+                return false;
+            ptr = parent;
+        }
+    }
+
+    return true;
+}
+
+void AssignmentPolicy::CollectPlacementNodes(ExecPlan& execPlan)
+{
+    auto& execSeq   = execPlan.execSeq;
+    auto& fuseShims = execPlan.fuseShims;
+
+    placementNodes.clear();
+    for(size_t i = 0; i < execSeq.size(); ++i)
+    {
+        auto node = execSeq[i];
+        if(!execPlan.IsChirpPlan && node->IsBluesteinChirpSetup())
+        {
+            // chirp setup nodes must use bluestein buffer, not
+            // connected to other nodes, so just set their buffers
+            // directly and don't search over them
+            if(node->typeBlue != BT_MULTI_KERNEL_FUSED)
+            {
+                node->obIn         = OB_TEMP_BLUESTEIN;
+                node->inArrayType  = rocfft_array_type_complex_interleaved;
+                node->obOut        = OB_TEMP_BLUESTEIN;
+                node->outArrayType = rocfft_array_type_complex_interleaved;
+                node->placement    = rocfft_placement_inplace;
+            }
+            continue;
+        }
+        placementNodes.push_back(i);
+    }
+
+    // Find which nodes each shim's fusability depends on.  Walk
+    // backwards through the nodes and shims together, pairing the
+    // last node of each shim with its first node.
+    shimBegin.assign(placementNodes.size(), nullptr);
+    shimEnd.assign(placementNodes.size(), nullptr);
+    shimOrderError = false;
+    int                   shimID = static_cast<int>(fuseShims.size()) - 1;
+    std::optional<size_t> lastPos;
+    for(size_t pos = placementNodes.size(); pos > 0 && shimID >= 0; --pos)
+    {
+        auto  node = execSeq[placementNodes[pos - 1]];
+        auto& shim = fuseShims[shimID];
+        if(node == shim->LastFuseNode())
+        {
+            if(lastPos)
+            {
+                shimOrderError = true;
+                return;
+            }
+            lastPos = pos - 1;
+        }
+        else if(node == shim->FirstFuseNode())
+        {
+            if(!lastPos)
+            {
+                shimOrderError = true;
+                return;
+            }
+            shimBegin[pos - 1] = shim;
+            shimEnd[*lastPos]  = shim;
+            lastPos.reset();
+            --shimID;
+        }
+    }
+}
+
+std::vector<PlacementMove> AssignmentPolicy::PlacementMoves(ExecPlan&             execPlan,
+                                                            const PlacementState& state)
+{
+    std::vector<PlacementMove> moves;
+
+    size_t    seqID   = placementNodes[state.step];
+    TreeNode* curNode = execPlan.execSeq[seqID];
+
+    // inplace first, any node dis-allowing inplace will skip this.
+    // If buffer is not available (when USER_IN is read-only), skip as well.
+    if(curNode->isPlacementAllowed(rocfft_placement_inplace) && availableBuffers.count(state.buf)
+       && ValidOutBuffer(execPlan, {seqID, state.buf, state.type}, *curNode, state.buf, state.type))
+    {
+        moves.push_back({state.buf, state.type});
+    }
+
+    // out-of-place, any node dis-allowing notinplace will skip this
+    if(curNode->isPlacementAllowed(rocfft_placement_notinplace))
+    {
+        // try every available output buffer, except for the input
+        for(auto testOutputBuf : availableBuffers)
+        {
+            if(testOutputBuf == state.buf)
+                continue;
+
+            // try every available array type
+            for(auto testOutType : availableArrayTypes)
+            {
+                if(ValidOutBuffer(execPlan,
+                                  {seqID, testOutputBuf, testOutType},
+                                  *curNode,
+                                  testOutputBuf,
+                                  testOutType))
+                    moves.push_back({testOutputBuf, testOutType});
+            }
+        }
+    }
+    return moves;
+}
+
+PlacementCost AssignmentPolicy::ApplyMove(ExecPlan&             execPlan,
+                                          const PlacementState& state,
+                                          const PlacementMove&  move,
+                                          PlacementState&       next)
+{
+    TreeNode* curNode = execPlan.execSeq[placementNodes[state.step]];
+
+    next             = state;
+    next.step        = state.step + 1;
+    next.buf         = move.outBuf;
+    next.type        = move.oType;
+    next.usedBuffers = state.usedBuffers | state.buf | move.outBuf;
+
+    PlacementCost cost;
+    cost.numInplace         = state.buf == move.outBuf;
+    cost.numTypeSwitching   = state.type != move.oType;
+    cost.numPaddableTempOps = (IsPaddableTempBuffer(state.buf) && curNode->PaddingBenefitsInput())
+                              + (IsPaddableTempBuffer(move.outBuf)
+                                 && curNode->PaddingBenefitsOutput());
+
+    if(shimBegin[state.step])
+    {
+        next.shimInBuf  = state.buf;
+        next.shimOutBuf = move.outBuf;
+    }
+    if(shimEnd[state.step])
+    {
+        cost.numFusedNodes = shimEnd[state.step]->PlacementFusable(
+            next.shimInBuf, next.shimOutBuf, move.outBuf);
+        next.shimInBuf  = OB_UNINIT;
+        next.shimOutBuf = OB_UNINIT;
+    }
+    return cost;
+}
+
+std::optional<PlacementCost> AssignmentPolicy::BestCost(ExecPlan&             execPlan,
+                                                        const PlacementState& state)
+{
+    auto key    = state.Key();
+    auto cached = bestCostCache.find(key);
+    if(cached != bestCostCache.end())
+        return cached->second;
+
+    std::optional<PlacementCost> best;
+
+    // Terminal Condition
+    // we've done all, check if this path works (matches the rootPlan's out)
+    if(state.step == placementNodes.size())
+    {
+        // the out buf and array type must match.
+        //
+        // If we are in the second try (adding T Buffer) or third try
+        // (adding C Buffer) but we don't have it in the path: this
+        // means we've already tried this path in the previous try.
+        if(state.buf == execPlan.rootPlan->obOut
+           && EquivalentArrayType(execPlan.rootPlan->outArrayType, state.type)
+           && (!mustUseTBuffer || (state.usedBuffers & OB_TEMP))
+           && (!mustUseCBuffer || (state.usedBuffers & OB_TEMP_CMPLX_FOR_REAL)))
+        {
+            if(shimOrderError)
+                throw std::runtime_error(
+                    "Tracing FusedShimsNode error when backtracking assignment path");
+            best.emplace();
+            best->numUsedBuffers = std::bitset<5>(state.usedBuffers).count();
+        }
+    }
+    else
+    {
+        for(const auto& move : PlacementMoves(execPlan, state))
+        {
+            PlacementState next;
+            auto           cost = ApplyMove(execPlan, state, move, next);
+            auto           rest = BestCost(execPlan, next);
+            if(!rest)
+                continue;
+            cost += *rest;
+            if(!best || cost.Better(*best))
+                best = cost;
+        }
+    }
+
+    bestCostCache.emplace(key, best);
+    return best;
+}
+
+void AssignmentPolicy::UpdateWinnerFromValidPaths(ExecPlan& execPlan)
+{
+    // Best-first search over paths.  Since BestCost gives the exact
+    // best score of finishing a partial path, complete paths come
+    // out of the queue sorted by score.  Ties are broken by the
+    // order of moves, so equally-scored paths come out in the order
+    // a depth-first enumeration would visit them.
+    struct PartialPath
+    {
+        PlacementCost              estimate;
+        std::vector<uint8_t>       moveIndexes;
+        PlacementCost              cost;
+        PlacementState             state;
+        std::vector<PlacementMove> moves;
+    };
+    auto worse = [](const PartialPath& lhs, const PartialPath& rhs) {
+        if(rhs.estimate.Better(lhs.estimate))
+            return true;
+        if(lhs.estimate.Better(rhs.estimate))
+            return false;
+        return lhs.moveIndexes > rhs.moveIndexes;
+    };
+    std::priority_queue<PartialPath, std::vector<PartialPath>, decltype(worse)> queue(worse);
+
+    PlacementState start;
+    start.buf  = execPlan.rootPlan->obIn;
+    start.type = is_complex_planar(execPlan.rootPlan->inArrayType)
+                     ? rocfft_array_type_complex_planar
+                     : rocfft_array_type_complex_interleaved;
+    auto startCost = BestCost(execPlan, start);
+    if(!startCost)
+        return;
+    queue.push({*startCost, {}, {}, start, {}});
+
+    while(!queue.empty())
+    {
+        auto path = queue.top();
+        queue.pop();
+
+        if(path.state.step < placementNodes.size())
+        {
+            auto moves = PlacementMoves(execPlan, path.state);
+            for(size_t i = 0; i < moves.size(); ++i)
+            {
+                PartialPath next;
+                next.cost = path.cost;
+                next.cost += ApplyMove(execPlan, path.state, moves[i], next.state);
+                auto rest = BestCost(execPlan, next.state);
+                if(!rest)
+                    continue;
+                next.estimate = next.cost;
+                next.estimate += *rest;
+                next.moveIndexes = path.moveIndexes;
+                next.moveIndexes.push_back(i);
+                next.moves = path.moves;
+                next.moves.push_back(moves[i]);
+                queue.push(std::move(next));
+            }
+            continue;
+        }
+
+        // skip it if this doesn't outdo the winner of prev. try (prev
+        // try = fewer buffers).  Paths are sorted by fusions first,
+        // so no later path will either.
+        if(static_cast<int>(path.estimate.numFusedNodes) <= numCurWinnerFusions)
+            return;
+
+        // fill the assignment to tree-node from the path
+        ApplyPath(execPlan, path.moves);
+
+        // assign the stride things. remember to refresh for the internal nodes
+        execPlan.rootPlan->RefreshTree();
+        // TODO- Next big thing to generalize
+        execPlan.rootPlan->AssignParams();
+
+        // Act as a final guard to check the stride and dist
+        // Ideally, all the valid-tests were handled in the AssignBuffers,
+        // So the first candidate is the result.
+        // But some inplace r2c/c2r are tricky and not easy to handle
+        // (most of them are dist and stride)
+        // This final guard somehow is the "error-detector"...
+        // TODO- Eventually we should make the AssignBuffer more robust
+        if(CheckAssignmentValid(execPlan))
+        {
+            numCurWinnerFusions = path.estimate.numFusedNodes;
+            return;
+        }
+    }
+}
+
+size_t PlacementTrace::BackwardCalcFusions(ExecPlan&       execPlan,
+                                           int             curFuseShimID,
+                                           PlacementTrace* shimLastNode)
+{
+    numFusedNodes = 0;
+    if(curFuseShimID < 0)
+        return 0;
+
+    auto& shim = execPlan.fuseShims[curFuseShimID];
+
+    // if this node is the last node of the fuseShim, pass self as shimLastNode and continue going back...
+    if(curNode == shim->LastFuseNode())
+    {
+        // should not have shimLastNode set, and should not have a null parent
+        if(shimLastNode != nullptr || parent == nullptr)
+            throw std::runtime_error(
+                "Tracing FusedShimsNode error when backtracking assignment path");
+        numFusedNodes = parent->BackwardCalcFusions(execPlan, curFuseShimID, this);
+    }
+    // if this node is the first node of the fuseShim, check if fusion can be done with the placement
+    else if(curNode == shim->FirstFuseNode())
+    {
+        // we should already have a shimLastNode
+        if(!shimLastNode)
+            throw std::runtime_error(
+                "Tracing FusedShimsNode error when backtracking assignment path");
+        size_t numFusion
+            = shim->PlacementFusable(this->inBuf, this->outBuf, shimLastNode->outBuf) ? 1 : 0;
+        numFusedNodes
+            = parent ? parent->BackwardCalcFusions(execPlan, curFuseShimID - 1, nullptr) + numFusion
+                     : numFusion;
+    }
+    // this node is either outside of a shim (shimLastNode == nullptr)
+    // or inside of a shim(shimLastNode != nullptr), simply keep on going back...
+    else
+    {
+        numFusedNodes
+            = parent ? parent->BackwardCalcFusions(execPlan, curFuseShimID, shimLastNode) : 0;
+    }
+
+    return numFusedNodes;
+}
+
+size_t PlacementTrace::NumPaddableTempOps() const
+{
+    auto   trace       = this;
+    size_t tempOpCount = 0;
+    while(trace != nullptr && trace->curNode != nullptr)
+    {
+        tempOpCount += IsPaddableTempBuffer(trace->inBuf) && trace->curNode->PaddingBenefitsInput();
+        tempOpCount
+            += IsPaddableTempBuffer(trace->outBuf) && trace->curNode->PaddingBenefitsOutput();
+        trace = trace->parent;
+    }
+    return tempOpCount;
+}
+
+void PlacementTrace::Backtracking(ExecPlan& execPlan, int execSeqID)
+{
+    const auto& execSeq = execPlan.execSeq;
+
+    if((execSeqID < 0) || (curNode != execSeq[execSeqID]))
+        throw std::runtime_error("Backtracking error: accessing invalid resource");
+
+    auto node          = execSeq[execSeqID];
+    node->placement    = this->isInplace ? rocfft_placement_inplace : rocfft_placement_notinplace;
+    node->obIn         = this->inBuf;
+    node->obOut        = this->outBuf;
+    node->inArrayType  = this->iType;
+    node->outArrayType = this->oType;
+
+    // Even-length internal nodes have real data for input or output but
+    // child nodes treat it as complex interleaved
+    if(node->parent
+       && (node->parent->scheme == CS_REAL_TRANSFORM_EVEN || node->parent->scheme == CS_REAL_2D_EVEN
+           || node->parent->scheme == CS_REAL_3D_EVEN))
+    {
+        // forward transform, first node (if it's a leaf) needs to treat real input as complex
+        if(node->direction == -1 && node == node->parent->childNodes.front().get()
+           && node->childNodes.empty())
+            node->inArrayType = rocfft_array_type_complex_interleaved;
+        // inverse transform, last node (if it's a leaf) needs to treat real output as complex
+        if(node->direction == 1 && node == node->parent->childNodes.back().get()
+           && node->childNodes.empty())
+            node->outArrayType = rocfft_array_type_complex_interleaved;
+    }
+
+    // Ensure that all nodes that take real input are declared as
+    // such.
+    if(node->scheme == CS_KERNEL_COPY_R_TO_CMPLX)
+        node->inArrayType = rocfft_array_type_real;
+
+    // for nodes that uses bluestein buffer
+    auto setBluesteinOffset = [node](size_t& offset) {
+        for(auto p = node->parent; p != nullptr; p = p->parent)
+        {
+            if(p->iOffset)
+            {
+                offset = p->iOffset;
+                break;
+            }
+            else if(p->oOffset)
+            {
+                offset = p->oOffset;
+                break;
+            }
+        }
+    };
+    if(node->obIn == OB_TEMP_BLUESTEIN)
+        setBluesteinOffset(node->iOffset);
+    else
+        node->iOffset = 0;
+    if(node->obOut == OB_TEMP_BLUESTEIN)
+        setBluesteinOffset(node->oOffset);
+    else
+        node->oOffset = 0;
+
+    // keep going backward to next node, skipping over chirp setup nodes
+    int nextExecSeqID = execSeqID;
+    while(nextExecSeqID > 0)
+    {
+        --nextExecSeqID;
+        auto nextNode = execSeq[nextExecSeqID];
+        if(!nextNode->IsBluesteinChirpSetup() || execPlan.IsChirpPlan)
+        {
+            parent->Backtracking(execPlan, nextExecSeqID);
+            return;
+        }
+    }
+
+    // if we're here, then 'node' must have already been the first
+    // node (and had its input set properly), or it's preceded only
+    // by chirp setup nodes.  in that case, we'll need to use root
+    // input type since the setup nodes are disconnected from the
+    // rest of the data flow.
+    if(node->parent && node != node->parent->childNodes.front().get())
+        node->inArrayType = execPlan.rootPlan->inArrayType;
+}
+
+void AssignmentPolicy::Enumerate(PlacementTrace*   parent,
+                                 ExecPlan&         execPlan,
+                                 size_t            curSeqID,
+                                 OperatingBuffer   startBuf,
+                                 rocfft_array_type startType)
+{
+    auto& execSeq   = execPlan.execSeq;
+    auto& fuseShims = execPlan.fuseShims;
+
+    // Terminal Condition
+    // we've done all, check if this path works (matches the rootPlan's out)
+    if(curSeqID >= execSeq.size())
+    {
+        auto endBuf       = execPlan.rootPlan->obOut;
+        auto endArrayType = execPlan.rootPlan->outArrayType;
+
+        // the out buf and array type must match
+        if(parent->outBuf == endBuf && EquivalentArrayType(endArrayType, parent->oType))
+        {
+            // we are in the second try (adding T Buffer) but we don't have it in the path:
+            // this means we've already tried this path in the previous try.
+            if(mustUseTBuffer && parent->usedBuffers.count(OB_TEMP) == 0)
+                return;
+
+            // we are in the third try (adding C Buffer) but we don't have it in the path:
+            // this means we've already tried this path in the previous try.
+            if(mustUseCBuffer && parent->usedBuffers.count(OB_TEMP_CMPLX_FOR_REAL) == 0)
+                return;
+
+            // See how many fusions can be done in this path
+            int numFusions = parent->BackwardCalcFusions(execPlan, fuseShims.size() - 1, nullptr);
+            // skip it if this doesn't outdo the winner of prev. try (prev try = fewer buffers)
+            if(numCurWinnerFusions >= numFusions)
+                return;
+
+            // set the oType to its original type of RootPlan (for example, change internal-CP to HP)
+            parent->oType = endArrayType;
+
+            winnerCandidates.emplace_back(parent);
+        }
+        return;
+    }
 
-    size_t sizeBufIn  = 0;
-    size_t sizeBufOut = 0;
-    if(execPlan.rootPlan->placement == rocfft_placement_notinplace)
+    TreeNode* curNode = execSeq[curSeqID];
+
+    // chirp setup nodes were already given their buffers by
+    // CollectPlacementNodes, and are not connected to other nodes.
+    // NOTE that it is important we propagate startBuf, startType to
+    // the next node.
+    if(!execPlan.IsChirpPlan && curNode->IsBluesteinChirpSetup())
     {
-        sizeBufIn  = getBufSize(execPlan.rootPlan.get(), true);
-        sizeBufOut = getBufSize(execPlan.rootPlan.get(), false);
+        Enumerate(parent, execPlan, curSeqID + 1, startBuf, startType);
+        return;
     }
-    else
-        sizeBufOut = std::max(getBufSize(execPlan.rootPlan.get(), true),
-                              getBufSize(execPlan.rootPlan.get(), false));
 
-    for(auto& curr : execPlan.execSeq)
+    // Branch of using inplace, any node dis-alllowing inplace will skip this
+    if(curNode->isPlacementAllowed(rocfft_placement_inplace))
     {
-        auto currSizeBufOut = getBufSize(curr, false);
-        if((curr->obOut == OB_USER_IN && currSizeBufOut > sizeBufIn)
-           || (curr->obOut == OB_USER_OUT && currSizeBufOut > sizeBufOut))
-        {
-            // std::cout << "buffer access violation, re-assign" << std::endl;
-            return false;
-        }
-
-        if(curr->placement == rocfft_placement_inplace)
+        // If buffer is not available (when USER_IN is read-only), skip as well.
+        if(availableBuffers.count(startBuf))
         {
-            const int infact  = curr->inArrayType == rocfft_array_type_real ? 1 : 2;
-            const int outfact = curr->outArrayType == rocfft_array_type_real ? 1 : 2;
-            for(size_t i = 0; i < curr->inStride.size(); i++)
+            NodeBufTestCacheKey cKey{curSeqID, startBuf, startType};
+            if(ValidOutBuffer(execPlan, cKey, *curNode, startBuf, startType))
             {
-                if(outfact * curr->inStride[i] != infact * curr->outStride[i])
-                {
-                    return false;
-                }
+                // Create/Push a PlacementTrace for an Inplace-Operation (others recurs)
+                parent->branches.emplace_back(std::make_unique<PlacementTrace>(
+                    curNode, startBuf, startBuf, startType, startType, parent));
+                // advance to next
+                Enumerate(
+                    parent->branches.back().get(), execPlan, curSeqID + 1, startBuf, startType);
             }
         }
+    }
 
-        // assignment already respects allowInplace and
-        // allowOutofplace flags on leaf nodes.  now, check that
-        // internal nodes also respect those flags.
-        //
-        // we're only iterating over leaf nodes in execSeq.  to
-        // ensure we only check parent flags once, check the parent's
-        // flags for any node that's the last child of its parent.
-        auto isLastChildOfParent = [](TreeNode* node) {
-            return node->parent && node->parent->childNodes.back().get() == node;
-        };
-        auto ptr = curr;
-        while(isLastChildOfParent(ptr))
+    // Branch of using out-of-place, any node dis-alllowing notinplace will skip this
+    if(curNode->isPlacementAllowed(rocfft_placement_notinplace))
+    {
+        // try every available output buffer
+        for(auto testOutputBuf : availableBuffers)
         {
-            auto parent = ptr->parent;
-            if(!parent->isPlacementAllowed(parent->placement))
-                return false;
-            ptr = parent;
-        }
-    }
+            // except for startBuf, since this is a out-of-place try
+            if(testOutputBuf == startBuf)
+                continue;
 
-    return true;
+            // try every available array type
+            for(auto testOutType : availableArrayTypes)
+            {
+                NodeBufTestCacheKey cKey{curSeqID, testOutputBuf, testOutType};
+                if(ValidOutBuffer(execPlan, cKey, *curNode, testOutputBuf, testOutType))
+                {
+                    // Create/Push a PlacementTrace for OuOfPlace-Operation (others recurs)
+                    parent->branches.emplace_back(std::make_unique<PlacementTrace>(
+                        curNode, startBuf, testOutputBuf, startType, testOutType, parent));
+                    // advance to next
+                    Enumerate(parent->branches.back().get(),
+                              execPlan,
+                              curSeqID + 1,
+                              testOutputBuf,
+                              testOutType);
+                }
+            } // end of testing each array type
+        } // end of testing each out buffer
+    } // end of out-of-place
 }
 
-void AssignmentPolicy::UpdateWinnerFromValidPaths(ExecPlan& execPlan)
+void AssignmentPolicy::UpdateWinnerFromCandidates(ExecPlan& execPlan)
 {
-    if(winnerCandidates.empty())
-        return;
-
-    //std::cout << "total candidates: " << winnerCandidates.size() << std::endl;
-
-    // sort the candidate, front is the best
-    std::sort(
-        winnerCandidates.begin(), winnerCandidates.end(), [](const auto& lhs, const auto& rhs) {
-            // compare numFusedNodes (more is better)
-            if(lhs->numFusedNodes > rhs->numFusedNodes)
-                return true;
-            if(lhs->numFusedNodes < rhs->numFusedNodes)
-                return false;
-
-            // if tie, we still choose the one with less buffers
-            if(lhs->NumUsedBuffers() < rhs->NumUsedBuffers())
-                return true;
-            if(lhs->NumUsedBuffers() > rhs->NumUsedBuffers())
-                return false;
-
-            // once we do have temp buffers, more temp ops that have
-            // better opportunities for padding are generally better,
-            // since we can avoid more bad memory access patterns
-            auto leftTempOps  = lhs->NumPaddableTempOps();
-            auto rightTempOps = rhs->NumPaddableTempOps();
-            if(leftTempOps != rightTempOps)
-                return leftTempOps > rightTempOps;
-
-            // if tie, we still choose the one with more inplace
-            if(lhs->numInplace > rhs->numInplace)
-                return true;
-            if(lhs->numInplace < rhs->numInplace)
-                return false;
-
-            // if tie, compare numTypeSwitching (less is better)
-            return lhs->numTypeSwitching < rhs->numTypeSwitching;
-        });
+    // sort the candidates, front is the best.  the sort is stable so
+    // that equally-scored paths are tried in the order they were
+    // enumerated.
+    auto cost = [](const PlacementTrace* trace) {
+        PlacementCost c;
+        c.numFusedNodes      = trace->numFusedNodes;
+        c.numUsedBuffers     = trace->usedBuffers.size();
+        c.numPaddableTempOps = trace->NumPaddableTempOps();
+        c.numInplace         = trace->numInplace;
+        c.numTypeSwitching   = trace->numTypeSwitching;
+        return c;
+    };
+    std::stable_sort(winnerCandidates.begin(),
+                     winnerCandidates.end(),
+                     [&cost](const PlacementTrace* lhs, const PlacementTrace* rhs) {
+                         return cost(lhs).Better(cost(rhs));
+                     });
 
     for(auto& winner : winnerCandidates)
     {
@@ -497,25 +988,35 @@ void AssignmentPolicy::UpdateWinnerFromValidPaths(ExecPlan& execPlan)
 
         // assign the stride things. remember to refresh for the internal nodes
         execPlan.rootPlan->RefreshTree();
-        // TODO- Next big thing to generalize
         execPlan.rootPlan->AssignParams();
 
-        // Act as a final guard to check the stride and dist
-        // Ideally, all the valid-tests were handled in the AssignBuffers,
-        // So the first candidate is the result.
-        // But some inplace r2c/c2r are tricky and not easy to handle (most of them are dist and stride)
-        // This final guard somehow is the "error-detector"...
-        // TODO- Eventually we should make the AssignBuffer more robust
         if(CheckAssignmentValid(execPlan))
         {
-            // std::cout << "num Fused: " << winner->numFusedNodes;
-            // std::cout << ", num IP:" << winner->numInplace;
-            // std::cout << std::endl;
             numCurWinnerFusions = winner->numFusedNodes;
             return;
         }
     }
-    return;
+}
+
+void AssignmentPolicy::SearchPaths(ExecPlan& execPlan)
+{
+    if(!exhaustiveSearch)
+    {
+        bestCostCache.clear();
+        UpdateWinnerFromValidPaths(execPlan);
+        return;
+    }
+
+    PlacementTrace root;
+    root.outBuf = execPlan.rootPlan->obIn;
+    root.oType  = is_complex_planar(execPlan.rootPlan->inArrayType)
+                      ? rocfft_array_type_complex_planar
+                      : rocfft_array_type_complex_interleaved;
+    winnerCandidates.clear();
+    Enumerate(&root, execPlan, 0, root.outBuf, root.oType);
+    UpdateWinnerFromCandidates(execPlan);
+    // candidates point into the tree under root
+    winnerCandidates.clear();
 }
 
 void AssignmentPolicy::FindBluesteinFusedNodes(ExecPlan&               execPlan,
@@ -583,6 +1084,8 @@ void AssignmentPolicy::AssignChirpBuffers(ExecPlan& execPlan)
 
 void AssignmentPolicy::AssignBuffers(ExecPlan& execPlan)
 {
+    exhaustiveSearch = rocfft_getenv("ROCFFT_INTERNAL_EXHAUSTIVE_ASSIGNMENT") == "1";
+
     AssignChirpBuffers(execPlan);
 
     AssignBuffers_internal(execPlan);
@@ -596,7 +1099,6 @@ void AssignmentPolicy::AssignBuffers_internal(ExecPlan& execPlan)
     mustUseCBuffer      = false;
 
     // remember to clear the container either in the beginning or at the end
-    winnerCandidates.clear();
     availableBuffers.clear();
     availableArrayTypes.clear();
     node_buf_test_cache.clear();
@@ -633,13 +1135,10 @@ void AssignmentPolicy::AssignBuffers_internal(ExecPlan& execPlan)
         }
     });
 
+    CollectPlacementNodes(execPlan);
+
     // First try !
-    PlacementTrace dummyRoot;
-    dummyRoot.outBuf = execPlan.rootPlan->obIn;
-    dummyRoot.oType  = aliasInType;
-    Enumerate(&dummyRoot, execPlan, 0, dummyRoot.outBuf, dummyRoot.oType);
-    // update num-of-winner's-fusions from winnerCandidates list
-    UpdateWinnerFromValidPaths(execPlan);
+    SearchPaths(execPlan);
     if(numCurWinnerFusions != -1)
     {
         // we already satisfy the strategy, so don't need to go further
@@ -657,15 +1156,12 @@ void AssignmentPolicy::AssignBuffers_internal(ExecPlan& execPlan)
     //    (strategy > rocfft_optimize_min_buffer)
     mustUseTBuffer = true;
     availableBuffers.insert(OB_TEMP);
-    dummyRoot.branches.clear();
-    winnerCandidates.clear();
-    Enumerate(&dummyRoot, execPlan, 0, dummyRoot.outBuf, dummyRoot.oType);
     // NB:
-    //   in this ABT try, winnerCandidates must contain T-buf (mustUseTBuffer=true)
-    //   and it's possible winnerCandidates is empty because there is no new path giving more fusions.
+    //   in this ABT try, valid paths must contain T-buf (mustUseTBuffer=true)
+    //   and it's possible there are none because there is no new path giving more fusions.
     //   So num-of-winner's-fusions won't be updated, but we may have a winner from prev try
     //   in this case, we should return if the strategy is "balance".
-    UpdateWinnerFromValidPaths(execPlan);
+    SearchPaths(execPlan);
     if(numCurWinnerFusions != -1)
     {
         // we already satisfy the strategy, so don't need to go further
@@ -680,12 +1176,9 @@ void AssignmentPolicy::AssignBuffers_internal(ExecPlan& execPlan)
     mustUseCBuffer = true;
     availableBuffers.insert(OB_TEMP_CMPLX_FOR_REAL);
     availableArrayTypes.insert(rocfft_array_type_complex_interleaved);
-    dummyRoot.branches.clear();
-    winnerCandidates.clear();
-    Enumerate(&dummyRoot, execPlan, 0, dummyRoot.outBuf, dummyRoot.oType);
     // NB:
-    //   in this ABTC try, winnerCandidates must contain C-buf (mustUseCBuffer=true)
-    UpdateWinnerFromValidPaths(execPlan);
+    //   in this ABTC try, valid paths must contain C-buf (mustUseCBuffer=true)
+    SearchPaths(execPlan);
     if(numCurWinnerFusions != -1)
         return;
 
@@ -693,137 +1186,6 @@ void AssignmentPolicy::AssignBuffers_internal(ExecPlan& execPlan)
     throw std::runtime_error("Can't find valid buffer assignment with current buffers.");
 }
 
-void AssignmentPolicy::Enumerate(PlacementTrace*   parent,
-                                 ExecPlan&         execPlan,
-                                 size_t            curSeqID,
-                                 OperatingBuffer   startBuf,
-                                 rocfft_array_type startType)
-{
-    auto& execSeq   = execPlan.execSeq;
-    auto& fuseShims = execPlan.fuseShims;
-
-    // Terminal Condition
-    // we've done all, check if this path works (matches the rootPlan's out)
-    if(curSeqID >= execSeq.size())
-    {
-        auto endBuf       = execPlan.rootPlan->obOut;
-        auto endArrayType = execPlan.rootPlan->outArrayType;
-
-        // the out buf and array type must match
-        if(parent->outBuf == endBuf && EquivalentArrayType(endArrayType, parent->oType))
-        {
-            // we are in the second try (adding T Buffer) but we don't have it in the path:
-            // this means we've already tried this path in the previous try.
-            if(mustUseTBuffer && parent->usedBuffers.count(OB_TEMP) == 0)
-                return;
-
-            // we are in the third try (adding C Buffer) but we don't have it in the path:
-            // this means we've already tried this path in the previous try.
-            if(mustUseCBuffer && parent->usedBuffers.count(OB_TEMP_CMPLX_FOR_REAL) == 0)
-                return;
-
-            // See how many fusions can be done in this path
-            int numFusions = parent->BackwardCalcFusions(execPlan, fuseShims.size() - 1, nullptr);
-            // skip it if this doesn't outdo the winner of prev. try (prev try = fewer buffers)
-            if(numCurWinnerFusions >= numFusions)
-                return;
-
-            // set the oType to its original type of RootPlan (for example, change internal-CP to HP)
-            parent->oType = endArrayType;
-
-            winnerCandidates.emplace_back(parent);
-            // debug
-            // parent->Print(*LogSingleton::GetInstance().GetTraceOS());
-        }
-        return;
-    }
-
-    TreeNode* curNode = execSeq[curSeqID];
-
-    // For chirp scheme, the startBuf/AType can differ from parent's, so we don't do this
-    // auto startBuf  = parent->outBuf;
-    // auto startType = parent->oType;
-
-    if(!execPlan.IsChirpPlan && curNode->IsBluesteinChirpSetup())
-    {
-        auto blueNode = curNode;
-        // bluestein setup kernels can input/output bluestein buffer only.
-        do
-        {
-            if(blueNode->typeBlue != BT_MULTI_KERNEL_FUSED)
-            {
-                // chirp setup nodes must use bluestein buffer, not
-                // connected to other nodes, so just set their buffers
-                // directly and don't enumerate them with PlacementTraces
-                blueNode->obIn         = OB_TEMP_BLUESTEIN;
-                blueNode->inArrayType  = rocfft_array_type_complex_interleaved;
-                blueNode->obOut        = OB_TEMP_BLUESTEIN;
-                blueNode->outArrayType = rocfft_array_type_complex_interleaved;
-                blueNode->placement    = rocfft_placement_inplace;
-            }
-
-            ++curSeqID;
-            blueNode = execSeq[curSeqID];
-        } while(blueNode->IsBluesteinChirpSetup());
-
-        // blueNode is now no longer a bluestein setup node
-
-        // advance to next
-        // NOTE that it is important we propagate startBuf, startType to next node
-        Enumerate(parent, execPlan, curSeqID, startBuf, startType);
-        return;
-    }
-
-    // Branch of using inplace, any node dis-alllowing inplace will skip this
-    if(curNode->isPlacementAllowed(rocfft_placement_inplace))
-    {
-        // If buffer is not available (when USER_IN is read-only), skip as well.
-        if(availableBuffers.count(startBuf))
-        {
-            NodeBufTestCacheKey cKey{curSeqID, startBuf, startType};
-            if(ValidOutBuffer(execPlan, cKey, *curNode, startBuf, startType))
-            {
-                // Create/Push a PlacementTrace for an Inplace-Operation (others recurs)
-                parent->branches.emplace_back(std::make_unique<PlacementTrace>(
-                    curNode, startBuf, startBuf, startType, startType, parent));
-                // advance to next
-                Enumerate(
-                    parent->branches.back().get(), execPlan, curSeqID + 1, startBuf, startType);
-            }
-        }
-    }
-
-    // Branch of using out-of-place, any node dis-alllowing notinplace will skip this
-    if(curNode->isPlacementAllowed(rocfft_placement_notinplace))
-    {
-        // try every available output buffer
-        for(auto testOutputBuf : availableBuffers)
-        {
-            // except for startBuf, since this is a out-of-place try
-            if(testOutputBuf == startBuf)
-                continue;
-
-            // try every available array type
-            for(auto testOutType : availableArrayTypes)
-            {
-                NodeBufTestCacheKey cKey{curSeqID, testOutputBuf, testOutType};
-                if(ValidOutBuffer(execPlan, cKey, *curNode, testOutputBuf, testOutType))
-                {
-                    // Create/Push a PlacementTrace for OuOfPlace-Operation (others recurs)
-                    parent->branches.emplace_back(std::make_unique<PlacementTrace>(
-                        curNode, startBuf, testOutputBuf, startType, testOutType, parent));
-                    // advance to next
-                    Enumerate(parent->branches.back().get(),
-                              execPlan,
-                              curSeqID + 1,
-                              testOutputBuf,
-                              testOutType);
-                }
-            } // end of testing each array type
-        } // end of testing each out buffer
-    } // end of out-of-place
-}
-
 // Lengths/strides on tree nodes are usually (but not always) fastest
 // dimension first.  Define a structure that can be sorted
 // fastest-to-slowest, without actually re-sorting the original
@@ -1227,15 +1589,6 @@ void CollectTempBufOps(TreeNode&               node,
     }
 }
 
-static bool IsPaddableTempBuffer(OperatingBuffer buf)
-{
-    // Non-Bluestein temp buffers are candidates for padding.
-    // Skip Bluestein because it has non-obvious rules around
-    // what size of data is actually in the buffer, and it's a
-    // slow fallback path anyway.
-    return buf == OB_TEMP || buf == OB_TEMP_CMPLX_FOR_REAL;
-}
-
 void AssignmentPolicy::PadPlan(ExecPlan& execPlan)
 {
     // for strided FFTs with dist 1, we mess around with dimensions
@@ -1367,17 +1720,3 @@ void AssignmentPolicy::PadPlan(ExecPlan& execPlan)
         }
     });
 }
-
-size_t PlacementTrace::NumPaddableTempOps() const
-{
-    auto   trace       = this;
-    size_t tempOpCount = 0;
-    while(trace != nullptr && trace->curNode != nullptr)
-    {
-        tempOpCount += IsPaddableTempBuffer(trace->inBuf) && trace->curNode->PaddingBenefitsInput();
-        tempOpCount
-            += IsPaddableTempBuffer(trace->outBuf) && trace->curNode->PaddingBenefitsOutput();
-        trace = trace->parent;
-    }
-    return tempOpCount;
-}
@@ -20,30 +20,37 @@
 * THE SOFTWARE.
 *******************************************************************************/
 
+#include "../../shared/concurrency.h"
 #include "../../shared/device_properties.h"
 #include "../../shared/environment.h"
 #include "../../shared/rocfft_hip.h"
 #include "logging.h"
+#include "offline_device.h"
+#include "plan_cache.h"
 #include "repo.h"
 #include "rocfft/rocfft.h"
 #include "rocfft_ostream.hpp"
 #include "rtc_cache.h"
+#include "rtc_compile_pool.h"
+#include "rtc_subprocess.h"
 #include "solution_map.h"
 #include "tuning_helper.h"
+#include <algorithm>
 #include <fcntl.h>
 #include <memory>
 
 /*******************************************************************************
  * Static handle data
  ******************************************************************************/
-int log_trace_fd    = -1;
-int log_bench_fd    = -1;
-int log_profile_fd  = -1;
-int log_plan_fd     = -1;
-int log_kernelio_fd = -1;
-int log_rtc_fd      = -1;
-int log_tuning_fd   = -1;
-int log_graph_fd    = -1;
+int log_trace_fd        = -1;
+int log_bench_fd        = -1;
+int log_profile_fd      = -1;
+int log_plan_fd         = -1;
+int log_kernelio_fd     = -1;
+int log_rtc_fd          = -1;
+int log_tuning_fd       = -1;
+int log_graph_fd        = -1;
+int log_plan_profile_fd = -1;
 
 /**
  *  @brief Logging function
@@ -79,11 +86,37 @@ static void open_log_stream(const char* environment_variable_name, int& log_fd)
     }
 }
 
+// number of plans that rocfft_cache_prefetch builds at once
+static const size_t max_prefetch_threads = 4;
+// number of rocfft_rtc_helper processes kept running for
+// out-of-process compiles
+static const size_t max_rtc_helpers = 4;
+
 // library setup function, called once in program at the start of library use
 rocfft_status rocfft_setup()
 {
     rocfft_ostream::setup();
-    RTCCache::single = std::make_unique<RTCCache>();
+
+    // plan for a device described in a file instead of the current
+    // device, if requested.  read the profile before anything else
+    // is set up, so that there's nothing to tear down if it's bad.
+    try
+    {
+        offline_device_setup();
+    }
+    catch(std::exception& e)
+    {
+        rocfft_cerr << e.what() << std::endl;
+        rocfft_ostream::cleanup();
+        return rocfft_status_failure;
+    }
+
+    RTCCache::single         = std::make_unique<RTCCache>();
+    RTCCompilePool::single   = std::make_unique<RTCCompilePool>(rocfft_concurrency());
+    RTCCompilePool::prefetch = std::make_unique<RTCCompilePool>(
+        std::min<size_t>(rocfft_concurrency(), max_prefetch_threads));
+    RTCHelperPool::single
+        = std::make_unique<RTCHelperPool>(std::min<size_t>(rocfft_concurrency(), max_rtc_helpers));
 
     // set layer_mode from value of environment variable ROCFFT_LAYER
     auto str_layer_mode = rocfft_getenv("ROCFFT_LAYER");
@@ -125,10 +158,14 @@ rocfft_status rocfft_setup()
         // open log_graph file
         if(layer_mode & rocfft_layer_mode_log_graph)
             open_log_stream("ROCFFT_LOG_GRAPH_PATH", log_graph_fd);
+
+        // open log_plan_profile file
+        if(layer_mode & rocfft_layer_mode_log_plan_profile)
+            open_log_stream("ROCFFT_LOG_PLAN_PROFILE_PATH", log_plan_profile_fd);
     }
 
     // setup solution map once in program at the start of library use
-    auto arch_name = get_arch_name(get_curr_device_prop());
+    auto arch_name = get_arch_name(get_plan_device_prop());
     solution_map::get_solution_map().setup(arch_name);
     TuningBenchmarker::GetSingleton().Setup();
 
@@ -142,11 +179,25 @@ rocfft_status rocfft_cleanup()
     log_trace(__func__);
 
     // close the RTC cache and clear the repo, so that subsequent
-    // rocfft_setup() + plan creation will start from scratch
+    // rocfft_setup() + plan creation will start from scratch.  stop
+    // the prefetch pool first, since prefetches use the compile
+    // pool, and then the compile pool, since compiles use the cache
+    // and the rtc helpers.  stopping a pool cancels queued
+    // speculative work (like prefetches that haven't started) and
+    // finishes the rest, which may build plans, so do that before
+    // dropping cached plans and then clearing the repo, since plans
+    // hold twiddles from it.
+    RTCCompilePool::prefetch.reset();
+    RTCCompilePool::single.reset();
+    PlanCache::GetInstance().Clear();
     Repo::Clear();
+    RTCHelperPool::single.reset();
+    if(RTCCache::single)
+        RTCCache::single->enforce_size_limit();
     RTCCache::single.reset();
 
     TuningBenchmarker::GetSingleton().Clean();
+    offline_device_cleanup();
 
     LogSingleton::GetInstance().SetLayerMode(rocfft_layer_mode_none);
     // Close log files
@@ -190,6 +241,11 @@ rocfft_status rocfft_cleanup()
         CLOSE(log_graph_fd);
         log_graph_fd = -1;
     }
+    if(log_plan_profile_fd != -1)
+    {
+        CLOSE(log_plan_profile_fd);
+        log_plan_profile_fd = -1;
+    }
 
     // stop all log worker threads
     rocfft_ostream::cleanup();
@@ -1079,6 +1079,13 @@ void operator+=(FFTOperationList& opers, const FFTOperation& op);
 
 void operator+=(FFTOperationList& opers, const FFTOperationList& ops);
 
+// static cost of an operation list, counted on the statements it
+// lowers to
+static KernelProfile profile_operations(FFTOperationList ops)
+{
+    return profile_statements(ops.lower());
+}
+
 //
 // Visitors
 //
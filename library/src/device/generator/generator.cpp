@@ -24,36 +24,36 @@
     NAME::NAME(const std::initializer_list<Expression>& il) \
         : args(il){};                                       \
     NAME::NAME(const std::vector<Expression>& il)           \
-        : args(il){};
-
-#define MAKE_BINARY_METHODS(NAME)                                  \
-    std::string NAME::render() const                               \
-    {                                                              \
-        std::string s;                                             \
-        if(get_precedence(args[0]) > precedence)                   \
-            s += "(" + vrender(args[0]) + ")";                     \
-        else                                                       \
-            s += vrender(args[0]);                                 \
-        for(auto arg = args.begin() + 1; arg != args.end(); ++arg) \
-        {                                                          \
-            s += oper;                                             \
-            if(get_precedence(*arg) >= precedence)                 \
-                s += "(" + vrender(*arg) + ")";                    \
-            else                                                   \
-                s += vrender(*arg);                                \
-        }                                                          \
-        return s;                                                  \
-    }
-
-#define MAKE_UNARY_PREFIX_METHODS(NAME)               \
-    std::string NAME::render() const                  \
-    {                                                 \
-        std::string s = oper;                         \
-        if(get_precedence(args.front()) > precedence) \
-            s += "(" + vrender(args.front()) + ")";   \
-        else                                          \
-            s += vrender(args.front());               \
-        return s;                                     \
+        : args(il){};                                       \
+    NAME::NAME(std::vector<Expression>&& il)                \
+        : args(std::move(il)){};
+
+// render an operand, parenthesized if asked
+static void render_operand(const Expression& arg, bool parens, std::string& out)
+{
+    if(parens)
+        out += "(";
+    vrender(arg, out);
+    if(parens)
+        out += ")";
+}
+
+#define MAKE_BINARY_METHODS(NAME)                                                 \
+    void NAME::render(std::string& out) const                                     \
+    {                                                                             \
+        render_operand(args[0], get_precedence(args[0]) > precedence, out);       \
+        for(auto arg = args.begin() + 1; arg != args.end(); ++arg)                \
+        {                                                                         \
+            out += oper;                                                          \
+            render_operand(*arg, get_precedence(*arg) >= precedence, out);        \
+        }                                                                         \
+    }
+
+#define MAKE_UNARY_PREFIX_METHODS(NAME)                                             \
+    void NAME::render(std::string& out) const                                       \
+    {                                                                               \
+        out += oper;                                                                \
+        render_operand(args.front(), get_precedence(args.front()) > precedence, out); \
     }
 
 std::string ArgumentList::render() const
@@ -158,9 +158,13 @@ Ternary::Ternary(std::vector<Expression>&& args)
 {
 }
 
-std::string Ternary::render() const
+void Ternary::render(std::string& out) const
 {
-    return vrender(args[0]) + " ? " + vrender(args[1]) + " : " + vrender(args[2]);
+    vrender(args[0], out);
+    out += " ? ";
+    vrender(args[1], out);
+    out += " : ";
+    vrender(args[2], out);
 }
 
 LoadGlobal::LoadGlobal(const Expression& ptr, const Expression& index)
@@ -173,9 +177,18 @@ LoadGlobal::LoadGlobal(const std::vector<Expression>& args)
 {
 }
 
-std::string LoadGlobal::render() const
+LoadGlobal::LoadGlobal(std::vector<Expression>&& args)
+    : args(std::move(args))
+{
+}
+
+void LoadGlobal::render(std::string& out) const
 {
-    return "load_cb(" + vrender(args[0]) + "," + vrender(args[1]) + ", load_cb_data, nullptr)";
+    out += "load_cb(";
+    vrender(args[0], out);
+    out += ",";
+    vrender(args[1], out);
+    out += ", load_cb_data, nullptr)";
 }
 
 LoadGlobalPlanar::LoadGlobalPlanar(const std::vector<Expression>& args)
@@ -183,6 +196,11 @@ LoadGlobalPlanar::LoadGlobalPlanar(const std::vector<Expression>& args)
 {
 }
 
+LoadGlobalPlanar::LoadGlobalPlanar(std::vector<Expression>&& args)
+    : args(std::move(args))
+{
+}
+
 std::string LoadGlobalPlanar::render() const
 {
     return "load_planar(" + vrender(args[0]) + "," + vrender(args[1]) + "," + vrender(args[2])
@@ -298,23 +316,26 @@ Variable Variable::y() const
     return ret;
 }
 
-std::string Variable::render() const
+void Variable::render(std::string& out) const
 {
-    std::string output;
+    out += name;
     if(index)
     {
-        output = name + "[" + vrender(*index) + "]";
+        out += "[";
+        vrender(*index, out);
+        out += "]";
         if(index2D)
-            output += "[" + vrender(*index2D) + "]";
+        {
+            out += "[";
+            vrender(*index2D, out);
+            out += "]";
+        }
     }
-    else
-        output = name;
 
     if(component == Component::REAL)
-        output += ".x";
+        out += ".x";
     else if(component == Component::IMAG)
-        output += ".y";
-    return output;
+        out += ".y";
 }
 
 Variable Variable::operator[](const Expression& index) const
@@ -334,9 +355,8 @@ OptionalExpression::OptionalExpression(OptionalExpression&& o)
 {
 }
 OptionalExpression::OptionalExpression(const OptionalExpression& o)
+    : expr(o.expr)
 {
-    if(o.expr)
-        this->expr = std::make_unique<Expression>(*o.expr);
 }
 
 OptionalExpression& OptionalExpression::operator=(OptionalExpression&& o)
@@ -347,8 +367,7 @@ OptionalExpression& OptionalExpression::operator=(OptionalExpression&& o)
 
 OptionalExpression& OptionalExpression::operator=(const OptionalExpression& o)
 {
-    if(o.expr)
-        this->expr = std::make_unique<Expression>(*o.expr);
+    expr = o.expr;
     return *this;
 }
 
@@ -364,49 +383,47 @@ Expression OptionalExpression::operator*() const
 
 OptionalExpression::OptionalExpression(const Expression& expr)
 {
-    this->expr = std::make_unique<Expression>(expr);
+    this->expr = std::make_shared<const Expression>(expr);
 }
 OptionalExpression& OptionalExpression::operator=(const Expression& in_expr)
 {
-    this->expr = std::make_unique<Expression>(in_expr);
+    this->expr = std::make_shared<const Expression>(in_expr);
     return *this;
 }
 
-std::string ComplexLiteral::render() const
+void ComplexLiteral::render(std::string& out) const
 {
-    std::string ret       = "{";
+    out += "{";
     const char* separator = nullptr;
     for(const auto& arg : args)
     {
         if(separator)
-            ret += separator;
-        ret += vrender(arg);
+            out += separator;
+        vrender(arg, out);
         separator = oper;
     }
-    ret += "}";
-    return ret;
+    out += "}";
 }
 
-std::string ComplexMultiply::render() const
+void ComplexMultiply::render(std::string& out) const
 {
     auto& a = std::get<Variable>(args[0]);
     auto& b = std::get<Variable>(args[1]);
-    auto  r = ComplexLiteral{a.x() * b.x() - a.y() * b.y(), a.y() * b.x() + a.x() * b.y()};
-    return r.render();
+    ComplexLiteral{a.x() * b.x() - a.y() * b.y(), a.y() * b.x() + a.x() * b.y()}.render(out);
 }
 
-std::string TwiddleMultiply::render() const
+void TwiddleMultiply::render(std::string& out) const
 {
     auto& a = vars[0];
     auto& b = vars[1];
-    return ComplexLiteral{a.x() * b.x() - a.y() * b.y(), a.y() * b.x() + a.x() * b.y()}.render();
+    ComplexLiteral{a.x() * b.x() - a.y() * b.y(), a.y() * b.x() + a.x() * b.y()}.render(out);
 }
 
-std::string TwiddleMultiplyConjugate::render() const
+void TwiddleMultiplyConjugate::render(std::string& out) const
 {
     auto& a = vars[0];
     auto& b = vars[1];
-    return ComplexLiteral{a.x() * b.x() + a.y() * b.y(), a.y() * b.x() - a.x() * b.y()}.render();
+    ComplexLiteral{a.x() * b.x() + a.y() * b.y(), a.y() * b.x() - a.x() * b.y()}.render(out);
 }
 
 Parens::Parens(Expression&& inside)
@@ -429,25 +446,24 @@ Parens::Parens(const std::vector<Expression>& args)
 {
 }
 
-std::string Parens::render() const
+void Parens::render(std::string& out) const
 {
-    return "(" + vrender(args.front()) + ")";
+    render_operand(args.front(), true, out);
 }
 
-CallExpr::CallExpr(const std::string& name, const std::vector<Expression>& arguments)
+CallExpr::CallExpr(const std::string& name, std::vector<Expression> arguments)
     : name(name)
-    , arguments(arguments){};
+    , arguments(std::move(arguments)){};
 
-CallExpr::CallExpr(const std::string&             name,
-                   const TemplateList&            templates,
-                   const std::vector<Expression>& arguments)
+CallExpr::CallExpr(const std::string&      name,
+                   TemplateList            templates,
+                   std::vector<Expression> arguments)
     : name(name)
-    , templates(templates)
-    , arguments(arguments){};
+    , templates(std::move(templates))
+    , arguments(std::move(arguments)){};
 
-std::string CallExpr::render() const
+void CallExpr::render(std::string& f) const
 {
-    std::string f;
     f += name;
     const char* separator = nullptr;
     const char* comma     = ",";
@@ -470,11 +486,10 @@ std::string CallExpr::render() const
     {
         if(separator)
             f += separator;
-        f += vrender(arg);
+        vrender(arg, f);
         separator = comma;
     }
     f += ")";
-    return f;
 }
 
 IntrinsicLoad::IntrinsicLoad(const std::vector<Expression>& args)
@@ -482,11 +497,21 @@ IntrinsicLoad::IntrinsicLoad(const std::vector<Expression>& args)
 {
 }
 
+IntrinsicLoad::IntrinsicLoad(std::vector<Expression>&& args)
+    : args(std::move(args))
+{
+}
+
 IntrinsicLoadPlanar::IntrinsicLoadPlanar(const std::vector<Expression>& args)
     : args(args)
 {
 }
 
+IntrinsicLoadPlanar::IntrinsicLoadPlanar(std::vector<Expression>&& args)
+    : args(std::move(args))
+{
+}
+
 std::string IntrinsicLoad::render() const
 {
     // intrinsic_load(const T* data, unsigned int voffset, unsigned int soffset,
@@ -504,21 +529,30 @@ std::string IntrinsicLoadPlanar::render() const
            + vrender(args[2]) + "," + vrender(args[3]) + "," + vrender(args[4]) + ")" + "}";
 }
 
-std::string Declaration::render() const
+void Declaration::render(std::string& s) const
 {
-    std::string s;
-    s = var.type;
+    s += var.type;
     if(var.pointer)
         s += "*";
     s += " " + var.name;
     if(var.size)
-        s += "[" + vrender(*var.size) + "]";
+    {
+        s += "[";
+        vrender(*var.size, s);
+        s += "]";
+    }
     if(var.size2D)
-        s += "[" + vrender(*var.size2D) + "]";
+    {
+        s += "[";
+        vrender(*var.size2D, s);
+        s += "]";
+    }
     if(value)
-        s += " = " + vrender(*value);
+    {
+        s += " = ";
+        vrender(*value, s);
+    }
     s += ";";
-    return s;
 }
 
 std::string StoreGlobalPlanar::render() const
@@ -527,7 +561,7 @@ std::string StoreGlobalPlanar::render() const
            + vrender(value) + ");";
 }
 
-std::string Butterfly::render() const
+void Butterfly::render(std::string& out) const
 {
     std::string func;
     if(forward)
@@ -538,42 +572,46 @@ std::string Butterfly::render() const
     {
         func += "InvRad" + std::to_string(args.size()) + "B1";
     }
-    return Call{func, args}.render();
+    if(split_radix)
+        func += "SplitRadix";
+    Call{func, args}.render(out);
 }
 
 StatementList::StatementList() {}
 StatementList::StatementList(const std::initializer_list<Statement>& il)
     : statements(il){};
-std::string StatementList::render() const
-{
-    std::string r;
-    for(auto s : statements)
-        r += vrender(s) + "\n";
-    return r;
-}
-
-For::For(const Variable&      var,
-         const Expression&    initial,
-         const Expression&    condition,
-         const Expression&    increment,
-         const StatementList& body,
-         bool                 pragma_unroll)
-    : var(var)
-    , initial(initial)
-    , condition(condition)
-    , increment(increment)
-    , body(body)
+void StatementList::render(std::string& out) const
+{
+    for(const auto& s : statements)
+    {
+        vrender(s, out);
+        out += "\n";
+    }
+}
+
+For::For(Variable      var,
+         Expression    initial,
+         Expression    condition,
+         Expression    increment,
+         StatementList body,
+         bool          pragma_unroll)
+    : var(std::move(var))
+    , initial(std::move(initial))
+    , condition(std::move(condition))
+    , increment(std::move(increment))
+    , body(std::move(body))
     , pragma_unroll(pragma_unroll){};
 
-std::string For::render() const
+void For::render(std::string& s) const
 {
-    std::string s;
     if(pragma_unroll)
         s += "#pragma unroll\n";
     s += "for(";
     s += var.type + " " + var.name + " = ";
-    s += vrender(initial) + "; ";
-    s += vrender(condition) + "; ";
+    vrender(initial, s);
+    s += "; ";
+    vrender(condition, s);
+    s += "; ";
 
     // ++ and -- are nicer to read, so render those as a special case
     if(std::holds_alternative<Literal>(increment) && std::get<Literal>(increment).value == "1")
@@ -582,68 +620,62 @@ std::string For::render() const
             && std::get<Literal>(increment).value == "-1")
         s += "--" + var.name;
     else
-        s += var.name + " += " + vrender(increment);
+    {
+        s += var.name + " += ";
+        vrender(increment, s);
+    }
     s += ") {\n ";
-    s += body.render();
+    body.render(s);
     s += "\n}";
-    return s;
 }
 
-While::While(const Expression& condition, const StatementList& body)
-    : condition(condition)
-    , body(body){};
-std::string While::render() const
+While::While(Expression condition, StatementList body)
+    : condition(std::move(condition))
+    , body(std::move(body)){};
+void While::render(std::string& s) const
 {
-    std::string s;
     s += "while(";
-    s += vrender(condition) + ") {\n";
-    s += body.render();
+    vrender(condition, s);
+    s += ") {\n";
+    body.render(s);
     s += "\n}";
-    return s;
 }
 
-If::If(const Expression& condition, const StatementList& body)
-    : condition(condition)
-    , body(body){};
-std::string If::render() const
+If::If(Expression condition, StatementList body)
+    : condition(std::move(condition))
+    , body(std::move(body)){};
+void If::render(std::string& s) const
 {
-    std::string s;
     s += "if(";
-    s += vrender(condition);
+    vrender(condition, s);
     s += ") {\n";
-    s += body.render();
+    body.render(s);
     s += "\n}\n";
-    return s;
 }
 
-ElseIf::ElseIf(const Expression& condition, const StatementList& body)
-    : condition(condition)
-    , body(body){};
-std::string ElseIf::render() const
+ElseIf::ElseIf(Expression condition, StatementList body)
+    : condition(std::move(condition))
+    , body(std::move(body)){};
+void ElseIf::render(std::string& s) const
 {
-    std::string s;
     s += "else if(";
-    s += vrender(condition);
+    vrender(condition, s);
     s += ") {\n";
-    s += body.render();
+    body.render(s);
     s += "\n}\n";
-    return s;
 }
 
-Else::Else(const StatementList& body)
-    : body(body){};
-std::string Else::render() const
+Else::Else(StatementList body)
+    : body(std::move(body)){};
+void Else::render(std::string& s) const
 {
-    std::string s;
     s += "else {\n";
-    s += body.render();
+    body.render(s);
     s += "\n}\n";
-    return s;
 }
 
-std::string Function::render() const
+void Function::render(std::string& f) const
 {
-    std::string f;
     if(templates)
     {
         f += "template<" + templates.render_decl() + ">";
@@ -653,7 +685,2504 @@ std::string Function::render() const
         f += "__launch_bounds__(" + std::to_string(launch_bounds) + ") ";
     f += return_type + " " + name;
     f += "(" + arguments.render_decl() + ") {\n";
-    f += body.render();
+    body.render(f);
     f += "}\n";
-    return f;
+}
+
+//
+// Name analysis, shared by make_cse and make_simplify
+//
+
+// what we know about each name used in a function
+struct FunctionNameInfo
+{
+    unsigned int         declarations = 0;
+    unsigned int         assignments  = 0;
+    bool                 argument     = false;
+    bool                 initialized  = false;
+    bool                 mutated      = false;
+    const StatementList* declared_in  = nullptr;
+    const StatementList* assigned_in  = nullptr;
+
+    // true if the name holds one value for as long as it's in scope:
+    // it's never written, or it's declared with a value and never
+    // written, or it's declared and then assigned once in the same
+    // block.  names are tracked by string, so a name that's declared
+    // more than once (or is an argument that a local shadows) might
+    // be several different variables, and is never stable.
+    bool stable() const
+    {
+        if(mutated || declarations > 1 || (argument && declarations > 0))
+            return false;
+        if(declarations == 0 || initialized)
+            return assignments == 0;
+        return assignments == 1 && assigned_in == declared_in;
+    }
+};
+typedef std::map<std::string, FunctionNameInfo> function_names_t;
+
+// find out how each name in a function is declared and written
+struct FunctionNameScan
+{
+    function_names_t names;
+
+    void note_name(const std::string& name)
+    {
+        // address() makes a variable named "&x" or "&x[i]", and
+        // whatever it's passed to might write x
+        if(!name.empty() && name.front() == '&')
+            names[name.substr(1, name.find('[') - 1)].mutated = true;
+        else
+            names[name];
+    }
+    void note_mutated(const Expression& expr)
+    {
+        if(std::holds_alternative<Variable>(expr))
+            names[std::get<Variable>(expr).name].mutated = true;
+    }
+
+    void scan(const Expression& expr)
+    {
+        std::visit([this](const auto& x) { scan_expr(x); }, expr);
+    }
+    void scan_expr(const Literal&) {}
+    void scan_expr(const Variable& x)
+    {
+        note_name(x.name);
+        if(x.index)
+            scan(*x.index);
+        if(x.index2D)
+            scan(*x.index2D);
+    }
+    void scan_expr(const CallExpr& x)
+    {
+        for(const auto& arg : x.arguments)
+            scan(arg);
+    }
+    void scan_expr(const TwiddleMultiply& x)
+    {
+        for(const auto& var : x.vars)
+            scan_expr(var);
+    }
+    void scan_expr(const TwiddleMultiplyConjugate& x)
+    {
+        for(const auto& var : x.vars)
+            scan_expr(var);
+    }
+    void scan_expr(const PreIncrement& x)
+    {
+        note_mutated(x.args.front());
+        scan(x.args.front());
+    }
+    void scan_expr(const PreDecrement& x)
+    {
+        note_mutated(x.args.front());
+        scan(x.args.front());
+    }
+    // everything else keeps its children in args
+    template <typename T>
+    void scan_expr(const T& x)
+    {
+        for(const auto& arg : x.args)
+            scan(arg);
+    }
+
+    void scan(const StatementList& block)
+    {
+        for(const auto& stmt : block.statements)
+            std::visit([this, &block](const auto& x) { scan_stmt(x, block); }, stmt);
+    }
+    void scan_stmt(const Assign& x, const StatementList& block)
+    {
+        if(!x.lhs.index)
+        {
+            auto& info = names[x.lhs.name];
+            ++info.assignments;
+            info.assigned_in = &block;
+            // compound assignments and component writes change a
+            // value that's already there
+            if(x.oper != "=" || x.lhs.component != Component::BOTH)
+                info.mutated = true;
+        }
+        scan_expr(x.lhs);
+        scan(x.rhs);
+    }
+    void scan_stmt(const Declaration& x, const StatementList& block)
+    {
+        auto& info = names[x.var.name];
+        ++info.declarations;
+        info.initialized = static_cast<bool>(x.value);
+        info.declared_in = &block;
+        if(x.value)
+            scan(*x.value);
+    }
+    void scan_stmt(const For& x, const StatementList&)
+    {
+        names[x.var.name].mutated = true;
+        scan(x.initial);
+        scan(x.condition);
+        scan(x.increment);
+        scan(x.body);
+    }
+    void scan_stmt(const While& x, const StatementList&)
+    {
+        scan(x.condition);
+        scan(x.body);
+    }
+    void scan_stmt(const If& x, const StatementList&)
+    {
+        scan(x.condition);
+        scan(x.body);
+    }
+    void scan_stmt(const ElseIf& x, const StatementList&)
+    {
+        scan(x.condition);
+        scan(x.body);
+    }
+    void scan_stmt(const Else& x, const StatementList&)
+    {
+        scan(x.body);
+    }
+    void scan_stmt(const Call& x, const StatementList&)
+    {
+        scan_expr(x.expr);
+    }
+    void scan_stmt(const ReturnExpr& x, const StatementList&)
+    {
+        scan(x.expr);
+    }
+    void scan_stmt(const StoreGlobal& x, const StatementList&)
+    {
+        scan(x.ptr);
+        scan(x.index);
+        scan(x.value);
+    }
+    void scan_stmt(const StoreGlobalPlanar& x, const StatementList&)
+    {
+        scan_expr(x.realPtr);
+        scan_expr(x.imagPtr);
+        scan(x.index);
+        scan(x.value);
+    }
+    void scan_stmt(const IntrinsicStore& x, const StatementList&)
+    {
+        for(const auto& e : {x.ptr, x.voffset, x.soffset, x.value, x.rw_flag})
+            scan(e);
+    }
+    void scan_stmt(const IntrinsicStorePlanar& x, const StatementList&)
+    {
+        for(const auto& e : {x.ptrre, x.ptrim, x.voffset, x.soffset, x.value, x.rw_flag})
+            scan(e);
+    }
+    void scan_stmt(const IntrinsicLoadToDest& x, const StatementList&)
+    {
+        note_mutated(x.dest);
+        for(const auto& e : {x.dest, x.data, x.voffset, x.soffset, x.rw_flag})
+            scan(e);
+    }
+    void scan_stmt(const Butterfly& x, const StatementList&)
+    {
+        for(const auto& arg : x.args)
+            scan(arg);
+    }
+    // remaining statements have no expressions
+    template <typename T>
+    void scan_stmt(const T&, const StatementList&)
+    {
+    }
+};
+
+// scan a whole function, including names that it takes as arguments
+static function_names_t scan_function_names(const Function& f)
+{
+    FunctionNameScan scan;
+    for(const auto& arg : f.arguments.arguments)
+        scan.names[arg.name].argument = true;
+    for(const auto& arg : f.templates.arguments)
+        scan.names[arg.name].argument = true;
+    scan.scan(f.body);
+    return std::move(scan.names);
+}
+
+//
+// Common subexpression elimination
+//
+
+// an expression that could be hoisted out of a block
+struct CSECandidate
+{
+    // number of times the expression appears in the block, less any
+    // appearances inside larger expressions that were hoisted
+    size_t uses = 0;
+    // index of the first statement in the block that uses the
+    // expression, and whether that statement always evaluates it
+    size_t                    first         = 0;
+    bool                      unconditional = false;
+    std::optional<Expression> expr;
+};
+typedef std::map<std::string, CSECandidate> cse_candidates_t;
+
+// Find the pure expressions in a block, and count how many times
+// each one appears.  An expression is pure if it's made of literals
+// and stable names, combined with operators that have no side
+// effects.  Candidates are keyed on their rendered source.
+struct CSECollector
+{
+    explicit CSECollector(const function_names_t& names)
+        : names(names)
+    {
+    }
+
+    const function_names_t& names;
+    cse_candidates_t   candidates;
+    // index of the statement in the block being collected
+    size_t stmt_index = 0;
+    // how deeply nested the statement being collected is, and the
+    // names declared in nested blocks.  those names are out of scope
+    // in the block being collected, so expressions that use them
+    // are left for the nested block to hoist.
+    size_t                depth = 0;
+    std::set<std::string> nested_locals;
+
+    template <typename T>
+    void record(const T& x, bool unconditional)
+    {
+        auto& c = candidates[x.render()];
+        if(c.uses == 0)
+        {
+            c.first = stmt_index;
+            c.expr  = x;
+        }
+        if(c.first == stmt_index && unconditional)
+            c.unconditional = true;
+        ++c.uses;
+    }
+
+    // returns true if the expression is pure.  unconditional is
+    // false if the expression might not be evaluated when its
+    // statement runs.
+    bool collect(const Expression& expr, bool unconditional)
+    {
+        return std::visit(
+            [this, unconditional](const auto& x) { return collect_expr(x, unconditional); }, expr);
+    }
+
+    template <typename T>
+    bool collect_oper(const T& x, bool unconditional, bool short_circuit)
+    {
+        bool pure = true;
+        for(size_t i = 0; i < x.args.size(); ++i)
+        {
+            if(!collect(x.args[i], unconditional && (i == 0 || !short_circuit)))
+                pure = false;
+        }
+        if(pure)
+            record(x, unconditional);
+        return pure;
+    }
+
+#define CSE_PURE_OPER(CLS)                                 \
+    bool collect_expr(const CLS& x, bool unconditional)    \
+    {                                                      \
+        return collect_oper(x, unconditional, false);      \
+    }
+
+    CSE_PURE_OPER(Add);
+    CSE_PURE_OPER(Subtract);
+    CSE_PURE_OPER(Multiply);
+    CSE_PURE_OPER(Divide);
+    CSE_PURE_OPER(Modulus);
+    CSE_PURE_OPER(ShiftLeft);
+    CSE_PURE_OPER(ShiftRight);
+    CSE_PURE_OPER(BitAnd);
+    CSE_PURE_OPER(Less);
+    CSE_PURE_OPER(LessEqual);
+    CSE_PURE_OPER(Greater);
+    CSE_PURE_OPER(GreaterEqual);
+    CSE_PURE_OPER(Equal);
+    CSE_PURE_OPER(NotEqual);
+    CSE_PURE_OPER(UnaryMinus);
+    CSE_PURE_OPER(Not);
+
+    // later operands of && and || are only evaluated sometimes, as
+    // are the results of a ternary
+    bool collect_expr(const And& x, bool unconditional)
+    {
+        return collect_oper(x, unconditional, true);
+    }
+    bool collect_expr(const Or& x, bool unconditional)
+    {
+        return collect_oper(x, unconditional, true);
+    }
+    bool collect_expr(const Ternary& x, bool unconditional)
+    {
+        return collect_oper(x, unconditional, true);
+    }
+
+    bool collect_expr(const Literal&, bool)
+    {
+        return true;
+    }
+    bool collect_expr(const Variable& x, bool unconditional)
+    {
+        // array accesses read memory, but their indexes might be pure
+        if(x.index)
+        {
+            collect(*x.index, unconditional);
+            if(x.index2D)
+                collect(*x.index2D, unconditional);
+            return false;
+        }
+        if(nested_locals.count(x.name))
+            return false;
+        auto info = names.find(x.name);
+        return info != names.end() && info->second.stable();
+    }
+    // parens are just rendering, so look through them
+    bool collect_expr(const Parens& x, bool unconditional)
+    {
+        return collect(x.args.front(), unconditional);
+    }
+    bool collect_expr(const CallExpr& x, bool unconditional)
+    {
+        for(const auto& arg : x.arguments)
+            collect(arg, unconditional);
+        return false;
+    }
+    bool collect_expr(const PreIncrement&, bool)
+    {
+        return false;
+    }
+    bool collect_expr(const PreDecrement&, bool)
+    {
+        return false;
+    }
+    bool collect_expr(const TwiddleMultiply&, bool)
+    {
+        return false;
+    }
+    bool collect_expr(const TwiddleMultiplyConjugate&, bool)
+    {
+        return false;
+    }
+    // loads and complex literals aren't pure, but their arguments
+    // might be.  (complex literals can't be hoisted, since "auto"
+    // would deduce an initializer list.)
+    template <typename T>
+    bool collect_expr(const T& x, bool unconditional)
+    {
+        for(const auto& arg : x.args)
+            collect(arg, unconditional);
+        return false;
+    }
+
+    // expressions in nested blocks might not be evaluated
+    void collect_block(const StatementList& block)
+    {
+        ++depth;
+        for(const auto& stmt : block.statements)
+            collect_statement(stmt, false);
+        --depth;
+    }
+    void collect_statement(const Statement& stmt, bool unconditional)
+    {
+        std::visit([this, unconditional](const auto& x) { collect_stmt(x, unconditional); }, stmt);
+    }
+
+    // only look at the statements whose expressions BaseVisitor
+    // rewrites, so that every use we count can be replaced
+    void collect_stmt(const Assign& x, bool unconditional)
+    {
+        collect_expr(x.lhs, unconditional);
+        collect(x.rhs, unconditional);
+    }
+    void collect_stmt(const Call& x, bool unconditional)
+    {
+        collect_expr(x.expr, unconditional);
+    }
+    void collect_stmt(const Declaration& x, bool unconditional)
+    {
+        if(x.value)
+            collect(*x.value, unconditional);
+        if(depth > 0)
+            nested_locals.insert(x.var.name);
+    }
+    void collect_stmt(const For& x, bool unconditional)
+    {
+        collect(x.initial, unconditional);
+        collect(x.condition, unconditional);
+        collect(x.increment, false);
+        collect_block(x.body);
+    }
+    void collect_stmt(const While& x, bool unconditional)
+    {
+        collect(x.condition, unconditional);
+        collect_block(x.body);
+    }
+    void collect_stmt(const If& x, bool unconditional)
+    {
+        collect(x.condition, unconditional);
+        collect_block(x.body);
+    }
+    void collect_stmt(const ElseIf& x, bool)
+    {
+        collect(x.condition, false);
+        collect_block(x.body);
+    }
+    void collect_stmt(const Else& x, bool)
+    {
+        collect_block(x.body);
+    }
+    void collect_stmt(const StoreGlobal& x, bool unconditional)
+    {
+        for(const auto& e : {x.ptr, x.index, x.value})
+            collect(e, unconditional);
+    }
+    void collect_stmt(const StoreGlobalPlanar& x, bool unconditional)
+    {
+        collect_expr(x.realPtr, unconditional);
+        collect_expr(x.imagPtr, unconditional);
+        collect(x.index, unconditional);
+        collect(x.value, unconditional);
+    }
+    void collect_stmt(const IntrinsicStore& x, bool unconditional)
+    {
+        for(const auto& e : {x.ptr, x.voffset, x.soffset, x.value, x.rw_flag})
+            collect(e, unconditional);
+    }
+    void collect_stmt(const IntrinsicStorePlanar& x, bool unconditional)
+    {
+        for(const auto& e : {x.ptrre, x.ptrim, x.voffset, x.soffset, x.value, x.rw_flag})
+            collect(e, unconditional);
+    }
+    template <typename T>
+    void collect_stmt(const T&, bool)
+    {
+    }
+};
+
+// replace hoisted expressions with the variables that hold them
+struct CSEReplaceVisitor : public BaseVisitor
+{
+    explicit CSEReplaceVisitor(const std::map<std::string, Variable>& hoisted)
+        : hoisted(hoisted)
+    {
+    }
+
+    const std::map<std::string, Variable>& hoisted;
+    // expression whose declaration is being built, which must not
+    // be replaced with itself
+    std::string skip;
+
+#define CSE_REPLACE_VISIT(CLS)                          \
+    Expression visit_##CLS(const CLS& x) override       \
+    {                                                   \
+        auto key = x.render();                          \
+        auto var = hoisted.find(key);                   \
+        if(var != hoisted.end() && key != skip)         \
+            return var->second;                         \
+        return BaseVisitor::visit_##CLS(x);             \
+    }
+
+    CSE_REPLACE_VISIT(Add);
+    CSE_REPLACE_VISIT(Subtract);
+    CSE_REPLACE_VISIT(Multiply);
+    CSE_REPLACE_VISIT(Divide);
+    CSE_REPLACE_VISIT(Modulus);
+    CSE_REPLACE_VISIT(ShiftLeft);
+    CSE_REPLACE_VISIT(ShiftRight);
+    CSE_REPLACE_VISIT(BitAnd);
+    CSE_REPLACE_VISIT(Less);
+    CSE_REPLACE_VISIT(LessEqual);
+    CSE_REPLACE_VISIT(Greater);
+    CSE_REPLACE_VISIT(GreaterEqual);
+    CSE_REPLACE_VISIT(Equal);
+    CSE_REPLACE_VISIT(NotEqual);
+    CSE_REPLACE_VISIT(UnaryMinus);
+    CSE_REPLACE_VISIT(Not);
+    CSE_REPLACE_VISIT(And);
+    CSE_REPLACE_VISIT(Or);
+    CSE_REPLACE_VISIT(Ternary);
+
+    // BaseVisitor doesn't look inside array indexes
+    Expression visit_Variable(const Variable& x) override
+    {
+        if(!x.index)
+            return x;
+        Variable y{x};
+        y.index = std::visit(*this, *x.index);
+        if(x.index2D)
+            y.index2D = std::visit(*this, *x.index2D);
+        return y;
+    }
+};
+
+struct CSEPass
+{
+    function_names_t names;
+    CSEReport   report;
+    size_t      next_name = 0;
+
+    std::string fresh_name()
+    {
+        std::string name;
+        do
+        {
+            name = "cse" + std::to_string(next_name++);
+        } while(names.count(name));
+        return name;
+    }
+
+    void process(StatementList& block)
+    {
+        CSECollector collector{names};
+        for(size_t i = 0; i < block.statements.size(); ++i)
+        {
+            collector.stmt_index = i;
+            collector.collect_statement(block.statements[i], true);
+        }
+        auto& candidates = collector.candidates;
+
+        // look at larger expressions first, since hoisting those
+        // also removes uses of their subexpressions
+        std::vector<cse_candidates_t::iterator> order;
+        for(auto c = candidates.begin(); c != candidates.end(); ++c)
+        {
+            if(c->second.uses > 1 && c->second.unconditional)
+                order.push_back(c);
+        }
+        std::sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+            return a->first.size() > b->first.size();
+        });
+
+        std::vector<cse_candidates_t::iterator> selected;
+        for(auto c : order)
+        {
+            auto uses = c->second.uses;
+            if(uses < 2)
+                continue;
+            selected.push_back(c);
+
+            // subexpressions now appear once in the declaration,
+            // instead of once per use
+            CSECollector sub{names};
+            sub.collect(*c->second.expr, true);
+            for(const auto& s : sub.candidates)
+            {
+                auto other = candidates.find(s.first);
+                if(s.first == c->first || other == candidates.end())
+                    continue;
+                other->second.uses -= std::min(other->second.uses, (uses - 1) * s.second.uses);
+            }
+        }
+
+        if(!selected.empty())
+        {
+            // declare in statement order, and smaller expressions
+            // first so that larger ones can use them
+            std::sort(selected.begin(), selected.end(), [](const auto& a, const auto& b) {
+                if(a->second.first != b->second.first)
+                    return a->second.first < b->second.first;
+                return a->first.size() < b->first.size();
+            });
+
+            std::map<std::string, Variable> hoisted;
+            for(auto c : selected)
+            {
+                Variable var{fresh_name(), "const auto"};
+                auto&    info = names[var.name];
+                info.declarations = 1;
+                info.initialized  = true;
+                hoisted.emplace(c->first, var);
+            }
+
+            CSEReplaceVisitor replace{hoisted};
+            StatementList     replaced;
+            auto              decl = selected.begin();
+            for(size_t i = 0; i < block.statements.size(); ++i)
+            {
+                for(; decl != selected.end() && (*decl)->second.first == i; ++decl)
+                {
+                    replace.skip = (*decl)->first;
+                    replaced += Declaration{hoisted.at((*decl)->first),
+                                            std::visit(replace, *(*decl)->second.expr)};
+                    report.expressions += 1;
+                    report.evaluations += (*decl)->second.uses - 1;
+                }
+                replace.skip.clear();
+                replaced += std::visit(replace, block.statements[i]);
+            }
+            block = std::move(replaced);
+        }
+
+        // now look for expressions that repeat within nested blocks
+        for(auto& stmt : block.statements)
+        {
+            if(auto x = std::get_if<For>(&stmt))
+                process(x->body);
+            else if(auto x = std::get_if<While>(&stmt))
+                process(x->body);
+            else if(auto x = std::get_if<If>(&stmt))
+                process(x->body);
+            else if(auto x = std::get_if<ElseIf>(&stmt))
+                process(x->body);
+            else if(auto x = std::get_if<Else>(&stmt))
+                process(x->body);
+        }
+    }
+};
+
+Function make_cse(const Function& f, CSEReport* report)
+{
+    CSEPass pass;
+    pass.names = scan_function_names(f);
+
+    Function y{f};
+    pass.process(y.body);
+
+    if(pass.report.expressions)
+    {
+        StatementList body;
+        body += CommentLines{"common subexpression elimination hoisted "
+                             + std::to_string(pass.report.expressions) + " expressions, removing "
+                             + std::to_string(pass.report.evaluations) + " evaluations"};
+        body += std::move(y.body);
+        y.body = std::move(body);
+    }
+    if(report)
+        *report = pass.report;
+    return y;
+}
+
+//
+// Simplification
+//
+
+// Types of the integer literals that the simplifier folds.  Plain
+// decimal literals are int, a "u" suffix makes them unsigned int,
+// and a "ull" suffix makes them unsigned long long, which is how
+// size_t values are given to the simplifier.  Enumerators are in
+// increasing order of conversion rank.
+enum class IntegerType
+{
+    INT,
+    UNSIGNED_INT,
+    UNSIGNED_LONG_LONG,
+};
+
+struct IntegerLiteral
+{
+    IntegerType type = IntegerType::INT;
+    // value converted to unsigned long long the way C++ converts
+    // integers, so int values are sign-extended
+    unsigned long long value = 0;
+
+    long long signed_value() const
+    {
+        return static_cast<long long>(value);
+    }
+};
+
+// bits that hold values of an integer type
+static unsigned long long integer_mask(IntegerType type)
+{
+    return type == IntegerType::UNSIGNED_INT ? std::numeric_limits<unsigned int>::max()
+                                             : std::numeric_limits<unsigned long long>::max();
+}
+
+// value and type of a literal that's a decimal integer, with an
+// optional leading minus and u or ull suffix
+static std::optional<IntegerLiteral> literal_integer_typed(const Expression& e)
+{
+    auto lit = std::get_if<Literal>(&e);
+    if(!lit || lit->value.empty())
+        return {};
+    bool negative = lit->value.front() == '-';
+    auto str      = negative ? lit->value.substr(1) : lit->value;
+
+    auto digits_end = std::find_if_not(str.begin(), str.end(), ::isdigit);
+    if(digits_end == str.begin())
+        return {};
+    std::string suffix(digits_end, str.end());
+    std::transform(suffix.begin(), suffix.end(), suffix.begin(), ::tolower);
+
+    IntegerLiteral result;
+    if(suffix == "u")
+        result.type = IntegerType::UNSIGNED_INT;
+    else if(suffix == "ull" || suffix == "llu")
+        result.type = IntegerType::UNSIGNED_LONG_LONG;
+    else if(!suffix.empty())
+        return {};
+
+    unsigned long long magnitude = 0;
+    for(auto c = str.begin(); c != digits_end; ++c)
+    {
+        unsigned int digit = *c - '0';
+        if(magnitude > (std::numeric_limits<unsigned long long>::max() - digit) / 10)
+            return {};
+        magnitude = magnitude * 10 + digit;
+    }
+
+    // a literal that's too big for its type would have a wider type
+    if(result.type == IntegerType::INT
+       && magnitude > static_cast<unsigned long long>(std::numeric_limits<int>::max()))
+        return {};
+    if(magnitude > integer_mask(result.type))
+        return {};
+    result.value = (negative ? 0 - magnitude : magnitude) & integer_mask(result.type);
+    return result;
+}
+
+// value of an integer literal, if it fits in a long long
+static std::optional<long long> literal_integer(const Expression& e)
+{
+    auto x = literal_integer_typed(e);
+    if(!x
+       || (x->type != IntegerType::INT
+           && x->value > static_cast<unsigned long long>(std::numeric_limits<long long>::max())))
+        return {};
+    return x->signed_value();
+}
+
+static std::optional<bool> literal_bool(const Expression& e)
+{
+    auto lit = std::get_if<Literal>(&e);
+    if(lit && lit->value == "true")
+        return true;
+    if(lit && lit->value == "false")
+        return false;
+    return {};
+}
+
+// literal for an integer value, if it can be written as a literal
+// of its type
+static std::optional<Expression> make_literal_integer(const IntegerLiteral& x)
+{
+    switch(x.type)
+    {
+    case IntegerType::INT:
+        // -2147483648 would be a negated long
+        if(x.signed_value() <= std::numeric_limits<int>::min()
+           || x.signed_value() > std::numeric_limits<int>::max())
+            return {};
+        return Literal{std::to_string(x.signed_value())};
+    case IntegerType::UNSIGNED_INT:
+        return Literal{std::to_string(x.value) + "u"};
+    case IntegerType::UNSIGNED_LONG_LONG:
+        return Literal{std::to_string(x.value) + "ull"};
+    }
+    return {};
+}
+
+// a declared type without static or const qualifiers
+static std::string unqualified_type(const std::string& type)
+{
+    std::string result = type;
+    for(const std::string qualifier : {"static ", "constexpr ", "const "})
+    {
+        if(result.compare(0, qualifier.size(), qualifier) == 0)
+            result.erase(0, qualifier.size());
+    }
+    return result;
+}
+
+// type of the values of a declared type, if the simplifier can fold
+// them
+static std::optional<IntegerType> declared_integer_type(const std::string& type)
+{
+    auto unqualified = unqualified_type(type);
+    if(unqualified == "int" || unqualified == "signed int")
+        return IntegerType::INT;
+    if(unqualified == "unsigned int" || unqualified == "unsigned")
+        return IntegerType::UNSIGNED_INT;
+    if(unqualified == "size_t" || unqualified == "unsigned long long")
+        return IntegerType::UNSIGNED_LONG_LONG;
+    return {};
+}
+
+// an integer literal converted to a declared type, the way
+// initializing a variable of that type would convert it.  auto
+// keeps the literal's type.
+static std::optional<Expression> convert_literal_integer(const Expression&  value,
+                                                         const std::string& type)
+{
+    auto x = literal_integer_typed(value);
+    if(!x)
+        return {};
+    auto to = unqualified_type(type) == "auto" ? x->type : declared_integer_type(type);
+    if(!to)
+        return {};
+    // unsigned values that don't fit in an int convert to an
+    // implementation-defined value
+    if(*to == IntegerType::INT && x->type != IntegerType::INT
+       && x->value > static_cast<unsigned long long>(std::numeric_limits<int>::max()))
+        return {};
+    return make_literal_integer({*to, x->value & integer_mask(*to)});
+}
+
+enum class IntegerOp
+{
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    MODULUS,
+    SHIFT_LEFT,
+    SHIFT_RIGHT,
+    BIT_AND,
+};
+
+// Fold an operator on two integer literals the way C++ evaluates
+// it: both operands are converted to their common type (shifts have
+// the type of their left operand), and the arithmetic is done in
+// that type, so unsigned arithmetic wraps.  int arithmetic that
+// overflows is undefined and isn't folded, nor is division by zero
+// or a shift by the width of the type or more.
+static std::optional<IntegerLiteral>
+    fold_integers(IntegerOp op, const IntegerLiteral& a, const IntegerLiteral& b)
+{
+    bool shift = op == IntegerOp::SHIFT_LEFT || op == IntegerOp::SHIFT_RIGHT;
+    auto type  = shift ? a.type : std::max(a.type, b.type);
+    if(shift)
+    {
+        long long width = type == IntegerType::UNSIGNED_LONG_LONG ? 64 : 32;
+        if(b.type == IntegerType::INT ? b.signed_value() < 0 || b.signed_value() >= width
+                                      : b.value >= static_cast<unsigned long long>(width))
+            return {};
+    }
+    if((op == IntegerOp::DIVIDE || op == IntegerOp::MODULUS) && (b.value & integer_mask(type)) == 0)
+        return {};
+
+    if(type == IntegerType::INT)
+    {
+        // both operands are ints, so none of these overflow a long
+        // long
+        auto      x      = a.signed_value();
+        auto      y      = b.signed_value();
+        long long result = 0;
+        switch(op)
+        {
+        case IntegerOp::ADD:
+            result = x + y;
+            break;
+        case IntegerOp::SUBTRACT:
+            result = x - y;
+            break;
+        case IntegerOp::MULTIPLY:
+            result = x * y;
+            break;
+        case IntegerOp::DIVIDE:
+            result = x / y;
+            break;
+        case IntegerOp::MODULUS:
+            result = x % y;
+            break;
+        case IntegerOp::SHIFT_LEFT:
+        case IntegerOp::SHIFT_RIGHT:
+            // shifting negative values is undefined or
+            // implementation-defined
+            if(x < 0)
+                return {};
+            result = op == IntegerOp::SHIFT_LEFT ? x << y : x >> y;
+            break;
+        case IntegerOp::BIT_AND:
+            result = x & y;
+            break;
+        }
+        if(result < std::numeric_limits<int>::min() || result > std::numeric_limits<int>::max())
+            return {};
+        return IntegerLiteral{type, static_cast<unsigned long long>(result)};
+    }
+
+    auto               mask   = integer_mask(type);
+    auto               x      = a.value & mask;
+    auto               y      = shift ? b.value : b.value & mask;
+    unsigned long long result = 0;
+    switch(op)
+    {
+    case IntegerOp::ADD:
+        result = x + y;
+        break;
+    case IntegerOp::SUBTRACT:
+        result = x - y;
+        break;
+    case IntegerOp::MULTIPLY:
+        result = x * y;
+        break;
+    case IntegerOp::DIVIDE:
+        result = x / y;
+        break;
+    case IntegerOp::MODULUS:
+        result = x % y;
+        break;
+    case IntegerOp::SHIFT_LEFT:
+        result = x << y;
+        break;
+    case IntegerOp::SHIFT_RIGHT:
+        result = x >> y;
+        break;
+    case IntegerOp::BIT_AND:
+        result = x & y;
+        break;
+    }
+    return IntegerLiteral{type, result & mask};
+}
+
+// fold an operator over integer literals, left to right
+static std::optional<IntegerLiteral> fold_integers(IntegerOp                          op,
+                                                   const std::vector<IntegerLiteral>& values)
+{
+    std::optional<IntegerLiteral> result = values.front();
+    for(auto v = values.begin() + 1; result && v != values.end(); ++v)
+        result = fold_integers(op, *result, *v);
+    return result;
+}
+
+// compare two integer literals in their common type, returning a
+// value less than, equal to or greater than zero
+static int compare_integers(const IntegerLiteral& a, const IntegerLiteral& b)
+{
+    auto type = std::max(a.type, b.type);
+    if(type == IntegerType::INT)
+        return (a.signed_value() > b.signed_value()) - (a.signed_value() < b.signed_value());
+    auto mask = integer_mask(type);
+    auto x    = a.value & mask;
+    auto y    = b.value & mask;
+    return (x > y) - (x < y);
+}
+
+// true if a literal is a (possibly qualified) name
+static bool is_identifier(const std::string& str)
+{
+    return !str.empty() && !::isdigit(str.front())
+           && std::all_of(str.begin(), str.end(), [](char c) {
+                  return ::isalnum(c) || c == '_' || c == ':';
+              });
+}
+
+static Expression make_literal_bool(bool value)
+{
+    return Literal{value ? "true" : "false"};
+}
+
+// true if an expression always has type bool
+static bool is_boolean(const Expression& e)
+{
+    return literal_bool(e) || std::holds_alternative<Less>(e)
+           || std::holds_alternative<LessEqual>(e) || std::holds_alternative<Greater>(e)
+           || std::holds_alternative<GreaterEqual>(e) || std::holds_alternative<Equal>(e)
+           || std::holds_alternative<NotEqual>(e) || std::holds_alternative<And>(e)
+           || std::holds_alternative<Or>(e) || std::holds_alternative<Not>(e);
+}
+
+// true if evaluating an expression might do more than compute a
+// value
+struct SideEffectCheck
+{
+    bool operator()(const CallExpr&)
+    {
+        return true;
+    }
+    bool operator()(const PreIncrement&)
+    {
+        return true;
+    }
+    bool operator()(const PreDecrement&)
+    {
+        return true;
+    }
+    bool operator()(const Literal&)
+    {
+        return false;
+    }
+    bool operator()(const Variable& x)
+    {
+        return (x.index && std::visit(*this, *x.index))
+               || (x.index2D && std::visit(*this, *x.index2D));
+    }
+    bool operator()(const TwiddleMultiply&)
+    {
+        return false;
+    }
+    bool operator()(const TwiddleMultiplyConjugate&)
+    {
+        return false;
+    }
+    template <typename T>
+    bool operator()(const T& x)
+    {
+        for(const auto& arg : x.args)
+        {
+            if(std::visit(*this, arg))
+                return true;
+        }
+        return false;
+    }
+};
+
+static bool has_side_effects(const Expression& e)
+{
+    return std::visit(SideEffectCheck{}, e);
+}
+
+// Two literals known to be equal or unequal.  Identical identifiers
+// are equal, and enumerators of the same scoped enum with different
+// names are unequal (none of the enums used in kernels have
+// duplicate values).
+static std::optional<bool> literals_equal(const Expression& a, const Expression& b)
+{
+    auto int_a = literal_integer_typed(a);
+    auto int_b = literal_integer_typed(b);
+    if(int_a && int_b)
+        return compare_integers(*int_a, *int_b) == 0;
+    auto bool_a = literal_bool(a);
+    auto bool_b = literal_bool(b);
+    if(bool_a && bool_b)
+        return *bool_a == *bool_b;
+
+    auto lit_a = std::get_if<Literal>(&a);
+    auto lit_b = std::get_if<Literal>(&b);
+    if(!lit_a || !lit_b || !is_identifier(lit_a->value) || !is_identifier(lit_b->value))
+        return {};
+    if(lit_a->value == lit_b->value)
+        return true;
+    auto scope_a = lit_a->value.rfind("::");
+    auto scope_b = lit_b->value.rfind("::");
+    if(scope_a != std::string::npos && scope_a == scope_b
+       && lit_a->value.compare(0, scope_a, lit_b->value, 0, scope_b) == 0)
+        return false;
+    return {};
+}
+
+struct SimplifyVisitor : public BaseVisitor
+{
+    SimplifyVisitor(const function_names_t&                   names,
+                    const std::map<std::string, std::string>& globals)
+        : names(names)
+    {
+        // ignore globals that the function shadows or changes
+        for(const auto& g : globals)
+        {
+            auto info = names.find(g.first);
+            if(info == names.end()
+               || (info->second.declarations == 0 && info->second.stable()))
+                constants.insert(g);
+        }
+    }
+
+    const function_names_t&            names;
+    std::map<std::string, std::string> constants;
+
+    std::optional<Expression> constant(const std::string& name)
+    {
+        auto c = constants.find(name);
+        if(c == constants.end())
+            return {};
+        return Literal{c->second};
+    }
+
+    Expression visit_Literal(const Literal& x) override
+    {
+        if(auto c = constant(x.value))
+            return *c;
+        return x;
+    }
+
+    // names being declared or written are left alone, but their
+    // indexes are simplified
+    Variable visit_name(const Variable& x)
+    {
+        Variable y{x};
+        if(x.index)
+            y.index = std::visit(*this, *x.index);
+        if(x.index2D)
+            y.index2D = std::visit(*this, *x.index2D);
+        return y;
+    }
+
+    Expression visit_Variable(const Variable& x) override
+    {
+        if(!x.index && x.component == Component::BOTH)
+        {
+            if(auto c = constant(x.name))
+                return *c;
+        }
+        return visit_name(x);
+    }
+
+    // template arguments must stay names
+    ArgumentList visit_ArgumentList(const ArgumentList& x) override
+    {
+        return x;
+    }
+
+    StatementList visit_Assign(const Assign& x) override
+    {
+        return {Assign{visit_name(x.lhs), std::visit(*this, x.rhs), x.oper}};
+    }
+
+    StatementList visit_Declaration(const Declaration& x) override
+    {
+        if(!x.value)
+            return {x};
+        auto value = std::visit(*this, *x.value);
+
+        // remember locals that are initialized to a constant and
+        // never changed, so that uses of them can be simplified too
+        // integers are converted to the local's type, so that
+        // arithmetic on them is folded in that type
+        auto info = names.find(x.var.name);
+        if(info != names.end() && info->second.declarations == 1 && info->second.stable()
+           && !x.var.pointer && !x.var.size && x.var.type.find('*') == std::string::npos)
+        {
+            auto type = unqualified_type(x.var.type);
+            if(literal_bool(value) && (type == "bool" || type == "auto"))
+                constants[x.var.name] = std::get<Literal>(value).value;
+            else if(auto converted = convert_literal_integer(value, x.var.type))
+                constants[x.var.name] = std::get<Literal>(*converted).value;
+        }
+
+        return {Declaration{x.var, value}};
+    }
+
+    StatementList visit_For(const For& x) override
+    {
+        auto initial   = std::visit(*this, x.initial);
+        auto condition = std::visit(*this, x.condition);
+        auto increment = std::visit(*this, x.increment);
+        auto body      = visit_StatementList(x.body);
+        return {For(x.var, initial, condition, increment, body, x.pragma_unroll)};
+    }
+
+    StatementList visit_StoreGlobalPlanar(const StoreGlobalPlanar& x) override
+    {
+        return {StoreGlobalPlanar(x.realPtr,
+                                  x.imagPtr,
+                                  std::visit(*this, x.index),
+                                  std::visit(*this, x.value))};
+    }
+
+    StatementList visit_While(const While& x) override
+    {
+        auto condition = std::visit(*this, x.condition);
+        if(literal_bool(condition) == false)
+            return {};
+        return {While(condition, visit_StatementList(x.body))};
+    }
+
+    // visit all arguments, returning integer values if they're all
+    // integer literals
+    template <typename T>
+    std::vector<Expression> visit_args(const T& x, std::vector<IntegerLiteral>& values)
+    {
+        std::vector<Expression> args;
+        for(const auto& arg : x.args)
+        {
+            args.emplace_back(std::visit(*this, arg));
+            if(auto value = literal_integer_typed(args.back()))
+                values.push_back(*value);
+        }
+        if(values.size() != args.size())
+            values.clear();
+        return args;
+    }
+
+    // remove literal arguments that don't change the result, keeping
+    // at least one argument.  unsigned literals are kept, since they
+    // might change the type of the result.
+    static void remove_identity(std::vector<Expression>& args, long long identity, size_t first)
+    {
+        for(size_t i = first; i < args.size() && args.size() > 1;)
+        {
+            auto value = literal_integer_typed(args[i]);
+            if(value && value->type == IntegerType::INT && value->signed_value() == identity)
+                args.erase(args.begin() + i);
+            else
+                ++i;
+        }
+    }
+
+    template <typename T>
+    static Expression make_oper(std::vector<Expression>&& args)
+    {
+        if(args.size() == 1)
+            return std::move(args.front());
+        return T{std::move(args)};
+    }
+
+    // fold all-literal arguments, if the result can be written as a
+    // literal
+    template <typename T>
+    std::optional<Expression> fold_args(const T& x, IntegerOp op, std::vector<Expression>& args)
+    {
+        std::vector<IntegerLiteral> values;
+        args = visit_args(x, values);
+        if(values.empty())
+            return {};
+        if(auto result = fold_integers(op, values))
+            return make_literal_integer(*result);
+        return {};
+    }
+
+    Expression visit_Add(const Add& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::ADD, args))
+            return *result;
+        remove_identity(args, 0, 0);
+        return make_oper<Add>(std::move(args));
+    }
+
+    Expression visit_Subtract(const Subtract& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::SUBTRACT, args))
+            return *result;
+        remove_identity(args, 0, 1);
+        return make_oper<Subtract>(std::move(args));
+    }
+
+    Expression visit_Multiply(const Multiply& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::MULTIPLY, args))
+            return *result;
+        remove_identity(args, 1, 0);
+        return make_oper<Multiply>(std::move(args));
+    }
+
+    Expression visit_Divide(const Divide& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::DIVIDE, args))
+            return *result;
+        remove_identity(args, 1, 1);
+        return make_oper<Divide>(std::move(args));
+    }
+
+    Expression visit_Modulus(const Modulus& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::MODULUS, args))
+            return *result;
+        return Modulus{std::move(args)};
+    }
+
+    Expression visit_ShiftLeft(const ShiftLeft& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::SHIFT_LEFT, args))
+            return *result;
+        remove_identity(args, 0, 1);
+        return make_oper<ShiftLeft>(std::move(args));
+    }
+
+    Expression visit_ShiftRight(const ShiftRight& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::SHIFT_RIGHT, args))
+            return *result;
+        remove_identity(args, 0, 1);
+        return make_oper<ShiftRight>(std::move(args));
+    }
+
+    Expression visit_BitAnd(const BitAnd& x) override
+    {
+        std::vector<Expression> args;
+        if(auto result = fold_args(x, IntegerOp::BIT_AND, args))
+            return *result;
+        return BitAnd{std::move(args)};
+    }
+
+#define SIMPLIFY_COMPARE(CLS, OPER)                                                  \
+    Expression visit_##CLS(const CLS& x) override                                    \
+    {                                                                                \
+        std::vector<IntegerLiteral> values;                                          \
+        auto                        args = visit_args(x, values);                    \
+        if(values.size() == 2)                                                       \
+            return make_literal_bool(compare_integers(values[0], values[1]) OPER 0); \
+        return CLS{std::move(args)};                                                 \
+    }
+
+    SIMPLIFY_COMPARE(Less, <);
+    SIMPLIFY_COMPARE(LessEqual, <=);
+    SIMPLIFY_COMPARE(Greater, >);
+    SIMPLIFY_COMPARE(GreaterEqual, >=);
+
+    Expression visit_Equal(const Equal& x) override
+    {
+        std::vector<IntegerLiteral> values;
+        auto                        args = visit_args(x, values);
+        if(args.size() == 2)
+        {
+            if(auto equal = literals_equal(args[0], args[1]))
+                return make_literal_bool(*equal);
+        }
+        return Equal{std::move(args)};
+    }
+
+    Expression visit_NotEqual(const NotEqual& x) override
+    {
+        std::vector<IntegerLiteral> values;
+        auto                        args = visit_args(x, values);
+        if(args.size() == 2)
+        {
+            if(auto equal = literals_equal(args[0], args[1]))
+                return make_literal_bool(!*equal);
+        }
+        return NotEqual{std::move(args)};
+    }
+
+    Expression visit_UnaryMinus(const UnaryMinus& x) override
+    {
+        auto arg = std::visit(*this, x.args.front());
+        if(auto value = literal_integer_typed(arg))
+        {
+            // negating an unsigned value wraps, like subtracting it
+            // from zero
+            if(auto negated = fold_integers(IntegerOp::SUBTRACT, {value->type, 0}, *value))
+            {
+                if(auto result = make_literal_integer(*negated))
+                    return *result;
+            }
+        }
+        return UnaryMinus{arg};
+    }
+
+    Expression visit_Not(const Not& x) override
+    {
+        auto arg = std::visit(*this, x.args.front());
+        if(auto value = literal_bool(arg))
+            return make_literal_bool(!*value);
+        return Not{arg};
+    }
+
+    // For && and ||: an argument equal to "identity" can be dropped,
+    // and an argument equal to !identity decides the result if the
+    // arguments before it can be skipped.
+    template <typename T>
+    Expression simplify_logical(const T& x, bool identity)
+    {
+        std::vector<Expression> args;
+        for(const auto& arg : x.args)
+        {
+            auto y     = std::visit(*this, arg);
+            auto value = literal_bool(y);
+            if(value == identity)
+                continue;
+            if(value == !identity)
+            {
+                if(std::none_of(args.begin(), args.end(), has_side_effects))
+                    return make_literal_bool(!identity);
+                args.push_back(std::move(y));
+                // later arguments are never evaluated
+                break;
+            }
+            args.push_back(std::move(y));
+        }
+        if(args.empty())
+            return make_literal_bool(identity);
+        // a single argument needs to still be a bool
+        if(args.size() == 1 && is_boolean(args.front()))
+            return std::move(args.front());
+        if(args.size() == 1)
+            args.push_back(make_literal_bool(identity));
+        return T{std::move(args)};
+    }
+
+    Expression visit_And(const And& x) override
+    {
+        return simplify_logical(x, true);
+    }
+
+    Expression visit_Or(const Or& x) override
+    {
+        return simplify_logical(x, false);
+    }
+
+    Expression visit_Ternary(const Ternary& x) override
+    {
+        auto condition = std::visit(*this, x.args[0]);
+        if(auto value = literal_bool(condition))
+            return std::visit(*this, x.args[*value ? 1 : 2]);
+        return Ternary{
+            std::move(condition), std::visit(*this, x.args[1]), std::visit(*this, x.args[2])};
+    }
+
+    // parens around a name or non-negative number aren't needed
+    Expression visit_Parens(const Parens& x) override
+    {
+        auto inside = std::visit(*this, x.args.front());
+        auto value  = literal_integer(inside);
+        auto lit    = std::get_if<Literal>(&inside);
+        if(std::holds_alternative<Parens>(inside) || std::holds_alternative<Variable>(inside)
+           || (value && *value >= 0) || (lit && is_identifier(lit->value)))
+            return inside;
+        return Parens{std::move(inside)};
+    }
+
+    // true if a block can be inlined into its parent without
+    // changing what names are in scope
+    static bool declares_names(const StatementList& block)
+    {
+        return std::any_of(block.statements.begin(), block.statements.end(), [](const auto& s) {
+            return std::holds_alternative<Declaration>(s)
+                   || std::holds_alternative<LDSDeclaration>(s)
+                   || std::holds_alternative<CallbackLoadDeclaration>(s)
+                   || std::holds_alternative<CallbackStoreDeclaration>(s);
+        });
+    }
+
+    // remove branches of if/else if/else chains whose conditions are
+    // known
+    StatementList visit_StatementList(const StatementList& x) override
+    {
+        auto          visited = BaseVisitor::visit_StatementList(x);
+        StatementList y;
+        auto&         stmts = visited.statements;
+        for(size_t i = 0; i < stmts.size(); ++i)
+        {
+            if(!std::holds_alternative<If>(stmts[i]))
+            {
+                y.statements.push_back(std::move(stmts[i]));
+                continue;
+            }
+
+            // collect the branches of the chain that might be taken -
+            // a branch without a condition is always taken
+            std::vector<std::pair<OptionalExpression, StatementList>> branches;
+            bool                                                      decided = false;
+            for(auto j = i; j < stmts.size(); ++j)
+            {
+                const Expression*    condition = nullptr;
+                const StatementList* body      = nullptr;
+                if(auto s = std::get_if<If>(&stmts[j]); s && j == i)
+                    condition = &s->condition, body = &s->body;
+                else if(auto s = std::get_if<ElseIf>(&stmts[j]))
+                    condition = &s->condition, body = &s->body;
+                else if(auto s = std::get_if<Else>(&stmts[j]))
+                    body = &s->body;
+                else
+                    break;
+                i = j;
+
+                if(decided)
+                    continue;
+                auto value = condition ? literal_bool(*condition) : std::optional<bool>(true);
+                if(value == false)
+                    continue;
+                branches.emplace_back();
+                if(value != true)
+                    branches.back().first = *condition;
+                branches.back().second = *body;
+                if(value == true)
+                    decided = true;
+                if(!condition)
+                    break;
+            }
+
+            for(size_t b = 0; b < branches.size(); ++b)
+            {
+                auto& [condition, body] = branches[b];
+                if(b == 0 && !condition)
+                {
+                    if(declares_names(body))
+                        y += If{Literal{"true"}, body};
+                    else
+                        y += std::move(body);
+                }
+                else if(b == 0)
+                    y += If{*condition, body};
+                else if(condition)
+                    y += ElseIf{*condition, body};
+                else
+                    y += Else{body};
+            }
+        }
+        return y;
+    }
+};
+
+Function make_simplify(const Function& f, const std::map<std::string, std::string>& globals)
+{
+    auto names = scan_function_names(f);
+
+    // integer values given for arguments have the arguments' types
+    auto typed_globals = globals;
+    for(const auto& arg : f.arguments.arguments)
+    {
+        auto g = typed_globals.find(arg.name);
+        if(g == typed_globals.end() || !literal_integer_typed(Literal{g->second}))
+            continue;
+        if(auto converted = convert_literal_integer(Literal{g->second}, arg.type))
+            g->second = std::get<Literal>(*converted).value;
+        else
+            typed_globals.erase(g);
+    }
+
+    SimplifyVisitor visitor{names, typed_globals};
+    auto            y = visitor(f);
+    // BaseVisitor::visit_Function doesn't copy these
+    y.return_type = f.return_type;
+    return y;
+}
+
+//
+// Static cost analysis
+//
+
+// number of times a for loop runs, if its bounds are literals
+static std::optional<long long> for_trip_count(const For& x)
+{
+    auto initial   = literal_integer(x.initial);
+    auto increment = literal_integer(x.increment);
+    if(!initial || !increment || *increment <= 0)
+        return {};
+
+    // condition compares the loop variable to a literal
+    std::optional<long long> bound;
+    bool                     inclusive = false;
+    if(auto less = std::get_if<Less>(&x.condition))
+        bound = literal_integer(less->args.back());
+    else if(auto less_equal = std::get_if<LessEqual>(&x.condition))
+    {
+        bound     = literal_integer(less_equal->args.back());
+        inclusive = true;
+    }
+    if(!bound)
+        return {};
+
+    auto end = *bound + (inclusive ? 1 : 0);
+    if(end <= *initial)
+        return 0;
+    return (end - *initial + *increment - 1) / *increment;
+}
+
+// indexed accesses to these names are LDS accesses
+static bool is_lds_access(const Variable& x)
+{
+    return x.index && x.name.compare(0, 3, "lds") == 0;
+}
+
+struct ProfileCounter
+{
+    std::map<std::string, const Function*> callees;
+    // profiles of callees, once they've been counted
+    std::map<std::string, KernelProfile> callee_profiles;
+    // callees we're in the middle of counting, to stop recursion
+    std::set<std::string> in_progress;
+    // most registers any callee needs on top of the caller's
+    size_t callee_registers = 0;
+
+    explicit ProfileCounter(const std::vector<const Function*>& callee_list)
+    {
+        for(auto f : callee_list)
+            callees[f->name] = f;
+    }
+
+    void count_call(const std::string& name, KernelProfile& p)
+    {
+        auto callee = callees.find(name);
+        if(callee == callees.end() || in_progress.count(name))
+            return;
+        auto cached = callee_profiles.find(name);
+        if(cached == callee_profiles.end())
+        {
+            in_progress.insert(name);
+            // callee's registers are only live while it runs, so
+            // they don't accumulate with the caller's declarations
+            auto saved_callee_registers = callee_registers;
+            callee_registers            = 0;
+
+            auto callee_profile = count(callee->second->body);
+            callee_profile.registers += callee_registers;
+
+            callee_registers = saved_callee_registers;
+            in_progress.erase(name);
+            cached = callee_profiles.emplace(name, callee_profile).first;
+        }
+        auto callee_profile = cached->second;
+        callee_registers    = std::max(callee_registers, callee_profile.registers);
+        callee_profile.registers = 0;
+        p += callee_profile;
+    }
+
+    void count(const Expression& expr, KernelProfile& p)
+    {
+        std::visit([this, &p](const auto& x) { count_expr(x, p); }, expr);
+    }
+    void count_expr(const Literal&, KernelProfile&) {}
+    void count_expr(const Variable& x, KernelProfile& p)
+    {
+        if(is_lds_access(x))
+            ++p.lds_reads;
+        if(x.index)
+            count(*x.index, p);
+        if(x.index2D)
+            count(*x.index2D, p);
+    }
+    void count_expr(const CallExpr& x, KernelProfile& p)
+    {
+        for(const auto& arg : x.arguments)
+            count(arg, p);
+        count_call(x.name, p);
+    }
+    void count_expr(const TwiddleMultiply& x, KernelProfile& p)
+    {
+        p.flops += 6;
+        for(const auto& var : x.vars)
+            count_expr(var, p);
+    }
+    void count_expr(const TwiddleMultiplyConjugate& x, KernelProfile& p)
+    {
+        p.flops += 6;
+        for(const auto& var : x.vars)
+            count_expr(var, p);
+    }
+    void count_expr(const ComplexMultiply& x, KernelProfile& p)
+    {
+        p.flops += 6;
+        count_args(x, p);
+    }
+    void count_expr(const LoadGlobal& x, KernelProfile& p)
+    {
+        ++p.global_loads;
+        count_args(x, p);
+    }
+    void count_expr(const LoadGlobalPlanar& x, KernelProfile& p)
+    {
+        ++p.global_loads;
+        count_args(x, p);
+    }
+    void count_expr(const IntrinsicLoad& x, KernelProfile& p)
+    {
+        ++p.global_loads;
+        count_args(x, p);
+    }
+    void count_expr(const IntrinsicLoadPlanar& x, KernelProfile& p)
+    {
+        ++p.global_loads;
+        count_args(x, p);
+    }
+    void count_expr(const Ternary& x, KernelProfile& p)
+    {
+        // only one of the results is evaluated
+        count(x.args[0], p);
+        KernelProfile true_result, false_result;
+        count(x.args[1], true_result);
+        count(x.args[2], false_result);
+        true_result.max(false_result);
+        p += true_result;
+    }
+    // everything else keeps its children in args
+    template <typename T>
+    void count_expr(const T& x, KernelProfile& p)
+    {
+        count_args(x, p);
+    }
+    template <typename T>
+    void count_args(const T& x, KernelProfile& p)
+    {
+        for(const auto& arg : x.args)
+            count(arg, p);
+    }
+
+    // a write to a variable, which might be in LDS
+    void count_write(const Variable& x, KernelProfile& p)
+    {
+        if(is_lds_access(x))
+            ++p.lds_writes;
+        if(x.index)
+            count(*x.index, p);
+        if(x.index2D)
+            count(*x.index2D, p);
+    }
+
+    KernelProfile count(const StatementList& block)
+    {
+        KernelProfile p;
+        // most expensive branch of the if/else chain we're in
+        std::optional<KernelProfile> branches;
+        for(const auto& stmt : block.statements)
+        {
+            auto branch_body = [this](const Expression* condition, const StatementList& body) {
+                KernelProfile branch;
+                if(condition)
+                    count(*condition, branch);
+                branch += count(body);
+                return branch;
+            };
+            if(auto x = std::get_if<If>(&stmt))
+            {
+                if(branches)
+                    p += *branches;
+                branches = branch_body(&x->condition, x->body);
+                continue;
+            }
+            if(auto x = std::get_if<ElseIf>(&stmt))
+            {
+                auto branch = branch_body(&x->condition, x->body);
+                if(branches)
+                    branches->max(branch);
+                else
+                    branches = branch;
+                continue;
+            }
+            if(auto x = std::get_if<Else>(&stmt))
+            {
+                auto branch = branch_body(nullptr, x->body);
+                if(branches)
+                    branches->max(branch);
+                else
+                    branches = branch;
+                continue;
+            }
+            if(branches)
+            {
+                p += *branches;
+                branches.reset();
+            }
+            std::visit([this, &p](const auto& x) { count_stmt(x, p); }, stmt);
+        }
+        if(branches)
+            p += *branches;
+        return p;
+    }
+
+    void count_stmt(const Assign& x, KernelProfile& p)
+    {
+        // compound assignments read the old value too
+        if(x.oper != "=")
+            count_expr(x.lhs, p);
+        count_write(x.lhs, p);
+        count(x.rhs, p);
+    }
+    void count_stmt(const Declaration& x, KernelProfile& p)
+    {
+        if(!x.var.pointer && x.var.type.find("scalar_type") != std::string::npos
+           && x.var.type.find("real_type_t") == std::string::npos)
+        {
+            auto size = x.var.size ? literal_integer(*x.var.size) : std::optional<long long>(1);
+            p.registers += size ? *size : 1;
+        }
+        if(x.value)
+            count(*x.value, p);
+    }
+    void count_stmt(const For& x, KernelProfile& p)
+    {
+        count(x.initial, p);
+        auto body = count(x.body);
+        count(x.condition, body);
+        if(auto trips = for_trip_count(x))
+        {
+            auto registers = body.registers;
+            body *= *trips;
+            body.registers = registers;
+        }
+        p += body;
+    }
+    void count_stmt(const While& x, KernelProfile& p)
+    {
+        count(x.condition, p);
+        p += count(x.body);
+    }
+    void count_stmt(const Call& x, KernelProfile& p)
+    {
+        count_expr(x.expr, p);
+    }
+    void count_stmt(const ReturnExpr& x, KernelProfile& p)
+    {
+        count(x.expr, p);
+    }
+    void count_stmt(const StoreGlobal& x, KernelProfile& p)
+    {
+        ++p.global_stores;
+        count(x.ptr, p);
+        count(x.index, p);
+        count(x.value, p);
+    }
+    void count_stmt(const StoreGlobalPlanar& x, KernelProfile& p)
+    {
+        ++p.global_stores;
+        count(x.index, p);
+        count(x.value, p);
+    }
+    void count_stmt(const IntrinsicStore& x, KernelProfile& p)
+    {
+        ++p.global_stores;
+        for(const auto& e : {x.ptr, x.voffset, x.soffset, x.value, x.rw_flag})
+            count(e, p);
+    }
+    void count_stmt(const IntrinsicStorePlanar& x, KernelProfile& p)
+    {
+        ++p.global_stores;
+        for(const auto& e : {x.ptrre, x.ptrim, x.voffset, x.soffset, x.value, x.rw_flag})
+            count(e, p);
+    }
+    void count_stmt(const IntrinsicLoadToDest& x, KernelProfile& p)
+    {
+        ++p.global_loads;
+        if(auto dest = std::get_if<Variable>(&x.dest))
+            count_write(*dest, p);
+        for(const auto& e : {x.data, x.voffset, x.soffset, x.rw_flag})
+            count(e, p);
+    }
+    void count_stmt(const Butterfly& x, KernelProfile& p)
+    {
+        // the usual 5 N log2(N) estimate for a length-N DFT, or
+        // split-radix's 4 N log2(N) - 6 N + 8
+        auto radix = static_cast<double>(x.args.size());
+        if(x.split_radix)
+            p.flops += 4.0 * radix * std::log2(radix) - 6.0 * radix + 8.0;
+        else if(radix > 1)
+            p.flops += 5.0 * radix * std::log2(radix);
+        for(const auto& arg : x.args)
+            count(arg, p);
+    }
+    void count_stmt(const SyncThreads&, KernelProfile& p)
+    {
+        ++p.syncthreads;
+    }
+    // remaining statements do no work that we count
+    template <typename T>
+    void count_stmt(const T&, KernelProfile&)
+    {
+    }
+};
+
+KernelProfile profile_statements(const StatementList&                stmts,
+                                 const std::vector<const Function*>& callees)
+{
+    ProfileCounter counter(callees);
+    auto           p = counter.count(stmts);
+    p.registers += counter.callee_registers;
+    return p;
+}
+
+KernelProfile profile_function(const Function& f, const std::vector<const Function*>& callees)
+{
+    return profile_statements(f.body, callees);
+}
+
+//
+// LDS bank conflict simulation
+//
+
+// a value known while simulating a thread: an integer (bools are 0
+// or 1), or the name of an enumerator
+struct SimValue
+{
+    std::optional<long long> number;
+    std::string              symbol;
+
+    SimValue() = default;
+    SimValue(long long number)
+        : number(number)
+    {
+    }
+    explicit SimValue(const std::string& symbol)
+        : symbol(symbol)
+    {
+    }
+    bool known() const
+    {
+        return number || !symbol.empty();
+    }
+};
+
+// one LDS access made by one thread
+struct LDSAccessRecord
+{
+    // barriers the thread executed before the access
+    size_t step;
+    // where the access is in the source, and how many times the
+    // thread made it before - lanes that agree on both are executing
+    // the same instruction
+    const void* site;
+    size_t      occurrence;
+    bool        write;
+    long long   address;
+    size_t      bytes;
+};
+
+struct LDSThreadSimulator
+{
+    // loops that run longer than this are assumed to not terminate
+    static const size_t max_trips = 65536;
+
+    const LDSSimulation&                         sim;
+    std::map<std::string, const Function*>       callees;
+    std::map<std::string, SimValue>              thread_values;
+    std::vector<std::map<std::string, SimValue>> frames;
+    std::map<const void*, size_t>                occurrences;
+    std::vector<LDSAccessRecord>                 accesses;
+    size_t                                       unresolved = 0;
+    size_t                                       step       = 0;
+
+    // set by return statements and breaks, until the function or
+    // loop they leave sees them
+    bool     returning = false;
+    bool     breaking  = false;
+    SimValue return_value;
+
+    LDSThreadSimulator(const LDSSimulation&                sim,
+                       const std::vector<const Function*>& callee_list,
+                       unsigned int                        thread)
+        : sim(sim)
+    {
+        for(auto f : callee_list)
+            callees[f->name] = f;
+        thread_values["threadIdx.x"] = static_cast<long long>(thread);
+        thread_values["blockIdx.x"]  = static_cast<long long>(sim.block_id);
+        thread_values["blockDim.x"]  = static_cast<long long>(sim.block_size);
+    }
+
+    SimValue lookup(const std::string& name)
+    {
+        if(!frames.empty())
+        {
+            auto local = frames.back().find(name);
+            if(local != frames.back().end())
+                return local->second;
+        }
+        auto value = thread_values.find(name);
+        if(value != thread_values.end())
+            return value->second;
+        auto scalar = sim.scalars.find(name);
+        if(scalar != sim.scalars.end())
+            return scalar->second;
+        auto global = sim.globals.find(name);
+        if(global != sim.globals.end() && global->second != name)
+            return eval_expr(Literal{global->second});
+        return {};
+    }
+
+    void access_lds(const Variable& x, bool write)
+    {
+        auto index = eval(*x.index);
+        if(!index.number)
+        {
+            ++unresolved;
+            return;
+        }
+        size_t    bytes   = x.name == "lds_real" ? sim.real_bytes : 2 * sim.real_bytes;
+        long long address = *index.number * static_cast<long long>(bytes);
+        // one component of a complex value
+        if(x.component != Component::BOTH)
+        {
+            bytes /= 2;
+            if(x.component == Component::IMAG)
+                address += bytes;
+        }
+        accesses.push_back({step, &x, occurrences[&x]++, write, address, bytes});
+    }
+
+    SimValue eval(const Expression& expr)
+    {
+        return std::visit([this](const auto& x) { return eval_expr(x); }, expr);
+    }
+
+    SimValue eval_expr(const Literal& x)
+    {
+        if(auto value = literal_integer(x))
+            return *value;
+        if(auto value = literal_bool(x))
+            return *value ? 1 : 0;
+        if(!is_identifier(x.value))
+            return {};
+        // names that aren't values are enumerators
+        auto value = lookup(x.value);
+        return value.known() ? value : SimValue{x.value};
+    }
+    SimValue eval_expr(const Variable& x)
+    {
+        if(is_lds_access(x))
+        {
+            access_lds(x, false);
+            return {};
+        }
+        if(x.index)
+        {
+            auto index = eval(*x.index);
+            auto array = sim.arrays.find(x.name);
+            if(array == sim.arrays.end() || !index.number || *index.number < 0
+               || static_cast<size_t>(*index.number) >= array->second.size())
+                return {};
+            return array->second[*index.number];
+        }
+        if(x.component != Component::BOTH)
+            return {};
+        return lookup(x.name);
+    }
+
+    // evaluate all arguments of an operator, and combine them from
+    // left to right if they're all known
+    template <typename T, typename Op>
+    SimValue fold(const T& x, Op op)
+    {
+        std::vector<SimValue> values;
+        for(const auto& arg : x.args)
+            values.push_back(eval(arg));
+        auto unknown = [](const SimValue& v) { return !v.number; };
+        if(values.empty() || std::any_of(values.begin(), values.end(), unknown))
+            return {};
+        auto result = values.front().number;
+        for(auto v = values.begin() + 1; v != values.end() && result; ++v)
+            result = op(*result, *v->number);
+        return result ? SimValue{*result} : SimValue{};
+    }
+
+    SimValue eval_expr(const Add& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a + b); });
+    }
+    SimValue eval_expr(const Subtract& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a - b); });
+    }
+    SimValue eval_expr(const Multiply& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a * b); });
+    }
+    SimValue eval_expr(const Divide& x)
+    {
+        return fold(x, [](long long a, long long b) {
+            return b ? std::optional<long long>(a / b) : std::nullopt;
+        });
+    }
+    SimValue eval_expr(const Modulus& x)
+    {
+        return fold(x, [](long long a, long long b) {
+            return b ? std::optional<long long>(a % b) : std::nullopt;
+        });
+    }
+    SimValue eval_expr(const ShiftLeft& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a << b); });
+    }
+    SimValue eval_expr(const ShiftRight& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a >> b); });
+    }
+    SimValue eval_expr(const BitAnd& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a & b); });
+    }
+    SimValue eval_expr(const Less& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a < b); });
+    }
+    SimValue eval_expr(const LessEqual& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a <= b); });
+    }
+    SimValue eval_expr(const Greater& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a > b); });
+    }
+    SimValue eval_expr(const GreaterEqual& x)
+    {
+        return fold(x, [](long long a, long long b) { return std::optional<long long>(a >= b); });
+    }
+
+    // enumerators are compared by name
+    std::optional<bool> equal(const Expression& a, const Expression& b)
+    {
+        auto value_a = eval(a);
+        auto value_b = eval(b);
+        if(value_a.number && value_b.number)
+            return *value_a.number == *value_b.number;
+        if(!value_a.symbol.empty() && !value_b.symbol.empty())
+            return value_a.symbol == value_b.symbol;
+        return {};
+    }
+    SimValue eval_expr(const Equal& x)
+    {
+        auto result = equal(x.args[0], x.args[1]);
+        return result ? SimValue{*result} : SimValue{};
+    }
+    SimValue eval_expr(const NotEqual& x)
+    {
+        auto result = equal(x.args[0], x.args[1]);
+        return result ? SimValue{!*result} : SimValue{};
+    }
+
+    // && and || stop at the first argument that decides the result
+    template <typename T>
+    SimValue logical(const T& x, bool identity)
+    {
+        bool known = true;
+        for(const auto& arg : x.args)
+        {
+            auto value = eval(arg);
+            if(!value.number)
+                known = false;
+            else if((*value.number != 0) != identity)
+                return !identity;
+        }
+        return known ? SimValue{identity} : SimValue{};
+    }
+    SimValue eval_expr(const And& x)
+    {
+        return logical(x, true);
+    }
+    SimValue eval_expr(const Or& x)
+    {
+        return logical(x, false);
+    }
+    SimValue eval_expr(const Not& x)
+    {
+        auto value = eval(x.args.front());
+        return value.number ? SimValue{*value.number == 0} : SimValue{};
+    }
+    SimValue eval_expr(const UnaryMinus& x)
+    {
+        auto value = eval(x.args.front());
+        return value.number ? SimValue{-*value.number} : SimValue{};
+    }
+    SimValue eval_expr(const PreIncrement& x)
+    {
+        return increment(x.args.front(), 1);
+    }
+    SimValue eval_expr(const PreDecrement& x)
+    {
+        return increment(x.args.front(), -1);
+    }
+    SimValue increment(const Expression& arg, long long delta)
+    {
+        auto var = std::get_if<Variable>(&arg);
+        if(!var || var->index || frames.empty())
+            return {};
+        auto& value = frames.back()[var->name];
+        value       = value.number ? SimValue{*value.number + delta} : SimValue{};
+        return value;
+    }
+    SimValue eval_expr(const Ternary& x)
+    {
+        auto condition = eval(x.args[0]);
+        if(!condition.number)
+        {
+            ++unresolved;
+            return {};
+        }
+        return eval(x.args[*condition.number ? 1 : 2]);
+    }
+    SimValue eval_expr(const Parens& x)
+    {
+        return eval(x.args.front());
+    }
+    SimValue eval_expr(const CallExpr& x)
+    {
+        std::vector<SimValue> args;
+        for(const auto& arg : x.arguments)
+            args.push_back(eval(arg));
+
+        auto callee = callees.find(x.name);
+        if(callee == callees.end())
+            return {};
+        const auto& f = *callee->second;
+
+        std::map<std::string, SimValue> frame;
+        for(size_t i = 0; i < f.arguments.arguments.size() && i < args.size(); ++i)
+            frame[f.arguments.arguments[i].name] = args[i];
+        for(size_t i = 0; i < f.templates.arguments.size() && i < x.templates.arguments.size();
+            ++i)
+            frame[f.templates.arguments[i].name] = template_value(x.templates.arguments[i].name);
+
+        frames.push_back(std::move(frame));
+        exec(f.body);
+        frames.pop_back();
+        returning = false;
+
+        auto result  = return_value;
+        return_value = {};
+        return result;
+    }
+    // global memory, and arithmetic on complex values
+    SimValue eval_expr(const TwiddleMultiply&)
+    {
+        return {};
+    }
+    SimValue eval_expr(const TwiddleMultiplyConjugate&)
+    {
+        return {};
+    }
+    template <typename T>
+    SimValue eval_expr(const T& x)
+    {
+        for(const auto& arg : x.args)
+            eval(arg);
+        return {};
+    }
+
+    // template arguments are names or expressions rendered as text,
+    // e.g. "lds_linear ? SB_UNIT : SB_NONUNIT"
+    SimValue template_value(const std::string& text)
+    {
+        auto question = text.find(" ? ");
+        auto colon    = text.find(" : ", question);
+        if(question != std::string::npos && colon != std::string::npos)
+        {
+            auto condition = template_value(text.substr(0, question));
+            if(!condition.number)
+                return {};
+            if(*condition.number)
+                return template_value(text.substr(question + 3, colon - question - 3));
+            return template_value(text.substr(colon + 3));
+        }
+        return eval_expr(Literal{text});
+    }
+
+    void exec(const StatementList& block)
+    {
+        // true once a branch of the current if/else chain is taken
+        bool taken = false;
+        for(const auto& stmt : block.statements)
+        {
+            if(returning || breaking)
+                return;
+            if(auto x = std::get_if<If>(&stmt))
+                taken = branch(x->condition, x->body);
+            else if(auto x = std::get_if<ElseIf>(&stmt))
+                taken = taken || branch(x->condition, x->body);
+            else if(auto x = std::get_if<Else>(&stmt))
+            {
+                if(!taken)
+                    exec(x->body);
+                taken = true;
+            }
+            else
+                std::visit([this](const auto& x) { exec_stmt(x); }, stmt);
+        }
+    }
+
+    // run a branch if its condition is true, and return true if the
+    // rest of the chain should be skipped
+    bool branch(const Expression& condition, const StatementList& body)
+    {
+        auto value = eval(condition);
+        if(!value.number)
+        {
+            ++unresolved;
+            return true;
+        }
+        if(*value.number == 0)
+            return false;
+        exec(body);
+        return true;
+    }
+
+    void exec_stmt(const Assign& x)
+    {
+        auto value = eval(x.rhs);
+        if(is_lds_access(x.lhs))
+        {
+            if(x.oper != "=")
+                access_lds(x.lhs, false);
+            access_lds(x.lhs, true);
+            return;
+        }
+        if(x.lhs.index)
+        {
+            eval(*x.lhs.index);
+            return;
+        }
+        if(x.lhs.component != Component::BOTH || frames.empty())
+            return;
+
+        auto& var = frames.back()[x.lhs.name];
+        if(x.oper == "=")
+            var = value;
+        else if(var.number && value.number && x.oper == "+=")
+            var = *var.number + *value.number;
+        else if(var.number && value.number && x.oper == "-=")
+            var = *var.number - *value.number;
+        else if(var.number && value.number && x.oper == "*=")
+            var = *var.number * *value.number;
+        else if(var.number && value.number && *value.number && x.oper == "%=")
+            var = *var.number % *value.number;
+        else
+            var = {};
+    }
+    void exec_stmt(const Declaration& x)
+    {
+        auto value = x.value ? eval(*x.value) : SimValue{};
+        if(x.var.size)
+            value = {};
+        frames.back()[x.var.name] = value;
+    }
+    // run a loop body until the loop's condition is false, or isn't
+    // known
+    template <typename Next>
+    void loop(const Expression& condition, const StatementList& body, Next next)
+    {
+        for(size_t trips = 0;; ++trips)
+        {
+            auto value = eval(condition);
+            if(!value.number || trips == max_trips)
+            {
+                ++unresolved;
+                return;
+            }
+            if(*value.number == 0)
+                return;
+            exec(body);
+            if(returning)
+                return;
+            if(breaking)
+            {
+                breaking = false;
+                return;
+            }
+            next();
+        }
+    }
+    void exec_stmt(const For& x)
+    {
+        frames.back()[x.var.name] = eval(x.initial);
+        loop(x.condition, x.body, [this, &x]() {
+            auto  increment = eval(x.increment);
+            auto& var       = frames.back()[x.var.name];
+            var = var.number && increment.number ? SimValue{*var.number + *increment.number}
+                                                 : SimValue{};
+        });
+    }
+    void exec_stmt(const While& x)
+    {
+        loop(x.condition, x.body, []() {});
+    }
+    void exec_stmt(const Call& x)
+    {
+        eval_expr(x.expr);
+    }
+    void exec_stmt(const ReturnExpr& x)
+    {
+        return_value = eval(x.expr);
+        returning    = true;
+    }
+    void exec_stmt(const Return&)
+    {
+        returning = true;
+    }
+    void exec_stmt(const Break&)
+    {
+        breaking = true;
+    }
+    void exec_stmt(const StoreGlobal& x)
+    {
+        eval(x.value);
+    }
+    void exec_stmt(const StoreGlobalPlanar& x)
+    {
+        eval(x.value);
+    }
+    void exec_stmt(const IntrinsicStore& x)
+    {
+        eval(x.value);
+    }
+    void exec_stmt(const IntrinsicStorePlanar& x)
+    {
+        eval(x.value);
+    }
+    void exec_stmt(const IntrinsicLoadToDest& x)
+    {
+        auto dest = std::get_if<Variable>(&x.dest);
+        if(dest && is_lds_access(*dest))
+            access_lds(*dest, true);
+    }
+    void exec_stmt(const SyncThreads&)
+    {
+        ++step;
+    }
+    // remaining statements don't touch LDS or integer values
+    template <typename T>
+    void exec_stmt(const T&)
+    {
+    }
+};
+
+// cycles that an LDS instruction takes, given each lane's access
+static size_t lds_instruction_cycles(const std::vector<const LDSAccessRecord*>& lanes,
+                                     const std::vector<unsigned int>&           lane_ids,
+                                     const LDSSimulation&                       sim,
+                                     size_t&                                    groups)
+{
+    // lanes are served in groups that can each access one dword
+    // from every bank
+    size_t dwords_per_lane = std::max<size_t>(1, (lanes.front()->bytes + 3) / 4);
+    size_t group_size      = std::max<size_t>(1, sim.lds_banks / dwords_per_lane);
+
+    // distinct dwords each group needs from each bank
+    std::map<size_t, std::map<size_t, std::set<long long>>> dwords;
+    for(size_t i = 0; i < lanes.size(); ++i)
+    {
+        auto  first = lanes[i]->address / 4;
+        auto  last  = (lanes[i]->address + static_cast<long long>(lanes[i]->bytes) - 1) / 4;
+        auto& banks = dwords[lane_ids[i] / group_size];
+        for(auto dword = first; dword <= last; ++dword)
+            banks[static_cast<size_t>(dword) % sim.lds_banks].insert(dword);
+    }
+
+    size_t cycles = 0;
+    for(const auto& group : dwords)
+    {
+        size_t group_cycles = 0;
+        for(const auto& bank : group.second)
+            group_cycles = std::max(group_cycles, bank.second.size());
+        cycles += group_cycles;
+    }
+    groups = dwords.size();
+    return cycles;
+}
+
+LDSConflictReport simulate_lds_conflicts(const Function&                     f,
+                                         const std::vector<const Function*>& callees,
+                                         const LDSSimulation&                sim)
+{
+    LDSConflictReport report;
+
+    // accesses that make up each instruction, keyed by wavefront,
+    // step, site and occurrence
+    using instruction_key = std::tuple<size_t, size_t, const void*, size_t>;
+    std::map<instruction_key, std::vector<const LDSAccessRecord*>> instructions;
+    std::map<instruction_key, std::vector<unsigned int>>           lane_ids;
+
+    std::vector<LDSThreadSimulator> threads;
+    threads.reserve(sim.block_size);
+    for(unsigned int thread = 0; thread < sim.block_size; ++thread)
+    {
+        threads.emplace_back(sim, callees, thread);
+        auto& t = threads.back();
+        t.frames.emplace_back();
+        t.exec(f.body);
+        report.unresolved += t.unresolved;
+
+        for(const auto& access : t.accesses)
+        {
+            instruction_key key{
+                thread / sim.wavefront_size, access.step, access.site, access.occurrence};
+            instructions[key].push_back(&access);
+            lane_ids[key].push_back(thread % sim.wavefront_size);
+        }
+    }
+
+    std::map<size_t, LDSConflictStep> steps;
+    for(const auto& [key, lanes] : instructions)
+    {
+        auto& step   = steps[std::get<1>(key)];
+        step.barrier = std::get<1>(key);
+        if(lanes.front()->write)
+            ++step.writes;
+        else
+            ++step.reads;
+
+        size_t groups = 0;
+        auto   cycles = lds_instruction_cycles(lanes, lane_ids[key], sim, groups);
+        step.cycles += cycles;
+        step.ideal_cycles += groups;
+        step.max_degree = std::max(step.max_degree, (cycles + groups - 1) / groups);
+    }
+    for(const auto& step : steps)
+        report.steps.push_back(step.second);
+    return report;
 }
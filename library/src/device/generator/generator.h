@@ -21,25 +21,62 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <set>
+#include <stdexcept>
 #include <string.h>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
+#include "../../include/kernel_profile.h"
 #include "../kernels/callback.h"
 
 //
 // Helpers
 //
 
+// Nodes in the syntax tree can render themselves by appending to
+// an output string, so that a whole function renders into a single
+// buffer.  Nodes that only return a string are appended as-is.
+template <typename T, typename = void>
+struct renders_to_string : std::false_type
+{
+};
+template <typename T>
+struct renders_to_string<
+    T,
+    std::void_t<decltype(std::declval<const T&>().render(std::declval<std::string&>()))>>
+    : std::true_type
+{
+};
+
+template <typename T>
+void vrender(const T& x, std::string& out)
+{
+    std::visit(
+        [&out](const auto& a) {
+            if constexpr(renders_to_string<std::decay_t<decltype(a)>>::value)
+                a.render(out);
+            else
+                out += a.render();
+        },
+        x);
+}
+
 template <typename T>
 std::string vrender(const T& x)
 {
-    return std::visit([](const auto& a) { return a.render(); }, x);
+    std::string out;
+    vrender(x, out);
+    return out;
 }
 
 template <typename T>
@@ -158,9 +195,13 @@ using Expression = std::variant<Variable,
                                 IntrinsicLoad,
                                 IntrinsicLoadPlanar>;
 
+// Expressions are never modified once they're in an
+// OptionalExpression, so copies share the same node instead of
+// deep-copying it.  Variables are copied a lot while rewriting
+// functions, and most of that copying is of their index expressions.
 class OptionalExpression
 {
-    std::unique_ptr<Expression> expr;
+    std::shared_ptr<const Expression> expr;
 
 public:
     OptionalExpression();
@@ -204,6 +245,10 @@ public:
 
     std::string value;
 
+    void render(std::string& out) const
+    {
+        out += value;
+    }
     std::string render() const
     {
         return value;
@@ -253,7 +298,13 @@ public:
     Variable x() const;
     Variable y() const;
 
-    std::string render() const;
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class ArgumentList
@@ -303,16 +354,20 @@ public:
     TemplateList            templates;
     std::vector<Expression> arguments;
 
-    CallExpr(const std::string& name, const std::vector<Expression>& arguments);
-    CallExpr(const std::string&             name,
-             const TemplateList&            templates,
-             const std::vector<Expression>& arguments);
+    CallExpr(const std::string& name, std::vector<Expression> arguments);
+    CallExpr(const std::string& name, TemplateList templates, std::vector<Expression> arguments);
     CallExpr(CallExpr&&)      = default;
     CallExpr(const CallExpr&) = default;
     CallExpr& operator=(CallExpr&&) = default;
     CallExpr& operator=(const CallExpr&) = default;
 
-    std::string render() const;
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class ComplexMultiply
@@ -323,12 +378,22 @@ public:
         : args(args)
     {
     }
+    explicit ComplexMultiply(std::vector<Expression>&& args)
+        : args(std::move(args))
+    {
+    }
     ComplexMultiply(ComplexMultiply&&)      = default;
     ComplexMultiply(const ComplexMultiply&) = default;
     ComplexMultiply& operator=(ComplexMultiply&&) = default;
     ComplexMultiply& operator=(const ComplexMultiply&) = default;
 
-    std::string render() const;
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 
     std::vector<Expression> args;
 };
@@ -341,9 +406,16 @@ public:
     explicit Ternary(std::vector<Expression>&& args);
     Ternary(Ternary&&)      = default;
     Ternary(const Ternary&) = default;
-    Ternary&    operator=(Ternary&&) = default;
-    Ternary&    operator=(const Ternary&) = default;
-    std::string render() const;
+    Ternary& operator=(Ternary&&) = default;
+    Ternary& operator=(const Ternary&) = default;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 
     std::vector<Expression> args;
 };
@@ -354,12 +426,19 @@ public:
     static const unsigned int precedence = 18;
     LoadGlobal(const Expression& ptr, const Expression& index);
     explicit LoadGlobal(const std::vector<Expression>& args);
+    explicit LoadGlobal(std::vector<Expression>&& args);
     LoadGlobal(LoadGlobal&&)      = default;
     LoadGlobal(const LoadGlobal&) = default;
     LoadGlobal& operator=(LoadGlobal&&) = default;
     LoadGlobal& operator=(const LoadGlobal&) = default;
 
-    std::string render() const;
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 
     std::vector<Expression> args;
 };
@@ -369,6 +448,7 @@ class LoadGlobalPlanar
 public:
     static const unsigned int precedence = 18;
     explicit LoadGlobalPlanar(const std::vector<Expression>& args);
+    explicit LoadGlobalPlanar(std::vector<Expression>&& args);
     LoadGlobalPlanar(LoadGlobalPlanar&&)      = default;
     LoadGlobalPlanar(const LoadGlobalPlanar&) = default;
     LoadGlobalPlanar& operator=(LoadGlobalPlanar&&) = default;
@@ -392,7 +472,14 @@ public:
     TwiddleMultiply&      operator=(TwiddleMultiply&&) = default;
     TwiddleMultiply&      operator=(const TwiddleMultiply&) = default;
     std::vector<Variable> vars;
-    std::string           render() const;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class TwiddleMultiplyConjugate
@@ -408,7 +495,14 @@ public:
     TwiddleMultiplyConjugate& operator=(TwiddleMultiplyConjugate&&) = default;
     TwiddleMultiplyConjugate& operator=(const TwiddleMultiplyConjugate&) = default;
     std::vector<Variable>     vars;
-    std::string               render() const;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class Parens
@@ -425,7 +519,14 @@ public:
     Parens& operator=(const Parens&) = default;
 
     std::vector<Expression> args;
-    std::string             render() const;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class IntrinsicLoad
@@ -433,6 +534,7 @@ class IntrinsicLoad
 public:
     static const unsigned int precedence = 18;
     explicit IntrinsicLoad(const std::vector<Expression>& args);
+    explicit IntrinsicLoad(std::vector<Expression>&& args);
     IntrinsicLoad(IntrinsicLoad&&)      = default;
     IntrinsicLoad(const IntrinsicLoad&) = default;
     IntrinsicLoad& operator=(IntrinsicLoad&&) = default;
@@ -448,6 +550,7 @@ class IntrinsicLoadPlanar
 public:
     static const unsigned int precedence = 18;
     explicit IntrinsicLoadPlanar(const std::vector<Expression>& args);
+    explicit IntrinsicLoadPlanar(std::vector<Expression>&& args);
     IntrinsicLoadPlanar(IntrinsicLoadPlanar&&)      = default;
     IntrinsicLoadPlanar(const IntrinsicLoadPlanar&) = default;
     IntrinsicLoadPlanar& operator=(IntrinsicLoadPlanar&&) = default;
@@ -468,11 +571,18 @@ public:
         std::vector<Expression>   args;                             \
         explicit NAME(const std::initializer_list<Expression>& il); \
         explicit NAME(const std::vector<Expression>& il);           \
+        explicit NAME(std::vector<Expression>&& il);                \
         NAME(NAME&&)        = default;                              \
         NAME(const NAME&)   = default;                              \
-        NAME&       operator=(NAME&&) = default;                    \
-        NAME&       operator=(const NAME&) = default;               \
-        std::string render() const;                                 \
+        NAME& operator=(NAME&&) = default;                          \
+        NAME& operator=(const NAME&) = default;                     \
+        void        render(std::string& out) const;                 \
+        std::string render() const                                  \
+        {                                                           \
+            std::string out;                                        \
+            render(out);                                            \
+            return out;                                             \
+        }                                                           \
     };
 
 MAKE_OPER(Add, " + ", 6);
@@ -713,14 +823,23 @@ public:
     Expression  rhs;
     std::string oper;
 
-    Assign(const Variable& lhs, const Expression& rhs, const std::string& oper = "=")
-        : lhs(lhs)
-        , rhs(rhs)
+    Assign(Variable lhs, Expression rhs, const std::string& oper = "=")
+        : lhs(std::move(lhs))
+        , rhs(std::move(rhs))
         , oper(oper){};
 
+    void render(std::string& out) const
+    {
+        lhs.render(out);
+        out += " " + oper + " ";
+        vrender(rhs, out);
+        out += ";";
+    }
     std::string render() const
     {
-        return lhs.render() + " " + oper + " " + vrender(rhs) + ";";
+        std::string out;
+        render(out);
+        return out;
     }
 };
 
@@ -747,15 +866,19 @@ class Declaration
 public:
     Variable                  var;
     std::optional<Expression> value;
-    explicit Declaration(const Variable& v)
-        : var(v){};
-    Declaration(const Variable& v, Expression&& val)
-        : var(v)
+    explicit Declaration(Variable v)
+        : var(std::move(v)){};
+    Declaration(Variable v, Expression val)
+        : var(std::move(v))
         , value(std::move(val)){};
-    Declaration(const Variable& v, const Expression& val)
-        : var(v)
-        , value(val){};
-    std::string render() const;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class LDSDeclaration
@@ -858,9 +981,17 @@ public:
 
     Expression expr;
 
+    void render(std::string& out) const
+    {
+        out += "return ";
+        vrender(expr, out);
+        out += ";";
+    }
     std::string render() const
     {
-        return "return " + vrender(expr) + ";";
+        std::string out;
+        render(out);
+        return out;
     }
 };
 class Call
@@ -870,6 +1001,10 @@ public:
         : expr(name, arguments)
     {
     }
+    explicit Call(CallExpr&& expr)
+        : expr(std::move(expr))
+    {
+    }
     Call(const std::string&             name,
          const TemplateList&            templates,
          const std::vector<Expression>& arguments)
@@ -879,9 +1014,16 @@ public:
 
     CallExpr expr;
 
+    void render(std::string& out) const
+    {
+        expr.render(out);
+        out += ";";
+    }
     std::string render() const
     {
-        return expr.render() + ";";
+        std::string out;
+        render(out);
+        return out;
     }
 };
 
@@ -891,7 +1033,14 @@ public:
     std::vector<Statement> statements;
     StatementList();
     StatementList(const std::initializer_list<Statement>& il);
-    std::string render() const;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class For
@@ -903,13 +1052,20 @@ public:
     Expression    increment;
     StatementList body;
     bool          pragma_unroll;
-    For(const Variable&      var,
-        const Expression&    initial,
-        const Expression&    condition,
-        const Expression&    increment,
-        const StatementList& body          = {},
-        bool                 pragma_unroll = false);
-    std::string render() const;
+    For(Variable      var,
+        Expression    initial,
+        Expression    condition,
+        Expression    increment,
+        StatementList body          = {},
+        bool          pragma_unroll = false);
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class While
@@ -917,8 +1073,15 @@ class While
 public:
     Expression    condition;
     StatementList body;
-    While(const Expression& condition, const StatementList& body = {});
-    std::string render() const;
+    While(Expression condition, StatementList body = {});
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class If
@@ -926,8 +1089,15 @@ class If
 public:
     Expression    condition;
     StatementList body;
-    If(const Expression& condition, const StatementList& body);
-    std::string render() const;
+    If(Expression condition, StatementList body);
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class ElseIf
@@ -935,31 +1105,56 @@ class ElseIf
 public:
     Expression    condition;
     StatementList body;
-    ElseIf(const Expression& condition, const StatementList& body);
-    std::string render() const;
+    ElseIf(Expression condition, StatementList body);
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class Else
 {
 public:
     StatementList body;
-    explicit Else(const StatementList& body);
-    std::string render() const;
+    explicit Else(StatementList body);
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 class StoreGlobal
 {
 public:
-    StoreGlobal(const Expression& ptr, const Expression& index, const Expression& value)
-        : ptr{ptr}
-        , index{index}
-        , value{value}
+    StoreGlobal(Expression ptr, Expression index, Expression value)
+        : ptr{std::move(ptr)}
+        , index{std::move(index)}
+        , value{std::move(value)}
     {
     }
+    void render(std::string& out) const
+    {
+        out += "store_cb(";
+        vrender(ptr, out);
+        out += ",";
+        vrender(index, out);
+        out += ",";
+        vrender(value, out);
+        out += ", store_cb_data, nullptr);";
+    }
     std::string render() const
     {
-        return "store_cb(" + vrender(ptr) + "," + vrender(index) + "," + vrender(value)
-               + ", store_cb_data, nullptr);";
+        std::string out;
+        render(out);
+        return out;
     }
 
     Expression ptr;
@@ -994,14 +1189,31 @@ class Butterfly
 {
 public:
     static const unsigned int precedence = 0;
-    Butterfly(bool forward, const std::vector<Expression>& args)
+    Butterfly(bool forward, const std::vector<Expression>& args, bool split_radix = false)
         : forward(forward)
         , args(args)
+        , split_radix(split_radix)
     {
     }
     bool                    forward;
     std::vector<Expression> args;
-    std::string             render() const;
+    // use the conjugate-pair split-radix variant of the butterfly,
+    // which needs fewer multiplies
+    bool split_radix;
+
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
+
+    // radices that have a split-radix variant
+    static bool split_radix_supported(size_t radix)
+    {
+        return radix == 8 || radix == 16;
+    }
 };
 
 class IntrinsicStore
@@ -1108,7 +1320,7 @@ static void operator+=(StatementList& stmts, const StatementList& s)
 {
     //    stmts.statements.insert(stmts.statements.end(), s.statements.cbegin(),
     //    s.statements.cend());
-    for(auto x : s.statements)
+    for(const auto& x : s.statements)
     {
         stmts += x;
     }
@@ -1140,7 +1352,13 @@ public:
     explicit Function(const std::string& name)
         : name(name){};
 
-    std::string render() const;
+    void        render(std::string& out) const;
+    std::string render() const
+    {
+        std::string out;
+        render(out);
+        return out;
+    }
 };
 
 //
@@ -1329,7 +1547,7 @@ struct BaseVisitor
     virtual StatementList visit_StatementList(const StatementList& x)
     {
         auto y = StatementList();
-        for(auto s : x.statements)
+        for(const auto& s : x.statements)
         {
             y += std::visit(*this, s);
         }
@@ -1339,7 +1557,7 @@ struct BaseVisitor
     virtual ArgumentList visit_ArgumentList(const ArgumentList& x)
     {
         auto y = ArgumentList();
-        for(auto s : x.arguments)
+        for(const auto& s : x.arguments)
         {
             y.append(std::get<Variable>(visit_Variable(s)));
         }
@@ -1350,24 +1568,22 @@ struct BaseVisitor
     {
         auto lhs = std::get<Variable>(visit_Variable(x.lhs));
         auto rhs = std::visit(*this, x.rhs);
-        return StatementList{Assign{lhs, rhs, x.oper}};
+        return StatementList{Assign{std::move(lhs), std::move(rhs), x.oper}};
     }
 
     virtual Expression visit_CallExpr(const CallExpr& x)
     {
-        auto y      = CallExpr(x);
-        y.templates = visit_ArgumentList(x.templates);
-        y.arguments.clear();
-        y.arguments.reserve(x.arguments.size());
+        std::vector<Expression> arguments;
+        arguments.reserve(x.arguments.size());
         for(const auto& arg : x.arguments)
-            y.arguments.emplace_back(std::visit(*this, arg));
-        return y;
+            arguments.emplace_back(std::visit(*this, arg));
+        return CallExpr(x.name, visit_ArgumentList(x.templates), std::move(arguments));
     }
 
     virtual StatementList visit_Call(const Call& x)
     {
         auto y = std::get<CallExpr>(visit_CallExpr(x.expr));
-        return StatementList{Call{y.name, y.templates, y.arguments}};
+        return StatementList{Call{std::move(y)}};
     }
 
     virtual StatementList visit_Declaration(const Declaration& x)
@@ -1375,9 +1591,9 @@ struct BaseVisitor
         auto var = std::get<Variable>(visit_Variable(x.var));
         if(x.value)
         {
-            return StatementList{Declaration(var, std::visit(*this, *x.value))};
+            return StatementList{Declaration(std::move(var), std::visit(*this, *x.value))};
         }
-        return StatementList{Declaration(var)};
+        return StatementList{Declaration(std::move(var))};
     }
 
     virtual StatementList visit_For(const For& x)
@@ -1387,34 +1603,39 @@ struct BaseVisitor
         auto condition = std::visit(*this, x.condition);
         auto increment = std::visit(*this, x.increment);
         auto body      = visit_StatementList(x.body);
-        return StatementList{For(var, initial, condition, increment, body, x.pragma_unroll)};
+        return StatementList{For(std::move(var),
+                                 std::move(initial),
+                                 std::move(condition),
+                                 std::move(increment),
+                                 std::move(body),
+                                 x.pragma_unroll)};
     }
 
     virtual StatementList visit_While(const While& x)
     {
         auto condition = std::visit(*this, x.condition);
         auto body      = visit_StatementList(x.body);
-        return StatementList{While(condition, body)};
+        return StatementList{While(std::move(condition), std::move(body))};
     }
 
     virtual StatementList visit_If(const If& x)
     {
         auto condition = std::visit(*this, x.condition);
         auto body      = visit_StatementList(x.body);
-        return StatementList{If(condition, body)};
+        return StatementList{If(std::move(condition), std::move(body))};
     }
 
     virtual StatementList visit_ElseIf(const ElseIf& x)
     {
         auto condition = std::visit(*this, x.condition);
         auto body      = visit_StatementList(x.body);
-        return StatementList{ElseIf(condition, body)};
+        return StatementList{ElseIf(std::move(condition), std::move(body))};
     }
 
     virtual StatementList visit_Else(const Else& x)
     {
         auto body = visit_StatementList(x.body);
-        return StatementList{Else(body)};
+        return StatementList{Else(std::move(body))};
     }
 
     virtual StatementList visit_StoreGlobal(const StoreGlobal& x)
@@ -1422,8 +1643,7 @@ struct BaseVisitor
         auto ptr   = std::visit(*this, x.ptr);
         auto index = std::visit(*this, x.index);
         auto value = std::visit(*this, x.value);
-        auto out   = StoreGlobal(ptr, index, value);
-        return StatementList{out};
+        return StatementList{StoreGlobal(std::move(ptr), std::move(index), std::move(value))};
     }
 
     virtual StatementList visit_IntrinsicStore(const IntrinsicStore& x)
@@ -1757,7 +1977,7 @@ struct MakeInverseVisitor : public BaseVisitor
 
     StatementList visit_Butterfly(const Butterfly& x) override
     {
-        return {Butterfly{false, x.args}};
+        return {Butterfly{false, x.args, x.split_radix}};
     }
 
     Expression visit_CallExpr(const CallExpr& x) override
@@ -1825,6 +2045,99 @@ static Function make_rtc(const Function& f, const std::string& kernel_name)
     return visitor(f);
 }
 
+// Rewrite kernel functions to run on the host, as plain C++.
+//
+// Each call of the global function runs one thread of one block.
+// Barriers are dropped and LDS becomes an array on the stack, so
+// this is only correct for kernels whose threads don't share data
+// through LDS - i.e. kernels with one thread per transform and one
+// transform per block.
+struct MakeHostVisitor : public BaseVisitor
+{
+    explicit MakeHostVisitor(unsigned int lds_elements)
+        : lds_elements(lds_elements)
+    {
+    }
+
+    Function visit_Function(const Function& x) override
+    {
+        auto y          = BaseVisitor::visit_Function(x);
+        y.return_type   = x.return_type;
+        y.qualifier     = "static";
+        y.launch_bounds = 0;
+        // block and thread indexes are passed in by the caller
+        if(x.qualifier.find("__global__") != std::string::npos)
+        {
+            y.arguments.append(Variable{"blockIdx", "const rocfft_host_dim3&"});
+            y.arguments.append(Variable{"threadIdx", "const rocfft_host_dim3&"});
+        }
+        return y;
+    }
+
+    // loads and stores don't go through callbacks
+    Expression visit_LoadGlobal(const LoadGlobal& x) override
+    {
+        auto ptr = std::get<Variable>(visit_Variable(std::get<Variable>(x.args[0])));
+        return ptr[std::visit(*this, x.args[1])];
+    }
+    StatementList visit_StoreGlobal(const StoreGlobal& x) override
+    {
+        auto ptr = std::get<Variable>(visit_Variable(std::get<Variable>(x.ptr)));
+        return {Assign{ptr[std::visit(*this, x.index)], std::visit(*this, x.value)}};
+    }
+    StatementList visit_CallbackLoadDeclaration(const CallbackLoadDeclaration& x) override
+    {
+        return {};
+    }
+    StatementList visit_CallbackStoreDeclaration(const CallbackStoreDeclaration& x) override
+    {
+        return {};
+    }
+
+    StatementList visit_SyncThreads(const SyncThreads& x) override
+    {
+        return {};
+    }
+
+    StatementList visit_LDSDeclaration(const LDSDeclaration& x) override
+    {
+        auto real_type = "real_type_t<" + x.scalar_type + ">";
+        return {Declaration{Variable{"lds_complex", x.scalar_type, false, false, lds_elements}},
+                Declaration{Variable{"lds_real", real_type, true},
+                            Literal{"reinterpret_cast<" + real_type + "*>(lds_complex)"}}};
+    }
+
+    // buffer intrinsics only exist on the GPU
+    Expression visit_IntrinsicLoad(const IntrinsicLoad& x) override
+    {
+        throw std::runtime_error("intrinsic buffer access is not supported on the host");
+    }
+    Expression visit_IntrinsicLoadPlanar(const IntrinsicLoadPlanar& x) override
+    {
+        throw std::runtime_error("intrinsic buffer access is not supported on the host");
+    }
+    StatementList visit_IntrinsicStore(const IntrinsicStore& x) override
+    {
+        throw std::runtime_error("intrinsic buffer access is not supported on the host");
+    }
+    StatementList visit_IntrinsicStorePlanar(const IntrinsicStorePlanar& x) override
+    {
+        throw std::runtime_error("intrinsic buffer access is not supported on the host");
+    }
+    StatementList visit_IntrinsicLoadToDest(const IntrinsicLoadToDest& x) override
+    {
+        throw std::runtime_error("intrinsic buffer access is not supported on the host");
+    }
+
+    unsigned int lds_elements;
+};
+
+static Function make_host(const Function& f, unsigned int lds_elements)
+{
+    auto visitor = MakeHostVisitor(lds_elements);
+    return visitor(f);
+}
+
 // Make callbacks compatible with real-complex even-length optimization
 struct MakeCallbackRealComplexVisitor : public BaseVisitor
 {
@@ -1865,3 +2178,104 @@ static Function make_callback_realcomplex(const Function& f, CallbackType cbtype
     auto visitor = MakeCallbackRealComplexVisitor(cbtype);
     return visitor(f);
 }
+
+//
+// Common subexpression elimination
+//
+
+struct CSEReport
+{
+    // number of repeated expressions hoisted into declarations
+    size_t expressions = 0;
+    // number of evaluations of those expressions that were removed
+    size_t evaluations = 0;
+};
+
+// Hoist repeated integer/boolean subexpressions into const
+// declarations, so the compiler is given less redundant work.
+//
+// Only expressions made of literals, operators and variables that
+// hold a single value while in scope are hoisted.  Each
+// declaration is placed just before a statement that would
+// unconditionally evaluate the expression anyway.
+//
+// A comment summarizing what was removed is added to the function,
+// and also returned in report if it's not null.
+Function make_cse(const Function& f, CSEReport* report = nullptr);
+
+//
+// Simplification
+//
+
+// Fold arithmetic and comparisons on integer literals, drop
+// operands that don't change a result (like "+ 0" and "* 1"), and
+// remove if/else branches whose conditions are known.
+//
+// globals maps names that the function uses but doesn't declare
+// (like the template parameters that make_rtc turns into global
+// constants) to their values.  Locals that are declared with a
+// value that simplifies to a literal, and are never written, are
+// substituted the same way.
+//
+// Integers are folded in their C++ types, so unsigned arithmetic
+// wraps.  Unsigned values must be given with a "u" suffix, or
+// "ull" for size_t - values given for arguments and locals are
+// converted to their declared types.
+Function make_simplify(const Function&                           f,
+                       const std::map<std::string, std::string>& globals = {});
+
+//
+// Static cost analysis
+//
+
+// Count the work a function does per thread: flops in butterflies
+// and complex multiplies, global memory and LDS accesses, barriers
+// and complex values declared in registers.
+//
+// Loops with literal bounds are counted once per iteration, other
+// loops are counted once.  Alternative if/else branches count
+// whichever is more expensive.  Calls to any of the callees are
+// counted as if the callee's body were inlined.
+//
+// lds_bytes is not known from the function body and is left as
+// zero.
+KernelProfile profile_function(const Function&                     f,
+                               const std::vector<const Function*>& callees = {});
+KernelProfile profile_statements(const StatementList&                stmts,
+                                 const std::vector<const Function*>& callees = {});
+
+//
+// LDS bank conflict simulation
+//
+
+// One threadblock of a kernel to simulate, and the LDS it runs on.
+struct LDSSimulation
+{
+    unsigned int block_size = 0;
+    unsigned int block_id   = 0;
+    // values of the global function's scalar and array arguments
+    std::map<std::string, long long>              scalars;
+    std::map<std::string, std::vector<long long>> arrays;
+    // global constants, as given to make_simplify
+    std::map<std::string, std::string> globals;
+    // size of a real value in LDS, complex values are twice this
+    unsigned int real_bytes = 4;
+    // threads that execute an LDS instruction together, and the
+    // number of 4-byte wide LDS banks
+    unsigned int wavefront_size = 64;
+    unsigned int lds_banks      = 32;
+};
+
+// Run a global function for each thread of a threadblock, keeping
+// track of integer values only, and work out the LDS addresses each
+// thread accesses.  Calls to any of the callees are simulated too.
+//
+// Accesses made by the same code, the same number of times, by the
+// threads of a wavefront are one LDS instruction.  An instruction is
+// served a group of lanes at a time - as many as can access one
+// dword from every bank - and a group takes as many cycles as the
+// most distinct dwords it needs from one bank.  Instructions are
+// reported per exchange step, i.e. between two barriers.
+LDSConflictReport simulate_lds_conflicts(const Function&                     f,
+                                         const std::vector<const Function*>& callees,
+                                         const LDSSimulation&                sim);
@@ -223,3 +223,214 @@ __device__ void InvRad16B1(T* R0,
     (*R11) = (*R13);
     (*R13) = res;
 }
+
+// Conjugate-pair split-radix butterflies: a length-8 split-radix DFT
+// of the even inputs, plus length-4 DFTs of the inputs at 4n+1 and
+// 4n-1 that are twiddled by w^k and w^-k.
+template <typename T>
+__device__ void FwdRad16B1SplitRadix(T* R0,
+                                     T* R1,
+                                     T* R2,
+                                     T* R3,
+                                     T* R4,
+                                     T* R5,
+                                     T* R6,
+                                     T* R7,
+                                     T* R8,
+                                     T* R9,
+                                     T* R10,
+                                     T* R11,
+                                     T* R12,
+                                     T* R13,
+                                     T* R14,
+                                     T* R15)
+{
+    // length-8 split-radix DFT of the even inputs
+    T t0 = (*R0) + (*R8);
+    T t1 = (*R0) - (*R8);
+    T t2 = (*R4) + (*R12);
+    T t3 = (*R4) - (*R12);
+    T u0 = t0 + t2;
+    T u2 = t0 - t2;
+    T u1 = t1 + T(t3.y, -t3.x);
+    T u3 = t1 - T(t3.y, -t3.x);
+
+    T e0  = (*R2) + (*R10);
+    T e1  = (*R2) - (*R10);
+    T ec0 = (*R14) + (*R6);
+    T ec1 = (*R14) - (*R6);
+
+    T ea = C8Q * T(e1.x + e1.y, e1.y - e1.x);
+    T eb = C8Q * T(ec1.x - ec1.y, ec1.y + ec1.x);
+
+    T es0 = e0 + ec0;
+    T ed0 = e0 - ec0;
+    T es1 = ea + eb;
+    T ed1 = ea - eb;
+
+    T U0 = u0 + es0;
+    T U4 = u0 - es0;
+    T U2 = u2 + T(ed0.y, -ed0.x);
+    T U6 = u2 - T(ed0.y, -ed0.x);
+    T U1 = u1 + es1;
+    T U5 = u1 - es1;
+    T U3 = u3 + T(ed1.y, -ed1.x);
+    T U7 = u3 - T(ed1.y, -ed1.x);
+
+    // length-4 DFTs of the inputs at 4n+1 and 4n-1
+    T p0 = (*R1) + (*R9);
+    T p1 = (*R1) - (*R9);
+    T p2 = (*R5) + (*R13);
+    T p3 = (*R5) - (*R13);
+    T z0 = p0 + p2;
+    T z2 = p0 - p2;
+    T z1 = p1 + T(p3.y, -p3.x);
+    T z3 = p1 - T(p3.y, -p3.x);
+
+    T q0  = (*R15) + (*R7);
+    T q1  = (*R15) - (*R7);
+    T q2  = (*R3) + (*R11);
+    T q3  = (*R3) - (*R11);
+    T zc0 = q0 + q2;
+    T zc2 = q0 - q2;
+    T zc1 = q1 + T(q3.y, -q3.x);
+    T zc3 = q1 - T(q3.y, -q3.x);
+
+    // twiddle by w^k and w^-k
+    T a1 = T(z1.x * C16A + z1.y * C16B, z1.y * C16A - z1.x * C16B);
+    T b1 = T(zc1.x * C16A - zc1.y * C16B, zc1.y * C16A + zc1.x * C16B);
+    T a2 = C8Q * T(z2.x + z2.y, z2.y - z2.x);
+    T b2 = C8Q * T(zc2.x - zc2.y, zc2.y + zc2.x);
+    T a3 = T(z3.x * C16B + z3.y * C16A, z3.y * C16B - z3.x * C16A);
+    T b3 = T(zc3.x * C16B - zc3.y * C16A, zc3.y * C16B + zc3.x * C16A);
+
+    T s0 = z0 + zc0;
+    T d0 = z0 - zc0;
+    T s1 = a1 + b1;
+    T d1 = a1 - b1;
+    T s2 = a2 + b2;
+    T d2 = a2 - b2;
+    T s3 = a3 + b3;
+    T d3 = a3 - b3;
+
+    (*R0)  = U0 + s0;
+    (*R8)  = U0 - s0;
+    (*R4)  = U4 + T(d0.y, -d0.x);
+    (*R12) = U4 - T(d0.y, -d0.x);
+    (*R1)  = U1 + s1;
+    (*R9)  = U1 - s1;
+    (*R5)  = U5 + T(d1.y, -d1.x);
+    (*R13) = U5 - T(d1.y, -d1.x);
+    (*R2)  = U2 + s2;
+    (*R10) = U2 - s2;
+    (*R6)  = U6 + T(d2.y, -d2.x);
+    (*R14) = U6 - T(d2.y, -d2.x);
+    (*R3)  = U3 + s3;
+    (*R11) = U3 - s3;
+    (*R7)  = U7 + T(d3.y, -d3.x);
+    (*R15) = U7 - T(d3.y, -d3.x);
+}
+
+template <typename T>
+__device__ void InvRad16B1SplitRadix(T* R0,
+                                     T* R1,
+                                     T* R2,
+                                     T* R3,
+                                     T* R4,
+                                     T* R5,
+                                     T* R6,
+                                     T* R7,
+                                     T* R8,
+                                     T* R9,
+                                     T* R10,
+                                     T* R11,
+                                     T* R12,
+                                     T* R13,
+                                     T* R14,
+                                     T* R15)
+{
+    // length-8 split-radix DFT of the even inputs
+    T t0 = (*R0) + (*R8);
+    T t1 = (*R0) - (*R8);
+    T t2 = (*R4) + (*R12);
+    T t3 = (*R4) - (*R12);
+    T u0 = t0 + t2;
+    T u2 = t0 - t2;
+    T u1 = t1 + T(-t3.y, t3.x);
+    T u3 = t1 - T(-t3.y, t3.x);
+
+    T e0  = (*R2) + (*R10);
+    T e1  = (*R2) - (*R10);
+    T ec0 = (*R14) + (*R6);
+    T ec1 = (*R14) - (*R6);
+
+    T ea = C8Q * T(e1.x - e1.y, e1.y + e1.x);
+    T eb = C8Q * T(ec1.x + ec1.y, ec1.y - ec1.x);
+
+    T es0 = e0 + ec0;
+    T ed0 = e0 - ec0;
+    T es1 = ea + eb;
+    T ed1 = ea - eb;
+
+    T U0 = u0 + es0;
+    T U4 = u0 - es0;
+    T U2 = u2 + T(-ed0.y, ed0.x);
+    T U6 = u2 - T(-ed0.y, ed0.x);
+    T U1 = u1 + es1;
+    T U5 = u1 - es1;
+    T U3 = u3 + T(-ed1.y, ed1.x);
+    T U7 = u3 - T(-ed1.y, ed1.x);
+
+    // length-4 DFTs of the inputs at 4n+1 and 4n-1
+    T p0 = (*R1) + (*R9);
+    T p1 = (*R1) - (*R9);
+    T p2 = (*R5) + (*R13);
+    T p3 = (*R5) - (*R13);
+    T z0 = p0 + p2;
+    T z2 = p0 - p2;
+    T z1 = p1 + T(-p3.y, p3.x);
+    T z3 = p1 - T(-p3.y, p3.x);
+
+    T q0  = (*R15) + (*R7);
+    T q1  = (*R15) - (*R7);
+    T q2  = (*R3) + (*R11);
+    T q3  = (*R3) - (*R11);
+    T zc0 = q0 + q2;
+    T zc2 = q0 - q2;
+    T zc1 = q1 + T(-q3.y, q3.x);
+    T zc3 = q1 - T(-q3.y, q3.x);
+
+    // twiddle by w^k and w^-k
+    T a1 = T(z1.x * C16A - z1.y * C16B, z1.y * C16A + z1.x * C16B);
+    T b1 = T(zc1.x * C16A + zc1.y * C16B, zc1.y * C16A - zc1.x * C16B);
+    T a2 = C8Q * T(z2.x - z2.y, z2.y + z2.x);
+    T b2 = C8Q * T(zc2.x + zc2.y, zc2.y - zc2.x);
+    T a3 = T(z3.x * C16B - z3.y * C16A, z3.y * C16B + z3.x * C16A);
+    T b3 = T(zc3.x * C16B + zc3.y * C16A, zc3.y * C16B - zc3.x * C16A);
+
+    T s0 = z0 + zc0;
+    T d0 = z0 - zc0;
+    T s1 = a1 + b1;
+    T d1 = a1 - b1;
+    T s2 = a2 + b2;
+    T d2 = a2 - b2;
+    T s3 = a3 + b3;
+    T d3 = a3 - b3;
+
+    (*R0)  = U0 + s0;
+    (*R8)  = U0 - s0;
+    (*R4)  = U4 + T(-d0.y, d0.x);
+    (*R12) = U4 - T(-d0.y, d0.x);
+    (*R1)  = U1 + s1;
+    (*R9)  = U1 - s1;
+    (*R5)  = U5 + T(-d1.y, d1.x);
+    (*R13) = U5 - T(-d1.y, d1.x);
+    (*R2)  = U2 + s2;
+    (*R10) = U2 - s2;
+    (*R6)  = U6 + T(-d2.y, d2.x);
+    (*R14) = U6 - T(-d2.y, d2.x);
+    (*R3)  = U3 + s3;
+    (*R11) = U3 - s3;
+    (*R7)  = U7 + T(-d3.y, d3.x);
+    (*R15) = U7 - T(-d3.y, d3.x);
+}
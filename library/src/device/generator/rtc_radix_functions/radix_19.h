@@ -0,0 +1,980 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ ******************************************************************************/
+
+// butterfly radix-19 constants, named as the radix-11 and radix-13
+// constants in butterfly_constant.h
+#define Q19i1j1R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i1j1I static_cast<real_type_t<T>>((-0.3246994692046834874076))
+#define Q19i1j2R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i1j2I static_cast<real_type_t<T>>((-0.6142127126896678174443))
+#define Q19i1j3R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i1j3I static_cast<real_type_t<T>>((-0.8371664782625285748061))
+#define Q19i1j4R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i1j4I static_cast<real_type_t<T>>((-0.9694002659393304167361))
+#define Q19i1j5R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i1j5I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+#define Q19i1j6R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i1j6I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i1j7R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i1j7I static_cast<real_type_t<T>>((-0.7357239106731316247742))
+#define Q19i1j8R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i1j8I static_cast<real_type_t<T>>((-0.4759473930370735444314))
+#define Q19i1j9R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i1j9I static_cast<real_type_t<T>>((-0.1645945902807338941437))
+#define Q19i2j1R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i2j1I static_cast<real_type_t<T>>((-0.6142127126896678174443))
+#define Q19i2j2R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i2j2I static_cast<real_type_t<T>>((-0.9694002659393304167361))
+#define Q19i2j3R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i2j3I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i2j4R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i2j4I static_cast<real_type_t<T>>((-0.4759473930370735444314))
+#define Q19i2j5R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i2j5I static_cast<real_type_t<T>>((0.1645945902807338941437))
+#define Q19i2j6R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i2j6I static_cast<real_type_t<T>>((0.7357239106731316247742))
+#define Q19i2j7R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i2j7I static_cast<real_type_t<T>>((0.9965844930066698498194))
+#define Q19i2j8R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i2j8I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i2j9R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i2j9I static_cast<real_type_t<T>>((0.3246994692046834874076))
+#define Q19i3j1R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i3j1I static_cast<real_type_t<T>>((-0.8371664782625285748061))
+#define Q19i3j2R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i3j2I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i3j3R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i3j3I static_cast<real_type_t<T>>((-0.1645945902807338941437))
+#define Q19i3j4R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i3j4I static_cast<real_type_t<T>>((0.7357239106731316247742))
+#define Q19i3j5R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i3j5I static_cast<real_type_t<T>>((0.9694002659393304167361))
+#define Q19i3j6R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i3j6I static_cast<real_type_t<T>>((0.3246994692046834874076))
+#define Q19i3j7R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i3j7I static_cast<real_type_t<T>>((-0.6142127126896678174443))
+#define Q19i3j8R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i3j8I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+#define Q19i3j9R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i3j9I static_cast<real_type_t<T>>((-0.4759473930370735444314))
+#define Q19i4j1R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i4j1I static_cast<real_type_t<T>>((-0.9694002659393304167361))
+#define Q19i4j2R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i4j2I static_cast<real_type_t<T>>((-0.4759473930370735444314))
+#define Q19i4j3R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i4j3I static_cast<real_type_t<T>>((0.7357239106731316247742))
+#define Q19i4j4R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i4j4I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i4j5R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i4j5I static_cast<real_type_t<T>>((-0.3246994692046834874076))
+#define Q19i4j6R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i4j6I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+#define Q19i4j7R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i4j7I static_cast<real_type_t<T>>((-0.1645945902807338941437))
+#define Q19i4j8R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i4j8I static_cast<real_type_t<T>>((0.9157733266550574399193))
+#define Q19i4j9R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i4j9I static_cast<real_type_t<T>>((0.6142127126896678174443))
+#define Q19i5j1R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i5j1I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+#define Q19i5j2R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i5j2I static_cast<real_type_t<T>>((0.1645945902807338941437))
+#define Q19i5j3R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i5j3I static_cast<real_type_t<T>>((0.9694002659393304167361))
+#define Q19i5j4R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i5j4I static_cast<real_type_t<T>>((-0.3246994692046834874076))
+#define Q19i5j5R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i5j5I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i5j6R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i5j6I static_cast<real_type_t<T>>((0.4759473930370735444314))
+#define Q19i5j7R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i5j7I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i5j8R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i5j8I static_cast<real_type_t<T>>((-0.6142127126896678174443))
+#define Q19i5j9R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i5j9I static_cast<real_type_t<T>>((-0.7357239106731316247742))
+#define Q19i6j1R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i6j1I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i6j2R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i6j2I static_cast<real_type_t<T>>((0.7357239106731316247742))
+#define Q19i6j3R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i6j3I static_cast<real_type_t<T>>((0.3246994692046834874076))
+#define Q19i6j4R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i6j4I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+#define Q19i6j5R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i6j5I static_cast<real_type_t<T>>((0.4759473930370735444314))
+#define Q19i6j6R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i6j6I static_cast<real_type_t<T>>((0.6142127126896678174443))
+#define Q19i6j7R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i6j7I static_cast<real_type_t<T>>((-0.9694002659393304167361))
+#define Q19i6j8R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i6j8I static_cast<real_type_t<T>>((0.1645945902807338941437))
+#define Q19i6j9R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i6j9I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i7j1R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i7j1I static_cast<real_type_t<T>>((-0.7357239106731316247742))
+#define Q19i7j2R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i7j2I static_cast<real_type_t<T>>((0.9965844930066698498194))
+#define Q19i7j3R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i7j3I static_cast<real_type_t<T>>((-0.6142127126896678174443))
+#define Q19i7j4R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i7j4I static_cast<real_type_t<T>>((-0.1645945902807338941437))
+#define Q19i7j5R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i7j5I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i7j6R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i7j6I static_cast<real_type_t<T>>((-0.9694002659393304167361))
+#define Q19i7j7R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i7j7I static_cast<real_type_t<T>>((0.4759473930370735444314))
+#define Q19i7j8R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i7j8I static_cast<real_type_t<T>>((0.3246994692046834874076))
+#define Q19i7j9R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i7j9I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i8j1R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i8j1I static_cast<real_type_t<T>>((-0.4759473930370735444314))
+#define Q19i8j2R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i8j2I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i8j3R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i8j3I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+#define Q19i8j4R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i8j4I static_cast<real_type_t<T>>((0.9157733266550574399193))
+#define Q19i8j5R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i8j5I static_cast<real_type_t<T>>((-0.6142127126896678174443))
+#define Q19i8j6R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i8j6I static_cast<real_type_t<T>>((0.1645945902807338941437))
+#define Q19i8j7R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i8j7I static_cast<real_type_t<T>>((0.3246994692046834874076))
+#define Q19i8j8R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i8j8I static_cast<real_type_t<T>>((-0.7357239106731316247742))
+#define Q19i8j9R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i8j9I static_cast<real_type_t<T>>((0.9694002659393304167361))
+#define Q19i9j1R static_cast<real_type_t<T>>((-0.9863613034027223736025))
+#define Q19i9j1I static_cast<real_type_t<T>>((-0.1645945902807338941437))
+#define Q19i9j2R static_cast<real_type_t<T>>((0.9458172417006346790197))
+#define Q19i9j2I static_cast<real_type_t<T>>((0.3246994692046834874076))
+#define Q19i9j3R static_cast<real_type_t<T>>((-0.8794737512064890713909))
+#define Q19i9j3I static_cast<real_type_t<T>>((-0.4759473930370735444314))
+#define Q19i9j4R static_cast<real_type_t<T>>((0.7891405093963935992190))
+#define Q19i9j4I static_cast<real_type_t<T>>((0.6142127126896678174443))
+#define Q19i9j5R static_cast<real_type_t<T>>((-0.6772815716257410747622))
+#define Q19i9j5I static_cast<real_type_t<T>>((-0.7357239106731316247742))
+#define Q19i9j6R static_cast<real_type_t<T>>((0.5469481581224268747118))
+#define Q19i9j6I static_cast<real_type_t<T>>((0.8371664782625285748061))
+#define Q19i9j7R static_cast<real_type_t<T>>((-0.4016954246529694575168))
+#define Q19i9j7I static_cast<real_type_t<T>>((-0.9157733266550574399193))
+#define Q19i9j8R static_cast<real_type_t<T>>((0.2454854871407991489223))
+#define Q19i9j8I static_cast<real_type_t<T>>((0.9694002659393304167361))
+#define Q19i9j9R static_cast<real_type_t<T>>((-0.08257934547233232460034))
+#define Q19i9j9I static_cast<real_type_t<T>>((-0.9965844930066698498194))
+
+template <typename T>
+__device__ void FwdRad19B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12,
+                           T* R13,
+                           T* R14,
+                           T* R15,
+                           T* R16,
+                           T* R17,
+                           T* R18)
+{
+    T x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, dp, dm;
+
+    x0 = (*R0) + (*R1) + (*R2) + (*R3) + (*R4) + (*R5) + (*R6) + (*R7) + (*R8) + (*R9) + (*R10)
+         + (*R11) + (*R12) + (*R13) + (*R14) + (*R15) + (*R16) + (*R17) + (*R18);
+    x1  = (*R0);
+    x2  = (*R0);
+    x3  = (*R0);
+    x4  = (*R0);
+    x5  = (*R0);
+    x6  = (*R0);
+    x7  = (*R0);
+    x8  = (*R0);
+    x9  = (*R0);
+    x10 = (*R0);
+    x11 = (*R0);
+    x12 = (*R0);
+    x13 = (*R0);
+    x14 = (*R0);
+    x15 = (*R0);
+    x16 = (*R0);
+    x17 = (*R0);
+    x18 = (*R0);
+    dp  = (*R1) + (*R18);
+    dm  = (*R1) - (*R18);
+    x1.x += Q19i1j1R * dp.x - Q19i1j1I * dm.y;
+    x1.y += Q19i1j1R * dp.y + Q19i1j1I * dm.x;
+    x18.x += Q19i1j1R * dp.x + Q19i1j1I * dm.y;
+    x18.y += Q19i1j1R * dp.y - Q19i1j1I * dm.x;
+    x2.x += Q19i2j1R * dp.x - Q19i2j1I * dm.y;
+    x2.y += Q19i2j1R * dp.y + Q19i2j1I * dm.x;
+    x17.x += Q19i2j1R * dp.x + Q19i2j1I * dm.y;
+    x17.y += Q19i2j1R * dp.y - Q19i2j1I * dm.x;
+    x3.x += Q19i3j1R * dp.x - Q19i3j1I * dm.y;
+    x3.y += Q19i3j1R * dp.y + Q19i3j1I * dm.x;
+    x16.x += Q19i3j1R * dp.x + Q19i3j1I * dm.y;
+    x16.y += Q19i3j1R * dp.y - Q19i3j1I * dm.x;
+    x4.x += Q19i4j1R * dp.x - Q19i4j1I * dm.y;
+    x4.y += Q19i4j1R * dp.y + Q19i4j1I * dm.x;
+    x15.x += Q19i4j1R * dp.x + Q19i4j1I * dm.y;
+    x15.y += Q19i4j1R * dp.y - Q19i4j1I * dm.x;
+    x5.x += Q19i5j1R * dp.x - Q19i5j1I * dm.y;
+    x5.y += Q19i5j1R * dp.y + Q19i5j1I * dm.x;
+    x14.x += Q19i5j1R * dp.x + Q19i5j1I * dm.y;
+    x14.y += Q19i5j1R * dp.y - Q19i5j1I * dm.x;
+    x6.x += Q19i6j1R * dp.x - Q19i6j1I * dm.y;
+    x6.y += Q19i6j1R * dp.y + Q19i6j1I * dm.x;
+    x13.x += Q19i6j1R * dp.x + Q19i6j1I * dm.y;
+    x13.y += Q19i6j1R * dp.y - Q19i6j1I * dm.x;
+    x7.x += Q19i7j1R * dp.x - Q19i7j1I * dm.y;
+    x7.y += Q19i7j1R * dp.y + Q19i7j1I * dm.x;
+    x12.x += Q19i7j1R * dp.x + Q19i7j1I * dm.y;
+    x12.y += Q19i7j1R * dp.y - Q19i7j1I * dm.x;
+    x8.x += Q19i8j1R * dp.x - Q19i8j1I * dm.y;
+    x8.y += Q19i8j1R * dp.y + Q19i8j1I * dm.x;
+    x11.x += Q19i8j1R * dp.x + Q19i8j1I * dm.y;
+    x11.y += Q19i8j1R * dp.y - Q19i8j1I * dm.x;
+    x9.x += Q19i9j1R * dp.x - Q19i9j1I * dm.y;
+    x9.y += Q19i9j1R * dp.y + Q19i9j1I * dm.x;
+    x10.x += Q19i9j1R * dp.x + Q19i9j1I * dm.y;
+    x10.y += Q19i9j1R * dp.y - Q19i9j1I * dm.x;
+    dp = (*R2) + (*R17);
+    dm = (*R2) - (*R17);
+    x1.x += Q19i1j2R * dp.x - Q19i1j2I * dm.y;
+    x1.y += Q19i1j2R * dp.y + Q19i1j2I * dm.x;
+    x18.x += Q19i1j2R * dp.x + Q19i1j2I * dm.y;
+    x18.y += Q19i1j2R * dp.y - Q19i1j2I * dm.x;
+    x2.x += Q19i2j2R * dp.x - Q19i2j2I * dm.y;
+    x2.y += Q19i2j2R * dp.y + Q19i2j2I * dm.x;
+    x17.x += Q19i2j2R * dp.x + Q19i2j2I * dm.y;
+    x17.y += Q19i2j2R * dp.y - Q19i2j2I * dm.x;
+    x3.x += Q19i3j2R * dp.x - Q19i3j2I * dm.y;
+    x3.y += Q19i3j2R * dp.y + Q19i3j2I * dm.x;
+    x16.x += Q19i3j2R * dp.x + Q19i3j2I * dm.y;
+    x16.y += Q19i3j2R * dp.y - Q19i3j2I * dm.x;
+    x4.x += Q19i4j2R * dp.x - Q19i4j2I * dm.y;
+    x4.y += Q19i4j2R * dp.y + Q19i4j2I * dm.x;
+    x15.x += Q19i4j2R * dp.x + Q19i4j2I * dm.y;
+    x15.y += Q19i4j2R * dp.y - Q19i4j2I * dm.x;
+    x5.x += Q19i5j2R * dp.x - Q19i5j2I * dm.y;
+    x5.y += Q19i5j2R * dp.y + Q19i5j2I * dm.x;
+    x14.x += Q19i5j2R * dp.x + Q19i5j2I * dm.y;
+    x14.y += Q19i5j2R * dp.y - Q19i5j2I * dm.x;
+    x6.x += Q19i6j2R * dp.x - Q19i6j2I * dm.y;
+    x6.y += Q19i6j2R * dp.y + Q19i6j2I * dm.x;
+    x13.x += Q19i6j2R * dp.x + Q19i6j2I * dm.y;
+    x13.y += Q19i6j2R * dp.y - Q19i6j2I * dm.x;
+    x7.x += Q19i7j2R * dp.x - Q19i7j2I * dm.y;
+    x7.y += Q19i7j2R * dp.y + Q19i7j2I * dm.x;
+    x12.x += Q19i7j2R * dp.x + Q19i7j2I * dm.y;
+    x12.y += Q19i7j2R * dp.y - Q19i7j2I * dm.x;
+    x8.x += Q19i8j2R * dp.x - Q19i8j2I * dm.y;
+    x8.y += Q19i8j2R * dp.y + Q19i8j2I * dm.x;
+    x11.x += Q19i8j2R * dp.x + Q19i8j2I * dm.y;
+    x11.y += Q19i8j2R * dp.y - Q19i8j2I * dm.x;
+    x9.x += Q19i9j2R * dp.x - Q19i9j2I * dm.y;
+    x9.y += Q19i9j2R * dp.y + Q19i9j2I * dm.x;
+    x10.x += Q19i9j2R * dp.x + Q19i9j2I * dm.y;
+    x10.y += Q19i9j2R * dp.y - Q19i9j2I * dm.x;
+    dp = (*R3) + (*R16);
+    dm = (*R3) - (*R16);
+    x1.x += Q19i1j3R * dp.x - Q19i1j3I * dm.y;
+    x1.y += Q19i1j3R * dp.y + Q19i1j3I * dm.x;
+    x18.x += Q19i1j3R * dp.x + Q19i1j3I * dm.y;
+    x18.y += Q19i1j3R * dp.y - Q19i1j3I * dm.x;
+    x2.x += Q19i2j3R * dp.x - Q19i2j3I * dm.y;
+    x2.y += Q19i2j3R * dp.y + Q19i2j3I * dm.x;
+    x17.x += Q19i2j3R * dp.x + Q19i2j3I * dm.y;
+    x17.y += Q19i2j3R * dp.y - Q19i2j3I * dm.x;
+    x3.x += Q19i3j3R * dp.x - Q19i3j3I * dm.y;
+    x3.y += Q19i3j3R * dp.y + Q19i3j3I * dm.x;
+    x16.x += Q19i3j3R * dp.x + Q19i3j3I * dm.y;
+    x16.y += Q19i3j3R * dp.y - Q19i3j3I * dm.x;
+    x4.x += Q19i4j3R * dp.x - Q19i4j3I * dm.y;
+    x4.y += Q19i4j3R * dp.y + Q19i4j3I * dm.x;
+    x15.x += Q19i4j3R * dp.x + Q19i4j3I * dm.y;
+    x15.y += Q19i4j3R * dp.y - Q19i4j3I * dm.x;
+    x5.x += Q19i5j3R * dp.x - Q19i5j3I * dm.y;
+    x5.y += Q19i5j3R * dp.y + Q19i5j3I * dm.x;
+    x14.x += Q19i5j3R * dp.x + Q19i5j3I * dm.y;
+    x14.y += Q19i5j3R * dp.y - Q19i5j3I * dm.x;
+    x6.x += Q19i6j3R * dp.x - Q19i6j3I * dm.y;
+    x6.y += Q19i6j3R * dp.y + Q19i6j3I * dm.x;
+    x13.x += Q19i6j3R * dp.x + Q19i6j3I * dm.y;
+    x13.y += Q19i6j3R * dp.y - Q19i6j3I * dm.x;
+    x7.x += Q19i7j3R * dp.x - Q19i7j3I * dm.y;
+    x7.y += Q19i7j3R * dp.y + Q19i7j3I * dm.x;
+    x12.x += Q19i7j3R * dp.x + Q19i7j3I * dm.y;
+    x12.y += Q19i7j3R * dp.y - Q19i7j3I * dm.x;
+    x8.x += Q19i8j3R * dp.x - Q19i8j3I * dm.y;
+    x8.y += Q19i8j3R * dp.y + Q19i8j3I * dm.x;
+    x11.x += Q19i8j3R * dp.x + Q19i8j3I * dm.y;
+    x11.y += Q19i8j3R * dp.y - Q19i8j3I * dm.x;
+    x9.x += Q19i9j3R * dp.x - Q19i9j3I * dm.y;
+    x9.y += Q19i9j3R * dp.y + Q19i9j3I * dm.x;
+    x10.x += Q19i9j3R * dp.x + Q19i9j3I * dm.y;
+    x10.y += Q19i9j3R * dp.y - Q19i9j3I * dm.x;
+    dp = (*R4) + (*R15);
+    dm = (*R4) - (*R15);
+    x1.x += Q19i1j4R * dp.x - Q19i1j4I * dm.y;
+    x1.y += Q19i1j4R * dp.y + Q19i1j4I * dm.x;
+    x18.x += Q19i1j4R * dp.x + Q19i1j4I * dm.y;
+    x18.y += Q19i1j4R * dp.y - Q19i1j4I * dm.x;
+    x2.x += Q19i2j4R * dp.x - Q19i2j4I * dm.y;
+    x2.y += Q19i2j4R * dp.y + Q19i2j4I * dm.x;
+    x17.x += Q19i2j4R * dp.x + Q19i2j4I * dm.y;
+    x17.y += Q19i2j4R * dp.y - Q19i2j4I * dm.x;
+    x3.x += Q19i3j4R * dp.x - Q19i3j4I * dm.y;
+    x3.y += Q19i3j4R * dp.y + Q19i3j4I * dm.x;
+    x16.x += Q19i3j4R * dp.x + Q19i3j4I * dm.y;
+    x16.y += Q19i3j4R * dp.y - Q19i3j4I * dm.x;
+    x4.x += Q19i4j4R * dp.x - Q19i4j4I * dm.y;
+    x4.y += Q19i4j4R * dp.y + Q19i4j4I * dm.x;
+    x15.x += Q19i4j4R * dp.x + Q19i4j4I * dm.y;
+    x15.y += Q19i4j4R * dp.y - Q19i4j4I * dm.x;
+    x5.x += Q19i5j4R * dp.x - Q19i5j4I * dm.y;
+    x5.y += Q19i5j4R * dp.y + Q19i5j4I * dm.x;
+    x14.x += Q19i5j4R * dp.x + Q19i5j4I * dm.y;
+    x14.y += Q19i5j4R * dp.y - Q19i5j4I * dm.x;
+    x6.x += Q19i6j4R * dp.x - Q19i6j4I * dm.y;
+    x6.y += Q19i6j4R * dp.y + Q19i6j4I * dm.x;
+    x13.x += Q19i6j4R * dp.x + Q19i6j4I * dm.y;
+    x13.y += Q19i6j4R * dp.y - Q19i6j4I * dm.x;
+    x7.x += Q19i7j4R * dp.x - Q19i7j4I * dm.y;
+    x7.y += Q19i7j4R * dp.y + Q19i7j4I * dm.x;
+    x12.x += Q19i7j4R * dp.x + Q19i7j4I * dm.y;
+    x12.y += Q19i7j4R * dp.y - Q19i7j4I * dm.x;
+    x8.x += Q19i8j4R * dp.x - Q19i8j4I * dm.y;
+    x8.y += Q19i8j4R * dp.y + Q19i8j4I * dm.x;
+    x11.x += Q19i8j4R * dp.x + Q19i8j4I * dm.y;
+    x11.y += Q19i8j4R * dp.y - Q19i8j4I * dm.x;
+    x9.x += Q19i9j4R * dp.x - Q19i9j4I * dm.y;
+    x9.y += Q19i9j4R * dp.y + Q19i9j4I * dm.x;
+    x10.x += Q19i9j4R * dp.x + Q19i9j4I * dm.y;
+    x10.y += Q19i9j4R * dp.y - Q19i9j4I * dm.x;
+    dp = (*R5) + (*R14);
+    dm = (*R5) - (*R14);
+    x1.x += Q19i1j5R * dp.x - Q19i1j5I * dm.y;
+    x1.y += Q19i1j5R * dp.y + Q19i1j5I * dm.x;
+    x18.x += Q19i1j5R * dp.x + Q19i1j5I * dm.y;
+    x18.y += Q19i1j5R * dp.y - Q19i1j5I * dm.x;
+    x2.x += Q19i2j5R * dp.x - Q19i2j5I * dm.y;
+    x2.y += Q19i2j5R * dp.y + Q19i2j5I * dm.x;
+    x17.x += Q19i2j5R * dp.x + Q19i2j5I * dm.y;
+    x17.y += Q19i2j5R * dp.y - Q19i2j5I * dm.x;
+    x3.x += Q19i3j5R * dp.x - Q19i3j5I * dm.y;
+    x3.y += Q19i3j5R * dp.y + Q19i3j5I * dm.x;
+    x16.x += Q19i3j5R * dp.x + Q19i3j5I * dm.y;
+    x16.y += Q19i3j5R * dp.y - Q19i3j5I * dm.x;
+    x4.x += Q19i4j5R * dp.x - Q19i4j5I * dm.y;
+    x4.y += Q19i4j5R * dp.y + Q19i4j5I * dm.x;
+    x15.x += Q19i4j5R * dp.x + Q19i4j5I * dm.y;
+    x15.y += Q19i4j5R * dp.y - Q19i4j5I * dm.x;
+    x5.x += Q19i5j5R * dp.x - Q19i5j5I * dm.y;
+    x5.y += Q19i5j5R * dp.y + Q19i5j5I * dm.x;
+    x14.x += Q19i5j5R * dp.x + Q19i5j5I * dm.y;
+    x14.y += Q19i5j5R * dp.y - Q19i5j5I * dm.x;
+    x6.x += Q19i6j5R * dp.x - Q19i6j5I * dm.y;
+    x6.y += Q19i6j5R * dp.y + Q19i6j5I * dm.x;
+    x13.x += Q19i6j5R * dp.x + Q19i6j5I * dm.y;
+    x13.y += Q19i6j5R * dp.y - Q19i6j5I * dm.x;
+    x7.x += Q19i7j5R * dp.x - Q19i7j5I * dm.y;
+    x7.y += Q19i7j5R * dp.y + Q19i7j5I * dm.x;
+    x12.x += Q19i7j5R * dp.x + Q19i7j5I * dm.y;
+    x12.y += Q19i7j5R * dp.y - Q19i7j5I * dm.x;
+    x8.x += Q19i8j5R * dp.x - Q19i8j5I * dm.y;
+    x8.y += Q19i8j5R * dp.y + Q19i8j5I * dm.x;
+    x11.x += Q19i8j5R * dp.x + Q19i8j5I * dm.y;
+    x11.y += Q19i8j5R * dp.y - Q19i8j5I * dm.x;
+    x9.x += Q19i9j5R * dp.x - Q19i9j5I * dm.y;
+    x9.y += Q19i9j5R * dp.y + Q19i9j5I * dm.x;
+    x10.x += Q19i9j5R * dp.x + Q19i9j5I * dm.y;
+    x10.y += Q19i9j5R * dp.y - Q19i9j5I * dm.x;
+    dp = (*R6) + (*R13);
+    dm = (*R6) - (*R13);
+    x1.x += Q19i1j6R * dp.x - Q19i1j6I * dm.y;
+    x1.y += Q19i1j6R * dp.y + Q19i1j6I * dm.x;
+    x18.x += Q19i1j6R * dp.x + Q19i1j6I * dm.y;
+    x18.y += Q19i1j6R * dp.y - Q19i1j6I * dm.x;
+    x2.x += Q19i2j6R * dp.x - Q19i2j6I * dm.y;
+    x2.y += Q19i2j6R * dp.y + Q19i2j6I * dm.x;
+    x17.x += Q19i2j6R * dp.x + Q19i2j6I * dm.y;
+    x17.y += Q19i2j6R * dp.y - Q19i2j6I * dm.x;
+    x3.x += Q19i3j6R * dp.x - Q19i3j6I * dm.y;
+    x3.y += Q19i3j6R * dp.y + Q19i3j6I * dm.x;
+    x16.x += Q19i3j6R * dp.x + Q19i3j6I * dm.y;
+    x16.y += Q19i3j6R * dp.y - Q19i3j6I * dm.x;
+    x4.x += Q19i4j6R * dp.x - Q19i4j6I * dm.y;
+    x4.y += Q19i4j6R * dp.y + Q19i4j6I * dm.x;
+    x15.x += Q19i4j6R * dp.x + Q19i4j6I * dm.y;
+    x15.y += Q19i4j6R * dp.y - Q19i4j6I * dm.x;
+    x5.x += Q19i5j6R * dp.x - Q19i5j6I * dm.y;
+    x5.y += Q19i5j6R * dp.y + Q19i5j6I * dm.x;
+    x14.x += Q19i5j6R * dp.x + Q19i5j6I * dm.y;
+    x14.y += Q19i5j6R * dp.y - Q19i5j6I * dm.x;
+    x6.x += Q19i6j6R * dp.x - Q19i6j6I * dm.y;
+    x6.y += Q19i6j6R * dp.y + Q19i6j6I * dm.x;
+    x13.x += Q19i6j6R * dp.x + Q19i6j6I * dm.y;
+    x13.y += Q19i6j6R * dp.y - Q19i6j6I * dm.x;
+    x7.x += Q19i7j6R * dp.x - Q19i7j6I * dm.y;
+    x7.y += Q19i7j6R * dp.y + Q19i7j6I * dm.x;
+    x12.x += Q19i7j6R * dp.x + Q19i7j6I * dm.y;
+    x12.y += Q19i7j6R * dp.y - Q19i7j6I * dm.x;
+    x8.x += Q19i8j6R * dp.x - Q19i8j6I * dm.y;
+    x8.y += Q19i8j6R * dp.y + Q19i8j6I * dm.x;
+    x11.x += Q19i8j6R * dp.x + Q19i8j6I * dm.y;
+    x11.y += Q19i8j6R * dp.y - Q19i8j6I * dm.x;
+    x9.x += Q19i9j6R * dp.x - Q19i9j6I * dm.y;
+    x9.y += Q19i9j6R * dp.y + Q19i9j6I * dm.x;
+    x10.x += Q19i9j6R * dp.x + Q19i9j6I * dm.y;
+    x10.y += Q19i9j6R * dp.y - Q19i9j6I * dm.x;
+    dp = (*R7) + (*R12);
+    dm = (*R7) - (*R12);
+    x1.x += Q19i1j7R * dp.x - Q19i1j7I * dm.y;
+    x1.y += Q19i1j7R * dp.y + Q19i1j7I * dm.x;
+    x18.x += Q19i1j7R * dp.x + Q19i1j7I * dm.y;
+    x18.y += Q19i1j7R * dp.y - Q19i1j7I * dm.x;
+    x2.x += Q19i2j7R * dp.x - Q19i2j7I * dm.y;
+    x2.y += Q19i2j7R * dp.y + Q19i2j7I * dm.x;
+    x17.x += Q19i2j7R * dp.x + Q19i2j7I * dm.y;
+    x17.y += Q19i2j7R * dp.y - Q19i2j7I * dm.x;
+    x3.x += Q19i3j7R * dp.x - Q19i3j7I * dm.y;
+    x3.y += Q19i3j7R * dp.y + Q19i3j7I * dm.x;
+    x16.x += Q19i3j7R * dp.x + Q19i3j7I * dm.y;
+    x16.y += Q19i3j7R * dp.y - Q19i3j7I * dm.x;
+    x4.x += Q19i4j7R * dp.x - Q19i4j7I * dm.y;
+    x4.y += Q19i4j7R * dp.y + Q19i4j7I * dm.x;
+    x15.x += Q19i4j7R * dp.x + Q19i4j7I * dm.y;
+    x15.y += Q19i4j7R * dp.y - Q19i4j7I * dm.x;
+    x5.x += Q19i5j7R * dp.x - Q19i5j7I * dm.y;
+    x5.y += Q19i5j7R * dp.y + Q19i5j7I * dm.x;
+    x14.x += Q19i5j7R * dp.x + Q19i5j7I * dm.y;
+    x14.y += Q19i5j7R * dp.y - Q19i5j7I * dm.x;
+    x6.x += Q19i6j7R * dp.x - Q19i6j7I * dm.y;
+    x6.y += Q19i6j7R * dp.y + Q19i6j7I * dm.x;
+    x13.x += Q19i6j7R * dp.x + Q19i6j7I * dm.y;
+    x13.y += Q19i6j7R * dp.y - Q19i6j7I * dm.x;
+    x7.x += Q19i7j7R * dp.x - Q19i7j7I * dm.y;
+    x7.y += Q19i7j7R * dp.y + Q19i7j7I * dm.x;
+    x12.x += Q19i7j7R * dp.x + Q19i7j7I * dm.y;
+    x12.y += Q19i7j7R * dp.y - Q19i7j7I * dm.x;
+    x8.x += Q19i8j7R * dp.x - Q19i8j7I * dm.y;
+    x8.y += Q19i8j7R * dp.y + Q19i8j7I * dm.x;
+    x11.x += Q19i8j7R * dp.x + Q19i8j7I * dm.y;
+    x11.y += Q19i8j7R * dp.y - Q19i8j7I * dm.x;
+    x9.x += Q19i9j7R * dp.x - Q19i9j7I * dm.y;
+    x9.y += Q19i9j7R * dp.y + Q19i9j7I * dm.x;
+    x10.x += Q19i9j7R * dp.x + Q19i9j7I * dm.y;
+    x10.y += Q19i9j7R * dp.y - Q19i9j7I * dm.x;
+    dp = (*R8) + (*R11);
+    dm = (*R8) - (*R11);
+    x1.x += Q19i1j8R * dp.x - Q19i1j8I * dm.y;
+    x1.y += Q19i1j8R * dp.y + Q19i1j8I * dm.x;
+    x18.x += Q19i1j8R * dp.x + Q19i1j8I * dm.y;
+    x18.y += Q19i1j8R * dp.y - Q19i1j8I * dm.x;
+    x2.x += Q19i2j8R * dp.x - Q19i2j8I * dm.y;
+    x2.y += Q19i2j8R * dp.y + Q19i2j8I * dm.x;
+    x17.x += Q19i2j8R * dp.x + Q19i2j8I * dm.y;
+    x17.y += Q19i2j8R * dp.y - Q19i2j8I * dm.x;
+    x3.x += Q19i3j8R * dp.x - Q19i3j8I * dm.y;
+    x3.y += Q19i3j8R * dp.y + Q19i3j8I * dm.x;
+    x16.x += Q19i3j8R * dp.x + Q19i3j8I * dm.y;
+    x16.y += Q19i3j8R * dp.y - Q19i3j8I * dm.x;
+    x4.x += Q19i4j8R * dp.x - Q19i4j8I * dm.y;
+    x4.y += Q19i4j8R * dp.y + Q19i4j8I * dm.x;
+    x15.x += Q19i4j8R * dp.x + Q19i4j8I * dm.y;
+    x15.y += Q19i4j8R * dp.y - Q19i4j8I * dm.x;
+    x5.x += Q19i5j8R * dp.x - Q19i5j8I * dm.y;
+    x5.y += Q19i5j8R * dp.y + Q19i5j8I * dm.x;
+    x14.x += Q19i5j8R * dp.x + Q19i5j8I * dm.y;
+    x14.y += Q19i5j8R * dp.y - Q19i5j8I * dm.x;
+    x6.x += Q19i6j8R * dp.x - Q19i6j8I * dm.y;
+    x6.y += Q19i6j8R * dp.y + Q19i6j8I * dm.x;
+    x13.x += Q19i6j8R * dp.x + Q19i6j8I * dm.y;
+    x13.y += Q19i6j8R * dp.y - Q19i6j8I * dm.x;
+    x7.x += Q19i7j8R * dp.x - Q19i7j8I * dm.y;
+    x7.y += Q19i7j8R * dp.y + Q19i7j8I * dm.x;
+    x12.x += Q19i7j8R * dp.x + Q19i7j8I * dm.y;
+    x12.y += Q19i7j8R * dp.y - Q19i7j8I * dm.x;
+    x8.x += Q19i8j8R * dp.x - Q19i8j8I * dm.y;
+    x8.y += Q19i8j8R * dp.y + Q19i8j8I * dm.x;
+    x11.x += Q19i8j8R * dp.x + Q19i8j8I * dm.y;
+    x11.y += Q19i8j8R * dp.y - Q19i8j8I * dm.x;
+    x9.x += Q19i9j8R * dp.x - Q19i9j8I * dm.y;
+    x9.y += Q19i9j8R * dp.y + Q19i9j8I * dm.x;
+    x10.x += Q19i9j8R * dp.x + Q19i9j8I * dm.y;
+    x10.y += Q19i9j8R * dp.y - Q19i9j8I * dm.x;
+    dp = (*R9) + (*R10);
+    dm = (*R9) - (*R10);
+    x1.x += Q19i1j9R * dp.x - Q19i1j9I * dm.y;
+    x1.y += Q19i1j9R * dp.y + Q19i1j9I * dm.x;
+    x18.x += Q19i1j9R * dp.x + Q19i1j9I * dm.y;
+    x18.y += Q19i1j9R * dp.y - Q19i1j9I * dm.x;
+    x2.x += Q19i2j9R * dp.x - Q19i2j9I * dm.y;
+    x2.y += Q19i2j9R * dp.y + Q19i2j9I * dm.x;
+    x17.x += Q19i2j9R * dp.x + Q19i2j9I * dm.y;
+    x17.y += Q19i2j9R * dp.y - Q19i2j9I * dm.x;
+    x3.x += Q19i3j9R * dp.x - Q19i3j9I * dm.y;
+    x3.y += Q19i3j9R * dp.y + Q19i3j9I * dm.x;
+    x16.x += Q19i3j9R * dp.x + Q19i3j9I * dm.y;
+    x16.y += Q19i3j9R * dp.y - Q19i3j9I * dm.x;
+    x4.x += Q19i4j9R * dp.x - Q19i4j9I * dm.y;
+    x4.y += Q19i4j9R * dp.y + Q19i4j9I * dm.x;
+    x15.x += Q19i4j9R * dp.x + Q19i4j9I * dm.y;
+    x15.y += Q19i4j9R * dp.y - Q19i4j9I * dm.x;
+    x5.x += Q19i5j9R * dp.x - Q19i5j9I * dm.y;
+    x5.y += Q19i5j9R * dp.y + Q19i5j9I * dm.x;
+    x14.x += Q19i5j9R * dp.x + Q19i5j9I * dm.y;
+    x14.y += Q19i5j9R * dp.y - Q19i5j9I * dm.x;
+    x6.x += Q19i6j9R * dp.x - Q19i6j9I * dm.y;
+    x6.y += Q19i6j9R * dp.y + Q19i6j9I * dm.x;
+    x13.x += Q19i6j9R * dp.x + Q19i6j9I * dm.y;
+    x13.y += Q19i6j9R * dp.y - Q19i6j9I * dm.x;
+    x7.x += Q19i7j9R * dp.x - Q19i7j9I * dm.y;
+    x7.y += Q19i7j9R * dp.y + Q19i7j9I * dm.x;
+    x12.x += Q19i7j9R * dp.x + Q19i7j9I * dm.y;
+    x12.y += Q19i7j9R * dp.y - Q19i7j9I * dm.x;
+    x8.x += Q19i8j9R * dp.x - Q19i8j9I * dm.y;
+    x8.y += Q19i8j9R * dp.y + Q19i8j9I * dm.x;
+    x11.x += Q19i8j9R * dp.x + Q19i8j9I * dm.y;
+    x11.y += Q19i8j9R * dp.y - Q19i8j9I * dm.x;
+    x9.x += Q19i9j9R * dp.x - Q19i9j9I * dm.y;
+    x9.y += Q19i9j9R * dp.y + Q19i9j9I * dm.x;
+    x10.x += Q19i9j9R * dp.x + Q19i9j9I * dm.y;
+    x10.y += Q19i9j9R * dp.y - Q19i9j9I * dm.x;
+    (*R0)  = x0;
+    (*R1)  = x1;
+    (*R2)  = x2;
+    (*R3)  = x3;
+    (*R4)  = x4;
+    (*R5)  = x5;
+    (*R6)  = x6;
+    (*R7)  = x7;
+    (*R8)  = x8;
+    (*R9)  = x9;
+    (*R10) = x10;
+    (*R11) = x11;
+    (*R12) = x12;
+    (*R13) = x13;
+    (*R14) = x14;
+    (*R15) = x15;
+    (*R16) = x16;
+    (*R17) = x17;
+    (*R18) = x18;
+}
+
+template <typename T>
+__device__ void InvRad19B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12,
+                           T* R13,
+                           T* R14,
+                           T* R15,
+                           T* R16,
+                           T* R17,
+                           T* R18)
+{
+    T x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, dp, dm;
+
+    x0 = (*R0) + (*R1) + (*R2) + (*R3) + (*R4) + (*R5) + (*R6) + (*R7) + (*R8) + (*R9) + (*R10)
+         + (*R11) + (*R12) + (*R13) + (*R14) + (*R15) + (*R16) + (*R17) + (*R18);
+    x1  = (*R0);
+    x2  = (*R0);
+    x3  = (*R0);
+    x4  = (*R0);
+    x5  = (*R0);
+    x6  = (*R0);
+    x7  = (*R0);
+    x8  = (*R0);
+    x9  = (*R0);
+    x10 = (*R0);
+    x11 = (*R0);
+    x12 = (*R0);
+    x13 = (*R0);
+    x14 = (*R0);
+    x15 = (*R0);
+    x16 = (*R0);
+    x17 = (*R0);
+    x18 = (*R0);
+    dp  = (*R1) + (*R18);
+    dm  = (*R1) - (*R18);
+    x1.x += Q19i1j1R * dp.x + Q19i1j1I * dm.y;
+    x1.y += Q19i1j1R * dp.y - Q19i1j1I * dm.x;
+    x18.x += Q19i1j1R * dp.x - Q19i1j1I * dm.y;
+    x18.y += Q19i1j1R * dp.y + Q19i1j1I * dm.x;
+    x2.x += Q19i2j1R * dp.x + Q19i2j1I * dm.y;
+    x2.y += Q19i2j1R * dp.y - Q19i2j1I * dm.x;
+    x17.x += Q19i2j1R * dp.x - Q19i2j1I * dm.y;
+    x17.y += Q19i2j1R * dp.y + Q19i2j1I * dm.x;
+    x3.x += Q19i3j1R * dp.x + Q19i3j1I * dm.y;
+    x3.y += Q19i3j1R * dp.y - Q19i3j1I * dm.x;
+    x16.x += Q19i3j1R * dp.x - Q19i3j1I * dm.y;
+    x16.y += Q19i3j1R * dp.y + Q19i3j1I * dm.x;
+    x4.x += Q19i4j1R * dp.x + Q19i4j1I * dm.y;
+    x4.y += Q19i4j1R * dp.y - Q19i4j1I * dm.x;
+    x15.x += Q19i4j1R * dp.x - Q19i4j1I * dm.y;
+    x15.y += Q19i4j1R * dp.y + Q19i4j1I * dm.x;
+    x5.x += Q19i5j1R * dp.x + Q19i5j1I * dm.y;
+    x5.y += Q19i5j1R * dp.y - Q19i5j1I * dm.x;
+    x14.x += Q19i5j1R * dp.x - Q19i5j1I * dm.y;
+    x14.y += Q19i5j1R * dp.y + Q19i5j1I * dm.x;
+    x6.x += Q19i6j1R * dp.x + Q19i6j1I * dm.y;
+    x6.y += Q19i6j1R * dp.y - Q19i6j1I * dm.x;
+    x13.x += Q19i6j1R * dp.x - Q19i6j1I * dm.y;
+    x13.y += Q19i6j1R * dp.y + Q19i6j1I * dm.x;
+    x7.x += Q19i7j1R * dp.x + Q19i7j1I * dm.y;
+    x7.y += Q19i7j1R * dp.y - Q19i7j1I * dm.x;
+    x12.x += Q19i7j1R * dp.x - Q19i7j1I * dm.y;
+    x12.y += Q19i7j1R * dp.y + Q19i7j1I * dm.x;
+    x8.x += Q19i8j1R * dp.x + Q19i8j1I * dm.y;
+    x8.y += Q19i8j1R * dp.y - Q19i8j1I * dm.x;
+    x11.x += Q19i8j1R * dp.x - Q19i8j1I * dm.y;
+    x11.y += Q19i8j1R * dp.y + Q19i8j1I * dm.x;
+    x9.x += Q19i9j1R * dp.x + Q19i9j1I * dm.y;
+    x9.y += Q19i9j1R * dp.y - Q19i9j1I * dm.x;
+    x10.x += Q19i9j1R * dp.x - Q19i9j1I * dm.y;
+    x10.y += Q19i9j1R * dp.y + Q19i9j1I * dm.x;
+    dp = (*R2) + (*R17);
+    dm = (*R2) - (*R17);
+    x1.x += Q19i1j2R * dp.x + Q19i1j2I * dm.y;
+    x1.y += Q19i1j2R * dp.y - Q19i1j2I * dm.x;
+    x18.x += Q19i1j2R * dp.x - Q19i1j2I * dm.y;
+    x18.y += Q19i1j2R * dp.y + Q19i1j2I * dm.x;
+    x2.x += Q19i2j2R * dp.x + Q19i2j2I * dm.y;
+    x2.y += Q19i2j2R * dp.y - Q19i2j2I * dm.x;
+    x17.x += Q19i2j2R * dp.x - Q19i2j2I * dm.y;
+    x17.y += Q19i2j2R * dp.y + Q19i2j2I * dm.x;
+    x3.x += Q19i3j2R * dp.x + Q19i3j2I * dm.y;
+    x3.y += Q19i3j2R * dp.y - Q19i3j2I * dm.x;
+    x16.x += Q19i3j2R * dp.x - Q19i3j2I * dm.y;
+    x16.y += Q19i3j2R * dp.y + Q19i3j2I * dm.x;
+    x4.x += Q19i4j2R * dp.x + Q19i4j2I * dm.y;
+    x4.y += Q19i4j2R * dp.y - Q19i4j2I * dm.x;
+    x15.x += Q19i4j2R * dp.x - Q19i4j2I * dm.y;
+    x15.y += Q19i4j2R * dp.y + Q19i4j2I * dm.x;
+    x5.x += Q19i5j2R * dp.x + Q19i5j2I * dm.y;
+    x5.y += Q19i5j2R * dp.y - Q19i5j2I * dm.x;
+    x14.x += Q19i5j2R * dp.x - Q19i5j2I * dm.y;
+    x14.y += Q19i5j2R * dp.y + Q19i5j2I * dm.x;
+    x6.x += Q19i6j2R * dp.x + Q19i6j2I * dm.y;
+    x6.y += Q19i6j2R * dp.y - Q19i6j2I * dm.x;
+    x13.x += Q19i6j2R * dp.x - Q19i6j2I * dm.y;
+    x13.y += Q19i6j2R * dp.y + Q19i6j2I * dm.x;
+    x7.x += Q19i7j2R * dp.x + Q19i7j2I * dm.y;
+    x7.y += Q19i7j2R * dp.y - Q19i7j2I * dm.x;
+    x12.x += Q19i7j2R * dp.x - Q19i7j2I * dm.y;
+    x12.y += Q19i7j2R * dp.y + Q19i7j2I * dm.x;
+    x8.x += Q19i8j2R * dp.x + Q19i8j2I * dm.y;
+    x8.y += Q19i8j2R * dp.y - Q19i8j2I * dm.x;
+    x11.x += Q19i8j2R * dp.x - Q19i8j2I * dm.y;
+    x11.y += Q19i8j2R * dp.y + Q19i8j2I * dm.x;
+    x9.x += Q19i9j2R * dp.x + Q19i9j2I * dm.y;
+    x9.y += Q19i9j2R * dp.y - Q19i9j2I * dm.x;
+    x10.x += Q19i9j2R * dp.x - Q19i9j2I * dm.y;
+    x10.y += Q19i9j2R * dp.y + Q19i9j2I * dm.x;
+    dp = (*R3) + (*R16);
+    dm = (*R3) - (*R16);
+    x1.x += Q19i1j3R * dp.x + Q19i1j3I * dm.y;
+    x1.y += Q19i1j3R * dp.y - Q19i1j3I * dm.x;
+    x18.x += Q19i1j3R * dp.x - Q19i1j3I * dm.y;
+    x18.y += Q19i1j3R * dp.y + Q19i1j3I * dm.x;
+    x2.x += Q19i2j3R * dp.x + Q19i2j3I * dm.y;
+    x2.y += Q19i2j3R * dp.y - Q19i2j3I * dm.x;
+    x17.x += Q19i2j3R * dp.x - Q19i2j3I * dm.y;
+    x17.y += Q19i2j3R * dp.y + Q19i2j3I * dm.x;
+    x3.x += Q19i3j3R * dp.x + Q19i3j3I * dm.y;
+    x3.y += Q19i3j3R * dp.y - Q19i3j3I * dm.x;
+    x16.x += Q19i3j3R * dp.x - Q19i3j3I * dm.y;
+    x16.y += Q19i3j3R * dp.y + Q19i3j3I * dm.x;
+    x4.x += Q19i4j3R * dp.x + Q19i4j3I * dm.y;
+    x4.y += Q19i4j3R * dp.y - Q19i4j3I * dm.x;
+    x15.x += Q19i4j3R * dp.x - Q19i4j3I * dm.y;
+    x15.y += Q19i4j3R * dp.y + Q19i4j3I * dm.x;
+    x5.x += Q19i5j3R * dp.x + Q19i5j3I * dm.y;
+    x5.y += Q19i5j3R * dp.y - Q19i5j3I * dm.x;
+    x14.x += Q19i5j3R * dp.x - Q19i5j3I * dm.y;
+    x14.y += Q19i5j3R * dp.y + Q19i5j3I * dm.x;
+    x6.x += Q19i6j3R * dp.x + Q19i6j3I * dm.y;
+    x6.y += Q19i6j3R * dp.y - Q19i6j3I * dm.x;
+    x13.x += Q19i6j3R * dp.x - Q19i6j3I * dm.y;
+    x13.y += Q19i6j3R * dp.y + Q19i6j3I * dm.x;
+    x7.x += Q19i7j3R * dp.x + Q19i7j3I * dm.y;
+    x7.y += Q19i7j3R * dp.y - Q19i7j3I * dm.x;
+    x12.x += Q19i7j3R * dp.x - Q19i7j3I * dm.y;
+    x12.y += Q19i7j3R * dp.y + Q19i7j3I * dm.x;
+    x8.x += Q19i8j3R * dp.x + Q19i8j3I * dm.y;
+    x8.y += Q19i8j3R * dp.y - Q19i8j3I * dm.x;
+    x11.x += Q19i8j3R * dp.x - Q19i8j3I * dm.y;
+    x11.y += Q19i8j3R * dp.y + Q19i8j3I * dm.x;
+    x9.x += Q19i9j3R * dp.x + Q19i9j3I * dm.y;
+    x9.y += Q19i9j3R * dp.y - Q19i9j3I * dm.x;
+    x10.x += Q19i9j3R * dp.x - Q19i9j3I * dm.y;
+    x10.y += Q19i9j3R * dp.y + Q19i9j3I * dm.x;
+    dp = (*R4) + (*R15);
+    dm = (*R4) - (*R15);
+    x1.x += Q19i1j4R * dp.x + Q19i1j4I * dm.y;
+    x1.y += Q19i1j4R * dp.y - Q19i1j4I * dm.x;
+    x18.x += Q19i1j4R * dp.x - Q19i1j4I * dm.y;
+    x18.y += Q19i1j4R * dp.y + Q19i1j4I * dm.x;
+    x2.x += Q19i2j4R * dp.x + Q19i2j4I * dm.y;
+    x2.y += Q19i2j4R * dp.y - Q19i2j4I * dm.x;
+    x17.x += Q19i2j4R * dp.x - Q19i2j4I * dm.y;
+    x17.y += Q19i2j4R * dp.y + Q19i2j4I * dm.x;
+    x3.x += Q19i3j4R * dp.x + Q19i3j4I * dm.y;
+    x3.y += Q19i3j4R * dp.y - Q19i3j4I * dm.x;
+    x16.x += Q19i3j4R * dp.x - Q19i3j4I * dm.y;
+    x16.y += Q19i3j4R * dp.y + Q19i3j4I * dm.x;
+    x4.x += Q19i4j4R * dp.x + Q19i4j4I * dm.y;
+    x4.y += Q19i4j4R * dp.y - Q19i4j4I * dm.x;
+    x15.x += Q19i4j4R * dp.x - Q19i4j4I * dm.y;
+    x15.y += Q19i4j4R * dp.y + Q19i4j4I * dm.x;
+    x5.x += Q19i5j4R * dp.x + Q19i5j4I * dm.y;
+    x5.y += Q19i5j4R * dp.y - Q19i5j4I * dm.x;
+    x14.x += Q19i5j4R * dp.x - Q19i5j4I * dm.y;
+    x14.y += Q19i5j4R * dp.y + Q19i5j4I * dm.x;
+    x6.x += Q19i6j4R * dp.x + Q19i6j4I * dm.y;
+    x6.y += Q19i6j4R * dp.y - Q19i6j4I * dm.x;
+    x13.x += Q19i6j4R * dp.x - Q19i6j4I * dm.y;
+    x13.y += Q19i6j4R * dp.y + Q19i6j4I * dm.x;
+    x7.x += Q19i7j4R * dp.x + Q19i7j4I * dm.y;
+    x7.y += Q19i7j4R * dp.y - Q19i7j4I * dm.x;
+    x12.x += Q19i7j4R * dp.x - Q19i7j4I * dm.y;
+    x12.y += Q19i7j4R * dp.y + Q19i7j4I * dm.x;
+    x8.x += Q19i8j4R * dp.x + Q19i8j4I * dm.y;
+    x8.y += Q19i8j4R * dp.y - Q19i8j4I * dm.x;
+    x11.x += Q19i8j4R * dp.x - Q19i8j4I * dm.y;
+    x11.y += Q19i8j4R * dp.y + Q19i8j4I * dm.x;
+    x9.x += Q19i9j4R * dp.x + Q19i9j4I * dm.y;
+    x9.y += Q19i9j4R * dp.y - Q19i9j4I * dm.x;
+    x10.x += Q19i9j4R * dp.x - Q19i9j4I * dm.y;
+    x10.y += Q19i9j4R * dp.y + Q19i9j4I * dm.x;
+    dp = (*R5) + (*R14);
+    dm = (*R5) - (*R14);
+    x1.x += Q19i1j5R * dp.x + Q19i1j5I * dm.y;
+    x1.y += Q19i1j5R * dp.y - Q19i1j5I * dm.x;
+    x18.x += Q19i1j5R * dp.x - Q19i1j5I * dm.y;
+    x18.y += Q19i1j5R * dp.y + Q19i1j5I * dm.x;
+    x2.x += Q19i2j5R * dp.x + Q19i2j5I * dm.y;
+    x2.y += Q19i2j5R * dp.y - Q19i2j5I * dm.x;
+    x17.x += Q19i2j5R * dp.x - Q19i2j5I * dm.y;
+    x17.y += Q19i2j5R * dp.y + Q19i2j5I * dm.x;
+    x3.x += Q19i3j5R * dp.x + Q19i3j5I * dm.y;
+    x3.y += Q19i3j5R * dp.y - Q19i3j5I * dm.x;
+    x16.x += Q19i3j5R * dp.x - Q19i3j5I * dm.y;
+    x16.y += Q19i3j5R * dp.y + Q19i3j5I * dm.x;
+    x4.x += Q19i4j5R * dp.x + Q19i4j5I * dm.y;
+    x4.y += Q19i4j5R * dp.y - Q19i4j5I * dm.x;
+    x15.x += Q19i4j5R * dp.x - Q19i4j5I * dm.y;
+    x15.y += Q19i4j5R * dp.y + Q19i4j5I * dm.x;
+    x5.x += Q19i5j5R * dp.x + Q19i5j5I * dm.y;
+    x5.y += Q19i5j5R * dp.y - Q19i5j5I * dm.x;
+    x14.x += Q19i5j5R * dp.x - Q19i5j5I * dm.y;
+    x14.y += Q19i5j5R * dp.y + Q19i5j5I * dm.x;
+    x6.x += Q19i6j5R * dp.x + Q19i6j5I * dm.y;
+    x6.y += Q19i6j5R * dp.y - Q19i6j5I * dm.x;
+    x13.x += Q19i6j5R * dp.x - Q19i6j5I * dm.y;
+    x13.y += Q19i6j5R * dp.y + Q19i6j5I * dm.x;
+    x7.x += Q19i7j5R * dp.x + Q19i7j5I * dm.y;
+    x7.y += Q19i7j5R * dp.y - Q19i7j5I * dm.x;
+    x12.x += Q19i7j5R * dp.x - Q19i7j5I * dm.y;
+    x12.y += Q19i7j5R * dp.y + Q19i7j5I * dm.x;
+    x8.x += Q19i8j5R * dp.x + Q19i8j5I * dm.y;
+    x8.y += Q19i8j5R * dp.y - Q19i8j5I * dm.x;
+    x11.x += Q19i8j5R * dp.x - Q19i8j5I * dm.y;
+    x11.y += Q19i8j5R * dp.y + Q19i8j5I * dm.x;
+    x9.x += Q19i9j5R * dp.x + Q19i9j5I * dm.y;
+    x9.y += Q19i9j5R * dp.y - Q19i9j5I * dm.x;
+    x10.x += Q19i9j5R * dp.x - Q19i9j5I * dm.y;
+    x10.y += Q19i9j5R * dp.y + Q19i9j5I * dm.x;
+    dp = (*R6) + (*R13);
+    dm = (*R6) - (*R13);
+    x1.x += Q19i1j6R * dp.x + Q19i1j6I * dm.y;
+    x1.y += Q19i1j6R * dp.y - Q19i1j6I * dm.x;
+    x18.x += Q19i1j6R * dp.x - Q19i1j6I * dm.y;
+    x18.y += Q19i1j6R * dp.y + Q19i1j6I * dm.x;
+    x2.x += Q19i2j6R * dp.x + Q19i2j6I * dm.y;
+    x2.y += Q19i2j6R * dp.y - Q19i2j6I * dm.x;
+    x17.x += Q19i2j6R * dp.x - Q19i2j6I * dm.y;
+    x17.y += Q19i2j6R * dp.y + Q19i2j6I * dm.x;
+    x3.x += Q19i3j6R * dp.x + Q19i3j6I * dm.y;
+    x3.y += Q19i3j6R * dp.y - Q19i3j6I * dm.x;
+    x16.x += Q19i3j6R * dp.x - Q19i3j6I * dm.y;
+    x16.y += Q19i3j6R * dp.y + Q19i3j6I * dm.x;
+    x4.x += Q19i4j6R * dp.x + Q19i4j6I * dm.y;
+    x4.y += Q19i4j6R * dp.y - Q19i4j6I * dm.x;
+    x15.x += Q19i4j6R * dp.x - Q19i4j6I * dm.y;
+    x15.y += Q19i4j6R * dp.y + Q19i4j6I * dm.x;
+    x5.x += Q19i5j6R * dp.x + Q19i5j6I * dm.y;
+    x5.y += Q19i5j6R * dp.y - Q19i5j6I * dm.x;
+    x14.x += Q19i5j6R * dp.x - Q19i5j6I * dm.y;
+    x14.y += Q19i5j6R * dp.y + Q19i5j6I * dm.x;
+    x6.x += Q19i6j6R * dp.x + Q19i6j6I * dm.y;
+    x6.y += Q19i6j6R * dp.y - Q19i6j6I * dm.x;
+    x13.x += Q19i6j6R * dp.x - Q19i6j6I * dm.y;
+    x13.y += Q19i6j6R * dp.y + Q19i6j6I * dm.x;
+    x7.x += Q19i7j6R * dp.x + Q19i7j6I * dm.y;
+    x7.y += Q19i7j6R * dp.y - Q19i7j6I * dm.x;
+    x12.x += Q19i7j6R * dp.x - Q19i7j6I * dm.y;
+    x12.y += Q19i7j6R * dp.y + Q19i7j6I * dm.x;
+    x8.x += Q19i8j6R * dp.x + Q19i8j6I * dm.y;
+    x8.y += Q19i8j6R * dp.y - Q19i8j6I * dm.x;
+    x11.x += Q19i8j6R * dp.x - Q19i8j6I * dm.y;
+    x11.y += Q19i8j6R * dp.y + Q19i8j6I * dm.x;
+    x9.x += Q19i9j6R * dp.x + Q19i9j6I * dm.y;
+    x9.y += Q19i9j6R * dp.y - Q19i9j6I * dm.x;
+    x10.x += Q19i9j6R * dp.x - Q19i9j6I * dm.y;
+    x10.y += Q19i9j6R * dp.y + Q19i9j6I * dm.x;
+    dp = (*R7) + (*R12);
+    dm = (*R7) - (*R12);
+    x1.x += Q19i1j7R * dp.x + Q19i1j7I * dm.y;
+    x1.y += Q19i1j7R * dp.y - Q19i1j7I * dm.x;
+    x18.x += Q19i1j7R * dp.x - Q19i1j7I * dm.y;
+    x18.y += Q19i1j7R * dp.y + Q19i1j7I * dm.x;
+    x2.x += Q19i2j7R * dp.x + Q19i2j7I * dm.y;
+    x2.y += Q19i2j7R * dp.y - Q19i2j7I * dm.x;
+    x17.x += Q19i2j7R * dp.x - Q19i2j7I * dm.y;
+    x17.y += Q19i2j7R * dp.y + Q19i2j7I * dm.x;
+    x3.x += Q19i3j7R * dp.x + Q19i3j7I * dm.y;
+    x3.y += Q19i3j7R * dp.y - Q19i3j7I * dm.x;
+    x16.x += Q19i3j7R * dp.x - Q19i3j7I * dm.y;
+    x16.y += Q19i3j7R * dp.y + Q19i3j7I * dm.x;
+    x4.x += Q19i4j7R * dp.x + Q19i4j7I * dm.y;
+    x4.y += Q19i4j7R * dp.y - Q19i4j7I * dm.x;
+    x15.x += Q19i4j7R * dp.x - Q19i4j7I * dm.y;
+    x15.y += Q19i4j7R * dp.y + Q19i4j7I * dm.x;
+    x5.x += Q19i5j7R * dp.x + Q19i5j7I * dm.y;
+    x5.y += Q19i5j7R * dp.y - Q19i5j7I * dm.x;
+    x14.x += Q19i5j7R * dp.x - Q19i5j7I * dm.y;
+    x14.y += Q19i5j7R * dp.y + Q19i5j7I * dm.x;
+    x6.x += Q19i6j7R * dp.x + Q19i6j7I * dm.y;
+    x6.y += Q19i6j7R * dp.y - Q19i6j7I * dm.x;
+    x13.x += Q19i6j7R * dp.x - Q19i6j7I * dm.y;
+    x13.y += Q19i6j7R * dp.y + Q19i6j7I * dm.x;
+    x7.x += Q19i7j7R * dp.x + Q19i7j7I * dm.y;
+    x7.y += Q19i7j7R * dp.y - Q19i7j7I * dm.x;
+    x12.x += Q19i7j7R * dp.x - Q19i7j7I * dm.y;
+    x12.y += Q19i7j7R * dp.y + Q19i7j7I * dm.x;
+    x8.x += Q19i8j7R * dp.x + Q19i8j7I * dm.y;
+    x8.y += Q19i8j7R * dp.y - Q19i8j7I * dm.x;
+    x11.x += Q19i8j7R * dp.x - Q19i8j7I * dm.y;
+    x11.y += Q19i8j7R * dp.y + Q19i8j7I * dm.x;
+    x9.x += Q19i9j7R * dp.x + Q19i9j7I * dm.y;
+    x9.y += Q19i9j7R * dp.y - Q19i9j7I * dm.x;
+    x10.x += Q19i9j7R * dp.x - Q19i9j7I * dm.y;
+    x10.y += Q19i9j7R * dp.y + Q19i9j7I * dm.x;
+    dp = (*R8) + (*R11);
+    dm = (*R8) - (*R11);
+    x1.x += Q19i1j8R * dp.x + Q19i1j8I * dm.y;
+    x1.y += Q19i1j8R * dp.y - Q19i1j8I * dm.x;
+    x18.x += Q19i1j8R * dp.x - Q19i1j8I * dm.y;
+    x18.y += Q19i1j8R * dp.y + Q19i1j8I * dm.x;
+    x2.x += Q19i2j8R * dp.x + Q19i2j8I * dm.y;
+    x2.y += Q19i2j8R * dp.y - Q19i2j8I * dm.x;
+    x17.x += Q19i2j8R * dp.x - Q19i2j8I * dm.y;
+    x17.y += Q19i2j8R * dp.y + Q19i2j8I * dm.x;
+    x3.x += Q19i3j8R * dp.x + Q19i3j8I * dm.y;
+    x3.y += Q19i3j8R * dp.y - Q19i3j8I * dm.x;
+    x16.x += Q19i3j8R * dp.x - Q19i3j8I * dm.y;
+    x16.y += Q19i3j8R * dp.y + Q19i3j8I * dm.x;
+    x4.x += Q19i4j8R * dp.x + Q19i4j8I * dm.y;
+    x4.y += Q19i4j8R * dp.y - Q19i4j8I * dm.x;
+    x15.x += Q19i4j8R * dp.x - Q19i4j8I * dm.y;
+    x15.y += Q19i4j8R * dp.y + Q19i4j8I * dm.x;
+    x5.x += Q19i5j8R * dp.x + Q19i5j8I * dm.y;
+    x5.y += Q19i5j8R * dp.y - Q19i5j8I * dm.x;
+    x14.x += Q19i5j8R * dp.x - Q19i5j8I * dm.y;
+    x14.y += Q19i5j8R * dp.y + Q19i5j8I * dm.x;
+    x6.x += Q19i6j8R * dp.x + Q19i6j8I * dm.y;
+    x6.y += Q19i6j8R * dp.y - Q19i6j8I * dm.x;
+    x13.x += Q19i6j8R * dp.x - Q19i6j8I * dm.y;
+    x13.y += Q19i6j8R * dp.y + Q19i6j8I * dm.x;
+    x7.x += Q19i7j8R * dp.x + Q19i7j8I * dm.y;
+    x7.y += Q19i7j8R * dp.y - Q19i7j8I * dm.x;
+    x12.x += Q19i7j8R * dp.x - Q19i7j8I * dm.y;
+    x12.y += Q19i7j8R * dp.y + Q19i7j8I * dm.x;
+    x8.x += Q19i8j8R * dp.x + Q19i8j8I * dm.y;
+    x8.y += Q19i8j8R * dp.y - Q19i8j8I * dm.x;
+    x11.x += Q19i8j8R * dp.x - Q19i8j8I * dm.y;
+    x11.y += Q19i8j8R * dp.y + Q19i8j8I * dm.x;
+    x9.x += Q19i9j8R * dp.x + Q19i9j8I * dm.y;
+    x9.y += Q19i9j8R * dp.y - Q19i9j8I * dm.x;
+    x10.x += Q19i9j8R * dp.x - Q19i9j8I * dm.y;
+    x10.y += Q19i9j8R * dp.y + Q19i9j8I * dm.x;
+    dp = (*R9) + (*R10);
+    dm = (*R9) - (*R10);
+    x1.x += Q19i1j9R * dp.x + Q19i1j9I * dm.y;
+    x1.y += Q19i1j9R * dp.y - Q19i1j9I * dm.x;
+    x18.x += Q19i1j9R * dp.x - Q19i1j9I * dm.y;
+    x18.y += Q19i1j9R * dp.y + Q19i1j9I * dm.x;
+    x2.x += Q19i2j9R * dp.x + Q19i2j9I * dm.y;
+    x2.y += Q19i2j9R * dp.y - Q19i2j9I * dm.x;
+    x17.x += Q19i2j9R * dp.x - Q19i2j9I * dm.y;
+    x17.y += Q19i2j9R * dp.y + Q19i2j9I * dm.x;
+    x3.x += Q19i3j9R * dp.x + Q19i3j9I * dm.y;
+    x3.y += Q19i3j9R * dp.y - Q19i3j9I * dm.x;
+    x16.x += Q19i3j9R * dp.x - Q19i3j9I * dm.y;
+    x16.y += Q19i3j9R * dp.y + Q19i3j9I * dm.x;
+    x4.x += Q19i4j9R * dp.x + Q19i4j9I * dm.y;
+    x4.y += Q19i4j9R * dp.y - Q19i4j9I * dm.x;
+    x15.x += Q19i4j9R * dp.x - Q19i4j9I * dm.y;
+    x15.y += Q19i4j9R * dp.y + Q19i4j9I * dm.x;
+    x5.x += Q19i5j9R * dp.x + Q19i5j9I * dm.y;
+    x5.y += Q19i5j9R * dp.y - Q19i5j9I * dm.x;
+    x14.x += Q19i5j9R * dp.x - Q19i5j9I * dm.y;
+    x14.y += Q19i5j9R * dp.y + Q19i5j9I * dm.x;
+    x6.x += Q19i6j9R * dp.x + Q19i6j9I * dm.y;
+    x6.y += Q19i6j9R * dp.y - Q19i6j9I * dm.x;
+    x13.x += Q19i6j9R * dp.x - Q19i6j9I * dm.y;
+    x13.y += Q19i6j9R * dp.y + Q19i6j9I * dm.x;
+    x7.x += Q19i7j9R * dp.x + Q19i7j9I * dm.y;
+    x7.y += Q19i7j9R * dp.y - Q19i7j9I * dm.x;
+    x12.x += Q19i7j9R * dp.x - Q19i7j9I * dm.y;
+    x12.y += Q19i7j9R * dp.y + Q19i7j9I * dm.x;
+    x8.x += Q19i8j9R * dp.x + Q19i8j9I * dm.y;
+    x8.y += Q19i8j9R * dp.y - Q19i8j9I * dm.x;
+    x11.x += Q19i8j9R * dp.x - Q19i8j9I * dm.y;
+    x11.y += Q19i8j9R * dp.y + Q19i8j9I * dm.x;
+    x9.x += Q19i9j9R * dp.x + Q19i9j9I * dm.y;
+    x9.y += Q19i9j9R * dp.y - Q19i9j9I * dm.x;
+    x10.x += Q19i9j9R * dp.x - Q19i9j9I * dm.y;
+    x10.y += Q19i9j9R * dp.y + Q19i9j9I * dm.x;
+    (*R0)  = x0;
+    (*R1)  = x1;
+    (*R2)  = x2;
+    (*R3)  = x3;
+    (*R4)  = x4;
+    (*R5)  = x5;
+    (*R6)  = x6;
+    (*R7)  = x7;
+    (*R8)  = x8;
+    (*R9)  = x9;
+    (*R10) = x10;
+    (*R11) = x11;
+    (*R12) = x12;
+    (*R13) = x13;
+    (*R14) = x14;
+    (*R15) = x15;
+    (*R16) = x16;
+    (*R17) = x17;
+    (*R18) = x18;
+}
@@ -0,0 +1,1416 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ ******************************************************************************/
+
+// butterfly radix-23 constants, named as the radix-11 and radix-13
+// constants in butterfly_constant.h
+#define Q23i1j1R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i1j1I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i1j2R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i1j2I static_cast<real_type_t<T>>((-0.5195839500354335781330))
+#define Q23i1j3R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i1j3I static_cast<real_type_t<T>>((-0.7308359642781241016508))
+#define Q23i1j4R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i1j4I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i1j5R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i1j5I static_cast<real_type_t<T>>((-0.9790840876823228756328))
+#define Q23i1j6R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i1j6I static_cast<real_type_t<T>>((-0.9976687691905391984536))
+#define Q23i1j7R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i1j7I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i1j8R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i1j8I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i1j9R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i1j9I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i1j10R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i1j10I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i1j11R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i1j11I static_cast<real_type_t<T>>((-0.1361666490962465907607))
+#define Q23i2j1R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i2j1I static_cast<real_type_t<T>>((-0.5195839500354335781330))
+#define Q23i2j2R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i2j2I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i2j3R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i2j3I static_cast<real_type_t<T>>((-0.9976687691905391984536))
+#define Q23i2j4R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i2j4I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i2j5R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i2j5I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i2j6R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i2j6I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i2j7R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i2j7I static_cast<real_type_t<T>>((0.6310879443260527893674))
+#define Q23i2j8R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i2j8I static_cast<real_type_t<T>>((0.9422609221188204956177))
+#define Q23i2j9R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i2j9I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i2j10R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i2j10I static_cast<real_type_t<T>>((0.7308359642781241016508))
+#define Q23i2j11R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i2j11I static_cast<real_type_t<T>>((0.2697967711570242712453))
+#define Q23i3j1R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i3j1I static_cast<real_type_t<T>>((-0.7308359642781241016508))
+#define Q23i3j2R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i3j2I static_cast<real_type_t<T>>((-0.9976687691905391984536))
+#define Q23i3j3R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i3j3I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i3j4R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i3j4I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i3j5R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i3j5I static_cast<real_type_t<T>>((0.8169698930104420169734))
+#define Q23i3j6R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i3j6I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i3j7R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i3j7I static_cast<real_type_t<T>>((0.5195839500354335781330))
+#define Q23i3j8R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i3j8I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i3j9R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i3j9I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i3j10R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i3j10I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i3j11R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i3j11I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i4j1R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i4j1I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i4j2R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i4j2I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i4j3R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i4j3I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i4j4R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i4j4I static_cast<real_type_t<T>>((0.9422609221188204956177))
+#define Q23i4j5R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i4j5I static_cast<real_type_t<T>>((0.7308359642781241016508))
+#define Q23i4j6R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i4j6I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i4j7R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i4j7I static_cast<real_type_t<T>>((-0.9790840876823228756328))
+#define Q23i4j8R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i4j8I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i4j9R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i4j9I static_cast<real_type_t<T>>((0.3984010898462414579979))
+#define Q23i4j10R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i4j10I static_cast<real_type_t<T>>((0.9976687691905391984536))
+#define Q23i4j11R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i4j11I static_cast<real_type_t<T>>((0.5195839500354335781330))
+#define Q23i5j1R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i5j1I static_cast<real_type_t<T>>((-0.9790840876823228756328))
+#define Q23i5j2R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i5j2I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i5j3R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i5j3I static_cast<real_type_t<T>>((0.8169698930104420169734))
+#define Q23i5j4R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i5j4I static_cast<real_type_t<T>>((0.7308359642781241016508))
+#define Q23i5j5R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i5j5I static_cast<real_type_t<T>>((-0.5195839500354335781330))
+#define Q23i5j6R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i5j6I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i5j7R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i5j7I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i5j8R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i5j8I static_cast<real_type_t<T>>((0.9976687691905391984536))
+#define Q23i5j9R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i5j9I static_cast<real_type_t<T>>((0.2697967711570242712453))
+#define Q23i5j10R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i5j10I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i5j11R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i5j11I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i6j1R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i6j1I static_cast<real_type_t<T>>((-0.9976687691905391984536))
+#define Q23i6j2R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i6j2I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i6j3R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i6j3I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i6j4R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i6j4I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i6j5R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i6j5I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i6j6R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i6j6I static_cast<real_type_t<T>>((0.3984010898462414579979))
+#define Q23i6j7R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i6j7I static_cast<real_type_t<T>>((0.8878852184023752349843))
+#define Q23i6j8R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i6j8I static_cast<real_type_t<T>>((-0.5195839500354335781330))
+#define Q23i6j9R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i6j9I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i6j10R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i6j10I static_cast<real_type_t<T>>((0.6310879443260527893674))
+#define Q23i6j11R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i6j11I static_cast<real_type_t<T>>((0.7308359642781241016508))
+#define Q23i7j1R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i7j1I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i7j2R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i7j2I static_cast<real_type_t<T>>((0.6310879443260527893674))
+#define Q23i7j3R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i7j3I static_cast<real_type_t<T>>((0.5195839500354335781330))
+#define Q23i7j4R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i7j4I static_cast<real_type_t<T>>((-0.9790840876823228756328))
+#define Q23i7j5R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i7j5I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i7j6R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i7j6I static_cast<real_type_t<T>>((0.8878852184023752349843))
+#define Q23i7j7R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i7j7I static_cast<real_type_t<T>>((-0.7308359642781241016508))
+#define Q23i7j8R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i7j8I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i7j9R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i7j9I static_cast<real_type_t<T>>((0.9976687691905391984536))
+#define Q23i7j10R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i7j10I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i7j11R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i7j11I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i8j1R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i8j1I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i8j2R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i8j2I static_cast<real_type_t<T>>((0.9422609221188204956177))
+#define Q23i8j3R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i8j3I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i8j4R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i8j4I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i8j5R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i8j5I static_cast<real_type_t<T>>((0.9976687691905391984536))
+#define Q23i8j6R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i8j6I static_cast<real_type_t<T>>((-0.5195839500354335781330))
+#define Q23i8j7R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i8j7I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i8j8R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i8j8I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i8j9R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i8j9I static_cast<real_type_t<T>>((-0.7308359642781241016508))
+#define Q23i8j10R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i8j10I static_cast<real_type_t<T>>((-0.1361666490962465907607))
+#define Q23i8j11R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i8j11I static_cast<real_type_t<T>>((0.8878852184023752349843))
+#define Q23i9j1R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i9j1I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i9j2R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i9j2I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i9j3R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i9j3I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i9j4R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i9j4I static_cast<real_type_t<T>>((0.3984010898462414579979))
+#define Q23i9j5R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i9j5I static_cast<real_type_t<T>>((0.2697967711570242712453))
+#define Q23i9j6R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i9j6I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i9j7R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i9j7I static_cast<real_type_t<T>>((0.9976687691905391984536))
+#define Q23i9j8R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i9j8I static_cast<real_type_t<T>>((-0.7308359642781241016508))
+#define Q23i9j9R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i9j9I static_cast<real_type_t<T>>((0.1361666490962465907607))
+#define Q23i9j10R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i9j10I static_cast<real_type_t<T>>((0.5195839500354335781330))
+#define Q23i9j11R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i9j11I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i10j1R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i10j1I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i10j2R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i10j2I static_cast<real_type_t<T>>((0.7308359642781241016508))
+#define Q23i10j3R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i10j3I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i10j4R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i10j4I static_cast<real_type_t<T>>((0.9976687691905391984536))
+#define Q23i10j5R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i10j5I static_cast<real_type_t<T>>((-0.8878852184023752349843))
+#define Q23i10j6R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i10j6I static_cast<real_type_t<T>>((0.6310879443260527893674))
+#define Q23i10j7R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i10j7I static_cast<real_type_t<T>>((-0.2697967711570242712453))
+#define Q23i10j8R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i10j8I static_cast<real_type_t<T>>((-0.1361666490962465907607))
+#define Q23i10j9R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i10j9I static_cast<real_type_t<T>>((0.5195839500354335781330))
+#define Q23i10j10R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i10j10I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i10j11R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i10j11I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i11j1R static_cast<real_type_t<T>>((-0.9906859460363307523423))
+#define Q23i11j1I static_cast<real_type_t<T>>((-0.1361666490962465907607))
+#define Q23i11j2R static_cast<real_type_t<T>>((0.9629172873477992950152))
+#define Q23i11j2I static_cast<real_type_t<T>>((0.2697967711570242712453))
+#define Q23i11j3R static_cast<real_type_t<T>>((-0.9172113015054530178438))
+#define Q23i11j3I static_cast<real_type_t<T>>((-0.3984010898462414579979))
+#define Q23i11j4R static_cast<real_type_t<T>>((0.8544194045464885525482))
+#define Q23i11j4I static_cast<real_type_t<T>>((0.5195839500354335781330))
+#define Q23i11j5R static_cast<real_type_t<T>>((-0.7757112907044198070411))
+#define Q23i11j5I static_cast<real_type_t<T>>((-0.6310879443260527893674))
+#define Q23i11j6R static_cast<real_type_t<T>>((0.6825531432186540828745))
+#define Q23i11j6I static_cast<real_type_t<T>>((0.7308359642781241016508))
+#define Q23i11j7R static_cast<real_type_t<T>>((-0.5766803221148671412510))
+#define Q23i11j7I static_cast<real_type_t<T>>((-0.8169698930104420169734))
+#define Q23i11j8R static_cast<real_type_t<T>>((0.4600650377311521260416))
+#define Q23i11j8I static_cast<real_type_t<T>>((0.8878852184023752349843))
+#define Q23i11j9R static_cast<real_type_t<T>>((-0.3348796121709861519581))
+#define Q23i11j9I static_cast<real_type_t<T>>((-0.9422609221188204956177))
+#define Q23i11j10R static_cast<real_type_t<T>>((0.2034560130526337898780))
+#define Q23i11j10I static_cast<real_type_t<T>>((0.9790840876823228756328))
+#define Q23i11j11R static_cast<real_type_t<T>>((-0.06824241336467097592119))
+#define Q23i11j11I static_cast<real_type_t<T>>((-0.9976687691905391984536))
+
+template <typename T>
+__device__ void FwdRad23B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12,
+                           T* R13,
+                           T* R14,
+                           T* R15,
+                           T* R16,
+                           T* R17,
+                           T* R18,
+                           T* R19,
+                           T* R20,
+                           T* R21,
+                           T* R22)
+{
+    T x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20;
+    T x21, x22, dp, dm;
+
+    x0 = (*R0) + (*R1) + (*R2) + (*R3) + (*R4) + (*R5) + (*R6) + (*R7) + (*R8) + (*R9) + (*R10)
+         + (*R11) + (*R12) + (*R13) + (*R14) + (*R15) + (*R16) + (*R17) + (*R18) + (*R19) + (*R20)
+         + (*R21) + (*R22);
+    x1  = (*R0);
+    x2  = (*R0);
+    x3  = (*R0);
+    x4  = (*R0);
+    x5  = (*R0);
+    x6  = (*R0);
+    x7  = (*R0);
+    x8  = (*R0);
+    x9  = (*R0);
+    x10 = (*R0);
+    x11 = (*R0);
+    x12 = (*R0);
+    x13 = (*R0);
+    x14 = (*R0);
+    x15 = (*R0);
+    x16 = (*R0);
+    x17 = (*R0);
+    x18 = (*R0);
+    x19 = (*R0);
+    x20 = (*R0);
+    x21 = (*R0);
+    x22 = (*R0);
+    dp  = (*R1) + (*R22);
+    dm  = (*R1) - (*R22);
+    x1.x += Q23i1j1R * dp.x - Q23i1j1I * dm.y;
+    x1.y += Q23i1j1R * dp.y + Q23i1j1I * dm.x;
+    x22.x += Q23i1j1R * dp.x + Q23i1j1I * dm.y;
+    x22.y += Q23i1j1R * dp.y - Q23i1j1I * dm.x;
+    x2.x += Q23i2j1R * dp.x - Q23i2j1I * dm.y;
+    x2.y += Q23i2j1R * dp.y + Q23i2j1I * dm.x;
+    x21.x += Q23i2j1R * dp.x + Q23i2j1I * dm.y;
+    x21.y += Q23i2j1R * dp.y - Q23i2j1I * dm.x;
+    x3.x += Q23i3j1R * dp.x - Q23i3j1I * dm.y;
+    x3.y += Q23i3j1R * dp.y + Q23i3j1I * dm.x;
+    x20.x += Q23i3j1R * dp.x + Q23i3j1I * dm.y;
+    x20.y += Q23i3j1R * dp.y - Q23i3j1I * dm.x;
+    x4.x += Q23i4j1R * dp.x - Q23i4j1I * dm.y;
+    x4.y += Q23i4j1R * dp.y + Q23i4j1I * dm.x;
+    x19.x += Q23i4j1R * dp.x + Q23i4j1I * dm.y;
+    x19.y += Q23i4j1R * dp.y - Q23i4j1I * dm.x;
+    x5.x += Q23i5j1R * dp.x - Q23i5j1I * dm.y;
+    x5.y += Q23i5j1R * dp.y + Q23i5j1I * dm.x;
+    x18.x += Q23i5j1R * dp.x + Q23i5j1I * dm.y;
+    x18.y += Q23i5j1R * dp.y - Q23i5j1I * dm.x;
+    x6.x += Q23i6j1R * dp.x - Q23i6j1I * dm.y;
+    x6.y += Q23i6j1R * dp.y + Q23i6j1I * dm.x;
+    x17.x += Q23i6j1R * dp.x + Q23i6j1I * dm.y;
+    x17.y += Q23i6j1R * dp.y - Q23i6j1I * dm.x;
+    x7.x += Q23i7j1R * dp.x - Q23i7j1I * dm.y;
+    x7.y += Q23i7j1R * dp.y + Q23i7j1I * dm.x;
+    x16.x += Q23i7j1R * dp.x + Q23i7j1I * dm.y;
+    x16.y += Q23i7j1R * dp.y - Q23i7j1I * dm.x;
+    x8.x += Q23i8j1R * dp.x - Q23i8j1I * dm.y;
+    x8.y += Q23i8j1R * dp.y + Q23i8j1I * dm.x;
+    x15.x += Q23i8j1R * dp.x + Q23i8j1I * dm.y;
+    x15.y += Q23i8j1R * dp.y - Q23i8j1I * dm.x;
+    x9.x += Q23i9j1R * dp.x - Q23i9j1I * dm.y;
+    x9.y += Q23i9j1R * dp.y + Q23i9j1I * dm.x;
+    x14.x += Q23i9j1R * dp.x + Q23i9j1I * dm.y;
+    x14.y += Q23i9j1R * dp.y - Q23i9j1I * dm.x;
+    x10.x += Q23i10j1R * dp.x - Q23i10j1I * dm.y;
+    x10.y += Q23i10j1R * dp.y + Q23i10j1I * dm.x;
+    x13.x += Q23i10j1R * dp.x + Q23i10j1I * dm.y;
+    x13.y += Q23i10j1R * dp.y - Q23i10j1I * dm.x;
+    x11.x += Q23i11j1R * dp.x - Q23i11j1I * dm.y;
+    x11.y += Q23i11j1R * dp.y + Q23i11j1I * dm.x;
+    x12.x += Q23i11j1R * dp.x + Q23i11j1I * dm.y;
+    x12.y += Q23i11j1R * dp.y - Q23i11j1I * dm.x;
+    dp = (*R2) + (*R21);
+    dm = (*R2) - (*R21);
+    x1.x += Q23i1j2R * dp.x - Q23i1j2I * dm.y;
+    x1.y += Q23i1j2R * dp.y + Q23i1j2I * dm.x;
+    x22.x += Q23i1j2R * dp.x + Q23i1j2I * dm.y;
+    x22.y += Q23i1j2R * dp.y - Q23i1j2I * dm.x;
+    x2.x += Q23i2j2R * dp.x - Q23i2j2I * dm.y;
+    x2.y += Q23i2j2R * dp.y + Q23i2j2I * dm.x;
+    x21.x += Q23i2j2R * dp.x + Q23i2j2I * dm.y;
+    x21.y += Q23i2j2R * dp.y - Q23i2j2I * dm.x;
+    x3.x += Q23i3j2R * dp.x - Q23i3j2I * dm.y;
+    x3.y += Q23i3j2R * dp.y + Q23i3j2I * dm.x;
+    x20.x += Q23i3j2R * dp.x + Q23i3j2I * dm.y;
+    x20.y += Q23i3j2R * dp.y - Q23i3j2I * dm.x;
+    x4.x += Q23i4j2R * dp.x - Q23i4j2I * dm.y;
+    x4.y += Q23i4j2R * dp.y + Q23i4j2I * dm.x;
+    x19.x += Q23i4j2R * dp.x + Q23i4j2I * dm.y;
+    x19.y += Q23i4j2R * dp.y - Q23i4j2I * dm.x;
+    x5.x += Q23i5j2R * dp.x - Q23i5j2I * dm.y;
+    x5.y += Q23i5j2R * dp.y + Q23i5j2I * dm.x;
+    x18.x += Q23i5j2R * dp.x + Q23i5j2I * dm.y;
+    x18.y += Q23i5j2R * dp.y - Q23i5j2I * dm.x;
+    x6.x += Q23i6j2R * dp.x - Q23i6j2I * dm.y;
+    x6.y += Q23i6j2R * dp.y + Q23i6j2I * dm.x;
+    x17.x += Q23i6j2R * dp.x + Q23i6j2I * dm.y;
+    x17.y += Q23i6j2R * dp.y - Q23i6j2I * dm.x;
+    x7.x += Q23i7j2R * dp.x - Q23i7j2I * dm.y;
+    x7.y += Q23i7j2R * dp.y + Q23i7j2I * dm.x;
+    x16.x += Q23i7j2R * dp.x + Q23i7j2I * dm.y;
+    x16.y += Q23i7j2R * dp.y - Q23i7j2I * dm.x;
+    x8.x += Q23i8j2R * dp.x - Q23i8j2I * dm.y;
+    x8.y += Q23i8j2R * dp.y + Q23i8j2I * dm.x;
+    x15.x += Q23i8j2R * dp.x + Q23i8j2I * dm.y;
+    x15.y += Q23i8j2R * dp.y - Q23i8j2I * dm.x;
+    x9.x += Q23i9j2R * dp.x - Q23i9j2I * dm.y;
+    x9.y += Q23i9j2R * dp.y + Q23i9j2I * dm.x;
+    x14.x += Q23i9j2R * dp.x + Q23i9j2I * dm.y;
+    x14.y += Q23i9j2R * dp.y - Q23i9j2I * dm.x;
+    x10.x += Q23i10j2R * dp.x - Q23i10j2I * dm.y;
+    x10.y += Q23i10j2R * dp.y + Q23i10j2I * dm.x;
+    x13.x += Q23i10j2R * dp.x + Q23i10j2I * dm.y;
+    x13.y += Q23i10j2R * dp.y - Q23i10j2I * dm.x;
+    x11.x += Q23i11j2R * dp.x - Q23i11j2I * dm.y;
+    x11.y += Q23i11j2R * dp.y + Q23i11j2I * dm.x;
+    x12.x += Q23i11j2R * dp.x + Q23i11j2I * dm.y;
+    x12.y += Q23i11j2R * dp.y - Q23i11j2I * dm.x;
+    dp = (*R3) + (*R20);
+    dm = (*R3) - (*R20);
+    x1.x += Q23i1j3R * dp.x - Q23i1j3I * dm.y;
+    x1.y += Q23i1j3R * dp.y + Q23i1j3I * dm.x;
+    x22.x += Q23i1j3R * dp.x + Q23i1j3I * dm.y;
+    x22.y += Q23i1j3R * dp.y - Q23i1j3I * dm.x;
+    x2.x += Q23i2j3R * dp.x - Q23i2j3I * dm.y;
+    x2.y += Q23i2j3R * dp.y + Q23i2j3I * dm.x;
+    x21.x += Q23i2j3R * dp.x + Q23i2j3I * dm.y;
+    x21.y += Q23i2j3R * dp.y - Q23i2j3I * dm.x;
+    x3.x += Q23i3j3R * dp.x - Q23i3j3I * dm.y;
+    x3.y += Q23i3j3R * dp.y + Q23i3j3I * dm.x;
+    x20.x += Q23i3j3R * dp.x + Q23i3j3I * dm.y;
+    x20.y += Q23i3j3R * dp.y - Q23i3j3I * dm.x;
+    x4.x += Q23i4j3R * dp.x - Q23i4j3I * dm.y;
+    x4.y += Q23i4j3R * dp.y + Q23i4j3I * dm.x;
+    x19.x += Q23i4j3R * dp.x + Q23i4j3I * dm.y;
+    x19.y += Q23i4j3R * dp.y - Q23i4j3I * dm.x;
+    x5.x += Q23i5j3R * dp.x - Q23i5j3I * dm.y;
+    x5.y += Q23i5j3R * dp.y + Q23i5j3I * dm.x;
+    x18.x += Q23i5j3R * dp.x + Q23i5j3I * dm.y;
+    x18.y += Q23i5j3R * dp.y - Q23i5j3I * dm.x;
+    x6.x += Q23i6j3R * dp.x - Q23i6j3I * dm.y;
+    x6.y += Q23i6j3R * dp.y + Q23i6j3I * dm.x;
+    x17.x += Q23i6j3R * dp.x + Q23i6j3I * dm.y;
+    x17.y += Q23i6j3R * dp.y - Q23i6j3I * dm.x;
+    x7.x += Q23i7j3R * dp.x - Q23i7j3I * dm.y;
+    x7.y += Q23i7j3R * dp.y + Q23i7j3I * dm.x;
+    x16.x += Q23i7j3R * dp.x + Q23i7j3I * dm.y;
+    x16.y += Q23i7j3R * dp.y - Q23i7j3I * dm.x;
+    x8.x += Q23i8j3R * dp.x - Q23i8j3I * dm.y;
+    x8.y += Q23i8j3R * dp.y + Q23i8j3I * dm.x;
+    x15.x += Q23i8j3R * dp.x + Q23i8j3I * dm.y;
+    x15.y += Q23i8j3R * dp.y - Q23i8j3I * dm.x;
+    x9.x += Q23i9j3R * dp.x - Q23i9j3I * dm.y;
+    x9.y += Q23i9j3R * dp.y + Q23i9j3I * dm.x;
+    x14.x += Q23i9j3R * dp.x + Q23i9j3I * dm.y;
+    x14.y += Q23i9j3R * dp.y - Q23i9j3I * dm.x;
+    x10.x += Q23i10j3R * dp.x - Q23i10j3I * dm.y;
+    x10.y += Q23i10j3R * dp.y + Q23i10j3I * dm.x;
+    x13.x += Q23i10j3R * dp.x + Q23i10j3I * dm.y;
+    x13.y += Q23i10j3R * dp.y - Q23i10j3I * dm.x;
+    x11.x += Q23i11j3R * dp.x - Q23i11j3I * dm.y;
+    x11.y += Q23i11j3R * dp.y + Q23i11j3I * dm.x;
+    x12.x += Q23i11j3R * dp.x + Q23i11j3I * dm.y;
+    x12.y += Q23i11j3R * dp.y - Q23i11j3I * dm.x;
+    dp = (*R4) + (*R19);
+    dm = (*R4) - (*R19);
+    x1.x += Q23i1j4R * dp.x - Q23i1j4I * dm.y;
+    x1.y += Q23i1j4R * dp.y + Q23i1j4I * dm.x;
+    x22.x += Q23i1j4R * dp.x + Q23i1j4I * dm.y;
+    x22.y += Q23i1j4R * dp.y - Q23i1j4I * dm.x;
+    x2.x += Q23i2j4R * dp.x - Q23i2j4I * dm.y;
+    x2.y += Q23i2j4R * dp.y + Q23i2j4I * dm.x;
+    x21.x += Q23i2j4R * dp.x + Q23i2j4I * dm.y;
+    x21.y += Q23i2j4R * dp.y - Q23i2j4I * dm.x;
+    x3.x += Q23i3j4R * dp.x - Q23i3j4I * dm.y;
+    x3.y += Q23i3j4R * dp.y + Q23i3j4I * dm.x;
+    x20.x += Q23i3j4R * dp.x + Q23i3j4I * dm.y;
+    x20.y += Q23i3j4R * dp.y - Q23i3j4I * dm.x;
+    x4.x += Q23i4j4R * dp.x - Q23i4j4I * dm.y;
+    x4.y += Q23i4j4R * dp.y + Q23i4j4I * dm.x;
+    x19.x += Q23i4j4R * dp.x + Q23i4j4I * dm.y;
+    x19.y += Q23i4j4R * dp.y - Q23i4j4I * dm.x;
+    x5.x += Q23i5j4R * dp.x - Q23i5j4I * dm.y;
+    x5.y += Q23i5j4R * dp.y + Q23i5j4I * dm.x;
+    x18.x += Q23i5j4R * dp.x + Q23i5j4I * dm.y;
+    x18.y += Q23i5j4R * dp.y - Q23i5j4I * dm.x;
+    x6.x += Q23i6j4R * dp.x - Q23i6j4I * dm.y;
+    x6.y += Q23i6j4R * dp.y + Q23i6j4I * dm.x;
+    x17.x += Q23i6j4R * dp.x + Q23i6j4I * dm.y;
+    x17.y += Q23i6j4R * dp.y - Q23i6j4I * dm.x;
+    x7.x += Q23i7j4R * dp.x - Q23i7j4I * dm.y;
+    x7.y += Q23i7j4R * dp.y + Q23i7j4I * dm.x;
+    x16.x += Q23i7j4R * dp.x + Q23i7j4I * dm.y;
+    x16.y += Q23i7j4R * dp.y - Q23i7j4I * dm.x;
+    x8.x += Q23i8j4R * dp.x - Q23i8j4I * dm.y;
+    x8.y += Q23i8j4R * dp.y + Q23i8j4I * dm.x;
+    x15.x += Q23i8j4R * dp.x + Q23i8j4I * dm.y;
+    x15.y += Q23i8j4R * dp.y - Q23i8j4I * dm.x;
+    x9.x += Q23i9j4R * dp.x - Q23i9j4I * dm.y;
+    x9.y += Q23i9j4R * dp.y + Q23i9j4I * dm.x;
+    x14.x += Q23i9j4R * dp.x + Q23i9j4I * dm.y;
+    x14.y += Q23i9j4R * dp.y - Q23i9j4I * dm.x;
+    x10.x += Q23i10j4R * dp.x - Q23i10j4I * dm.y;
+    x10.y += Q23i10j4R * dp.y + Q23i10j4I * dm.x;
+    x13.x += Q23i10j4R * dp.x + Q23i10j4I * dm.y;
+    x13.y += Q23i10j4R * dp.y - Q23i10j4I * dm.x;
+    x11.x += Q23i11j4R * dp.x - Q23i11j4I * dm.y;
+    x11.y += Q23i11j4R * dp.y + Q23i11j4I * dm.x;
+    x12.x += Q23i11j4R * dp.x + Q23i11j4I * dm.y;
+    x12.y += Q23i11j4R * dp.y - Q23i11j4I * dm.x;
+    dp = (*R5) + (*R18);
+    dm = (*R5) - (*R18);
+    x1.x += Q23i1j5R * dp.x - Q23i1j5I * dm.y;
+    x1.y += Q23i1j5R * dp.y + Q23i1j5I * dm.x;
+    x22.x += Q23i1j5R * dp.x + Q23i1j5I * dm.y;
+    x22.y += Q23i1j5R * dp.y - Q23i1j5I * dm.x;
+    x2.x += Q23i2j5R * dp.x - Q23i2j5I * dm.y;
+    x2.y += Q23i2j5R * dp.y + Q23i2j5I * dm.x;
+    x21.x += Q23i2j5R * dp.x + Q23i2j5I * dm.y;
+    x21.y += Q23i2j5R * dp.y - Q23i2j5I * dm.x;
+    x3.x += Q23i3j5R * dp.x - Q23i3j5I * dm.y;
+    x3.y += Q23i3j5R * dp.y + Q23i3j5I * dm.x;
+    x20.x += Q23i3j5R * dp.x + Q23i3j5I * dm.y;
+    x20.y += Q23i3j5R * dp.y - Q23i3j5I * dm.x;
+    x4.x += Q23i4j5R * dp.x - Q23i4j5I * dm.y;
+    x4.y += Q23i4j5R * dp.y + Q23i4j5I * dm.x;
+    x19.x += Q23i4j5R * dp.x + Q23i4j5I * dm.y;
+    x19.y += Q23i4j5R * dp.y - Q23i4j5I * dm.x;
+    x5.x += Q23i5j5R * dp.x - Q23i5j5I * dm.y;
+    x5.y += Q23i5j5R * dp.y + Q23i5j5I * dm.x;
+    x18.x += Q23i5j5R * dp.x + Q23i5j5I * dm.y;
+    x18.y += Q23i5j5R * dp.y - Q23i5j5I * dm.x;
+    x6.x += Q23i6j5R * dp.x - Q23i6j5I * dm.y;
+    x6.y += Q23i6j5R * dp.y + Q23i6j5I * dm.x;
+    x17.x += Q23i6j5R * dp.x + Q23i6j5I * dm.y;
+    x17.y += Q23i6j5R * dp.y - Q23i6j5I * dm.x;
+    x7.x += Q23i7j5R * dp.x - Q23i7j5I * dm.y;
+    x7.y += Q23i7j5R * dp.y + Q23i7j5I * dm.x;
+    x16.x += Q23i7j5R * dp.x + Q23i7j5I * dm.y;
+    x16.y += Q23i7j5R * dp.y - Q23i7j5I * dm.x;
+    x8.x += Q23i8j5R * dp.x - Q23i8j5I * dm.y;
+    x8.y += Q23i8j5R * dp.y + Q23i8j5I * dm.x;
+    x15.x += Q23i8j5R * dp.x + Q23i8j5I * dm.y;
+    x15.y += Q23i8j5R * dp.y - Q23i8j5I * dm.x;
+    x9.x += Q23i9j5R * dp.x - Q23i9j5I * dm.y;
+    x9.y += Q23i9j5R * dp.y + Q23i9j5I * dm.x;
+    x14.x += Q23i9j5R * dp.x + Q23i9j5I * dm.y;
+    x14.y += Q23i9j5R * dp.y - Q23i9j5I * dm.x;
+    x10.x += Q23i10j5R * dp.x - Q23i10j5I * dm.y;
+    x10.y += Q23i10j5R * dp.y + Q23i10j5I * dm.x;
+    x13.x += Q23i10j5R * dp.x + Q23i10j5I * dm.y;
+    x13.y += Q23i10j5R * dp.y - Q23i10j5I * dm.x;
+    x11.x += Q23i11j5R * dp.x - Q23i11j5I * dm.y;
+    x11.y += Q23i11j5R * dp.y + Q23i11j5I * dm.x;
+    x12.x += Q23i11j5R * dp.x + Q23i11j5I * dm.y;
+    x12.y += Q23i11j5R * dp.y - Q23i11j5I * dm.x;
+    dp = (*R6) + (*R17);
+    dm = (*R6) - (*R17);
+    x1.x += Q23i1j6R * dp.x - Q23i1j6I * dm.y;
+    x1.y += Q23i1j6R * dp.y + Q23i1j6I * dm.x;
+    x22.x += Q23i1j6R * dp.x + Q23i1j6I * dm.y;
+    x22.y += Q23i1j6R * dp.y - Q23i1j6I * dm.x;
+    x2.x += Q23i2j6R * dp.x - Q23i2j6I * dm.y;
+    x2.y += Q23i2j6R * dp.y + Q23i2j6I * dm.x;
+    x21.x += Q23i2j6R * dp.x + Q23i2j6I * dm.y;
+    x21.y += Q23i2j6R * dp.y - Q23i2j6I * dm.x;
+    x3.x += Q23i3j6R * dp.x - Q23i3j6I * dm.y;
+    x3.y += Q23i3j6R * dp.y + Q23i3j6I * dm.x;
+    x20.x += Q23i3j6R * dp.x + Q23i3j6I * dm.y;
+    x20.y += Q23i3j6R * dp.y - Q23i3j6I * dm.x;
+    x4.x += Q23i4j6R * dp.x - Q23i4j6I * dm.y;
+    x4.y += Q23i4j6R * dp.y + Q23i4j6I * dm.x;
+    x19.x += Q23i4j6R * dp.x + Q23i4j6I * dm.y;
+    x19.y += Q23i4j6R * dp.y - Q23i4j6I * dm.x;
+    x5.x += Q23i5j6R * dp.x - Q23i5j6I * dm.y;
+    x5.y += Q23i5j6R * dp.y + Q23i5j6I * dm.x;
+    x18.x += Q23i5j6R * dp.x + Q23i5j6I * dm.y;
+    x18.y += Q23i5j6R * dp.y - Q23i5j6I * dm.x;
+    x6.x += Q23i6j6R * dp.x - Q23i6j6I * dm.y;
+    x6.y += Q23i6j6R * dp.y + Q23i6j6I * dm.x;
+    x17.x += Q23i6j6R * dp.x + Q23i6j6I * dm.y;
+    x17.y += Q23i6j6R * dp.y - Q23i6j6I * dm.x;
+    x7.x += Q23i7j6R * dp.x - Q23i7j6I * dm.y;
+    x7.y += Q23i7j6R * dp.y + Q23i7j6I * dm.x;
+    x16.x += Q23i7j6R * dp.x + Q23i7j6I * dm.y;
+    x16.y += Q23i7j6R * dp.y - Q23i7j6I * dm.x;
+    x8.x += Q23i8j6R * dp.x - Q23i8j6I * dm.y;
+    x8.y += Q23i8j6R * dp.y + Q23i8j6I * dm.x;
+    x15.x += Q23i8j6R * dp.x + Q23i8j6I * dm.y;
+    x15.y += Q23i8j6R * dp.y - Q23i8j6I * dm.x;
+    x9.x += Q23i9j6R * dp.x - Q23i9j6I * dm.y;
+    x9.y += Q23i9j6R * dp.y + Q23i9j6I * dm.x;
+    x14.x += Q23i9j6R * dp.x + Q23i9j6I * dm.y;
+    x14.y += Q23i9j6R * dp.y - Q23i9j6I * dm.x;
+    x10.x += Q23i10j6R * dp.x - Q23i10j6I * dm.y;
+    x10.y += Q23i10j6R * dp.y + Q23i10j6I * dm.x;
+    x13.x += Q23i10j6R * dp.x + Q23i10j6I * dm.y;
+    x13.y += Q23i10j6R * dp.y - Q23i10j6I * dm.x;
+    x11.x += Q23i11j6R * dp.x - Q23i11j6I * dm.y;
+    x11.y += Q23i11j6R * dp.y + Q23i11j6I * dm.x;
+    x12.x += Q23i11j6R * dp.x + Q23i11j6I * dm.y;
+    x12.y += Q23i11j6R * dp.y - Q23i11j6I * dm.x;
+    dp = (*R7) + (*R16);
+    dm = (*R7) - (*R16);
+    x1.x += Q23i1j7R * dp.x - Q23i1j7I * dm.y;
+    x1.y += Q23i1j7R * dp.y + Q23i1j7I * dm.x;
+    x22.x += Q23i1j7R * dp.x + Q23i1j7I * dm.y;
+    x22.y += Q23i1j7R * dp.y - Q23i1j7I * dm.x;
+    x2.x += Q23i2j7R * dp.x - Q23i2j7I * dm.y;
+    x2.y += Q23i2j7R * dp.y + Q23i2j7I * dm.x;
+    x21.x += Q23i2j7R * dp.x + Q23i2j7I * dm.y;
+    x21.y += Q23i2j7R * dp.y - Q23i2j7I * dm.x;
+    x3.x += Q23i3j7R * dp.x - Q23i3j7I * dm.y;
+    x3.y += Q23i3j7R * dp.y + Q23i3j7I * dm.x;
+    x20.x += Q23i3j7R * dp.x + Q23i3j7I * dm.y;
+    x20.y += Q23i3j7R * dp.y - Q23i3j7I * dm.x;
+    x4.x += Q23i4j7R * dp.x - Q23i4j7I * dm.y;
+    x4.y += Q23i4j7R * dp.y + Q23i4j7I * dm.x;
+    x19.x += Q23i4j7R * dp.x + Q23i4j7I * dm.y;
+    x19.y += Q23i4j7R * dp.y - Q23i4j7I * dm.x;
+    x5.x += Q23i5j7R * dp.x - Q23i5j7I * dm.y;
+    x5.y += Q23i5j7R * dp.y + Q23i5j7I * dm.x;
+    x18.x += Q23i5j7R * dp.x + Q23i5j7I * dm.y;
+    x18.y += Q23i5j7R * dp.y - Q23i5j7I * dm.x;
+    x6.x += Q23i6j7R * dp.x - Q23i6j7I * dm.y;
+    x6.y += Q23i6j7R * dp.y + Q23i6j7I * dm.x;
+    x17.x += Q23i6j7R * dp.x + Q23i6j7I * dm.y;
+    x17.y += Q23i6j7R * dp.y - Q23i6j7I * dm.x;
+    x7.x += Q23i7j7R * dp.x - Q23i7j7I * dm.y;
+    x7.y += Q23i7j7R * dp.y + Q23i7j7I * dm.x;
+    x16.x += Q23i7j7R * dp.x + Q23i7j7I * dm.y;
+    x16.y += Q23i7j7R * dp.y - Q23i7j7I * dm.x;
+    x8.x += Q23i8j7R * dp.x - Q23i8j7I * dm.y;
+    x8.y += Q23i8j7R * dp.y + Q23i8j7I * dm.x;
+    x15.x += Q23i8j7R * dp.x + Q23i8j7I * dm.y;
+    x15.y += Q23i8j7R * dp.y - Q23i8j7I * dm.x;
+    x9.x += Q23i9j7R * dp.x - Q23i9j7I * dm.y;
+    x9.y += Q23i9j7R * dp.y + Q23i9j7I * dm.x;
+    x14.x += Q23i9j7R * dp.x + Q23i9j7I * dm.y;
+    x14.y += Q23i9j7R * dp.y - Q23i9j7I * dm.x;
+    x10.x += Q23i10j7R * dp.x - Q23i10j7I * dm.y;
+    x10.y += Q23i10j7R * dp.y + Q23i10j7I * dm.x;
+    x13.x += Q23i10j7R * dp.x + Q23i10j7I * dm.y;
+    x13.y += Q23i10j7R * dp.y - Q23i10j7I * dm.x;
+    x11.x += Q23i11j7R * dp.x - Q23i11j7I * dm.y;
+    x11.y += Q23i11j7R * dp.y + Q23i11j7I * dm.x;
+    x12.x += Q23i11j7R * dp.x + Q23i11j7I * dm.y;
+    x12.y += Q23i11j7R * dp.y - Q23i11j7I * dm.x;
+    dp = (*R8) + (*R15);
+    dm = (*R8) - (*R15);
+    x1.x += Q23i1j8R * dp.x - Q23i1j8I * dm.y;
+    x1.y += Q23i1j8R * dp.y + Q23i1j8I * dm.x;
+    x22.x += Q23i1j8R * dp.x + Q23i1j8I * dm.y;
+    x22.y += Q23i1j8R * dp.y - Q23i1j8I * dm.x;
+    x2.x += Q23i2j8R * dp.x - Q23i2j8I * dm.y;
+    x2.y += Q23i2j8R * dp.y + Q23i2j8I * dm.x;
+    x21.x += Q23i2j8R * dp.x + Q23i2j8I * dm.y;
+    x21.y += Q23i2j8R * dp.y - Q23i2j8I * dm.x;
+    x3.x += Q23i3j8R * dp.x - Q23i3j8I * dm.y;
+    x3.y += Q23i3j8R * dp.y + Q23i3j8I * dm.x;
+    x20.x += Q23i3j8R * dp.x + Q23i3j8I * dm.y;
+    x20.y += Q23i3j8R * dp.y - Q23i3j8I * dm.x;
+    x4.x += Q23i4j8R * dp.x - Q23i4j8I * dm.y;
+    x4.y += Q23i4j8R * dp.y + Q23i4j8I * dm.x;
+    x19.x += Q23i4j8R * dp.x + Q23i4j8I * dm.y;
+    x19.y += Q23i4j8R * dp.y - Q23i4j8I * dm.x;
+    x5.x += Q23i5j8R * dp.x - Q23i5j8I * dm.y;
+    x5.y += Q23i5j8R * dp.y + Q23i5j8I * dm.x;
+    x18.x += Q23i5j8R * dp.x + Q23i5j8I * dm.y;
+    x18.y += Q23i5j8R * dp.y - Q23i5j8I * dm.x;
+    x6.x += Q23i6j8R * dp.x - Q23i6j8I * dm.y;
+    x6.y += Q23i6j8R * dp.y + Q23i6j8I * dm.x;
+    x17.x += Q23i6j8R * dp.x + Q23i6j8I * dm.y;
+    x17.y += Q23i6j8R * dp.y - Q23i6j8I * dm.x;
+    x7.x += Q23i7j8R * dp.x - Q23i7j8I * dm.y;
+    x7.y += Q23i7j8R * dp.y + Q23i7j8I * dm.x;
+    x16.x += Q23i7j8R * dp.x + Q23i7j8I * dm.y;
+    x16.y += Q23i7j8R * dp.y - Q23i7j8I * dm.x;
+    x8.x += Q23i8j8R * dp.x - Q23i8j8I * dm.y;
+    x8.y += Q23i8j8R * dp.y + Q23i8j8I * dm.x;
+    x15.x += Q23i8j8R * dp.x + Q23i8j8I * dm.y;
+    x15.y += Q23i8j8R * dp.y - Q23i8j8I * dm.x;
+    x9.x += Q23i9j8R * dp.x - Q23i9j8I * dm.y;
+    x9.y += Q23i9j8R * dp.y + Q23i9j8I * dm.x;
+    x14.x += Q23i9j8R * dp.x + Q23i9j8I * dm.y;
+    x14.y += Q23i9j8R * dp.y - Q23i9j8I * dm.x;
+    x10.x += Q23i10j8R * dp.x - Q23i10j8I * dm.y;
+    x10.y += Q23i10j8R * dp.y + Q23i10j8I * dm.x;
+    x13.x += Q23i10j8R * dp.x + Q23i10j8I * dm.y;
+    x13.y += Q23i10j8R * dp.y - Q23i10j8I * dm.x;
+    x11.x += Q23i11j8R * dp.x - Q23i11j8I * dm.y;
+    x11.y += Q23i11j8R * dp.y + Q23i11j8I * dm.x;
+    x12.x += Q23i11j8R * dp.x + Q23i11j8I * dm.y;
+    x12.y += Q23i11j8R * dp.y - Q23i11j8I * dm.x;
+    dp = (*R9) + (*R14);
+    dm = (*R9) - (*R14);
+    x1.x += Q23i1j9R * dp.x - Q23i1j9I * dm.y;
+    x1.y += Q23i1j9R * dp.y + Q23i1j9I * dm.x;
+    x22.x += Q23i1j9R * dp.x + Q23i1j9I * dm.y;
+    x22.y += Q23i1j9R * dp.y - Q23i1j9I * dm.x;
+    x2.x += Q23i2j9R * dp.x - Q23i2j9I * dm.y;
+    x2.y += Q23i2j9R * dp.y + Q23i2j9I * dm.x;
+    x21.x += Q23i2j9R * dp.x + Q23i2j9I * dm.y;
+    x21.y += Q23i2j9R * dp.y - Q23i2j9I * dm.x;
+    x3.x += Q23i3j9R * dp.x - Q23i3j9I * dm.y;
+    x3.y += Q23i3j9R * dp.y + Q23i3j9I * dm.x;
+    x20.x += Q23i3j9R * dp.x + Q23i3j9I * dm.y;
+    x20.y += Q23i3j9R * dp.y - Q23i3j9I * dm.x;
+    x4.x += Q23i4j9R * dp.x - Q23i4j9I * dm.y;
+    x4.y += Q23i4j9R * dp.y + Q23i4j9I * dm.x;
+    x19.x += Q23i4j9R * dp.x + Q23i4j9I * dm.y;
+    x19.y += Q23i4j9R * dp.y - Q23i4j9I * dm.x;
+    x5.x += Q23i5j9R * dp.x - Q23i5j9I * dm.y;
+    x5.y += Q23i5j9R * dp.y + Q23i5j9I * dm.x;
+    x18.x += Q23i5j9R * dp.x + Q23i5j9I * dm.y;
+    x18.y += Q23i5j9R * dp.y - Q23i5j9I * dm.x;
+    x6.x += Q23i6j9R * dp.x - Q23i6j9I * dm.y;
+    x6.y += Q23i6j9R * dp.y + Q23i6j9I * dm.x;
+    x17.x += Q23i6j9R * dp.x + Q23i6j9I * dm.y;
+    x17.y += Q23i6j9R * dp.y - Q23i6j9I * dm.x;
+    x7.x += Q23i7j9R * dp.x - Q23i7j9I * dm.y;
+    x7.y += Q23i7j9R * dp.y + Q23i7j9I * dm.x;
+    x16.x += Q23i7j9R * dp.x + Q23i7j9I * dm.y;
+    x16.y += Q23i7j9R * dp.y - Q23i7j9I * dm.x;
+    x8.x += Q23i8j9R * dp.x - Q23i8j9I * dm.y;
+    x8.y += Q23i8j9R * dp.y + Q23i8j9I * dm.x;
+    x15.x += Q23i8j9R * dp.x + Q23i8j9I * dm.y;
+    x15.y += Q23i8j9R * dp.y - Q23i8j9I * dm.x;
+    x9.x += Q23i9j9R * dp.x - Q23i9j9I * dm.y;
+    x9.y += Q23i9j9R * dp.y + Q23i9j9I * dm.x;
+    x14.x += Q23i9j9R * dp.x + Q23i9j9I * dm.y;
+    x14.y += Q23i9j9R * dp.y - Q23i9j9I * dm.x;
+    x10.x += Q23i10j9R * dp.x - Q23i10j9I * dm.y;
+    x10.y += Q23i10j9R * dp.y + Q23i10j9I * dm.x;
+    x13.x += Q23i10j9R * dp.x + Q23i10j9I * dm.y;
+    x13.y += Q23i10j9R * dp.y - Q23i10j9I * dm.x;
+    x11.x += Q23i11j9R * dp.x - Q23i11j9I * dm.y;
+    x11.y += Q23i11j9R * dp.y + Q23i11j9I * dm.x;
+    x12.x += Q23i11j9R * dp.x + Q23i11j9I * dm.y;
+    x12.y += Q23i11j9R * dp.y - Q23i11j9I * dm.x;
+    dp = (*R10) + (*R13);
+    dm = (*R10) - (*R13);
+    x1.x += Q23i1j10R * dp.x - Q23i1j10I * dm.y;
+    x1.y += Q23i1j10R * dp.y + Q23i1j10I * dm.x;
+    x22.x += Q23i1j10R * dp.x + Q23i1j10I * dm.y;
+    x22.y += Q23i1j10R * dp.y - Q23i1j10I * dm.x;
+    x2.x += Q23i2j10R * dp.x - Q23i2j10I * dm.y;
+    x2.y += Q23i2j10R * dp.y + Q23i2j10I * dm.x;
+    x21.x += Q23i2j10R * dp.x + Q23i2j10I * dm.y;
+    x21.y += Q23i2j10R * dp.y - Q23i2j10I * dm.x;
+    x3.x += Q23i3j10R * dp.x - Q23i3j10I * dm.y;
+    x3.y += Q23i3j10R * dp.y + Q23i3j10I * dm.x;
+    x20.x += Q23i3j10R * dp.x + Q23i3j10I * dm.y;
+    x20.y += Q23i3j10R * dp.y - Q23i3j10I * dm.x;
+    x4.x += Q23i4j10R * dp.x - Q23i4j10I * dm.y;
+    x4.y += Q23i4j10R * dp.y + Q23i4j10I * dm.x;
+    x19.x += Q23i4j10R * dp.x + Q23i4j10I * dm.y;
+    x19.y += Q23i4j10R * dp.y - Q23i4j10I * dm.x;
+    x5.x += Q23i5j10R * dp.x - Q23i5j10I * dm.y;
+    x5.y += Q23i5j10R * dp.y + Q23i5j10I * dm.x;
+    x18.x += Q23i5j10R * dp.x + Q23i5j10I * dm.y;
+    x18.y += Q23i5j10R * dp.y - Q23i5j10I * dm.x;
+    x6.x += Q23i6j10R * dp.x - Q23i6j10I * dm.y;
+    x6.y += Q23i6j10R * dp.y + Q23i6j10I * dm.x;
+    x17.x += Q23i6j10R * dp.x + Q23i6j10I * dm.y;
+    x17.y += Q23i6j10R * dp.y - Q23i6j10I * dm.x;
+    x7.x += Q23i7j10R * dp.x - Q23i7j10I * dm.y;
+    x7.y += Q23i7j10R * dp.y + Q23i7j10I * dm.x;
+    x16.x += Q23i7j10R * dp.x + Q23i7j10I * dm.y;
+    x16.y += Q23i7j10R * dp.y - Q23i7j10I * dm.x;
+    x8.x += Q23i8j10R * dp.x - Q23i8j10I * dm.y;
+    x8.y += Q23i8j10R * dp.y + Q23i8j10I * dm.x;
+    x15.x += Q23i8j10R * dp.x + Q23i8j10I * dm.y;
+    x15.y += Q23i8j10R * dp.y - Q23i8j10I * dm.x;
+    x9.x += Q23i9j10R * dp.x - Q23i9j10I * dm.y;
+    x9.y += Q23i9j10R * dp.y + Q23i9j10I * dm.x;
+    x14.x += Q23i9j10R * dp.x + Q23i9j10I * dm.y;
+    x14.y += Q23i9j10R * dp.y - Q23i9j10I * dm.x;
+    x10.x += Q23i10j10R * dp.x - Q23i10j10I * dm.y;
+    x10.y += Q23i10j10R * dp.y + Q23i10j10I * dm.x;
+    x13.x += Q23i10j10R * dp.x + Q23i10j10I * dm.y;
+    x13.y += Q23i10j10R * dp.y - Q23i10j10I * dm.x;
+    x11.x += Q23i11j10R * dp.x - Q23i11j10I * dm.y;
+    x11.y += Q23i11j10R * dp.y + Q23i11j10I * dm.x;
+    x12.x += Q23i11j10R * dp.x + Q23i11j10I * dm.y;
+    x12.y += Q23i11j10R * dp.y - Q23i11j10I * dm.x;
+    dp = (*R11) + (*R12);
+    dm = (*R11) - (*R12);
+    x1.x += Q23i1j11R * dp.x - Q23i1j11I * dm.y;
+    x1.y += Q23i1j11R * dp.y + Q23i1j11I * dm.x;
+    x22.x += Q23i1j11R * dp.x + Q23i1j11I * dm.y;
+    x22.y += Q23i1j11R * dp.y - Q23i1j11I * dm.x;
+    x2.x += Q23i2j11R * dp.x - Q23i2j11I * dm.y;
+    x2.y += Q23i2j11R * dp.y + Q23i2j11I * dm.x;
+    x21.x += Q23i2j11R * dp.x + Q23i2j11I * dm.y;
+    x21.y += Q23i2j11R * dp.y - Q23i2j11I * dm.x;
+    x3.x += Q23i3j11R * dp.x - Q23i3j11I * dm.y;
+    x3.y += Q23i3j11R * dp.y + Q23i3j11I * dm.x;
+    x20.x += Q23i3j11R * dp.x + Q23i3j11I * dm.y;
+    x20.y += Q23i3j11R * dp.y - Q23i3j11I * dm.x;
+    x4.x += Q23i4j11R * dp.x - Q23i4j11I * dm.y;
+    x4.y += Q23i4j11R * dp.y + Q23i4j11I * dm.x;
+    x19.x += Q23i4j11R * dp.x + Q23i4j11I * dm.y;
+    x19.y += Q23i4j11R * dp.y - Q23i4j11I * dm.x;
+    x5.x += Q23i5j11R * dp.x - Q23i5j11I * dm.y;
+    x5.y += Q23i5j11R * dp.y + Q23i5j11I * dm.x;
+    x18.x += Q23i5j11R * dp.x + Q23i5j11I * dm.y;
+    x18.y += Q23i5j11R * dp.y - Q23i5j11I * dm.x;
+    x6.x += Q23i6j11R * dp.x - Q23i6j11I * dm.y;
+    x6.y += Q23i6j11R * dp.y + Q23i6j11I * dm.x;
+    x17.x += Q23i6j11R * dp.x + Q23i6j11I * dm.y;
+    x17.y += Q23i6j11R * dp.y - Q23i6j11I * dm.x;
+    x7.x += Q23i7j11R * dp.x - Q23i7j11I * dm.y;
+    x7.y += Q23i7j11R * dp.y + Q23i7j11I * dm.x;
+    x16.x += Q23i7j11R * dp.x + Q23i7j11I * dm.y;
+    x16.y += Q23i7j11R * dp.y - Q23i7j11I * dm.x;
+    x8.x += Q23i8j11R * dp.x - Q23i8j11I * dm.y;
+    x8.y += Q23i8j11R * dp.y + Q23i8j11I * dm.x;
+    x15.x += Q23i8j11R * dp.x + Q23i8j11I * dm.y;
+    x15.y += Q23i8j11R * dp.y - Q23i8j11I * dm.x;
+    x9.x += Q23i9j11R * dp.x - Q23i9j11I * dm.y;
+    x9.y += Q23i9j11R * dp.y + Q23i9j11I * dm.x;
+    x14.x += Q23i9j11R * dp.x + Q23i9j11I * dm.y;
+    x14.y += Q23i9j11R * dp.y - Q23i9j11I * dm.x;
+    x10.x += Q23i10j11R * dp.x - Q23i10j11I * dm.y;
+    x10.y += Q23i10j11R * dp.y + Q23i10j11I * dm.x;
+    x13.x += Q23i10j11R * dp.x + Q23i10j11I * dm.y;
+    x13.y += Q23i10j11R * dp.y - Q23i10j11I * dm.x;
+    x11.x += Q23i11j11R * dp.x - Q23i11j11I * dm.y;
+    x11.y += Q23i11j11R * dp.y + Q23i11j11I * dm.x;
+    x12.x += Q23i11j11R * dp.x + Q23i11j11I * dm.y;
+    x12.y += Q23i11j11R * dp.y - Q23i11j11I * dm.x;
+    (*R0)  = x0;
+    (*R1)  = x1;
+    (*R2)  = x2;
+    (*R3)  = x3;
+    (*R4)  = x4;
+    (*R5)  = x5;
+    (*R6)  = x6;
+    (*R7)  = x7;
+    (*R8)  = x8;
+    (*R9)  = x9;
+    (*R10) = x10;
+    (*R11) = x11;
+    (*R12) = x12;
+    (*R13) = x13;
+    (*R14) = x14;
+    (*R15) = x15;
+    (*R16) = x16;
+    (*R17) = x17;
+    (*R18) = x18;
+    (*R19) = x19;
+    (*R20) = x20;
+    (*R21) = x21;
+    (*R22) = x22;
+}
+
+template <typename T>
+__device__ void InvRad23B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12,
+                           T* R13,
+                           T* R14,
+                           T* R15,
+                           T* R16,
+                           T* R17,
+                           T* R18,
+                           T* R19,
+                           T* R20,
+                           T* R21,
+                           T* R22)
+{
+    T x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20;
+    T x21, x22, dp, dm;
+
+    x0 = (*R0) + (*R1) + (*R2) + (*R3) + (*R4) + (*R5) + (*R6) + (*R7) + (*R8) + (*R9) + (*R10)
+         + (*R11) + (*R12) + (*R13) + (*R14) + (*R15) + (*R16) + (*R17) + (*R18) + (*R19) + (*R20)
+         + (*R21) + (*R22);
+    x1  = (*R0);
+    x2  = (*R0);
+    x3  = (*R0);
+    x4  = (*R0);
+    x5  = (*R0);
+    x6  = (*R0);
+    x7  = (*R0);
+    x8  = (*R0);
+    x9  = (*R0);
+    x10 = (*R0);
+    x11 = (*R0);
+    x12 = (*R0);
+    x13 = (*R0);
+    x14 = (*R0);
+    x15 = (*R0);
+    x16 = (*R0);
+    x17 = (*R0);
+    x18 = (*R0);
+    x19 = (*R0);
+    x20 = (*R0);
+    x21 = (*R0);
+    x22 = (*R0);
+    dp  = (*R1) + (*R22);
+    dm  = (*R1) - (*R22);
+    x1.x += Q23i1j1R * dp.x + Q23i1j1I * dm.y;
+    x1.y += Q23i1j1R * dp.y - Q23i1j1I * dm.x;
+    x22.x += Q23i1j1R * dp.x - Q23i1j1I * dm.y;
+    x22.y += Q23i1j1R * dp.y + Q23i1j1I * dm.x;
+    x2.x += Q23i2j1R * dp.x + Q23i2j1I * dm.y;
+    x2.y += Q23i2j1R * dp.y - Q23i2j1I * dm.x;
+    x21.x += Q23i2j1R * dp.x - Q23i2j1I * dm.y;
+    x21.y += Q23i2j1R * dp.y + Q23i2j1I * dm.x;
+    x3.x += Q23i3j1R * dp.x + Q23i3j1I * dm.y;
+    x3.y += Q23i3j1R * dp.y - Q23i3j1I * dm.x;
+    x20.x += Q23i3j1R * dp.x - Q23i3j1I * dm.y;
+    x20.y += Q23i3j1R * dp.y + Q23i3j1I * dm.x;
+    x4.x += Q23i4j1R * dp.x + Q23i4j1I * dm.y;
+    x4.y += Q23i4j1R * dp.y - Q23i4j1I * dm.x;
+    x19.x += Q23i4j1R * dp.x - Q23i4j1I * dm.y;
+    x19.y += Q23i4j1R * dp.y + Q23i4j1I * dm.x;
+    x5.x += Q23i5j1R * dp.x + Q23i5j1I * dm.y;
+    x5.y += Q23i5j1R * dp.y - Q23i5j1I * dm.x;
+    x18.x += Q23i5j1R * dp.x - Q23i5j1I * dm.y;
+    x18.y += Q23i5j1R * dp.y + Q23i5j1I * dm.x;
+    x6.x += Q23i6j1R * dp.x + Q23i6j1I * dm.y;
+    x6.y += Q23i6j1R * dp.y - Q23i6j1I * dm.x;
+    x17.x += Q23i6j1R * dp.x - Q23i6j1I * dm.y;
+    x17.y += Q23i6j1R * dp.y + Q23i6j1I * dm.x;
+    x7.x += Q23i7j1R * dp.x + Q23i7j1I * dm.y;
+    x7.y += Q23i7j1R * dp.y - Q23i7j1I * dm.x;
+    x16.x += Q23i7j1R * dp.x - Q23i7j1I * dm.y;
+    x16.y += Q23i7j1R * dp.y + Q23i7j1I * dm.x;
+    x8.x += Q23i8j1R * dp.x + Q23i8j1I * dm.y;
+    x8.y += Q23i8j1R * dp.y - Q23i8j1I * dm.x;
+    x15.x += Q23i8j1R * dp.x - Q23i8j1I * dm.y;
+    x15.y += Q23i8j1R * dp.y + Q23i8j1I * dm.x;
+    x9.x += Q23i9j1R * dp.x + Q23i9j1I * dm.y;
+    x9.y += Q23i9j1R * dp.y - Q23i9j1I * dm.x;
+    x14.x += Q23i9j1R * dp.x - Q23i9j1I * dm.y;
+    x14.y += Q23i9j1R * dp.y + Q23i9j1I * dm.x;
+    x10.x += Q23i10j1R * dp.x + Q23i10j1I * dm.y;
+    x10.y += Q23i10j1R * dp.y - Q23i10j1I * dm.x;
+    x13.x += Q23i10j1R * dp.x - Q23i10j1I * dm.y;
+    x13.y += Q23i10j1R * dp.y + Q23i10j1I * dm.x;
+    x11.x += Q23i11j1R * dp.x + Q23i11j1I * dm.y;
+    x11.y += Q23i11j1R * dp.y - Q23i11j1I * dm.x;
+    x12.x += Q23i11j1R * dp.x - Q23i11j1I * dm.y;
+    x12.y += Q23i11j1R * dp.y + Q23i11j1I * dm.x;
+    dp = (*R2) + (*R21);
+    dm = (*R2) - (*R21);
+    x1.x += Q23i1j2R * dp.x + Q23i1j2I * dm.y;
+    x1.y += Q23i1j2R * dp.y - Q23i1j2I * dm.x;
+    x22.x += Q23i1j2R * dp.x - Q23i1j2I * dm.y;
+    x22.y += Q23i1j2R * dp.y + Q23i1j2I * dm.x;
+    x2.x += Q23i2j2R * dp.x + Q23i2j2I * dm.y;
+    x2.y += Q23i2j2R * dp.y - Q23i2j2I * dm.x;
+    x21.x += Q23i2j2R * dp.x - Q23i2j2I * dm.y;
+    x21.y += Q23i2j2R * dp.y + Q23i2j2I * dm.x;
+    x3.x += Q23i3j2R * dp.x + Q23i3j2I * dm.y;
+    x3.y += Q23i3j2R * dp.y - Q23i3j2I * dm.x;
+    x20.x += Q23i3j2R * dp.x - Q23i3j2I * dm.y;
+    x20.y += Q23i3j2R * dp.y + Q23i3j2I * dm.x;
+    x4.x += Q23i4j2R * dp.x + Q23i4j2I * dm.y;
+    x4.y += Q23i4j2R * dp.y - Q23i4j2I * dm.x;
+    x19.x += Q23i4j2R * dp.x - Q23i4j2I * dm.y;
+    x19.y += Q23i4j2R * dp.y + Q23i4j2I * dm.x;
+    x5.x += Q23i5j2R * dp.x + Q23i5j2I * dm.y;
+    x5.y += Q23i5j2R * dp.y - Q23i5j2I * dm.x;
+    x18.x += Q23i5j2R * dp.x - Q23i5j2I * dm.y;
+    x18.y += Q23i5j2R * dp.y + Q23i5j2I * dm.x;
+    x6.x += Q23i6j2R * dp.x + Q23i6j2I * dm.y;
+    x6.y += Q23i6j2R * dp.y - Q23i6j2I * dm.x;
+    x17.x += Q23i6j2R * dp.x - Q23i6j2I * dm.y;
+    x17.y += Q23i6j2R * dp.y + Q23i6j2I * dm.x;
+    x7.x += Q23i7j2R * dp.x + Q23i7j2I * dm.y;
+    x7.y += Q23i7j2R * dp.y - Q23i7j2I * dm.x;
+    x16.x += Q23i7j2R * dp.x - Q23i7j2I * dm.y;
+    x16.y += Q23i7j2R * dp.y + Q23i7j2I * dm.x;
+    x8.x += Q23i8j2R * dp.x + Q23i8j2I * dm.y;
+    x8.y += Q23i8j2R * dp.y - Q23i8j2I * dm.x;
+    x15.x += Q23i8j2R * dp.x - Q23i8j2I * dm.y;
+    x15.y += Q23i8j2R * dp.y + Q23i8j2I * dm.x;
+    x9.x += Q23i9j2R * dp.x + Q23i9j2I * dm.y;
+    x9.y += Q23i9j2R * dp.y - Q23i9j2I * dm.x;
+    x14.x += Q23i9j2R * dp.x - Q23i9j2I * dm.y;
+    x14.y += Q23i9j2R * dp.y + Q23i9j2I * dm.x;
+    x10.x += Q23i10j2R * dp.x + Q23i10j2I * dm.y;
+    x10.y += Q23i10j2R * dp.y - Q23i10j2I * dm.x;
+    x13.x += Q23i10j2R * dp.x - Q23i10j2I * dm.y;
+    x13.y += Q23i10j2R * dp.y + Q23i10j2I * dm.x;
+    x11.x += Q23i11j2R * dp.x + Q23i11j2I * dm.y;
+    x11.y += Q23i11j2R * dp.y - Q23i11j2I * dm.x;
+    x12.x += Q23i11j2R * dp.x - Q23i11j2I * dm.y;
+    x12.y += Q23i11j2R * dp.y + Q23i11j2I * dm.x;
+    dp = (*R3) + (*R20);
+    dm = (*R3) - (*R20);
+    x1.x += Q23i1j3R * dp.x + Q23i1j3I * dm.y;
+    x1.y += Q23i1j3R * dp.y - Q23i1j3I * dm.x;
+    x22.x += Q23i1j3R * dp.x - Q23i1j3I * dm.y;
+    x22.y += Q23i1j3R * dp.y + Q23i1j3I * dm.x;
+    x2.x += Q23i2j3R * dp.x + Q23i2j3I * dm.y;
+    x2.y += Q23i2j3R * dp.y - Q23i2j3I * dm.x;
+    x21.x += Q23i2j3R * dp.x - Q23i2j3I * dm.y;
+    x21.y += Q23i2j3R * dp.y + Q23i2j3I * dm.x;
+    x3.x += Q23i3j3R * dp.x + Q23i3j3I * dm.y;
+    x3.y += Q23i3j3R * dp.y - Q23i3j3I * dm.x;
+    x20.x += Q23i3j3R * dp.x - Q23i3j3I * dm.y;
+    x20.y += Q23i3j3R * dp.y + Q23i3j3I * dm.x;
+    x4.x += Q23i4j3R * dp.x + Q23i4j3I * dm.y;
+    x4.y += Q23i4j3R * dp.y - Q23i4j3I * dm.x;
+    x19.x += Q23i4j3R * dp.x - Q23i4j3I * dm.y;
+    x19.y += Q23i4j3R * dp.y + Q23i4j3I * dm.x;
+    x5.x += Q23i5j3R * dp.x + Q23i5j3I * dm.y;
+    x5.y += Q23i5j3R * dp.y - Q23i5j3I * dm.x;
+    x18.x += Q23i5j3R * dp.x - Q23i5j3I * dm.y;
+    x18.y += Q23i5j3R * dp.y + Q23i5j3I * dm.x;
+    x6.x += Q23i6j3R * dp.x + Q23i6j3I * dm.y;
+    x6.y += Q23i6j3R * dp.y - Q23i6j3I * dm.x;
+    x17.x += Q23i6j3R * dp.x - Q23i6j3I * dm.y;
+    x17.y += Q23i6j3R * dp.y + Q23i6j3I * dm.x;
+    x7.x += Q23i7j3R * dp.x + Q23i7j3I * dm.y;
+    x7.y += Q23i7j3R * dp.y - Q23i7j3I * dm.x;
+    x16.x += Q23i7j3R * dp.x - Q23i7j3I * dm.y;
+    x16.y += Q23i7j3R * dp.y + Q23i7j3I * dm.x;
+    x8.x += Q23i8j3R * dp.x + Q23i8j3I * dm.y;
+    x8.y += Q23i8j3R * dp.y - Q23i8j3I * dm.x;
+    x15.x += Q23i8j3R * dp.x - Q23i8j3I * dm.y;
+    x15.y += Q23i8j3R * dp.y + Q23i8j3I * dm.x;
+    x9.x += Q23i9j3R * dp.x + Q23i9j3I * dm.y;
+    x9.y += Q23i9j3R * dp.y - Q23i9j3I * dm.x;
+    x14.x += Q23i9j3R * dp.x - Q23i9j3I * dm.y;
+    x14.y += Q23i9j3R * dp.y + Q23i9j3I * dm.x;
+    x10.x += Q23i10j3R * dp.x + Q23i10j3I * dm.y;
+    x10.y += Q23i10j3R * dp.y - Q23i10j3I * dm.x;
+    x13.x += Q23i10j3R * dp.x - Q23i10j3I * dm.y;
+    x13.y += Q23i10j3R * dp.y + Q23i10j3I * dm.x;
+    x11.x += Q23i11j3R * dp.x + Q23i11j3I * dm.y;
+    x11.y += Q23i11j3R * dp.y - Q23i11j3I * dm.x;
+    x12.x += Q23i11j3R * dp.x - Q23i11j3I * dm.y;
+    x12.y += Q23i11j3R * dp.y + Q23i11j3I * dm.x;
+    dp = (*R4) + (*R19);
+    dm = (*R4) - (*R19);
+    x1.x += Q23i1j4R * dp.x + Q23i1j4I * dm.y;
+    x1.y += Q23i1j4R * dp.y - Q23i1j4I * dm.x;
+    x22.x += Q23i1j4R * dp.x - Q23i1j4I * dm.y;
+    x22.y += Q23i1j4R * dp.y + Q23i1j4I * dm.x;
+    x2.x += Q23i2j4R * dp.x + Q23i2j4I * dm.y;
+    x2.y += Q23i2j4R * dp.y - Q23i2j4I * dm.x;
+    x21.x += Q23i2j4R * dp.x - Q23i2j4I * dm.y;
+    x21.y += Q23i2j4R * dp.y + Q23i2j4I * dm.x;
+    x3.x += Q23i3j4R * dp.x + Q23i3j4I * dm.y;
+    x3.y += Q23i3j4R * dp.y - Q23i3j4I * dm.x;
+    x20.x += Q23i3j4R * dp.x - Q23i3j4I * dm.y;
+    x20.y += Q23i3j4R * dp.y + Q23i3j4I * dm.x;
+    x4.x += Q23i4j4R * dp.x + Q23i4j4I * dm.y;
+    x4.y += Q23i4j4R * dp.y - Q23i4j4I * dm.x;
+    x19.x += Q23i4j4R * dp.x - Q23i4j4I * dm.y;
+    x19.y += Q23i4j4R * dp.y + Q23i4j4I * dm.x;
+    x5.x += Q23i5j4R * dp.x + Q23i5j4I * dm.y;
+    x5.y += Q23i5j4R * dp.y - Q23i5j4I * dm.x;
+    x18.x += Q23i5j4R * dp.x - Q23i5j4I * dm.y;
+    x18.y += Q23i5j4R * dp.y + Q23i5j4I * dm.x;
+    x6.x += Q23i6j4R * dp.x + Q23i6j4I * dm.y;
+    x6.y += Q23i6j4R * dp.y - Q23i6j4I * dm.x;
+    x17.x += Q23i6j4R * dp.x - Q23i6j4I * dm.y;
+    x17.y += Q23i6j4R * dp.y + Q23i6j4I * dm.x;
+    x7.x += Q23i7j4R * dp.x + Q23i7j4I * dm.y;
+    x7.y += Q23i7j4R * dp.y - Q23i7j4I * dm.x;
+    x16.x += Q23i7j4R * dp.x - Q23i7j4I * dm.y;
+    x16.y += Q23i7j4R * dp.y + Q23i7j4I * dm.x;
+    x8.x += Q23i8j4R * dp.x + Q23i8j4I * dm.y;
+    x8.y += Q23i8j4R * dp.y - Q23i8j4I * dm.x;
+    x15.x += Q23i8j4R * dp.x - Q23i8j4I * dm.y;
+    x15.y += Q23i8j4R * dp.y + Q23i8j4I * dm.x;
+    x9.x += Q23i9j4R * dp.x + Q23i9j4I * dm.y;
+    x9.y += Q23i9j4R * dp.y - Q23i9j4I * dm.x;
+    x14.x += Q23i9j4R * dp.x - Q23i9j4I * dm.y;
+    x14.y += Q23i9j4R * dp.y + Q23i9j4I * dm.x;
+    x10.x += Q23i10j4R * dp.x + Q23i10j4I * dm.y;
+    x10.y += Q23i10j4R * dp.y - Q23i10j4I * dm.x;
+    x13.x += Q23i10j4R * dp.x - Q23i10j4I * dm.y;
+    x13.y += Q23i10j4R * dp.y + Q23i10j4I * dm.x;
+    x11.x += Q23i11j4R * dp.x + Q23i11j4I * dm.y;
+    x11.y += Q23i11j4R * dp.y - Q23i11j4I * dm.x;
+    x12.x += Q23i11j4R * dp.x - Q23i11j4I * dm.y;
+    x12.y += Q23i11j4R * dp.y + Q23i11j4I * dm.x;
+    dp = (*R5) + (*R18);
+    dm = (*R5) - (*R18);
+    x1.x += Q23i1j5R * dp.x + Q23i1j5I * dm.y;
+    x1.y += Q23i1j5R * dp.y - Q23i1j5I * dm.x;
+    x22.x += Q23i1j5R * dp.x - Q23i1j5I * dm.y;
+    x22.y += Q23i1j5R * dp.y + Q23i1j5I * dm.x;
+    x2.x += Q23i2j5R * dp.x + Q23i2j5I * dm.y;
+    x2.y += Q23i2j5R * dp.y - Q23i2j5I * dm.x;
+    x21.x += Q23i2j5R * dp.x - Q23i2j5I * dm.y;
+    x21.y += Q23i2j5R * dp.y + Q23i2j5I * dm.x;
+    x3.x += Q23i3j5R * dp.x + Q23i3j5I * dm.y;
+    x3.y += Q23i3j5R * dp.y - Q23i3j5I * dm.x;
+    x20.x += Q23i3j5R * dp.x - Q23i3j5I * dm.y;
+    x20.y += Q23i3j5R * dp.y + Q23i3j5I * dm.x;
+    x4.x += Q23i4j5R * dp.x + Q23i4j5I * dm.y;
+    x4.y += Q23i4j5R * dp.y - Q23i4j5I * dm.x;
+    x19.x += Q23i4j5R * dp.x - Q23i4j5I * dm.y;
+    x19.y += Q23i4j5R * dp.y + Q23i4j5I * dm.x;
+    x5.x += Q23i5j5R * dp.x + Q23i5j5I * dm.y;
+    x5.y += Q23i5j5R * dp.y - Q23i5j5I * dm.x;
+    x18.x += Q23i5j5R * dp.x - Q23i5j5I * dm.y;
+    x18.y += Q23i5j5R * dp.y + Q23i5j5I * dm.x;
+    x6.x += Q23i6j5R * dp.x + Q23i6j5I * dm.y;
+    x6.y += Q23i6j5R * dp.y - Q23i6j5I * dm.x;
+    x17.x += Q23i6j5R * dp.x - Q23i6j5I * dm.y;
+    x17.y += Q23i6j5R * dp.y + Q23i6j5I * dm.x;
+    x7.x += Q23i7j5R * dp.x + Q23i7j5I * dm.y;
+    x7.y += Q23i7j5R * dp.y - Q23i7j5I * dm.x;
+    x16.x += Q23i7j5R * dp.x - Q23i7j5I * dm.y;
+    x16.y += Q23i7j5R * dp.y + Q23i7j5I * dm.x;
+    x8.x += Q23i8j5R * dp.x + Q23i8j5I * dm.y;
+    x8.y += Q23i8j5R * dp.y - Q23i8j5I * dm.x;
+    x15.x += Q23i8j5R * dp.x - Q23i8j5I * dm.y;
+    x15.y += Q23i8j5R * dp.y + Q23i8j5I * dm.x;
+    x9.x += Q23i9j5R * dp.x + Q23i9j5I * dm.y;
+    x9.y += Q23i9j5R * dp.y - Q23i9j5I * dm.x;
+    x14.x += Q23i9j5R * dp.x - Q23i9j5I * dm.y;
+    x14.y += Q23i9j5R * dp.y + Q23i9j5I * dm.x;
+    x10.x += Q23i10j5R * dp.x + Q23i10j5I * dm.y;
+    x10.y += Q23i10j5R * dp.y - Q23i10j5I * dm.x;
+    x13.x += Q23i10j5R * dp.x - Q23i10j5I * dm.y;
+    x13.y += Q23i10j5R * dp.y + Q23i10j5I * dm.x;
+    x11.x += Q23i11j5R * dp.x + Q23i11j5I * dm.y;
+    x11.y += Q23i11j5R * dp.y - Q23i11j5I * dm.x;
+    x12.x += Q23i11j5R * dp.x - Q23i11j5I * dm.y;
+    x12.y += Q23i11j5R * dp.y + Q23i11j5I * dm.x;
+    dp = (*R6) + (*R17);
+    dm = (*R6) - (*R17);
+    x1.x += Q23i1j6R * dp.x + Q23i1j6I * dm.y;
+    x1.y += Q23i1j6R * dp.y - Q23i1j6I * dm.x;
+    x22.x += Q23i1j6R * dp.x - Q23i1j6I * dm.y;
+    x22.y += Q23i1j6R * dp.y + Q23i1j6I * dm.x;
+    x2.x += Q23i2j6R * dp.x + Q23i2j6I * dm.y;
+    x2.y += Q23i2j6R * dp.y - Q23i2j6I * dm.x;
+    x21.x += Q23i2j6R * dp.x - Q23i2j6I * dm.y;
+    x21.y += Q23i2j6R * dp.y + Q23i2j6I * dm.x;
+    x3.x += Q23i3j6R * dp.x + Q23i3j6I * dm.y;
+    x3.y += Q23i3j6R * dp.y - Q23i3j6I * dm.x;
+    x20.x += Q23i3j6R * dp.x - Q23i3j6I * dm.y;
+    x20.y += Q23i3j6R * dp.y + Q23i3j6I * dm.x;
+    x4.x += Q23i4j6R * dp.x + Q23i4j6I * dm.y;
+    x4.y += Q23i4j6R * dp.y - Q23i4j6I * dm.x;
+    x19.x += Q23i4j6R * dp.x - Q23i4j6I * dm.y;
+    x19.y += Q23i4j6R * dp.y + Q23i4j6I * dm.x;
+    x5.x += Q23i5j6R * dp.x + Q23i5j6I * dm.y;
+    x5.y += Q23i5j6R * dp.y - Q23i5j6I * dm.x;
+    x18.x += Q23i5j6R * dp.x - Q23i5j6I * dm.y;
+    x18.y += Q23i5j6R * dp.y + Q23i5j6I * dm.x;
+    x6.x += Q23i6j6R * dp.x + Q23i6j6I * dm.y;
+    x6.y += Q23i6j6R * dp.y - Q23i6j6I * dm.x;
+    x17.x += Q23i6j6R * dp.x - Q23i6j6I * dm.y;
+    x17.y += Q23i6j6R * dp.y + Q23i6j6I * dm.x;
+    x7.x += Q23i7j6R * dp.x + Q23i7j6I * dm.y;
+    x7.y += Q23i7j6R * dp.y - Q23i7j6I * dm.x;
+    x16.x += Q23i7j6R * dp.x - Q23i7j6I * dm.y;
+    x16.y += Q23i7j6R * dp.y + Q23i7j6I * dm.x;
+    x8.x += Q23i8j6R * dp.x + Q23i8j6I * dm.y;
+    x8.y += Q23i8j6R * dp.y - Q23i8j6I * dm.x;
+    x15.x += Q23i8j6R * dp.x - Q23i8j6I * dm.y;
+    x15.y += Q23i8j6R * dp.y + Q23i8j6I * dm.x;
+    x9.x += Q23i9j6R * dp.x + Q23i9j6I * dm.y;
+    x9.y += Q23i9j6R * dp.y - Q23i9j6I * dm.x;
+    x14.x += Q23i9j6R * dp.x - Q23i9j6I * dm.y;
+    x14.y += Q23i9j6R * dp.y + Q23i9j6I * dm.x;
+    x10.x += Q23i10j6R * dp.x + Q23i10j6I * dm.y;
+    x10.y += Q23i10j6R * dp.y - Q23i10j6I * dm.x;
+    x13.x += Q23i10j6R * dp.x - Q23i10j6I * dm.y;
+    x13.y += Q23i10j6R * dp.y + Q23i10j6I * dm.x;
+    x11.x += Q23i11j6R * dp.x + Q23i11j6I * dm.y;
+    x11.y += Q23i11j6R * dp.y - Q23i11j6I * dm.x;
+    x12.x += Q23i11j6R * dp.x - Q23i11j6I * dm.y;
+    x12.y += Q23i11j6R * dp.y + Q23i11j6I * dm.x;
+    dp = (*R7) + (*R16);
+    dm = (*R7) - (*R16);
+    x1.x += Q23i1j7R * dp.x + Q23i1j7I * dm.y;
+    x1.y += Q23i1j7R * dp.y - Q23i1j7I * dm.x;
+    x22.x += Q23i1j7R * dp.x - Q23i1j7I * dm.y;
+    x22.y += Q23i1j7R * dp.y + Q23i1j7I * dm.x;
+    x2.x += Q23i2j7R * dp.x + Q23i2j7I * dm.y;
+    x2.y += Q23i2j7R * dp.y - Q23i2j7I * dm.x;
+    x21.x += Q23i2j7R * dp.x - Q23i2j7I * dm.y;
+    x21.y += Q23i2j7R * dp.y + Q23i2j7I * dm.x;
+    x3.x += Q23i3j7R * dp.x + Q23i3j7I * dm.y;
+    x3.y += Q23i3j7R * dp.y - Q23i3j7I * dm.x;
+    x20.x += Q23i3j7R * dp.x - Q23i3j7I * dm.y;
+    x20.y += Q23i3j7R * dp.y + Q23i3j7I * dm.x;
+    x4.x += Q23i4j7R * dp.x + Q23i4j7I * dm.y;
+    x4.y += Q23i4j7R * dp.y - Q23i4j7I * dm.x;
+    x19.x += Q23i4j7R * dp.x - Q23i4j7I * dm.y;
+    x19.y += Q23i4j7R * dp.y + Q23i4j7I * dm.x;
+    x5.x += Q23i5j7R * dp.x + Q23i5j7I * dm.y;
+    x5.y += Q23i5j7R * dp.y - Q23i5j7I * dm.x;
+    x18.x += Q23i5j7R * dp.x - Q23i5j7I * dm.y;
+    x18.y += Q23i5j7R * dp.y + Q23i5j7I * dm.x;
+    x6.x += Q23i6j7R * dp.x + Q23i6j7I * dm.y;
+    x6.y += Q23i6j7R * dp.y - Q23i6j7I * dm.x;
+    x17.x += Q23i6j7R * dp.x - Q23i6j7I * dm.y;
+    x17.y += Q23i6j7R * dp.y + Q23i6j7I * dm.x;
+    x7.x += Q23i7j7R * dp.x + Q23i7j7I * dm.y;
+    x7.y += Q23i7j7R * dp.y - Q23i7j7I * dm.x;
+    x16.x += Q23i7j7R * dp.x - Q23i7j7I * dm.y;
+    x16.y += Q23i7j7R * dp.y + Q23i7j7I * dm.x;
+    x8.x += Q23i8j7R * dp.x + Q23i8j7I * dm.y;
+    x8.y += Q23i8j7R * dp.y - Q23i8j7I * dm.x;
+    x15.x += Q23i8j7R * dp.x - Q23i8j7I * dm.y;
+    x15.y += Q23i8j7R * dp.y + Q23i8j7I * dm.x;
+    x9.x += Q23i9j7R * dp.x + Q23i9j7I * dm.y;
+    x9.y += Q23i9j7R * dp.y - Q23i9j7I * dm.x;
+    x14.x += Q23i9j7R * dp.x - Q23i9j7I * dm.y;
+    x14.y += Q23i9j7R * dp.y + Q23i9j7I * dm.x;
+    x10.x += Q23i10j7R * dp.x + Q23i10j7I * dm.y;
+    x10.y += Q23i10j7R * dp.y - Q23i10j7I * dm.x;
+    x13.x += Q23i10j7R * dp.x - Q23i10j7I * dm.y;
+    x13.y += Q23i10j7R * dp.y + Q23i10j7I * dm.x;
+    x11.x += Q23i11j7R * dp.x + Q23i11j7I * dm.y;
+    x11.y += Q23i11j7R * dp.y - Q23i11j7I * dm.x;
+    x12.x += Q23i11j7R * dp.x - Q23i11j7I * dm.y;
+    x12.y += Q23i11j7R * dp.y + Q23i11j7I * dm.x;
+    dp = (*R8) + (*R15);
+    dm = (*R8) - (*R15);
+    x1.x += Q23i1j8R * dp.x + Q23i1j8I * dm.y;
+    x1.y += Q23i1j8R * dp.y - Q23i1j8I * dm.x;
+    x22.x += Q23i1j8R * dp.x - Q23i1j8I * dm.y;
+    x22.y += Q23i1j8R * dp.y + Q23i1j8I * dm.x;
+    x2.x += Q23i2j8R * dp.x + Q23i2j8I * dm.y;
+    x2.y += Q23i2j8R * dp.y - Q23i2j8I * dm.x;
+    x21.x += Q23i2j8R * dp.x - Q23i2j8I * dm.y;
+    x21.y += Q23i2j8R * dp.y + Q23i2j8I * dm.x;
+    x3.x += Q23i3j8R * dp.x + Q23i3j8I * dm.y;
+    x3.y += Q23i3j8R * dp.y - Q23i3j8I * dm.x;
+    x20.x += Q23i3j8R * dp.x - Q23i3j8I * dm.y;
+    x20.y += Q23i3j8R * dp.y + Q23i3j8I * dm.x;
+    x4.x += Q23i4j8R * dp.x + Q23i4j8I * dm.y;
+    x4.y += Q23i4j8R * dp.y - Q23i4j8I * dm.x;
+    x19.x += Q23i4j8R * dp.x - Q23i4j8I * dm.y;
+    x19.y += Q23i4j8R * dp.y + Q23i4j8I * dm.x;
+    x5.x += Q23i5j8R * dp.x + Q23i5j8I * dm.y;
+    x5.y += Q23i5j8R * dp.y - Q23i5j8I * dm.x;
+    x18.x += Q23i5j8R * dp.x - Q23i5j8I * dm.y;
+    x18.y += Q23i5j8R * dp.y + Q23i5j8I * dm.x;
+    x6.x += Q23i6j8R * dp.x + Q23i6j8I * dm.y;
+    x6.y += Q23i6j8R * dp.y - Q23i6j8I * dm.x;
+    x17.x += Q23i6j8R * dp.x - Q23i6j8I * dm.y;
+    x17.y += Q23i6j8R * dp.y + Q23i6j8I * dm.x;
+    x7.x += Q23i7j8R * dp.x + Q23i7j8I * dm.y;
+    x7.y += Q23i7j8R * dp.y - Q23i7j8I * dm.x;
+    x16.x += Q23i7j8R * dp.x - Q23i7j8I * dm.y;
+    x16.y += Q23i7j8R * dp.y + Q23i7j8I * dm.x;
+    x8.x += Q23i8j8R * dp.x + Q23i8j8I * dm.y;
+    x8.y += Q23i8j8R * dp.y - Q23i8j8I * dm.x;
+    x15.x += Q23i8j8R * dp.x - Q23i8j8I * dm.y;
+    x15.y += Q23i8j8R * dp.y + Q23i8j8I * dm.x;
+    x9.x += Q23i9j8R * dp.x + Q23i9j8I * dm.y;
+    x9.y += Q23i9j8R * dp.y - Q23i9j8I * dm.x;
+    x14.x += Q23i9j8R * dp.x - Q23i9j8I * dm.y;
+    x14.y += Q23i9j8R * dp.y + Q23i9j8I * dm.x;
+    x10.x += Q23i10j8R * dp.x + Q23i10j8I * dm.y;
+    x10.y += Q23i10j8R * dp.y - Q23i10j8I * dm.x;
+    x13.x += Q23i10j8R * dp.x - Q23i10j8I * dm.y;
+    x13.y += Q23i10j8R * dp.y + Q23i10j8I * dm.x;
+    x11.x += Q23i11j8R * dp.x + Q23i11j8I * dm.y;
+    x11.y += Q23i11j8R * dp.y - Q23i11j8I * dm.x;
+    x12.x += Q23i11j8R * dp.x - Q23i11j8I * dm.y;
+    x12.y += Q23i11j8R * dp.y + Q23i11j8I * dm.x;
+    dp = (*R9) + (*R14);
+    dm = (*R9) - (*R14);
+    x1.x += Q23i1j9R * dp.x + Q23i1j9I * dm.y;
+    x1.y += Q23i1j9R * dp.y - Q23i1j9I * dm.x;
+    x22.x += Q23i1j9R * dp.x - Q23i1j9I * dm.y;
+    x22.y += Q23i1j9R * dp.y + Q23i1j9I * dm.x;
+    x2.x += Q23i2j9R * dp.x + Q23i2j9I * dm.y;
+    x2.y += Q23i2j9R * dp.y - Q23i2j9I * dm.x;
+    x21.x += Q23i2j9R * dp.x - Q23i2j9I * dm.y;
+    x21.y += Q23i2j9R * dp.y + Q23i2j9I * dm.x;
+    x3.x += Q23i3j9R * dp.x + Q23i3j9I * dm.y;
+    x3.y += Q23i3j9R * dp.y - Q23i3j9I * dm.x;
+    x20.x += Q23i3j9R * dp.x - Q23i3j9I * dm.y;
+    x20.y += Q23i3j9R * dp.y + Q23i3j9I * dm.x;
+    x4.x += Q23i4j9R * dp.x + Q23i4j9I * dm.y;
+    x4.y += Q23i4j9R * dp.y - Q23i4j9I * dm.x;
+    x19.x += Q23i4j9R * dp.x - Q23i4j9I * dm.y;
+    x19.y += Q23i4j9R * dp.y + Q23i4j9I * dm.x;
+    x5.x += Q23i5j9R * dp.x + Q23i5j9I * dm.y;
+    x5.y += Q23i5j9R * dp.y - Q23i5j9I * dm.x;
+    x18.x += Q23i5j9R * dp.x - Q23i5j9I * dm.y;
+    x18.y += Q23i5j9R * dp.y + Q23i5j9I * dm.x;
+    x6.x += Q23i6j9R * dp.x + Q23i6j9I * dm.y;
+    x6.y += Q23i6j9R * dp.y - Q23i6j9I * dm.x;
+    x17.x += Q23i6j9R * dp.x - Q23i6j9I * dm.y;
+    x17.y += Q23i6j9R * dp.y + Q23i6j9I * dm.x;
+    x7.x += Q23i7j9R * dp.x + Q23i7j9I * dm.y;
+    x7.y += Q23i7j9R * dp.y - Q23i7j9I * dm.x;
+    x16.x += Q23i7j9R * dp.x - Q23i7j9I * dm.y;
+    x16.y += Q23i7j9R * dp.y + Q23i7j9I * dm.x;
+    x8.x += Q23i8j9R * dp.x + Q23i8j9I * dm.y;
+    x8.y += Q23i8j9R * dp.y - Q23i8j9I * dm.x;
+    x15.x += Q23i8j9R * dp.x - Q23i8j9I * dm.y;
+    x15.y += Q23i8j9R * dp.y + Q23i8j9I * dm.x;
+    x9.x += Q23i9j9R * dp.x + Q23i9j9I * dm.y;
+    x9.y += Q23i9j9R * dp.y - Q23i9j9I * dm.x;
+    x14.x += Q23i9j9R * dp.x - Q23i9j9I * dm.y;
+    x14.y += Q23i9j9R * dp.y + Q23i9j9I * dm.x;
+    x10.x += Q23i10j9R * dp.x + Q23i10j9I * dm.y;
+    x10.y += Q23i10j9R * dp.y - Q23i10j9I * dm.x;
+    x13.x += Q23i10j9R * dp.x - Q23i10j9I * dm.y;
+    x13.y += Q23i10j9R * dp.y + Q23i10j9I * dm.x;
+    x11.x += Q23i11j9R * dp.x + Q23i11j9I * dm.y;
+    x11.y += Q23i11j9R * dp.y - Q23i11j9I * dm.x;
+    x12.x += Q23i11j9R * dp.x - Q23i11j9I * dm.y;
+    x12.y += Q23i11j9R * dp.y + Q23i11j9I * dm.x;
+    dp = (*R10) + (*R13);
+    dm = (*R10) - (*R13);
+    x1.x += Q23i1j10R * dp.x + Q23i1j10I * dm.y;
+    x1.y += Q23i1j10R * dp.y - Q23i1j10I * dm.x;
+    x22.x += Q23i1j10R * dp.x - Q23i1j10I * dm.y;
+    x22.y += Q23i1j10R * dp.y + Q23i1j10I * dm.x;
+    x2.x += Q23i2j10R * dp.x + Q23i2j10I * dm.y;
+    x2.y += Q23i2j10R * dp.y - Q23i2j10I * dm.x;
+    x21.x += Q23i2j10R * dp.x - Q23i2j10I * dm.y;
+    x21.y += Q23i2j10R * dp.y + Q23i2j10I * dm.x;
+    x3.x += Q23i3j10R * dp.x + Q23i3j10I * dm.y;
+    x3.y += Q23i3j10R * dp.y - Q23i3j10I * dm.x;
+    x20.x += Q23i3j10R * dp.x - Q23i3j10I * dm.y;
+    x20.y += Q23i3j10R * dp.y + Q23i3j10I * dm.x;
+    x4.x += Q23i4j10R * dp.x + Q23i4j10I * dm.y;
+    x4.y += Q23i4j10R * dp.y - Q23i4j10I * dm.x;
+    x19.x += Q23i4j10R * dp.x - Q23i4j10I * dm.y;
+    x19.y += Q23i4j10R * dp.y + Q23i4j10I * dm.x;
+    x5.x += Q23i5j10R * dp.x + Q23i5j10I * dm.y;
+    x5.y += Q23i5j10R * dp.y - Q23i5j10I * dm.x;
+    x18.x += Q23i5j10R * dp.x - Q23i5j10I * dm.y;
+    x18.y += Q23i5j10R * dp.y + Q23i5j10I * dm.x;
+    x6.x += Q23i6j10R * dp.x + Q23i6j10I * dm.y;
+    x6.y += Q23i6j10R * dp.y - Q23i6j10I * dm.x;
+    x17.x += Q23i6j10R * dp.x - Q23i6j10I * dm.y;
+    x17.y += Q23i6j10R * dp.y + Q23i6j10I * dm.x;
+    x7.x += Q23i7j10R * dp.x + Q23i7j10I * dm.y;
+    x7.y += Q23i7j10R * dp.y - Q23i7j10I * dm.x;
+    x16.x += Q23i7j10R * dp.x - Q23i7j10I * dm.y;
+    x16.y += Q23i7j10R * dp.y + Q23i7j10I * dm.x;
+    x8.x += Q23i8j10R * dp.x + Q23i8j10I * dm.y;
+    x8.y += Q23i8j10R * dp.y - Q23i8j10I * dm.x;
+    x15.x += Q23i8j10R * dp.x - Q23i8j10I * dm.y;
+    x15.y += Q23i8j10R * dp.y + Q23i8j10I * dm.x;
+    x9.x += Q23i9j10R * dp.x + Q23i9j10I * dm.y;
+    x9.y += Q23i9j10R * dp.y - Q23i9j10I * dm.x;
+    x14.x += Q23i9j10R * dp.x - Q23i9j10I * dm.y;
+    x14.y += Q23i9j10R * dp.y + Q23i9j10I * dm.x;
+    x10.x += Q23i10j10R * dp.x + Q23i10j10I * dm.y;
+    x10.y += Q23i10j10R * dp.y - Q23i10j10I * dm.x;
+    x13.x += Q23i10j10R * dp.x - Q23i10j10I * dm.y;
+    x13.y += Q23i10j10R * dp.y + Q23i10j10I * dm.x;
+    x11.x += Q23i11j10R * dp.x + Q23i11j10I * dm.y;
+    x11.y += Q23i11j10R * dp.y - Q23i11j10I * dm.x;
+    x12.x += Q23i11j10R * dp.x - Q23i11j10I * dm.y;
+    x12.y += Q23i11j10R * dp.y + Q23i11j10I * dm.x;
+    dp = (*R11) + (*R12);
+    dm = (*R11) - (*R12);
+    x1.x += Q23i1j11R * dp.x + Q23i1j11I * dm.y;
+    x1.y += Q23i1j11R * dp.y - Q23i1j11I * dm.x;
+    x22.x += Q23i1j11R * dp.x - Q23i1j11I * dm.y;
+    x22.y += Q23i1j11R * dp.y + Q23i1j11I * dm.x;
+    x2.x += Q23i2j11R * dp.x + Q23i2j11I * dm.y;
+    x2.y += Q23i2j11R * dp.y - Q23i2j11I * dm.x;
+    x21.x += Q23i2j11R * dp.x - Q23i2j11I * dm.y;
+    x21.y += Q23i2j11R * dp.y + Q23i2j11I * dm.x;
+    x3.x += Q23i3j11R * dp.x + Q23i3j11I * dm.y;
+    x3.y += Q23i3j11R * dp.y - Q23i3j11I * dm.x;
+    x20.x += Q23i3j11R * dp.x - Q23i3j11I * dm.y;
+    x20.y += Q23i3j11R * dp.y + Q23i3j11I * dm.x;
+    x4.x += Q23i4j11R * dp.x + Q23i4j11I * dm.y;
+    x4.y += Q23i4j11R * dp.y - Q23i4j11I * dm.x;
+    x19.x += Q23i4j11R * dp.x - Q23i4j11I * dm.y;
+    x19.y += Q23i4j11R * dp.y + Q23i4j11I * dm.x;
+    x5.x += Q23i5j11R * dp.x + Q23i5j11I * dm.y;
+    x5.y += Q23i5j11R * dp.y - Q23i5j11I * dm.x;
+    x18.x += Q23i5j11R * dp.x - Q23i5j11I * dm.y;
+    x18.y += Q23i5j11R * dp.y + Q23i5j11I * dm.x;
+    x6.x += Q23i6j11R * dp.x + Q23i6j11I * dm.y;
+    x6.y += Q23i6j11R * dp.y - Q23i6j11I * dm.x;
+    x17.x += Q23i6j11R * dp.x - Q23i6j11I * dm.y;
+    x17.y += Q23i6j11R * dp.y + Q23i6j11I * dm.x;
+    x7.x += Q23i7j11R * dp.x + Q23i7j11I * dm.y;
+    x7.y += Q23i7j11R * dp.y - Q23i7j11I * dm.x;
+    x16.x += Q23i7j11R * dp.x - Q23i7j11I * dm.y;
+    x16.y += Q23i7j11R * dp.y + Q23i7j11I * dm.x;
+    x8.x += Q23i8j11R * dp.x + Q23i8j11I * dm.y;
+    x8.y += Q23i8j11R * dp.y - Q23i8j11I * dm.x;
+    x15.x += Q23i8j11R * dp.x - Q23i8j11I * dm.y;
+    x15.y += Q23i8j11R * dp.y + Q23i8j11I * dm.x;
+    x9.x += Q23i9j11R * dp.x + Q23i9j11I * dm.y;
+    x9.y += Q23i9j11R * dp.y - Q23i9j11I * dm.x;
+    x14.x += Q23i9j11R * dp.x - Q23i9j11I * dm.y;
+    x14.y += Q23i9j11R * dp.y + Q23i9j11I * dm.x;
+    x10.x += Q23i10j11R * dp.x + Q23i10j11I * dm.y;
+    x10.y += Q23i10j11R * dp.y - Q23i10j11I * dm.x;
+    x13.x += Q23i10j11R * dp.x - Q23i10j11I * dm.y;
+    x13.y += Q23i10j11R * dp.y + Q23i10j11I * dm.x;
+    x11.x += Q23i11j11R * dp.x + Q23i11j11I * dm.y;
+    x11.y += Q23i11j11R * dp.y - Q23i11j11I * dm.x;
+    x12.x += Q23i11j11R * dp.x - Q23i11j11I * dm.y;
+    x12.y += Q23i11j11R * dp.y + Q23i11j11I * dm.x;
+    (*R0)  = x0;
+    (*R1)  = x1;
+    (*R2)  = x2;
+    (*R3)  = x3;
+    (*R4)  = x4;
+    (*R5)  = x5;
+    (*R6)  = x6;
+    (*R7)  = x7;
+    (*R8)  = x8;
+    (*R9)  = x9;
+    (*R10) = x10;
+    (*R11) = x11;
+    (*R12) = x12;
+    (*R13) = x13;
+    (*R14) = x14;
+    (*R15) = x15;
+    (*R16) = x16;
+    (*R17) = x17;
+    (*R18) = x18;
+    (*R19) = x19;
+    (*R20) = x20;
+    (*R21) = x21;
+    (*R22) = x22;
+}
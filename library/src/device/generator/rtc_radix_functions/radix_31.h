@@ -0,0 +1,2520 @@
+/*******************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ ******************************************************************************/
+
+// butterfly radix-31 constants, named as the radix-11 and radix-13
+// constants in butterfly_constant.h
+#define Q31i1j1R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i1j1I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i1j2R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i1j2I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i1j3R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i1j3I static_cast<real_type_t<T>>((-0.5712682150947922791574))
+#define Q31i1j4R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i1j4I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i1j5R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i1j5I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i1j6R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i1j6I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i1j7R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i1j7I static_cast<real_type_t<T>>((-0.9884683243281113991622))
+#define Q31i1j8R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i1j8I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i1j9R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i1j9I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i1j10R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i1j10I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i1j11R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i1j11I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i1j12R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i1j12I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i1j13R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i1j13I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i1j14R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i1j14I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i1j15R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i1j15I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i2j1R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i2j1I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i2j2R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i2j2I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i2j3R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i2j3I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i2j4R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i2j4I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i2j5R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i2j5I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i2j6R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i2j6I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i2j7R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i2j7I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i2j8R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i2j8I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i2j9R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i2j9I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i2j10R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i2j10I static_cast<real_type_t<T>>((0.7907757369376985820782))
+#define Q31i2j11R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i2j11I static_cast<real_type_t<T>>((0.9680771188662043051530))
+#define Q31i2j12R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i2j12I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i2j13R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i2j13I static_cast<real_type_t<T>>((0.8486442574947509504641))
+#define Q31i2j14R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i2j14I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i2j15R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i2j15I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i3j1R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i3j1I static_cast<real_type_t<T>>((-0.5712682150947922791574))
+#define Q31i3j2R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i3j2I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i3j3R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i3j3I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i3j4R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i3j4I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i3j5R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i3j5I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i3j6R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i3j6I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i3j7R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i3j7I static_cast<real_type_t<T>>((0.8978045395707416571368))
+#define Q31i3j8R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i3j8I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i3j9R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i3j9I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i3j10R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i3j10I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i3j11R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i3j11I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i3j12R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i3j12I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i3j13R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i3j13I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i3j14R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i3j14I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i3j15R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i3j15I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i4j1R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i4j1I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i4j2R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i4j2I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i4j3R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i4j3I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i4j4R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i4j4I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i4j5R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i4j5I static_cast<real_type_t<T>>((0.7907757369376985820782))
+#define Q31i4j6R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i4j6I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i4j7R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i4j7I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i4j8R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i4j8I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i4j9R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i4j9I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i4j10R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i4j10I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i4j11R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i4j11I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i4j12R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i4j12I static_cast<real_type_t<T>>((0.2993631229733579540081))
+#define Q31i4j13R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i4j13I static_cast<real_type_t<T>>((0.8978045395707416571368))
+#define Q31i4j14R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i4j14I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i4j15R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i4j15I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i5j1R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i5j1I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i5j2R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i5j2I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i5j3R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i5j3I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i5j4R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i5j4I static_cast<real_type_t<T>>((0.7907757369376985820782))
+#define Q31i5j5R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i5j5I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i5j6R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i5j6I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i5j7R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i5j7I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i5j8R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i5j8I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i5j9R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i5j9I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i5j10R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i5j10I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i5j11R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i5j11I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i5j12R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i5j12I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i5j13R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i5j13I static_cast<real_type_t<T>>((-0.5712682150947922791574))
+#define Q31i5j14R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i5j14I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i5j15R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i5j15I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i6j1R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i6j1I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i6j2R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i6j2I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i6j3R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i6j3I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i6j4R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i6j4I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i6j5R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i6j5I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i6j6R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i6j6I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i6j7R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i6j7I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i6j8R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i6j8I static_cast<real_type_t<T>>((0.2993631229733579540081))
+#define Q31i6j9R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i6j9I static_cast<real_type_t<T>>((0.9987165071710528071463))
+#define Q31i6j10R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i6j10I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i6j11R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i6j11I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i6j12R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i6j12I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i6j13R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i6j13I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i6j14R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i6j14I static_cast<real_type_t<T>>((0.9680771188662043051530))
+#define Q31i6j15R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i6j15I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i7j1R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i7j1I static_cast<real_type_t<T>>((-0.9884683243281113991622))
+#define Q31i7j2R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i7j2I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i7j3R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i7j3I static_cast<real_type_t<T>>((0.8978045395707416571368))
+#define Q31i7j4R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i7j4I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i7j5R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i7j5I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i7j6R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i7j6I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i7j7R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i7j7I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i7j8R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i7j8I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i7j9R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i7j9I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i7j10R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i7j10I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i7j11R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i7j11I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i7j12R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i7j12I static_cast<real_type_t<T>>((0.9680771188662043051530))
+#define Q31i7j13R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i7j13I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i7j14R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i7j14I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i7j15R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i7j15I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i8j1R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i8j1I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i8j2R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i8j2I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i8j3R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i8j3I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i8j4R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i8j4I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i8j5R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i8j5I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i8j6R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i8j6I static_cast<real_type_t<T>>((0.2993631229733579540081))
+#define Q31i8j7R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i8j7I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i8j8R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i8j8I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i8j9R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i8j9I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i8j10R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i8j10I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i8j11R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i8j11I static_cast<real_type_t<T>>((0.8486442574947509504641))
+#define Q31i8j12R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i8j12I static_cast<real_type_t<T>>((-0.5712682150947922791574))
+#define Q31i8j13R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i8j13I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i8j14R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i8j14I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i8j15R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i8j15I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i9j1R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i9j1I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i9j2R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i9j2I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i9j3R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i9j3I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i9j4R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i9j4I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i9j5R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i9j5I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i9j6R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i9j6I static_cast<real_type_t<T>>((0.9987165071710528071463))
+#define Q31i9j7R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i9j7I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i9j8R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i9j8I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i9j9R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i9j9I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i9j10R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i9j10I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i9j11R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i9j11I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i9j12R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i9j12I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i9j13R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i9j13I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i9j14R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i9j14I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i9j15R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i9j15I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i10j1R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i10j1I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i10j2R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i10j2I static_cast<real_type_t<T>>((0.7907757369376985820782))
+#define Q31i10j3R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i10j3I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i10j4R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i10j4I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i10j5R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i10j5I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i10j6R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i10j6I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i10j7R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i10j7I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i10j8R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i10j8I static_cast<real_type_t<T>>((0.4853019625310810252146))
+#define Q31i10j9R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i10j9I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i10j10R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i10j10I static_cast<real_type_t<T>>((-0.9884683243281113991622))
+#define Q31i10j11R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i10j11I static_cast<real_type_t<T>>((0.2993631229733579540081))
+#define Q31i10j12R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i10j12I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i10j13R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i10j13I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i10j14R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i10j14I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i10j15R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i10j15I static_cast<real_type_t<T>>((0.8486442574947509504641))
+#define Q31i11j1R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i11j1I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i11j2R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i11j2I static_cast<real_type_t<T>>((0.9680771188662043051530))
+#define Q31i11j3R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i11j3I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i11j4R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i11j4I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i11j5R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i11j5I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i11j6R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i11j6I static_cast<real_type_t<T>>((-0.7247927872291199588655))
+#define Q31i11j7R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i11j7I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i11j8R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i11j8I static_cast<real_type_t<T>>((0.8486442574947509504641))
+#define Q31i11j9R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i11j9I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i11j10R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i11j10I static_cast<real_type_t<T>>((0.2993631229733579540081))
+#define Q31i11j11R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i11j11I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i11j12R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i11j12I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i11j13R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i11j13I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i11j14R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i11j14I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i11j15R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i11j15I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i12j1R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i12j1I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i12j2R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i12j2I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i12j3R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i12j3I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i12j4R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i12j4I static_cast<real_type_t<T>>((0.2993631229733579540081))
+#define Q31i12j5R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i12j5I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i12j6R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i12j6I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i12j7R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i12j7I static_cast<real_type_t<T>>((0.9680771188662043051530))
+#define Q31i12j8R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i12j8I static_cast<real_type_t<T>>((-0.5712682150947922791574))
+#define Q31i12j9R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i12j9I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i12j10R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i12j10I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i12j11R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i12j11I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i12j12R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i12j12I static_cast<real_type_t<T>>((0.7907757369376985820782))
+#define Q31i12j13R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i12j13I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i12j14R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i12j14I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i12j15R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i12j15I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i13j1R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i13j1I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i13j2R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i13j2I static_cast<real_type_t<T>>((0.8486442574947509504641))
+#define Q31i13j3R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i13j3I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i13j4R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i13j4I static_cast<real_type_t<T>>((0.8978045395707416571368))
+#define Q31i13j5R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i13j5I static_cast<real_type_t<T>>((-0.5712682150947922791574))
+#define Q31i13j6R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i13j6I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i13j7R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i13j7I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i13j8R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i13j8I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i13j9R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i13j9I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i13j10R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i13j10I static_cast<real_type_t<T>>((-0.9377521321470804584292))
+#define Q31i13j11R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i13j11I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i13j12R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i13j12I static_cast<real_type_t<T>>((-0.2012985200886600791415))
+#define Q31i13j13R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i13j13I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i13j14R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i13j14I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i13j15R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i13j15I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i14j1R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i14j1I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i14j2R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i14j2I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i14j3R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i14j3I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i14j4R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i14j4I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i14j5R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i14j5I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+#define Q31i14j6R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i14j6I static_cast<real_type_t<T>>((0.9680771188662043051530))
+#define Q31i14j7R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i14j7I static_cast<real_type_t<T>>((-0.8486442574947509504641))
+#define Q31i14j8R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i14j8I static_cast<real_type_t<T>>((0.6513724827222222074540))
+#define Q31i14j9R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i14j9I static_cast<real_type_t<T>>((-0.3943558551133185801016))
+#define Q31i14j10R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i14j10I static_cast<real_type_t<T>>((0.1011683219874321777860))
+#define Q31i14j11R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i14j11I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i14j12R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i14j12I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i14j13R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i14j13I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i14j14R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i14j14I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i14j15R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i14j15I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i15j1R static_cast<real_type_t<T>>((-0.9948693233918951463214))
+#define Q31i15j1I static_cast<real_type_t<T>>((-0.1011683219874321777860))
+#define Q31i15j2R static_cast<real_type_t<T>>((0.9795299412524944939380))
+#define Q31i15j2I static_cast<real_type_t<T>>((0.2012985200886600791415))
+#define Q31i15j3R static_cast<real_type_t<T>>((-0.9541392564000488514759))
+#define Q31i15j3I static_cast<real_type_t<T>>((-0.2993631229733579540081))
+#define Q31i15j4R static_cast<real_type_t<T>>((0.9189578116202306291272))
+#define Q31i15j4I static_cast<real_type_t<T>>((0.3943558551133185801016))
+#define Q31i15j5R static_cast<real_type_t<T>>((-0.8743466161445821188275))
+#define Q31i15j5I static_cast<real_type_t<T>>((-0.4853019625310810252146))
+#define Q31i15j6R static_cast<real_type_t<T>>((0.8207634412072763263635))
+#define Q31i15j6I static_cast<real_type_t<T>>((0.5712682150947922791574))
+#define Q31i15j7R static_cast<real_type_t<T>>((-0.7587581226927909019133))
+#define Q31i15j7I static_cast<real_type_t<T>>((-0.6513724827222222074540))
+#define Q31i15j8R static_cast<real_type_t<T>>((0.6889669190756865678009))
+#define Q31i15j8I static_cast<real_type_t<T>>((0.7247927872291199588655))
+#define Q31i15j9R static_cast<real_type_t<T>>((-0.6121059825476628441467))
+#define Q31i15j9I static_cast<real_type_t<T>>((-0.7907757369376985820782))
+#define Q31i15j10R static_cast<real_type_t<T>>((0.5289640103269624573655))
+#define Q31i15j10I static_cast<real_type_t<T>>((0.8486442574947509504641))
+#define Q31i15j11R static_cast<real_type_t<T>>((-0.4403941515576343095162))
+#define Q31i15j11I static_cast<real_type_t<T>>((-0.8978045395707416571368))
+#define Q31i15j12R static_cast<real_type_t<T>>((0.3473052528448202855419))
+#define Q31i15j12I static_cast<real_type_t<T>>((0.9377521321470804584292))
+#define Q31i15j13R static_cast<real_type_t<T>>((-0.2506525322587205393148))
+#define Q31i15j13I static_cast<real_type_t<T>>((-0.9680771188662043051530))
+#define Q31i15j14R static_cast<real_type_t<T>>((0.1514277775045766636575))
+#define Q31i15j14I static_cast<real_type_t<T>>((0.9884683243281113991622))
+#define Q31i15j15R static_cast<real_type_t<T>>((-0.05064916883871271227875))
+#define Q31i15j15I static_cast<real_type_t<T>>((-0.9987165071710528071463))
+
+template <typename T>
+__device__ void FwdRad31B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12,
+                           T* R13,
+                           T* R14,
+                           T* R15,
+                           T* R16,
+                           T* R17,
+                           T* R18,
+                           T* R19,
+                           T* R20,
+                           T* R21,
+                           T* R22,
+                           T* R23,
+                           T* R24,
+                           T* R25,
+                           T* R26,
+                           T* R27,
+                           T* R28,
+                           T* R29,
+                           T* R30)
+{
+    T x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20;
+    T x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, dp, dm;
+
+    x0 = (*R0) + (*R1) + (*R2) + (*R3) + (*R4) + (*R5) + (*R6) + (*R7) + (*R8) + (*R9) + (*R10)
+         + (*R11) + (*R12) + (*R13) + (*R14) + (*R15) + (*R16) + (*R17) + (*R18) + (*R19) + (*R20)
+         + (*R21) + (*R22) + (*R23) + (*R24) + (*R25) + (*R26) + (*R27) + (*R28) + (*R29) + (*R30);
+    x1  = (*R0);
+    x2  = (*R0);
+    x3  = (*R0);
+    x4  = (*R0);
+    x5  = (*R0);
+    x6  = (*R0);
+    x7  = (*R0);
+    x8  = (*R0);
+    x9  = (*R0);
+    x10 = (*R0);
+    x11 = (*R0);
+    x12 = (*R0);
+    x13 = (*R0);
+    x14 = (*R0);
+    x15 = (*R0);
+    x16 = (*R0);
+    x17 = (*R0);
+    x18 = (*R0);
+    x19 = (*R0);
+    x20 = (*R0);
+    x21 = (*R0);
+    x22 = (*R0);
+    x23 = (*R0);
+    x24 = (*R0);
+    x25 = (*R0);
+    x26 = (*R0);
+    x27 = (*R0);
+    x28 = (*R0);
+    x29 = (*R0);
+    x30 = (*R0);
+    dp  = (*R1) + (*R30);
+    dm  = (*R1) - (*R30);
+    x1.x += Q31i1j1R * dp.x - Q31i1j1I * dm.y;
+    x1.y += Q31i1j1R * dp.y + Q31i1j1I * dm.x;
+    x30.x += Q31i1j1R * dp.x + Q31i1j1I * dm.y;
+    x30.y += Q31i1j1R * dp.y - Q31i1j1I * dm.x;
+    x2.x += Q31i2j1R * dp.x - Q31i2j1I * dm.y;
+    x2.y += Q31i2j1R * dp.y + Q31i2j1I * dm.x;
+    x29.x += Q31i2j1R * dp.x + Q31i2j1I * dm.y;
+    x29.y += Q31i2j1R * dp.y - Q31i2j1I * dm.x;
+    x3.x += Q31i3j1R * dp.x - Q31i3j1I * dm.y;
+    x3.y += Q31i3j1R * dp.y + Q31i3j1I * dm.x;
+    x28.x += Q31i3j1R * dp.x + Q31i3j1I * dm.y;
+    x28.y += Q31i3j1R * dp.y - Q31i3j1I * dm.x;
+    x4.x += Q31i4j1R * dp.x - Q31i4j1I * dm.y;
+    x4.y += Q31i4j1R * dp.y + Q31i4j1I * dm.x;
+    x27.x += Q31i4j1R * dp.x + Q31i4j1I * dm.y;
+    x27.y += Q31i4j1R * dp.y - Q31i4j1I * dm.x;
+    x5.x += Q31i5j1R * dp.x - Q31i5j1I * dm.y;
+    x5.y += Q31i5j1R * dp.y + Q31i5j1I * dm.x;
+    x26.x += Q31i5j1R * dp.x + Q31i5j1I * dm.y;
+    x26.y += Q31i5j1R * dp.y - Q31i5j1I * dm.x;
+    x6.x += Q31i6j1R * dp.x - Q31i6j1I * dm.y;
+    x6.y += Q31i6j1R * dp.y + Q31i6j1I * dm.x;
+    x25.x += Q31i6j1R * dp.x + Q31i6j1I * dm.y;
+    x25.y += Q31i6j1R * dp.y - Q31i6j1I * dm.x;
+    x7.x += Q31i7j1R * dp.x - Q31i7j1I * dm.y;
+    x7.y += Q31i7j1R * dp.y + Q31i7j1I * dm.x;
+    x24.x += Q31i7j1R * dp.x + Q31i7j1I * dm.y;
+    x24.y += Q31i7j1R * dp.y - Q31i7j1I * dm.x;
+    x8.x += Q31i8j1R * dp.x - Q31i8j1I * dm.y;
+    x8.y += Q31i8j1R * dp.y + Q31i8j1I * dm.x;
+    x23.x += Q31i8j1R * dp.x + Q31i8j1I * dm.y;
+    x23.y += Q31i8j1R * dp.y - Q31i8j1I * dm.x;
+    x9.x += Q31i9j1R * dp.x - Q31i9j1I * dm.y;
+    x9.y += Q31i9j1R * dp.y + Q31i9j1I * dm.x;
+    x22.x += Q31i9j1R * dp.x + Q31i9j1I * dm.y;
+    x22.y += Q31i9j1R * dp.y - Q31i9j1I * dm.x;
+    x10.x += Q31i10j1R * dp.x - Q31i10j1I * dm.y;
+    x10.y += Q31i10j1R * dp.y + Q31i10j1I * dm.x;
+    x21.x += Q31i10j1R * dp.x + Q31i10j1I * dm.y;
+    x21.y += Q31i10j1R * dp.y - Q31i10j1I * dm.x;
+    x11.x += Q31i11j1R * dp.x - Q31i11j1I * dm.y;
+    x11.y += Q31i11j1R * dp.y + Q31i11j1I * dm.x;
+    x20.x += Q31i11j1R * dp.x + Q31i11j1I * dm.y;
+    x20.y += Q31i11j1R * dp.y - Q31i11j1I * dm.x;
+    x12.x += Q31i12j1R * dp.x - Q31i12j1I * dm.y;
+    x12.y += Q31i12j1R * dp.y + Q31i12j1I * dm.x;
+    x19.x += Q31i12j1R * dp.x + Q31i12j1I * dm.y;
+    x19.y += Q31i12j1R * dp.y - Q31i12j1I * dm.x;
+    x13.x += Q31i13j1R * dp.x - Q31i13j1I * dm.y;
+    x13.y += Q31i13j1R * dp.y + Q31i13j1I * dm.x;
+    x18.x += Q31i13j1R * dp.x + Q31i13j1I * dm.y;
+    x18.y += Q31i13j1R * dp.y - Q31i13j1I * dm.x;
+    x14.x += Q31i14j1R * dp.x - Q31i14j1I * dm.y;
+    x14.y += Q31i14j1R * dp.y + Q31i14j1I * dm.x;
+    x17.x += Q31i14j1R * dp.x + Q31i14j1I * dm.y;
+    x17.y += Q31i14j1R * dp.y - Q31i14j1I * dm.x;
+    x15.x += Q31i15j1R * dp.x - Q31i15j1I * dm.y;
+    x15.y += Q31i15j1R * dp.y + Q31i15j1I * dm.x;
+    x16.x += Q31i15j1R * dp.x + Q31i15j1I * dm.y;
+    x16.y += Q31i15j1R * dp.y - Q31i15j1I * dm.x;
+    dp = (*R2) + (*R29);
+    dm = (*R2) - (*R29);
+    x1.x += Q31i1j2R * dp.x - Q31i1j2I * dm.y;
+    x1.y += Q31i1j2R * dp.y + Q31i1j2I * dm.x;
+    x30.x += Q31i1j2R * dp.x + Q31i1j2I * dm.y;
+    x30.y += Q31i1j2R * dp.y - Q31i1j2I * dm.x;
+    x2.x += Q31i2j2R * dp.x - Q31i2j2I * dm.y;
+    x2.y += Q31i2j2R * dp.y + Q31i2j2I * dm.x;
+    x29.x += Q31i2j2R * dp.x + Q31i2j2I * dm.y;
+    x29.y += Q31i2j2R * dp.y - Q31i2j2I * dm.x;
+    x3.x += Q31i3j2R * dp.x - Q31i3j2I * dm.y;
+    x3.y += Q31i3j2R * dp.y + Q31i3j2I * dm.x;
+    x28.x += Q31i3j2R * dp.x + Q31i3j2I * dm.y;
+    x28.y += Q31i3j2R * dp.y - Q31i3j2I * dm.x;
+    x4.x += Q31i4j2R * dp.x - Q31i4j2I * dm.y;
+    x4.y += Q31i4j2R * dp.y + Q31i4j2I * dm.x;
+    x27.x += Q31i4j2R * dp.x + Q31i4j2I * dm.y;
+    x27.y += Q31i4j2R * dp.y - Q31i4j2I * dm.x;
+    x5.x += Q31i5j2R * dp.x - Q31i5j2I * dm.y;
+    x5.y += Q31i5j2R * dp.y + Q31i5j2I * dm.x;
+    x26.x += Q31i5j2R * dp.x + Q31i5j2I * dm.y;
+    x26.y += Q31i5j2R * dp.y - Q31i5j2I * dm.x;
+    x6.x += Q31i6j2R * dp.x - Q31i6j2I * dm.y;
+    x6.y += Q31i6j2R * dp.y + Q31i6j2I * dm.x;
+    x25.x += Q31i6j2R * dp.x + Q31i6j2I * dm.y;
+    x25.y += Q31i6j2R * dp.y - Q31i6j2I * dm.x;
+    x7.x += Q31i7j2R * dp.x - Q31i7j2I * dm.y;
+    x7.y += Q31i7j2R * dp.y + Q31i7j2I * dm.x;
+    x24.x += Q31i7j2R * dp.x + Q31i7j2I * dm.y;
+    x24.y += Q31i7j2R * dp.y - Q31i7j2I * dm.x;
+    x8.x += Q31i8j2R * dp.x - Q31i8j2I * dm.y;
+    x8.y += Q31i8j2R * dp.y + Q31i8j2I * dm.x;
+    x23.x += Q31i8j2R * dp.x + Q31i8j2I * dm.y;
+    x23.y += Q31i8j2R * dp.y - Q31i8j2I * dm.x;
+    x9.x += Q31i9j2R * dp.x - Q31i9j2I * dm.y;
+    x9.y += Q31i9j2R * dp.y + Q31i9j2I * dm.x;
+    x22.x += Q31i9j2R * dp.x + Q31i9j2I * dm.y;
+    x22.y += Q31i9j2R * dp.y - Q31i9j2I * dm.x;
+    x10.x += Q31i10j2R * dp.x - Q31i10j2I * dm.y;
+    x10.y += Q31i10j2R * dp.y + Q31i10j2I * dm.x;
+    x21.x += Q31i10j2R * dp.x + Q31i10j2I * dm.y;
+    x21.y += Q31i10j2R * dp.y - Q31i10j2I * dm.x;
+    x11.x += Q31i11j2R * dp.x - Q31i11j2I * dm.y;
+    x11.y += Q31i11j2R * dp.y + Q31i11j2I * dm.x;
+    x20.x += Q31i11j2R * dp.x + Q31i11j2I * dm.y;
+    x20.y += Q31i11j2R * dp.y - Q31i11j2I * dm.x;
+    x12.x += Q31i12j2R * dp.x - Q31i12j2I * dm.y;
+    x12.y += Q31i12j2R * dp.y + Q31i12j2I * dm.x;
+    x19.x += Q31i12j2R * dp.x + Q31i12j2I * dm.y;
+    x19.y += Q31i12j2R * dp.y - Q31i12j2I * dm.x;
+    x13.x += Q31i13j2R * dp.x - Q31i13j2I * dm.y;
+    x13.y += Q31i13j2R * dp.y + Q31i13j2I * dm.x;
+    x18.x += Q31i13j2R * dp.x + Q31i13j2I * dm.y;
+    x18.y += Q31i13j2R * dp.y - Q31i13j2I * dm.x;
+    x14.x += Q31i14j2R * dp.x - Q31i14j2I * dm.y;
+    x14.y += Q31i14j2R * dp.y + Q31i14j2I * dm.x;
+    x17.x += Q31i14j2R * dp.x + Q31i14j2I * dm.y;
+    x17.y += Q31i14j2R * dp.y - Q31i14j2I * dm.x;
+    x15.x += Q31i15j2R * dp.x - Q31i15j2I * dm.y;
+    x15.y += Q31i15j2R * dp.y + Q31i15j2I * dm.x;
+    x16.x += Q31i15j2R * dp.x + Q31i15j2I * dm.y;
+    x16.y += Q31i15j2R * dp.y - Q31i15j2I * dm.x;
+    dp = (*R3) + (*R28);
+    dm = (*R3) - (*R28);
+    x1.x += Q31i1j3R * dp.x - Q31i1j3I * dm.y;
+    x1.y += Q31i1j3R * dp.y + Q31i1j3I * dm.x;
+    x30.x += Q31i1j3R * dp.x + Q31i1j3I * dm.y;
+    x30.y += Q31i1j3R * dp.y - Q31i1j3I * dm.x;
+    x2.x += Q31i2j3R * dp.x - Q31i2j3I * dm.y;
+    x2.y += Q31i2j3R * dp.y + Q31i2j3I * dm.x;
+    x29.x += Q31i2j3R * dp.x + Q31i2j3I * dm.y;
+    x29.y += Q31i2j3R * dp.y - Q31i2j3I * dm.x;
+    x3.x += Q31i3j3R * dp.x - Q31i3j3I * dm.y;
+    x3.y += Q31i3j3R * dp.y + Q31i3j3I * dm.x;
+    x28.x += Q31i3j3R * dp.x + Q31i3j3I * dm.y;
+    x28.y += Q31i3j3R * dp.y - Q31i3j3I * dm.x;
+    x4.x += Q31i4j3R * dp.x - Q31i4j3I * dm.y;
+    x4.y += Q31i4j3R * dp.y + Q31i4j3I * dm.x;
+    x27.x += Q31i4j3R * dp.x + Q31i4j3I * dm.y;
+    x27.y += Q31i4j3R * dp.y - Q31i4j3I * dm.x;
+    x5.x += Q31i5j3R * dp.x - Q31i5j3I * dm.y;
+    x5.y += Q31i5j3R * dp.y + Q31i5j3I * dm.x;
+    x26.x += Q31i5j3R * dp.x + Q31i5j3I * dm.y;
+    x26.y += Q31i5j3R * dp.y - Q31i5j3I * dm.x;
+    x6.x += Q31i6j3R * dp.x - Q31i6j3I * dm.y;
+    x6.y += Q31i6j3R * dp.y + Q31i6j3I * dm.x;
+    x25.x += Q31i6j3R * dp.x + Q31i6j3I * dm.y;
+    x25.y += Q31i6j3R * dp.y - Q31i6j3I * dm.x;
+    x7.x += Q31i7j3R * dp.x - Q31i7j3I * dm.y;
+    x7.y += Q31i7j3R * dp.y + Q31i7j3I * dm.x;
+    x24.x += Q31i7j3R * dp.x + Q31i7j3I * dm.y;
+    x24.y += Q31i7j3R * dp.y - Q31i7j3I * dm.x;
+    x8.x += Q31i8j3R * dp.x - Q31i8j3I * dm.y;
+    x8.y += Q31i8j3R * dp.y + Q31i8j3I * dm.x;
+    x23.x += Q31i8j3R * dp.x + Q31i8j3I * dm.y;
+    x23.y += Q31i8j3R * dp.y - Q31i8j3I * dm.x;
+    x9.x += Q31i9j3R * dp.x - Q31i9j3I * dm.y;
+    x9.y += Q31i9j3R * dp.y + Q31i9j3I * dm.x;
+    x22.x += Q31i9j3R * dp.x + Q31i9j3I * dm.y;
+    x22.y += Q31i9j3R * dp.y - Q31i9j3I * dm.x;
+    x10.x += Q31i10j3R * dp.x - Q31i10j3I * dm.y;
+    x10.y += Q31i10j3R * dp.y + Q31i10j3I * dm.x;
+    x21.x += Q31i10j3R * dp.x + Q31i10j3I * dm.y;
+    x21.y += Q31i10j3R * dp.y - Q31i10j3I * dm.x;
+    x11.x += Q31i11j3R * dp.x - Q31i11j3I * dm.y;
+    x11.y += Q31i11j3R * dp.y + Q31i11j3I * dm.x;
+    x20.x += Q31i11j3R * dp.x + Q31i11j3I * dm.y;
+    x20.y += Q31i11j3R * dp.y - Q31i11j3I * dm.x;
+    x12.x += Q31i12j3R * dp.x - Q31i12j3I * dm.y;
+    x12.y += Q31i12j3R * dp.y + Q31i12j3I * dm.x;
+    x19.x += Q31i12j3R * dp.x + Q31i12j3I * dm.y;
+    x19.y += Q31i12j3R * dp.y - Q31i12j3I * dm.x;
+    x13.x += Q31i13j3R * dp.x - Q31i13j3I * dm.y;
+    x13.y += Q31i13j3R * dp.y + Q31i13j3I * dm.x;
+    x18.x += Q31i13j3R * dp.x + Q31i13j3I * dm.y;
+    x18.y += Q31i13j3R * dp.y - Q31i13j3I * dm.x;
+    x14.x += Q31i14j3R * dp.x - Q31i14j3I * dm.y;
+    x14.y += Q31i14j3R * dp.y + Q31i14j3I * dm.x;
+    x17.x += Q31i14j3R * dp.x + Q31i14j3I * dm.y;
+    x17.y += Q31i14j3R * dp.y - Q31i14j3I * dm.x;
+    x15.x += Q31i15j3R * dp.x - Q31i15j3I * dm.y;
+    x15.y += Q31i15j3R * dp.y + Q31i15j3I * dm.x;
+    x16.x += Q31i15j3R * dp.x + Q31i15j3I * dm.y;
+    x16.y += Q31i15j3R * dp.y - Q31i15j3I * dm.x;
+    dp = (*R4) + (*R27);
+    dm = (*R4) - (*R27);
+    x1.x += Q31i1j4R * dp.x - Q31i1j4I * dm.y;
+    x1.y += Q31i1j4R * dp.y + Q31i1j4I * dm.x;
+    x30.x += Q31i1j4R * dp.x + Q31i1j4I * dm.y;
+    x30.y += Q31i1j4R * dp.y - Q31i1j4I * dm.x;
+    x2.x += Q31i2j4R * dp.x - Q31i2j4I * dm.y;
+    x2.y += Q31i2j4R * dp.y + Q31i2j4I * dm.x;
+    x29.x += Q31i2j4R * dp.x + Q31i2j4I * dm.y;
+    x29.y += Q31i2j4R * dp.y - Q31i2j4I * dm.x;
+    x3.x += Q31i3j4R * dp.x - Q31i3j4I * dm.y;
+    x3.y += Q31i3j4R * dp.y + Q31i3j4I * dm.x;
+    x28.x += Q31i3j4R * dp.x + Q31i3j4I * dm.y;
+    x28.y += Q31i3j4R * dp.y - Q31i3j4I * dm.x;
+    x4.x += Q31i4j4R * dp.x - Q31i4j4I * dm.y;
+    x4.y += Q31i4j4R * dp.y + Q31i4j4I * dm.x;
+    x27.x += Q31i4j4R * dp.x + Q31i4j4I * dm.y;
+    x27.y += Q31i4j4R * dp.y - Q31i4j4I * dm.x;
+    x5.x += Q31i5j4R * dp.x - Q31i5j4I * dm.y;
+    x5.y += Q31i5j4R * dp.y + Q31i5j4I * dm.x;
+    x26.x += Q31i5j4R * dp.x + Q31i5j4I * dm.y;
+    x26.y += Q31i5j4R * dp.y - Q31i5j4I * dm.x;
+    x6.x += Q31i6j4R * dp.x - Q31i6j4I * dm.y;
+    x6.y += Q31i6j4R * dp.y + Q31i6j4I * dm.x;
+    x25.x += Q31i6j4R * dp.x + Q31i6j4I * dm.y;
+    x25.y += Q31i6j4R * dp.y - Q31i6j4I * dm.x;
+    x7.x += Q31i7j4R * dp.x - Q31i7j4I * dm.y;
+    x7.y += Q31i7j4R * dp.y + Q31i7j4I * dm.x;
+    x24.x += Q31i7j4R * dp.x + Q31i7j4I * dm.y;
+    x24.y += Q31i7j4R * dp.y - Q31i7j4I * dm.x;
+    x8.x += Q31i8j4R * dp.x - Q31i8j4I * dm.y;
+    x8.y += Q31i8j4R * dp.y + Q31i8j4I * dm.x;
+    x23.x += Q31i8j4R * dp.x + Q31i8j4I * dm.y;
+    x23.y += Q31i8j4R * dp.y - Q31i8j4I * dm.x;
+    x9.x += Q31i9j4R * dp.x - Q31i9j4I * dm.y;
+    x9.y += Q31i9j4R * dp.y + Q31i9j4I * dm.x;
+    x22.x += Q31i9j4R * dp.x + Q31i9j4I * dm.y;
+    x22.y += Q31i9j4R * dp.y - Q31i9j4I * dm.x;
+    x10.x += Q31i10j4R * dp.x - Q31i10j4I * dm.y;
+    x10.y += Q31i10j4R * dp.y + Q31i10j4I * dm.x;
+    x21.x += Q31i10j4R * dp.x + Q31i10j4I * dm.y;
+    x21.y += Q31i10j4R * dp.y - Q31i10j4I * dm.x;
+    x11.x += Q31i11j4R * dp.x - Q31i11j4I * dm.y;
+    x11.y += Q31i11j4R * dp.y + Q31i11j4I * dm.x;
+    x20.x += Q31i11j4R * dp.x + Q31i11j4I * dm.y;
+    x20.y += Q31i11j4R * dp.y - Q31i11j4I * dm.x;
+    x12.x += Q31i12j4R * dp.x - Q31i12j4I * dm.y;
+    x12.y += Q31i12j4R * dp.y + Q31i12j4I * dm.x;
+    x19.x += Q31i12j4R * dp.x + Q31i12j4I * dm.y;
+    x19.y += Q31i12j4R * dp.y - Q31i12j4I * dm.x;
+    x13.x += Q31i13j4R * dp.x - Q31i13j4I * dm.y;
+    x13.y += Q31i13j4R * dp.y + Q31i13j4I * dm.x;
+    x18.x += Q31i13j4R * dp.x + Q31i13j4I * dm.y;
+    x18.y += Q31i13j4R * dp.y - Q31i13j4I * dm.x;
+    x14.x += Q31i14j4R * dp.x - Q31i14j4I * dm.y;
+    x14.y += Q31i14j4R * dp.y + Q31i14j4I * dm.x;
+    x17.x += Q31i14j4R * dp.x + Q31i14j4I * dm.y;
+    x17.y += Q31i14j4R * dp.y - Q31i14j4I * dm.x;
+    x15.x += Q31i15j4R * dp.x - Q31i15j4I * dm.y;
+    x15.y += Q31i15j4R * dp.y + Q31i15j4I * dm.x;
+    x16.x += Q31i15j4R * dp.x + Q31i15j4I * dm.y;
+    x16.y += Q31i15j4R * dp.y - Q31i15j4I * dm.x;
+    dp = (*R5) + (*R26);
+    dm = (*R5) - (*R26);
+    x1.x += Q31i1j5R * dp.x - Q31i1j5I * dm.y;
+    x1.y += Q31i1j5R * dp.y + Q31i1j5I * dm.x;
+    x30.x += Q31i1j5R * dp.x + Q31i1j5I * dm.y;
+    x30.y += Q31i1j5R * dp.y - Q31i1j5I * dm.x;
+    x2.x += Q31i2j5R * dp.x - Q31i2j5I * dm.y;
+    x2.y += Q31i2j5R * dp.y + Q31i2j5I * dm.x;
+    x29.x += Q31i2j5R * dp.x + Q31i2j5I * dm.y;
+    x29.y += Q31i2j5R * dp.y - Q31i2j5I * dm.x;
+    x3.x += Q31i3j5R * dp.x - Q31i3j5I * dm.y;
+    x3.y += Q31i3j5R * dp.y + Q31i3j5I * dm.x;
+    x28.x += Q31i3j5R * dp.x + Q31i3j5I * dm.y;
+    x28.y += Q31i3j5R * dp.y - Q31i3j5I * dm.x;
+    x4.x += Q31i4j5R * dp.x - Q31i4j5I * dm.y;
+    x4.y += Q31i4j5R * dp.y + Q31i4j5I * dm.x;
+    x27.x += Q31i4j5R * dp.x + Q31i4j5I * dm.y;
+    x27.y += Q31i4j5R * dp.y - Q31i4j5I * dm.x;
+    x5.x += Q31i5j5R * dp.x - Q31i5j5I * dm.y;
+    x5.y += Q31i5j5R * dp.y + Q31i5j5I * dm.x;
+    x26.x += Q31i5j5R * dp.x + Q31i5j5I * dm.y;
+    x26.y += Q31i5j5R * dp.y - Q31i5j5I * dm.x;
+    x6.x += Q31i6j5R * dp.x - Q31i6j5I * dm.y;
+    x6.y += Q31i6j5R * dp.y + Q31i6j5I * dm.x;
+    x25.x += Q31i6j5R * dp.x + Q31i6j5I * dm.y;
+    x25.y += Q31i6j5R * dp.y - Q31i6j5I * dm.x;
+    x7.x += Q31i7j5R * dp.x - Q31i7j5I * dm.y;
+    x7.y += Q31i7j5R * dp.y + Q31i7j5I * dm.x;
+    x24.x += Q31i7j5R * dp.x + Q31i7j5I * dm.y;
+    x24.y += Q31i7j5R * dp.y - Q31i7j5I * dm.x;
+    x8.x += Q31i8j5R * dp.x - Q31i8j5I * dm.y;
+    x8.y += Q31i8j5R * dp.y + Q31i8j5I * dm.x;
+    x23.x += Q31i8j5R * dp.x + Q31i8j5I * dm.y;
+    x23.y += Q31i8j5R * dp.y - Q31i8j5I * dm.x;
+    x9.x += Q31i9j5R * dp.x - Q31i9j5I * dm.y;
+    x9.y += Q31i9j5R * dp.y + Q31i9j5I * dm.x;
+    x22.x += Q31i9j5R * dp.x + Q31i9j5I * dm.y;
+    x22.y += Q31i9j5R * dp.y - Q31i9j5I * dm.x;
+    x10.x += Q31i10j5R * dp.x - Q31i10j5I * dm.y;
+    x10.y += Q31i10j5R * dp.y + Q31i10j5I * dm.x;
+    x21.x += Q31i10j5R * dp.x + Q31i10j5I * dm.y;
+    x21.y += Q31i10j5R * dp.y - Q31i10j5I * dm.x;
+    x11.x += Q31i11j5R * dp.x - Q31i11j5I * dm.y;
+    x11.y += Q31i11j5R * dp.y + Q31i11j5I * dm.x;
+    x20.x += Q31i11j5R * dp.x + Q31i11j5I * dm.y;
+    x20.y += Q31i11j5R * dp.y - Q31i11j5I * dm.x;
+    x12.x += Q31i12j5R * dp.x - Q31i12j5I * dm.y;
+    x12.y += Q31i12j5R * dp.y + Q31i12j5I * dm.x;
+    x19.x += Q31i12j5R * dp.x + Q31i12j5I * dm.y;
+    x19.y += Q31i12j5R * dp.y - Q31i12j5I * dm.x;
+    x13.x += Q31i13j5R * dp.x - Q31i13j5I * dm.y;
+    x13.y += Q31i13j5R * dp.y + Q31i13j5I * dm.x;
+    x18.x += Q31i13j5R * dp.x + Q31i13j5I * dm.y;
+    x18.y += Q31i13j5R * dp.y - Q31i13j5I * dm.x;
+    x14.x += Q31i14j5R * dp.x - Q31i14j5I * dm.y;
+    x14.y += Q31i14j5R * dp.y + Q31i14j5I * dm.x;
+    x17.x += Q31i14j5R * dp.x + Q31i14j5I * dm.y;
+    x17.y += Q31i14j5R * dp.y - Q31i14j5I * dm.x;
+    x15.x += Q31i15j5R * dp.x - Q31i15j5I * dm.y;
+    x15.y += Q31i15j5R * dp.y + Q31i15j5I * dm.x;
+    x16.x += Q31i15j5R * dp.x + Q31i15j5I * dm.y;
+    x16.y += Q31i15j5R * dp.y - Q31i15j5I * dm.x;
+    dp = (*R6) + (*R25);
+    dm = (*R6) - (*R25);
+    x1.x += Q31i1j6R * dp.x - Q31i1j6I * dm.y;
+    x1.y += Q31i1j6R * dp.y + Q31i1j6I * dm.x;
+    x30.x += Q31i1j6R * dp.x + Q31i1j6I * dm.y;
+    x30.y += Q31i1j6R * dp.y - Q31i1j6I * dm.x;
+    x2.x += Q31i2j6R * dp.x - Q31i2j6I * dm.y;
+    x2.y += Q31i2j6R * dp.y + Q31i2j6I * dm.x;
+    x29.x += Q31i2j6R * dp.x + Q31i2j6I * dm.y;
+    x29.y += Q31i2j6R * dp.y - Q31i2j6I * dm.x;
+    x3.x += Q31i3j6R * dp.x - Q31i3j6I * dm.y;
+    x3.y += Q31i3j6R * dp.y + Q31i3j6I * dm.x;
+    x28.x += Q31i3j6R * dp.x + Q31i3j6I * dm.y;
+    x28.y += Q31i3j6R * dp.y - Q31i3j6I * dm.x;
+    x4.x += Q31i4j6R * dp.x - Q31i4j6I * dm.y;
+    x4.y += Q31i4j6R * dp.y + Q31i4j6I * dm.x;
+    x27.x += Q31i4j6R * dp.x + Q31i4j6I * dm.y;
+    x27.y += Q31i4j6R * dp.y - Q31i4j6I * dm.x;
+    x5.x += Q31i5j6R * dp.x - Q31i5j6I * dm.y;
+    x5.y += Q31i5j6R * dp.y + Q31i5j6I * dm.x;
+    x26.x += Q31i5j6R * dp.x + Q31i5j6I * dm.y;
+    x26.y += Q31i5j6R * dp.y - Q31i5j6I * dm.x;
+    x6.x += Q31i6j6R * dp.x - Q31i6j6I * dm.y;
+    x6.y += Q31i6j6R * dp.y + Q31i6j6I * dm.x;
+    x25.x += Q31i6j6R * dp.x + Q31i6j6I * dm.y;
+    x25.y += Q31i6j6R * dp.y - Q31i6j6I * dm.x;
+    x7.x += Q31i7j6R * dp.x - Q31i7j6I * dm.y;
+    x7.y += Q31i7j6R * dp.y + Q31i7j6I * dm.x;
+    x24.x += Q31i7j6R * dp.x + Q31i7j6I * dm.y;
+    x24.y += Q31i7j6R * dp.y - Q31i7j6I * dm.x;
+    x8.x += Q31i8j6R * dp.x - Q31i8j6I * dm.y;
+    x8.y += Q31i8j6R * dp.y + Q31i8j6I * dm.x;
+    x23.x += Q31i8j6R * dp.x + Q31i8j6I * dm.y;
+    x23.y += Q31i8j6R * dp.y - Q31i8j6I * dm.x;
+    x9.x += Q31i9j6R * dp.x - Q31i9j6I * dm.y;
+    x9.y += Q31i9j6R * dp.y + Q31i9j6I * dm.x;
+    x22.x += Q31i9j6R * dp.x + Q31i9j6I * dm.y;
+    x22.y += Q31i9j6R * dp.y - Q31i9j6I * dm.x;
+    x10.x += Q31i10j6R * dp.x - Q31i10j6I * dm.y;
+    x10.y += Q31i10j6R * dp.y + Q31i10j6I * dm.x;
+    x21.x += Q31i10j6R * dp.x + Q31i10j6I * dm.y;
+    x21.y += Q31i10j6R * dp.y - Q31i10j6I * dm.x;
+    x11.x += Q31i11j6R * dp.x - Q31i11j6I * dm.y;
+    x11.y += Q31i11j6R * dp.y + Q31i11j6I * dm.x;
+    x20.x += Q31i11j6R * dp.x + Q31i11j6I * dm.y;
+    x20.y += Q31i11j6R * dp.y - Q31i11j6I * dm.x;
+    x12.x += Q31i12j6R * dp.x - Q31i12j6I * dm.y;
+    x12.y += Q31i12j6R * dp.y + Q31i12j6I * dm.x;
+    x19.x += Q31i12j6R * dp.x + Q31i12j6I * dm.y;
+    x19.y += Q31i12j6R * dp.y - Q31i12j6I * dm.x;
+    x13.x += Q31i13j6R * dp.x - Q31i13j6I * dm.y;
+    x13.y += Q31i13j6R * dp.y + Q31i13j6I * dm.x;
+    x18.x += Q31i13j6R * dp.x + Q31i13j6I * dm.y;
+    x18.y += Q31i13j6R * dp.y - Q31i13j6I * dm.x;
+    x14.x += Q31i14j6R * dp.x - Q31i14j6I * dm.y;
+    x14.y += Q31i14j6R * dp.y + Q31i14j6I * dm.x;
+    x17.x += Q31i14j6R * dp.x + Q31i14j6I * dm.y;
+    x17.y += Q31i14j6R * dp.y - Q31i14j6I * dm.x;
+    x15.x += Q31i15j6R * dp.x - Q31i15j6I * dm.y;
+    x15.y += Q31i15j6R * dp.y + Q31i15j6I * dm.x;
+    x16.x += Q31i15j6R * dp.x + Q31i15j6I * dm.y;
+    x16.y += Q31i15j6R * dp.y - Q31i15j6I * dm.x;
+    dp = (*R7) + (*R24);
+    dm = (*R7) - (*R24);
+    x1.x += Q31i1j7R * dp.x - Q31i1j7I * dm.y;
+    x1.y += Q31i1j7R * dp.y + Q31i1j7I * dm.x;
+    x30.x += Q31i1j7R * dp.x + Q31i1j7I * dm.y;
+    x30.y += Q31i1j7R * dp.y - Q31i1j7I * dm.x;
+    x2.x += Q31i2j7R * dp.x - Q31i2j7I * dm.y;
+    x2.y += Q31i2j7R * dp.y + Q31i2j7I * dm.x;
+    x29.x += Q31i2j7R * dp.x + Q31i2j7I * dm.y;
+    x29.y += Q31i2j7R * dp.y - Q31i2j7I * dm.x;
+    x3.x += Q31i3j7R * dp.x - Q31i3j7I * dm.y;
+    x3.y += Q31i3j7R * dp.y + Q31i3j7I * dm.x;
+    x28.x += Q31i3j7R * dp.x + Q31i3j7I * dm.y;
+    x28.y += Q31i3j7R * dp.y - Q31i3j7I * dm.x;
+    x4.x += Q31i4j7R * dp.x - Q31i4j7I * dm.y;
+    x4.y += Q31i4j7R * dp.y + Q31i4j7I * dm.x;
+    x27.x += Q31i4j7R * dp.x + Q31i4j7I * dm.y;
+    x27.y += Q31i4j7R * dp.y - Q31i4j7I * dm.x;
+    x5.x += Q31i5j7R * dp.x - Q31i5j7I * dm.y;
+    x5.y += Q31i5j7R * dp.y + Q31i5j7I * dm.x;
+    x26.x += Q31i5j7R * dp.x + Q31i5j7I * dm.y;
+    x26.y += Q31i5j7R * dp.y - Q31i5j7I * dm.x;
+    x6.x += Q31i6j7R * dp.x - Q31i6j7I * dm.y;
+    x6.y += Q31i6j7R * dp.y + Q31i6j7I * dm.x;
+    x25.x += Q31i6j7R * dp.x + Q31i6j7I * dm.y;
+    x25.y += Q31i6j7R * dp.y - Q31i6j7I * dm.x;
+    x7.x += Q31i7j7R * dp.x - Q31i7j7I * dm.y;
+    x7.y += Q31i7j7R * dp.y + Q31i7j7I * dm.x;
+    x24.x += Q31i7j7R * dp.x + Q31i7j7I * dm.y;
+    x24.y += Q31i7j7R * dp.y - Q31i7j7I * dm.x;
+    x8.x += Q31i8j7R * dp.x - Q31i8j7I * dm.y;
+    x8.y += Q31i8j7R * dp.y + Q31i8j7I * dm.x;
+    x23.x += Q31i8j7R * dp.x + Q31i8j7I * dm.y;
+    x23.y += Q31i8j7R * dp.y - Q31i8j7I * dm.x;
+    x9.x += Q31i9j7R * dp.x - Q31i9j7I * dm.y;
+    x9.y += Q31i9j7R * dp.y + Q31i9j7I * dm.x;
+    x22.x += Q31i9j7R * dp.x + Q31i9j7I * dm.y;
+    x22.y += Q31i9j7R * dp.y - Q31i9j7I * dm.x;
+    x10.x += Q31i10j7R * dp.x - Q31i10j7I * dm.y;
+    x10.y += Q31i10j7R * dp.y + Q31i10j7I * dm.x;
+    x21.x += Q31i10j7R * dp.x + Q31i10j7I * dm.y;
+    x21.y += Q31i10j7R * dp.y - Q31i10j7I * dm.x;
+    x11.x += Q31i11j7R * dp.x - Q31i11j7I * dm.y;
+    x11.y += Q31i11j7R * dp.y + Q31i11j7I * dm.x;
+    x20.x += Q31i11j7R * dp.x + Q31i11j7I * dm.y;
+    x20.y += Q31i11j7R * dp.y - Q31i11j7I * dm.x;
+    x12.x += Q31i12j7R * dp.x - Q31i12j7I * dm.y;
+    x12.y += Q31i12j7R * dp.y + Q31i12j7I * dm.x;
+    x19.x += Q31i12j7R * dp.x + Q31i12j7I * dm.y;
+    x19.y += Q31i12j7R * dp.y - Q31i12j7I * dm.x;
+    x13.x += Q31i13j7R * dp.x - Q31i13j7I * dm.y;
+    x13.y += Q31i13j7R * dp.y + Q31i13j7I * dm.x;
+    x18.x += Q31i13j7R * dp.x + Q31i13j7I * dm.y;
+    x18.y += Q31i13j7R * dp.y - Q31i13j7I * dm.x;
+    x14.x += Q31i14j7R * dp.x - Q31i14j7I * dm.y;
+    x14.y += Q31i14j7R * dp.y + Q31i14j7I * dm.x;
+    x17.x += Q31i14j7R * dp.x + Q31i14j7I * dm.y;
+    x17.y += Q31i14j7R * dp.y - Q31i14j7I * dm.x;
+    x15.x += Q31i15j7R * dp.x - Q31i15j7I * dm.y;
+    x15.y += Q31i15j7R * dp.y + Q31i15j7I * dm.x;
+    x16.x += Q31i15j7R * dp.x + Q31i15j7I * dm.y;
+    x16.y += Q31i15j7R * dp.y - Q31i15j7I * dm.x;
+    dp = (*R8) + (*R23);
+    dm = (*R8) - (*R23);
+    x1.x += Q31i1j8R * dp.x - Q31i1j8I * dm.y;
+    x1.y += Q31i1j8R * dp.y + Q31i1j8I * dm.x;
+    x30.x += Q31i1j8R * dp.x + Q31i1j8I * dm.y;
+    x30.y += Q31i1j8R * dp.y - Q31i1j8I * dm.x;
+    x2.x += Q31i2j8R * dp.x - Q31i2j8I * dm.y;
+    x2.y += Q31i2j8R * dp.y + Q31i2j8I * dm.x;
+    x29.x += Q31i2j8R * dp.x + Q31i2j8I * dm.y;
+    x29.y += Q31i2j8R * dp.y - Q31i2j8I * dm.x;
+    x3.x += Q31i3j8R * dp.x - Q31i3j8I * dm.y;
+    x3.y += Q31i3j8R * dp.y + Q31i3j8I * dm.x;
+    x28.x += Q31i3j8R * dp.x + Q31i3j8I * dm.y;
+    x28.y += Q31i3j8R * dp.y - Q31i3j8I * dm.x;
+    x4.x += Q31i4j8R * dp.x - Q31i4j8I * dm.y;
+    x4.y += Q31i4j8R * dp.y + Q31i4j8I * dm.x;
+    x27.x += Q31i4j8R * dp.x + Q31i4j8I * dm.y;
+    x27.y += Q31i4j8R * dp.y - Q31i4j8I * dm.x;
+    x5.x += Q31i5j8R * dp.x - Q31i5j8I * dm.y;
+    x5.y += Q31i5j8R * dp.y + Q31i5j8I * dm.x;
+    x26.x += Q31i5j8R * dp.x + Q31i5j8I * dm.y;
+    x26.y += Q31i5j8R * dp.y - Q31i5j8I * dm.x;
+    x6.x += Q31i6j8R * dp.x - Q31i6j8I * dm.y;
+    x6.y += Q31i6j8R * dp.y + Q31i6j8I * dm.x;
+    x25.x += Q31i6j8R * dp.x + Q31i6j8I * dm.y;
+    x25.y += Q31i6j8R * dp.y - Q31i6j8I * dm.x;
+    x7.x += Q31i7j8R * dp.x - Q31i7j8I * dm.y;
+    x7.y += Q31i7j8R * dp.y + Q31i7j8I * dm.x;
+    x24.x += Q31i7j8R * dp.x + Q31i7j8I * dm.y;
+    x24.y += Q31i7j8R * dp.y - Q31i7j8I * dm.x;
+    x8.x += Q31i8j8R * dp.x - Q31i8j8I * dm.y;
+    x8.y += Q31i8j8R * dp.y + Q31i8j8I * dm.x;
+    x23.x += Q31i8j8R * dp.x + Q31i8j8I * dm.y;
+    x23.y += Q31i8j8R * dp.y - Q31i8j8I * dm.x;
+    x9.x += Q31i9j8R * dp.x - Q31i9j8I * dm.y;
+    x9.y += Q31i9j8R * dp.y + Q31i9j8I * dm.x;
+    x22.x += Q31i9j8R * dp.x + Q31i9j8I * dm.y;
+    x22.y += Q31i9j8R * dp.y - Q31i9j8I * dm.x;
+    x10.x += Q31i10j8R * dp.x - Q31i10j8I * dm.y;
+    x10.y += Q31i10j8R * dp.y + Q31i10j8I * dm.x;
+    x21.x += Q31i10j8R * dp.x + Q31i10j8I * dm.y;
+    x21.y += Q31i10j8R * dp.y - Q31i10j8I * dm.x;
+    x11.x += Q31i11j8R * dp.x - Q31i11j8I * dm.y;
+    x11.y += Q31i11j8R * dp.y + Q31i11j8I * dm.x;
+    x20.x += Q31i11j8R * dp.x + Q31i11j8I * dm.y;
+    x20.y += Q31i11j8R * dp.y - Q31i11j8I * dm.x;
+    x12.x += Q31i12j8R * dp.x - Q31i12j8I * dm.y;
+    x12.y += Q31i12j8R * dp.y + Q31i12j8I * dm.x;
+    x19.x += Q31i12j8R * dp.x + Q31i12j8I * dm.y;
+    x19.y += Q31i12j8R * dp.y - Q31i12j8I * dm.x;
+    x13.x += Q31i13j8R * dp.x - Q31i13j8I * dm.y;
+    x13.y += Q31i13j8R * dp.y + Q31i13j8I * dm.x;
+    x18.x += Q31i13j8R * dp.x + Q31i13j8I * dm.y;
+    x18.y += Q31i13j8R * dp.y - Q31i13j8I * dm.x;
+    x14.x += Q31i14j8R * dp.x - Q31i14j8I * dm.y;
+    x14.y += Q31i14j8R * dp.y + Q31i14j8I * dm.x;
+    x17.x += Q31i14j8R * dp.x + Q31i14j8I * dm.y;
+    x17.y += Q31i14j8R * dp.y - Q31i14j8I * dm.x;
+    x15.x += Q31i15j8R * dp.x - Q31i15j8I * dm.y;
+    x15.y += Q31i15j8R * dp.y + Q31i15j8I * dm.x;
+    x16.x += Q31i15j8R * dp.x + Q31i15j8I * dm.y;
+    x16.y += Q31i15j8R * dp.y - Q31i15j8I * dm.x;
+    dp = (*R9) + (*R22);
+    dm = (*R9) - (*R22);
+    x1.x += Q31i1j9R * dp.x - Q31i1j9I * dm.y;
+    x1.y += Q31i1j9R * dp.y + Q31i1j9I * dm.x;
+    x30.x += Q31i1j9R * dp.x + Q31i1j9I * dm.y;
+    x30.y += Q31i1j9R * dp.y - Q31i1j9I * dm.x;
+    x2.x += Q31i2j9R * dp.x - Q31i2j9I * dm.y;
+    x2.y += Q31i2j9R * dp.y + Q31i2j9I * dm.x;
+    x29.x += Q31i2j9R * dp.x + Q31i2j9I * dm.y;
+    x29.y += Q31i2j9R * dp.y - Q31i2j9I * dm.x;
+    x3.x += Q31i3j9R * dp.x - Q31i3j9I * dm.y;
+    x3.y += Q31i3j9R * dp.y + Q31i3j9I * dm.x;
+    x28.x += Q31i3j9R * dp.x + Q31i3j9I * dm.y;
+    x28.y += Q31i3j9R * dp.y - Q31i3j9I * dm.x;
+    x4.x += Q31i4j9R * dp.x - Q31i4j9I * dm.y;
+    x4.y += Q31i4j9R * dp.y + Q31i4j9I * dm.x;
+    x27.x += Q31i4j9R * dp.x + Q31i4j9I * dm.y;
+    x27.y += Q31i4j9R * dp.y - Q31i4j9I * dm.x;
+    x5.x += Q31i5j9R * dp.x - Q31i5j9I * dm.y;
+    x5.y += Q31i5j9R * dp.y + Q31i5j9I * dm.x;
+    x26.x += Q31i5j9R * dp.x + Q31i5j9I * dm.y;
+    x26.y += Q31i5j9R * dp.y - Q31i5j9I * dm.x;
+    x6.x += Q31i6j9R * dp.x - Q31i6j9I * dm.y;
+    x6.y += Q31i6j9R * dp.y + Q31i6j9I * dm.x;
+    x25.x += Q31i6j9R * dp.x + Q31i6j9I * dm.y;
+    x25.y += Q31i6j9R * dp.y - Q31i6j9I * dm.x;
+    x7.x += Q31i7j9R * dp.x - Q31i7j9I * dm.y;
+    x7.y += Q31i7j9R * dp.y + Q31i7j9I * dm.x;
+    x24.x += Q31i7j9R * dp.x + Q31i7j9I * dm.y;
+    x24.y += Q31i7j9R * dp.y - Q31i7j9I * dm.x;
+    x8.x += Q31i8j9R * dp.x - Q31i8j9I * dm.y;
+    x8.y += Q31i8j9R * dp.y + Q31i8j9I * dm.x;
+    x23.x += Q31i8j9R * dp.x + Q31i8j9I * dm.y;
+    x23.y += Q31i8j9R * dp.y - Q31i8j9I * dm.x;
+    x9.x += Q31i9j9R * dp.x - Q31i9j9I * dm.y;
+    x9.y += Q31i9j9R * dp.y + Q31i9j9I * dm.x;
+    x22.x += Q31i9j9R * dp.x + Q31i9j9I * dm.y;
+    x22.y += Q31i9j9R * dp.y - Q31i9j9I * dm.x;
+    x10.x += Q31i10j9R * dp.x - Q31i10j9I * dm.y;
+    x10.y += Q31i10j9R * dp.y + Q31i10j9I * dm.x;
+    x21.x += Q31i10j9R * dp.x + Q31i10j9I * dm.y;
+    x21.y += Q31i10j9R * dp.y - Q31i10j9I * dm.x;
+    x11.x += Q31i11j9R * dp.x - Q31i11j9I * dm.y;
+    x11.y += Q31i11j9R * dp.y + Q31i11j9I * dm.x;
+    x20.x += Q31i11j9R * dp.x + Q31i11j9I * dm.y;
+    x20.y += Q31i11j9R * dp.y - Q31i11j9I * dm.x;
+    x12.x += Q31i12j9R * dp.x - Q31i12j9I * dm.y;
+    x12.y += Q31i12j9R * dp.y + Q31i12j9I * dm.x;
+    x19.x += Q31i12j9R * dp.x + Q31i12j9I * dm.y;
+    x19.y += Q31i12j9R * dp.y - Q31i12j9I * dm.x;
+    x13.x += Q31i13j9R * dp.x - Q31i13j9I * dm.y;
+    x13.y += Q31i13j9R * dp.y + Q31i13j9I * dm.x;
+    x18.x += Q31i13j9R * dp.x + Q31i13j9I * dm.y;
+    x18.y += Q31i13j9R * dp.y - Q31i13j9I * dm.x;
+    x14.x += Q31i14j9R * dp.x - Q31i14j9I * dm.y;
+    x14.y += Q31i14j9R * dp.y + Q31i14j9I * dm.x;
+    x17.x += Q31i14j9R * dp.x + Q31i14j9I * dm.y;
+    x17.y += Q31i14j9R * dp.y - Q31i14j9I * dm.x;
+    x15.x += Q31i15j9R * dp.x - Q31i15j9I * dm.y;
+    x15.y += Q31i15j9R * dp.y + Q31i15j9I * dm.x;
+    x16.x += Q31i15j9R * dp.x + Q31i15j9I * dm.y;
+    x16.y += Q31i15j9R * dp.y - Q31i15j9I * dm.x;
+    dp = (*R10) + (*R21);
+    dm = (*R10) - (*R21);
+    x1.x += Q31i1j10R * dp.x - Q31i1j10I * dm.y;
+    x1.y += Q31i1j10R * dp.y + Q31i1j10I * dm.x;
+    x30.x += Q31i1j10R * dp.x + Q31i1j10I * dm.y;
+    x30.y += Q31i1j10R * dp.y - Q31i1j10I * dm.x;
+    x2.x += Q31i2j10R * dp.x - Q31i2j10I * dm.y;
+    x2.y += Q31i2j10R * dp.y + Q31i2j10I * dm.x;
+    x29.x += Q31i2j10R * dp.x + Q31i2j10I * dm.y;
+    x29.y += Q31i2j10R * dp.y - Q31i2j10I * dm.x;
+    x3.x += Q31i3j10R * dp.x - Q31i3j10I * dm.y;
+    x3.y += Q31i3j10R * dp.y + Q31i3j10I * dm.x;
+    x28.x += Q31i3j10R * dp.x + Q31i3j10I * dm.y;
+    x28.y += Q31i3j10R * dp.y - Q31i3j10I * dm.x;
+    x4.x += Q31i4j10R * dp.x - Q31i4j10I * dm.y;
+    x4.y += Q31i4j10R * dp.y + Q31i4j10I * dm.x;
+    x27.x += Q31i4j10R * dp.x + Q31i4j10I * dm.y;
+    x27.y += Q31i4j10R * dp.y - Q31i4j10I * dm.x;
+    x5.x += Q31i5j10R * dp.x - Q31i5j10I * dm.y;
+    x5.y += Q31i5j10R * dp.y + Q31i5j10I * dm.x;
+    x26.x += Q31i5j10R * dp.x + Q31i5j10I * dm.y;
+    x26.y += Q31i5j10R * dp.y - Q31i5j10I * dm.x;
+    x6.x += Q31i6j10R * dp.x - Q31i6j10I * dm.y;
+    x6.y += Q31i6j10R * dp.y + Q31i6j10I * dm.x;
+    x25.x += Q31i6j10R * dp.x + Q31i6j10I * dm.y;
+    x25.y += Q31i6j10R * dp.y - Q31i6j10I * dm.x;
+    x7.x += Q31i7j10R * dp.x - Q31i7j10I * dm.y;
+    x7.y += Q31i7j10R * dp.y + Q31i7j10I * dm.x;
+    x24.x += Q31i7j10R * dp.x + Q31i7j10I * dm.y;
+    x24.y += Q31i7j10R * dp.y - Q31i7j10I * dm.x;
+    x8.x += Q31i8j10R * dp.x - Q31i8j10I * dm.y;
+    x8.y += Q31i8j10R * dp.y + Q31i8j10I * dm.x;
+    x23.x += Q31i8j10R * dp.x + Q31i8j10I * dm.y;
+    x23.y += Q31i8j10R * dp.y - Q31i8j10I * dm.x;
+    x9.x += Q31i9j10R * dp.x - Q31i9j10I * dm.y;
+    x9.y += Q31i9j10R * dp.y + Q31i9j10I * dm.x;
+    x22.x += Q31i9j10R * dp.x + Q31i9j10I * dm.y;
+    x22.y += Q31i9j10R * dp.y - Q31i9j10I * dm.x;
+    x10.x += Q31i10j10R * dp.x - Q31i10j10I * dm.y;
+    x10.y += Q31i10j10R * dp.y + Q31i10j10I * dm.x;
+    x21.x += Q31i10j10R * dp.x + Q31i10j10I * dm.y;
+    x21.y += Q31i10j10R * dp.y - Q31i10j10I * dm.x;
+    x11.x += Q31i11j10R * dp.x - Q31i11j10I * dm.y;
+    x11.y += Q31i11j10R * dp.y + Q31i11j10I * dm.x;
+    x20.x += Q31i11j10R * dp.x + Q31i11j10I * dm.y;
+    x20.y += Q31i11j10R * dp.y - Q31i11j10I * dm.x;
+    x12.x += Q31i12j10R * dp.x - Q31i12j10I * dm.y;
+    x12.y += Q31i12j10R * dp.y + Q31i12j10I * dm.x;
+    x19.x += Q31i12j10R * dp.x + Q31i12j10I * dm.y;
+    x19.y += Q31i12j10R * dp.y - Q31i12j10I * dm.x;
+    x13.x += Q31i13j10R * dp.x - Q31i13j10I * dm.y;
+    x13.y += Q31i13j10R * dp.y + Q31i13j10I * dm.x;
+    x18.x += Q31i13j10R * dp.x + Q31i13j10I * dm.y;
+    x18.y += Q31i13j10R * dp.y - Q31i13j10I * dm.x;
+    x14.x += Q31i14j10R * dp.x - Q31i14j10I * dm.y;
+    x14.y += Q31i14j10R * dp.y + Q31i14j10I * dm.x;
+    x17.x += Q31i14j10R * dp.x + Q31i14j10I * dm.y;
+    x17.y += Q31i14j10R * dp.y - Q31i14j10I * dm.x;
+    x15.x += Q31i15j10R * dp.x - Q31i15j10I * dm.y;
+    x15.y += Q31i15j10R * dp.y + Q31i15j10I * dm.x;
+    x16.x += Q31i15j10R * dp.x + Q31i15j10I * dm.y;
+    x16.y += Q31i15j10R * dp.y - Q31i15j10I * dm.x;
+    dp = (*R11) + (*R20);
+    dm = (*R11) - (*R20);
+    x1.x += Q31i1j11R * dp.x - Q31i1j11I * dm.y;
+    x1.y += Q31i1j11R * dp.y + Q31i1j11I * dm.x;
+    x30.x += Q31i1j11R * dp.x + Q31i1j11I * dm.y;
+    x30.y += Q31i1j11R * dp.y - Q31i1j11I * dm.x;
+    x2.x += Q31i2j11R * dp.x - Q31i2j11I * dm.y;
+    x2.y += Q31i2j11R * dp.y + Q31i2j11I * dm.x;
+    x29.x += Q31i2j11R * dp.x + Q31i2j11I * dm.y;
+    x29.y += Q31i2j11R * dp.y - Q31i2j11I * dm.x;
+    x3.x += Q31i3j11R * dp.x - Q31i3j11I * dm.y;
+    x3.y += Q31i3j11R * dp.y + Q31i3j11I * dm.x;
+    x28.x += Q31i3j11R * dp.x + Q31i3j11I * dm.y;
+    x28.y += Q31i3j11R * dp.y - Q31i3j11I * dm.x;
+    x4.x += Q31i4j11R * dp.x - Q31i4j11I * dm.y;
+    x4.y += Q31i4j11R * dp.y + Q31i4j11I * dm.x;
+    x27.x += Q31i4j11R * dp.x + Q31i4j11I * dm.y;
+    x27.y += Q31i4j11R * dp.y - Q31i4j11I * dm.x;
+    x5.x += Q31i5j11R * dp.x - Q31i5j11I * dm.y;
+    x5.y += Q31i5j11R * dp.y + Q31i5j11I * dm.x;
+    x26.x += Q31i5j11R * dp.x + Q31i5j11I * dm.y;
+    x26.y += Q31i5j11R * dp.y - Q31i5j11I * dm.x;
+    x6.x += Q31i6j11R * dp.x - Q31i6j11I * dm.y;
+    x6.y += Q31i6j11R * dp.y + Q31i6j11I * dm.x;
+    x25.x += Q31i6j11R * dp.x + Q31i6j11I * dm.y;
+    x25.y += Q31i6j11R * dp.y - Q31i6j11I * dm.x;
+    x7.x += Q31i7j11R * dp.x - Q31i7j11I * dm.y;
+    x7.y += Q31i7j11R * dp.y + Q31i7j11I * dm.x;
+    x24.x += Q31i7j11R * dp.x + Q31i7j11I * dm.y;
+    x24.y += Q31i7j11R * dp.y - Q31i7j11I * dm.x;
+    x8.x += Q31i8j11R * dp.x - Q31i8j11I * dm.y;
+    x8.y += Q31i8j11R * dp.y + Q31i8j11I * dm.x;
+    x23.x += Q31i8j11R * dp.x + Q31i8j11I * dm.y;
+    x23.y += Q31i8j11R * dp.y - Q31i8j11I * dm.x;
+    x9.x += Q31i9j11R * dp.x - Q31i9j11I * dm.y;
+    x9.y += Q31i9j11R * dp.y + Q31i9j11I * dm.x;
+    x22.x += Q31i9j11R * dp.x + Q31i9j11I * dm.y;
+    x22.y += Q31i9j11R * dp.y - Q31i9j11I * dm.x;
+    x10.x += Q31i10j11R * dp.x - Q31i10j11I * dm.y;
+    x10.y += Q31i10j11R * dp.y + Q31i10j11I * dm.x;
+    x21.x += Q31i10j11R * dp.x + Q31i10j11I * dm.y;
+    x21.y += Q31i10j11R * dp.y - Q31i10j11I * dm.x;
+    x11.x += Q31i11j11R * dp.x - Q31i11j11I * dm.y;
+    x11.y += Q31i11j11R * dp.y + Q31i11j11I * dm.x;
+    x20.x += Q31i11j11R * dp.x + Q31i11j11I * dm.y;
+    x20.y += Q31i11j11R * dp.y - Q31i11j11I * dm.x;
+    x12.x += Q31i12j11R * dp.x - Q31i12j11I * dm.y;
+    x12.y += Q31i12j11R * dp.y + Q31i12j11I * dm.x;
+    x19.x += Q31i12j11R * dp.x + Q31i12j11I * dm.y;
+    x19.y += Q31i12j11R * dp.y - Q31i12j11I * dm.x;
+    x13.x += Q31i13j11R * dp.x - Q31i13j11I * dm.y;
+    x13.y += Q31i13j11R * dp.y + Q31i13j11I * dm.x;
+    x18.x += Q31i13j11R * dp.x + Q31i13j11I * dm.y;
+    x18.y += Q31i13j11R * dp.y - Q31i13j11I * dm.x;
+    x14.x += Q31i14j11R * dp.x - Q31i14j11I * dm.y;
+    x14.y += Q31i14j11R * dp.y + Q31i14j11I * dm.x;
+    x17.x += Q31i14j11R * dp.x + Q31i14j11I * dm.y;
+    x17.y += Q31i14j11R * dp.y - Q31i14j11I * dm.x;
+    x15.x += Q31i15j11R * dp.x - Q31i15j11I * dm.y;
+    x15.y += Q31i15j11R * dp.y + Q31i15j11I * dm.x;
+    x16.x += Q31i15j11R * dp.x + Q31i15j11I * dm.y;
+    x16.y += Q31i15j11R * dp.y - Q31i15j11I * dm.x;
+    dp = (*R12) + (*R19);
+    dm = (*R12) - (*R19);
+    x1.x += Q31i1j12R * dp.x - Q31i1j12I * dm.y;
+    x1.y += Q31i1j12R * dp.y + Q31i1j12I * dm.x;
+    x30.x += Q31i1j12R * dp.x + Q31i1j12I * dm.y;
+    x30.y += Q31i1j12R * dp.y - Q31i1j12I * dm.x;
+    x2.x += Q31i2j12R * dp.x - Q31i2j12I * dm.y;
+    x2.y += Q31i2j12R * dp.y + Q31i2j12I * dm.x;
+    x29.x += Q31i2j12R * dp.x + Q31i2j12I * dm.y;
+    x29.y += Q31i2j12R * dp.y - Q31i2j12I * dm.x;
+    x3.x += Q31i3j12R * dp.x - Q31i3j12I * dm.y;
+    x3.y += Q31i3j12R * dp.y + Q31i3j12I * dm.x;
+    x28.x += Q31i3j12R * dp.x + Q31i3j12I * dm.y;
+    x28.y += Q31i3j12R * dp.y - Q31i3j12I * dm.x;
+    x4.x += Q31i4j12R * dp.x - Q31i4j12I * dm.y;
+    x4.y += Q31i4j12R * dp.y + Q31i4j12I * dm.x;
+    x27.x += Q31i4j12R * dp.x + Q31i4j12I * dm.y;
+    x27.y += Q31i4j12R * dp.y - Q31i4j12I * dm.x;
+    x5.x += Q31i5j12R * dp.x - Q31i5j12I * dm.y;
+    x5.y += Q31i5j12R * dp.y + Q31i5j12I * dm.x;
+    x26.x += Q31i5j12R * dp.x + Q31i5j12I * dm.y;
+    x26.y += Q31i5j12R * dp.y - Q31i5j12I * dm.x;
+    x6.x += Q31i6j12R * dp.x - Q31i6j12I * dm.y;
+    x6.y += Q31i6j12R * dp.y + Q31i6j12I * dm.x;
+    x25.x += Q31i6j12R * dp.x + Q31i6j12I * dm.y;
+    x25.y += Q31i6j12R * dp.y - Q31i6j12I * dm.x;
+    x7.x += Q31i7j12R * dp.x - Q31i7j12I * dm.y;
+    x7.y += Q31i7j12R * dp.y + Q31i7j12I * dm.x;
+    x24.x += Q31i7j12R * dp.x + Q31i7j12I * dm.y;
+    x24.y += Q31i7j12R * dp.y - Q31i7j12I * dm.x;
+    x8.x += Q31i8j12R * dp.x - Q31i8j12I * dm.y;
+    x8.y += Q31i8j12R * dp.y + Q31i8j12I * dm.x;
+    x23.x += Q31i8j12R * dp.x + Q31i8j12I * dm.y;
+    x23.y += Q31i8j12R * dp.y - Q31i8j12I * dm.x;
+    x9.x += Q31i9j12R * dp.x - Q31i9j12I * dm.y;
+    x9.y += Q31i9j12R * dp.y + Q31i9j12I * dm.x;
+    x22.x += Q31i9j12R * dp.x + Q31i9j12I * dm.y;
+    x22.y += Q31i9j12R * dp.y - Q31i9j12I * dm.x;
+    x10.x += Q31i10j12R * dp.x - Q31i10j12I * dm.y;
+    x10.y += Q31i10j12R * dp.y + Q31i10j12I * dm.x;
+    x21.x += Q31i10j12R * dp.x + Q31i10j12I * dm.y;
+    x21.y += Q31i10j12R * dp.y - Q31i10j12I * dm.x;
+    x11.x += Q31i11j12R * dp.x - Q31i11j12I * dm.y;
+    x11.y += Q31i11j12R * dp.y + Q31i11j12I * dm.x;
+    x20.x += Q31i11j12R * dp.x + Q31i11j12I * dm.y;
+    x20.y += Q31i11j12R * dp.y - Q31i11j12I * dm.x;
+    x12.x += Q31i12j12R * dp.x - Q31i12j12I * dm.y;
+    x12.y += Q31i12j12R * dp.y + Q31i12j12I * dm.x;
+    x19.x += Q31i12j12R * dp.x + Q31i12j12I * dm.y;
+    x19.y += Q31i12j12R * dp.y - Q31i12j12I * dm.x;
+    x13.x += Q31i13j12R * dp.x - Q31i13j12I * dm.y;
+    x13.y += Q31i13j12R * dp.y + Q31i13j12I * dm.x;
+    x18.x += Q31i13j12R * dp.x + Q31i13j12I * dm.y;
+    x18.y += Q31i13j12R * dp.y - Q31i13j12I * dm.x;
+    x14.x += Q31i14j12R * dp.x - Q31i14j12I * dm.y;
+    x14.y += Q31i14j12R * dp.y + Q31i14j12I * dm.x;
+    x17.x += Q31i14j12R * dp.x + Q31i14j12I * dm.y;
+    x17.y += Q31i14j12R * dp.y - Q31i14j12I * dm.x;
+    x15.x += Q31i15j12R * dp.x - Q31i15j12I * dm.y;
+    x15.y += Q31i15j12R * dp.y + Q31i15j12I * dm.x;
+    x16.x += Q31i15j12R * dp.x + Q31i15j12I * dm.y;
+    x16.y += Q31i15j12R * dp.y - Q31i15j12I * dm.x;
+    dp = (*R13) + (*R18);
+    dm = (*R13) - (*R18);
+    x1.x += Q31i1j13R * dp.x - Q31i1j13I * dm.y;
+    x1.y += Q31i1j13R * dp.y + Q31i1j13I * dm.x;
+    x30.x += Q31i1j13R * dp.x + Q31i1j13I * dm.y;
+    x30.y += Q31i1j13R * dp.y - Q31i1j13I * dm.x;
+    x2.x += Q31i2j13R * dp.x - Q31i2j13I * dm.y;
+    x2.y += Q31i2j13R * dp.y + Q31i2j13I * dm.x;
+    x29.x += Q31i2j13R * dp.x + Q31i2j13I * dm.y;
+    x29.y += Q31i2j13R * dp.y - Q31i2j13I * dm.x;
+    x3.x += Q31i3j13R * dp.x - Q31i3j13I * dm.y;
+    x3.y += Q31i3j13R * dp.y + Q31i3j13I * dm.x;
+    x28.x += Q31i3j13R * dp.x + Q31i3j13I * dm.y;
+    x28.y += Q31i3j13R * dp.y - Q31i3j13I * dm.x;
+    x4.x += Q31i4j13R * dp.x - Q31i4j13I * dm.y;
+    x4.y += Q31i4j13R * dp.y + Q31i4j13I * dm.x;
+    x27.x += Q31i4j13R * dp.x + Q31i4j13I * dm.y;
+    x27.y += Q31i4j13R * dp.y - Q31i4j13I * dm.x;
+    x5.x += Q31i5j13R * dp.x - Q31i5j13I * dm.y;
+    x5.y += Q31i5j13R * dp.y + Q31i5j13I * dm.x;
+    x26.x += Q31i5j13R * dp.x + Q31i5j13I * dm.y;
+    x26.y += Q31i5j13R * dp.y - Q31i5j13I * dm.x;
+    x6.x += Q31i6j13R * dp.x - Q31i6j13I * dm.y;
+    x6.y += Q31i6j13R * dp.y + Q31i6j13I * dm.x;
+    x25.x += Q31i6j13R * dp.x + Q31i6j13I * dm.y;
+    x25.y += Q31i6j13R * dp.y - Q31i6j13I * dm.x;
+    x7.x += Q31i7j13R * dp.x - Q31i7j13I * dm.y;
+    x7.y += Q31i7j13R * dp.y + Q31i7j13I * dm.x;
+    x24.x += Q31i7j13R * dp.x + Q31i7j13I * dm.y;
+    x24.y += Q31i7j13R * dp.y - Q31i7j13I * dm.x;
+    x8.x += Q31i8j13R * dp.x - Q31i8j13I * dm.y;
+    x8.y += Q31i8j13R * dp.y + Q31i8j13I * dm.x;
+    x23.x += Q31i8j13R * dp.x + Q31i8j13I * dm.y;
+    x23.y += Q31i8j13R * dp.y - Q31i8j13I * dm.x;
+    x9.x += Q31i9j13R * dp.x - Q31i9j13I * dm.y;
+    x9.y += Q31i9j13R * dp.y + Q31i9j13I * dm.x;
+    x22.x += Q31i9j13R * dp.x + Q31i9j13I * dm.y;
+    x22.y += Q31i9j13R * dp.y - Q31i9j13I * dm.x;
+    x10.x += Q31i10j13R * dp.x - Q31i10j13I * dm.y;
+    x10.y += Q31i10j13R * dp.y + Q31i10j13I * dm.x;
+    x21.x += Q31i10j13R * dp.x + Q31i10j13I * dm.y;
+    x21.y += Q31i10j13R * dp.y - Q31i10j13I * dm.x;
+    x11.x += Q31i11j13R * dp.x - Q31i11j13I * dm.y;
+    x11.y += Q31i11j13R * dp.y + Q31i11j13I * dm.x;
+    x20.x += Q31i11j13R * dp.x + Q31i11j13I * dm.y;
+    x20.y += Q31i11j13R * dp.y - Q31i11j13I * dm.x;
+    x12.x += Q31i12j13R * dp.x - Q31i12j13I * dm.y;
+    x12.y += Q31i12j13R * dp.y + Q31i12j13I * dm.x;
+    x19.x += Q31i12j13R * dp.x + Q31i12j13I * dm.y;
+    x19.y += Q31i12j13R * dp.y - Q31i12j13I * dm.x;
+    x13.x += Q31i13j13R * dp.x - Q31i13j13I * dm.y;
+    x13.y += Q31i13j13R * dp.y + Q31i13j13I * dm.x;
+    x18.x += Q31i13j13R * dp.x + Q31i13j13I * dm.y;
+    x18.y += Q31i13j13R * dp.y - Q31i13j13I * dm.x;
+    x14.x += Q31i14j13R * dp.x - Q31i14j13I * dm.y;
+    x14.y += Q31i14j13R * dp.y + Q31i14j13I * dm.x;
+    x17.x += Q31i14j13R * dp.x + Q31i14j13I * dm.y;
+    x17.y += Q31i14j13R * dp.y - Q31i14j13I * dm.x;
+    x15.x += Q31i15j13R * dp.x - Q31i15j13I * dm.y;
+    x15.y += Q31i15j13R * dp.y + Q31i15j13I * dm.x;
+    x16.x += Q31i15j13R * dp.x + Q31i15j13I * dm.y;
+    x16.y += Q31i15j13R * dp.y - Q31i15j13I * dm.x;
+    dp = (*R14) + (*R17);
+    dm = (*R14) - (*R17);
+    x1.x += Q31i1j14R * dp.x - Q31i1j14I * dm.y;
+    x1.y += Q31i1j14R * dp.y + Q31i1j14I * dm.x;
+    x30.x += Q31i1j14R * dp.x + Q31i1j14I * dm.y;
+    x30.y += Q31i1j14R * dp.y - Q31i1j14I * dm.x;
+    x2.x += Q31i2j14R * dp.x - Q31i2j14I * dm.y;
+    x2.y += Q31i2j14R * dp.y + Q31i2j14I * dm.x;
+    x29.x += Q31i2j14R * dp.x + Q31i2j14I * dm.y;
+    x29.y += Q31i2j14R * dp.y - Q31i2j14I * dm.x;
+    x3.x += Q31i3j14R * dp.x - Q31i3j14I * dm.y;
+    x3.y += Q31i3j14R * dp.y + Q31i3j14I * dm.x;
+    x28.x += Q31i3j14R * dp.x + Q31i3j14I * dm.y;
+    x28.y += Q31i3j14R * dp.y - Q31i3j14I * dm.x;
+    x4.x += Q31i4j14R * dp.x - Q31i4j14I * dm.y;
+    x4.y += Q31i4j14R * dp.y + Q31i4j14I * dm.x;
+    x27.x += Q31i4j14R * dp.x + Q31i4j14I * dm.y;
+    x27.y += Q31i4j14R * dp.y - Q31i4j14I * dm.x;
+    x5.x += Q31i5j14R * dp.x - Q31i5j14I * dm.y;
+    x5.y += Q31i5j14R * dp.y + Q31i5j14I * dm.x;
+    x26.x += Q31i5j14R * dp.x + Q31i5j14I * dm.y;
+    x26.y += Q31i5j14R * dp.y - Q31i5j14I * dm.x;
+    x6.x += Q31i6j14R * dp.x - Q31i6j14I * dm.y;
+    x6.y += Q31i6j14R * dp.y + Q31i6j14I * dm.x;
+    x25.x += Q31i6j14R * dp.x + Q31i6j14I * dm.y;
+    x25.y += Q31i6j14R * dp.y - Q31i6j14I * dm.x;
+    x7.x += Q31i7j14R * dp.x - Q31i7j14I * dm.y;
+    x7.y += Q31i7j14R * dp.y + Q31i7j14I * dm.x;
+    x24.x += Q31i7j14R * dp.x + Q31i7j14I * dm.y;
+    x24.y += Q31i7j14R * dp.y - Q31i7j14I * dm.x;
+    x8.x += Q31i8j14R * dp.x - Q31i8j14I * dm.y;
+    x8.y += Q31i8j14R * dp.y + Q31i8j14I * dm.x;
+    x23.x += Q31i8j14R * dp.x + Q31i8j14I * dm.y;
+    x23.y += Q31i8j14R * dp.y - Q31i8j14I * dm.x;
+    x9.x += Q31i9j14R * dp.x - Q31i9j14I * dm.y;
+    x9.y += Q31i9j14R * dp.y + Q31i9j14I * dm.x;
+    x22.x += Q31i9j14R * dp.x + Q31i9j14I * dm.y;
+    x22.y += Q31i9j14R * dp.y - Q31i9j14I * dm.x;
+    x10.x += Q31i10j14R * dp.x - Q31i10j14I * dm.y;
+    x10.y += Q31i10j14R * dp.y + Q31i10j14I * dm.x;
+    x21.x += Q31i10j14R * dp.x + Q31i10j14I * dm.y;
+    x21.y += Q31i10j14R * dp.y - Q31i10j14I * dm.x;
+    x11.x += Q31i11j14R * dp.x - Q31i11j14I * dm.y;
+    x11.y += Q31i11j14R * dp.y + Q31i11j14I * dm.x;
+    x20.x += Q31i11j14R * dp.x + Q31i11j14I * dm.y;
+    x20.y += Q31i11j14R * dp.y - Q31i11j14I * dm.x;
+    x12.x += Q31i12j14R * dp.x - Q31i12j14I * dm.y;
+    x12.y += Q31i12j14R * dp.y + Q31i12j14I * dm.x;
+    x19.x += Q31i12j14R * dp.x + Q31i12j14I * dm.y;
+    x19.y += Q31i12j14R * dp.y - Q31i12j14I * dm.x;
+    x13.x += Q31i13j14R * dp.x - Q31i13j14I * dm.y;
+    x13.y += Q31i13j14R * dp.y + Q31i13j14I * dm.x;
+    x18.x += Q31i13j14R * dp.x + Q31i13j14I * dm.y;
+    x18.y += Q31i13j14R * dp.y - Q31i13j14I * dm.x;
+    x14.x += Q31i14j14R * dp.x - Q31i14j14I * dm.y;
+    x14.y += Q31i14j14R * dp.y + Q31i14j14I * dm.x;
+    x17.x += Q31i14j14R * dp.x + Q31i14j14I * dm.y;
+    x17.y += Q31i14j14R * dp.y - Q31i14j14I * dm.x;
+    x15.x += Q31i15j14R * dp.x - Q31i15j14I * dm.y;
+    x15.y += Q31i15j14R * dp.y + Q31i15j14I * dm.x;
+    x16.x += Q31i15j14R * dp.x + Q31i15j14I * dm.y;
+    x16.y += Q31i15j14R * dp.y - Q31i15j14I * dm.x;
+    dp = (*R15) + (*R16);
+    dm = (*R15) - (*R16);
+    x1.x += Q31i1j15R * dp.x - Q31i1j15I * dm.y;
+    x1.y += Q31i1j15R * dp.y + Q31i1j15I * dm.x;
+    x30.x += Q31i1j15R * dp.x + Q31i1j15I * dm.y;
+    x30.y += Q31i1j15R * dp.y - Q31i1j15I * dm.x;
+    x2.x += Q31i2j15R * dp.x - Q31i2j15I * dm.y;
+    x2.y += Q31i2j15R * dp.y + Q31i2j15I * dm.x;
+    x29.x += Q31i2j15R * dp.x + Q31i2j15I * dm.y;
+    x29.y += Q31i2j15R * dp.y - Q31i2j15I * dm.x;
+    x3.x += Q31i3j15R * dp.x - Q31i3j15I * dm.y;
+    x3.y += Q31i3j15R * dp.y + Q31i3j15I * dm.x;
+    x28.x += Q31i3j15R * dp.x + Q31i3j15I * dm.y;
+    x28.y += Q31i3j15R * dp.y - Q31i3j15I * dm.x;
+    x4.x += Q31i4j15R * dp.x - Q31i4j15I * dm.y;
+    x4.y += Q31i4j15R * dp.y + Q31i4j15I * dm.x;
+    x27.x += Q31i4j15R * dp.x + Q31i4j15I * dm.y;
+    x27.y += Q31i4j15R * dp.y - Q31i4j15I * dm.x;
+    x5.x += Q31i5j15R * dp.x - Q31i5j15I * dm.y;
+    x5.y += Q31i5j15R * dp.y + Q31i5j15I * dm.x;
+    x26.x += Q31i5j15R * dp.x + Q31i5j15I * dm.y;
+    x26.y += Q31i5j15R * dp.y - Q31i5j15I * dm.x;
+    x6.x += Q31i6j15R * dp.x - Q31i6j15I * dm.y;
+    x6.y += Q31i6j15R * dp.y + Q31i6j15I * dm.x;
+    x25.x += Q31i6j15R * dp.x + Q31i6j15I * dm.y;
+    x25.y += Q31i6j15R * dp.y - Q31i6j15I * dm.x;
+    x7.x += Q31i7j15R * dp.x - Q31i7j15I * dm.y;
+    x7.y += Q31i7j15R * dp.y + Q31i7j15I * dm.x;
+    x24.x += Q31i7j15R * dp.x + Q31i7j15I * dm.y;
+    x24.y += Q31i7j15R * dp.y - Q31i7j15I * dm.x;
+    x8.x += Q31i8j15R * dp.x - Q31i8j15I * dm.y;
+    x8.y += Q31i8j15R * dp.y + Q31i8j15I * dm.x;
+    x23.x += Q31i8j15R * dp.x + Q31i8j15I * dm.y;
+    x23.y += Q31i8j15R * dp.y - Q31i8j15I * dm.x;
+    x9.x += Q31i9j15R * dp.x - Q31i9j15I * dm.y;
+    x9.y += Q31i9j15R * dp.y + Q31i9j15I * dm.x;
+    x22.x += Q31i9j15R * dp.x + Q31i9j15I * dm.y;
+    x22.y += Q31i9j15R * dp.y - Q31i9j15I * dm.x;
+    x10.x += Q31i10j15R * dp.x - Q31i10j15I * dm.y;
+    x10.y += Q31i10j15R * dp.y + Q31i10j15I * dm.x;
+    x21.x += Q31i10j15R * dp.x + Q31i10j15I * dm.y;
+    x21.y += Q31i10j15R * dp.y - Q31i10j15I * dm.x;
+    x11.x += Q31i11j15R * dp.x - Q31i11j15I * dm.y;
+    x11.y += Q31i11j15R * dp.y + Q31i11j15I * dm.x;
+    x20.x += Q31i11j15R * dp.x + Q31i11j15I * dm.y;
+    x20.y += Q31i11j15R * dp.y - Q31i11j15I * dm.x;
+    x12.x += Q31i12j15R * dp.x - Q31i12j15I * dm.y;
+    x12.y += Q31i12j15R * dp.y + Q31i12j15I * dm.x;
+    x19.x += Q31i12j15R * dp.x + Q31i12j15I * dm.y;
+    x19.y += Q31i12j15R * dp.y - Q31i12j15I * dm.x;
+    x13.x += Q31i13j15R * dp.x - Q31i13j15I * dm.y;
+    x13.y += Q31i13j15R * dp.y + Q31i13j15I * dm.x;
+    x18.x += Q31i13j15R * dp.x + Q31i13j15I * dm.y;
+    x18.y += Q31i13j15R * dp.y - Q31i13j15I * dm.x;
+    x14.x += Q31i14j15R * dp.x - Q31i14j15I * dm.y;
+    x14.y += Q31i14j15R * dp.y + Q31i14j15I * dm.x;
+    x17.x += Q31i14j15R * dp.x + Q31i14j15I * dm.y;
+    x17.y += Q31i14j15R * dp.y - Q31i14j15I * dm.x;
+    x15.x += Q31i15j15R * dp.x - Q31i15j15I * dm.y;
+    x15.y += Q31i15j15R * dp.y + Q31i15j15I * dm.x;
+    x16.x += Q31i15j15R * dp.x + Q31i15j15I * dm.y;
+    x16.y += Q31i15j15R * dp.y - Q31i15j15I * dm.x;
+    (*R0)  = x0;
+    (*R1)  = x1;
+    (*R2)  = x2;
+    (*R3)  = x3;
+    (*R4)  = x4;
+    (*R5)  = x5;
+    (*R6)  = x6;
+    (*R7)  = x7;
+    (*R8)  = x8;
+    (*R9)  = x9;
+    (*R10) = x10;
+    (*R11) = x11;
+    (*R12) = x12;
+    (*R13) = x13;
+    (*R14) = x14;
+    (*R15) = x15;
+    (*R16) = x16;
+    (*R17) = x17;
+    (*R18) = x18;
+    (*R19) = x19;
+    (*R20) = x20;
+    (*R21) = x21;
+    (*R22) = x22;
+    (*R23) = x23;
+    (*R24) = x24;
+    (*R25) = x25;
+    (*R26) = x26;
+    (*R27) = x27;
+    (*R28) = x28;
+    (*R29) = x29;
+    (*R30) = x30;
+}
+
+template <typename T>
+__device__ void InvRad31B1(T* R0,
+                           T* R1,
+                           T* R2,
+                           T* R3,
+                           T* R4,
+                           T* R5,
+                           T* R6,
+                           T* R7,
+                           T* R8,
+                           T* R9,
+                           T* R10,
+                           T* R11,
+                           T* R12,
+                           T* R13,
+                           T* R14,
+                           T* R15,
+                           T* R16,
+                           T* R17,
+                           T* R18,
+                           T* R19,
+                           T* R20,
+                           T* R21,
+                           T* R22,
+                           T* R23,
+                           T* R24,
+                           T* R25,
+                           T* R26,
+                           T* R27,
+                           T* R28,
+                           T* R29,
+                           T* R30)
+{
+    T x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19, x20;
+    T x21, x22, x23, x24, x25, x26, x27, x28, x29, x30, dp, dm;
+
+    x0 = (*R0) + (*R1) + (*R2) + (*R3) + (*R4) + (*R5) + (*R6) + (*R7) + (*R8) + (*R9) + (*R10)
+         + (*R11) + (*R12) + (*R13) + (*R14) + (*R15) + (*R16) + (*R17) + (*R18) + (*R19) + (*R20)
+         + (*R21) + (*R22) + (*R23) + (*R24) + (*R25) + (*R26) + (*R27) + (*R28) + (*R29) + (*R30);
+    x1  = (*R0);
+    x2  = (*R0);
+    x3  = (*R0);
+    x4  = (*R0);
+    x5  = (*R0);
+    x6  = (*R0);
+    x7  = (*R0);
+    x8  = (*R0);
+    x9  = (*R0);
+    x10 = (*R0);
+    x11 = (*R0);
+    x12 = (*R0);
+    x13 = (*R0);
+    x14 = (*R0);
+    x15 = (*R0);
+    x16 = (*R0);
+    x17 = (*R0);
+    x18 = (*R0);
+    x19 = (*R0);
+    x20 = (*R0);
+    x21 = (*R0);
+    x22 = (*R0);
+    x23 = (*R0);
+    x24 = (*R0);
+    x25 = (*R0);
+    x26 = (*R0);
+    x27 = (*R0);
+    x28 = (*R0);
+    x29 = (*R0);
+    x30 = (*R0);
+    dp  = (*R1) + (*R30);
+    dm  = (*R1) - (*R30);
+    x1.x += Q31i1j1R * dp.x + Q31i1j1I * dm.y;
+    x1.y += Q31i1j1R * dp.y - Q31i1j1I * dm.x;
+    x30.x += Q31i1j1R * dp.x - Q31i1j1I * dm.y;
+    x30.y += Q31i1j1R * dp.y + Q31i1j1I * dm.x;
+    x2.x += Q31i2j1R * dp.x + Q31i2j1I * dm.y;
+    x2.y += Q31i2j1R * dp.y - Q31i2j1I * dm.x;
+    x29.x += Q31i2j1R * dp.x - Q31i2j1I * dm.y;
+    x29.y += Q31i2j1R * dp.y + Q31i2j1I * dm.x;
+    x3.x += Q31i3j1R * dp.x + Q31i3j1I * dm.y;
+    x3.y += Q31i3j1R * dp.y - Q31i3j1I * dm.x;
+    x28.x += Q31i3j1R * dp.x - Q31i3j1I * dm.y;
+    x28.y += Q31i3j1R * dp.y + Q31i3j1I * dm.x;
+    x4.x += Q31i4j1R * dp.x + Q31i4j1I * dm.y;
+    x4.y += Q31i4j1R * dp.y - Q31i4j1I * dm.x;
+    x27.x += Q31i4j1R * dp.x - Q31i4j1I * dm.y;
+    x27.y += Q31i4j1R * dp.y + Q31i4j1I * dm.x;
+    x5.x += Q31i5j1R * dp.x + Q31i5j1I * dm.y;
+    x5.y += Q31i5j1R * dp.y - Q31i5j1I * dm.x;
+    x26.x += Q31i5j1R * dp.x - Q31i5j1I * dm.y;
+    x26.y += Q31i5j1R * dp.y + Q31i5j1I * dm.x;
+    x6.x += Q31i6j1R * dp.x + Q31i6j1I * dm.y;
+    x6.y += Q31i6j1R * dp.y - Q31i6j1I * dm.x;
+    x25.x += Q31i6j1R * dp.x - Q31i6j1I * dm.y;
+    x25.y += Q31i6j1R * dp.y + Q31i6j1I * dm.x;
+    x7.x += Q31i7j1R * dp.x + Q31i7j1I * dm.y;
+    x7.y += Q31i7j1R * dp.y - Q31i7j1I * dm.x;
+    x24.x += Q31i7j1R * dp.x - Q31i7j1I * dm.y;
+    x24.y += Q31i7j1R * dp.y + Q31i7j1I * dm.x;
+    x8.x += Q31i8j1R * dp.x + Q31i8j1I * dm.y;
+    x8.y += Q31i8j1R * dp.y - Q31i8j1I * dm.x;
+    x23.x += Q31i8j1R * dp.x - Q31i8j1I * dm.y;
+    x23.y += Q31i8j1R * dp.y + Q31i8j1I * dm.x;
+    x9.x += Q31i9j1R * dp.x + Q31i9j1I * dm.y;
+    x9.y += Q31i9j1R * dp.y - Q31i9j1I * dm.x;
+    x22.x += Q31i9j1R * dp.x - Q31i9j1I * dm.y;
+    x22.y += Q31i9j1R * dp.y + Q31i9j1I * dm.x;
+    x10.x += Q31i10j1R * dp.x + Q31i10j1I * dm.y;
+    x10.y += Q31i10j1R * dp.y - Q31i10j1I * dm.x;
+    x21.x += Q31i10j1R * dp.x - Q31i10j1I * dm.y;
+    x21.y += Q31i10j1R * dp.y + Q31i10j1I * dm.x;
+    x11.x += Q31i11j1R * dp.x + Q31i11j1I * dm.y;
+    x11.y += Q31i11j1R * dp.y - Q31i11j1I * dm.x;
+    x20.x += Q31i11j1R * dp.x - Q31i11j1I * dm.y;
+    x20.y += Q31i11j1R * dp.y + Q31i11j1I * dm.x;
+    x12.x += Q31i12j1R * dp.x + Q31i12j1I * dm.y;
+    x12.y += Q31i12j1R * dp.y - Q31i12j1I * dm.x;
+    x19.x += Q31i12j1R * dp.x - Q31i12j1I * dm.y;
+    x19.y += Q31i12j1R * dp.y + Q31i12j1I * dm.x;
+    x13.x += Q31i13j1R * dp.x + Q31i13j1I * dm.y;
+    x13.y += Q31i13j1R * dp.y - Q31i13j1I * dm.x;
+    x18.x += Q31i13j1R * dp.x - Q31i13j1I * dm.y;
+    x18.y += Q31i13j1R * dp.y + Q31i13j1I * dm.x;
+    x14.x += Q31i14j1R * dp.x + Q31i14j1I * dm.y;
+    x14.y += Q31i14j1R * dp.y - Q31i14j1I * dm.x;
+    x17.x += Q31i14j1R * dp.x - Q31i14j1I * dm.y;
+    x17.y += Q31i14j1R * dp.y + Q31i14j1I * dm.x;
+    x15.x += Q31i15j1R * dp.x + Q31i15j1I * dm.y;
+    x15.y += Q31i15j1R * dp.y - Q31i15j1I * dm.x;
+    x16.x += Q31i15j1R * dp.x - Q31i15j1I * dm.y;
+    x16.y += Q31i15j1R * dp.y + Q31i15j1I * dm.x;
+    dp = (*R2) + (*R29);
+    dm = (*R2) - (*R29);
+    x1.x += Q31i1j2R * dp.x + Q31i1j2I * dm.y;
+    x1.y += Q31i1j2R * dp.y - Q31i1j2I * dm.x;
+    x30.x += Q31i1j2R * dp.x - Q31i1j2I * dm.y;
+    x30.y += Q31i1j2R * dp.y + Q31i1j2I * dm.x;
+    x2.x += Q31i2j2R * dp.x + Q31i2j2I * dm.y;
+    x2.y += Q31i2j2R * dp.y - Q31i2j2I * dm.x;
+    x29.x += Q31i2j2R * dp.x - Q31i2j2I * dm.y;
+    x29.y += Q31i2j2R * dp.y + Q31i2j2I * dm.x;
+    x3.x += Q31i3j2R * dp.x + Q31i3j2I * dm.y;
+    x3.y += Q31i3j2R * dp.y - Q31i3j2I * dm.x;
+    x28.x += Q31i3j2R * dp.x - Q31i3j2I * dm.y;
+    x28.y += Q31i3j2R * dp.y + Q31i3j2I * dm.x;
+    x4.x += Q31i4j2R * dp.x + Q31i4j2I * dm.y;
+    x4.y += Q31i4j2R * dp.y - Q31i4j2I * dm.x;
+    x27.x += Q31i4j2R * dp.x - Q31i4j2I * dm.y;
+    x27.y += Q31i4j2R * dp.y + Q31i4j2I * dm.x;
+    x5.x += Q31i5j2R * dp.x + Q31i5j2I * dm.y;
+    x5.y += Q31i5j2R * dp.y - Q31i5j2I * dm.x;
+    x26.x += Q31i5j2R * dp.x - Q31i5j2I * dm.y;
+    x26.y += Q31i5j2R * dp.y + Q31i5j2I * dm.x;
+    x6.x += Q31i6j2R * dp.x + Q31i6j2I * dm.y;
+    x6.y += Q31i6j2R * dp.y - Q31i6j2I * dm.x;
+    x25.x += Q31i6j2R * dp.x - Q31i6j2I * dm.y;
+    x25.y += Q31i6j2R * dp.y + Q31i6j2I * dm.x;
+    x7.x += Q31i7j2R * dp.x + Q31i7j2I * dm.y;
+    x7.y += Q31i7j2R * dp.y - Q31i7j2I * dm.x;
+    x24.x += Q31i7j2R * dp.x - Q31i7j2I * dm.y;
+    x24.y += Q31i7j2R * dp.y + Q31i7j2I * dm.x;
+    x8.x += Q31i8j2R * dp.x + Q31i8j2I * dm.y;
+    x8.y += Q31i8j2R * dp.y - Q31i8j2I * dm.x;
+    x23.x += Q31i8j2R * dp.x - Q31i8j2I * dm.y;
+    x23.y += Q31i8j2R * dp.y + Q31i8j2I * dm.x;
+    x9.x += Q31i9j2R * dp.x + Q31i9j2I * dm.y;
+    x9.y += Q31i9j2R * dp.y - Q31i9j2I * dm.x;
+    x22.x += Q31i9j2R * dp.x - Q31i9j2I * dm.y;
+    x22.y += Q31i9j2R * dp.y + Q31i9j2I * dm.x;
+    x10.x += Q31i10j2R * dp.x + Q31i10j2I * dm.y;
+    x10.y += Q31i10j2R * dp.y - Q31i10j2I * dm.x;
+    x21.x += Q31i10j2R * dp.x - Q31i10j2I * dm.y;
+    x21.y += Q31i10j2R * dp.y + Q31i10j2I * dm.x;
+    x11.x += Q31i11j2R * dp.x + Q31i11j2I * dm.y;
+    x11.y += Q31i11j2R * dp.y - Q31i11j2I * dm.x;
+    x20.x += Q31i11j2R * dp.x - Q31i11j2I * dm.y;
+    x20.y += Q31i11j2R * dp.y + Q31i11j2I * dm.x;
+    x12.x += Q31i12j2R * dp.x + Q31i12j2I * dm.y;
+    x12.y += Q31i12j2R * dp.y - Q31i12j2I * dm.x;
+    x19.x += Q31i12j2R * dp.x - Q31i12j2I * dm.y;
+    x19.y += Q31i12j2R * dp.y + Q31i12j2I * dm.x;
+    x13.x += Q31i13j2R * dp.x + Q31i13j2I * dm.y;
+    x13.y += Q31i13j2R * dp.y - Q31i13j2I * dm.x;
+    x18.x += Q31i13j2R * dp.x - Q31i13j2I * dm.y;
+    x18.y += Q31i13j2R * dp.y + Q31i13j2I * dm.x;
+    x14.x += Q31i14j2R * dp.x + Q31i14j2I * dm.y;
+    x14.y += Q31i14j2R * dp.y - Q31i14j2I * dm.x;
+    x17.x += Q31i14j2R * dp.x - Q31i14j2I * dm.y;
+    x17.y += Q31i14j2R * dp.y + Q31i14j2I * dm.x;
+    x15.x += Q31i15j2R * dp.x + Q31i15j2I * dm.y;
+    x15.y += Q31i15j2R * dp.y - Q31i15j2I * dm.x;
+    x16.x += Q31i15j2R * dp.x - Q31i15j2I * dm.y;
+    x16.y += Q31i15j2R * dp.y + Q31i15j2I * dm.x;
+    dp = (*R3) + (*R28);
+    dm = (*R3) - (*R28);
+    x1.x += Q31i1j3R * dp.x + Q31i1j3I * dm.y;
+    x1.y += Q31i1j3R * dp.y - Q31i1j3I * dm.x;
+    x30.x += Q31i1j3R * dp.x - Q31i1j3I * dm.y;
+    x30.y += Q31i1j3R * dp.y + Q31i1j3I * dm.x;
+    x2.x += Q31i2j3R * dp.x + Q31i2j3I * dm.y;
+    x2.y += Q31i2j3R * dp.y - Q31i2j3I * dm.x;
+    x29.x += Q31i2j3R * dp.x - Q31i2j3I * dm.y;
+    x29.y += Q31i2j3R * dp.y + Q31i2j3I * dm.x;
+    x3.x += Q31i3j3R * dp.x + Q31i3j3I * dm.y;
+    x3.y += Q31i3j3R * dp.y - Q31i3j3I * dm.x;
+    x28.x += Q31i3j3R * dp.x - Q31i3j3I * dm.y;
+    x28.y += Q31i3j3R * dp.y + Q31i3j3I * dm.x;
+    x4.x += Q31i4j3R * dp.x + Q31i4j3I * dm.y;
+    x4.y += Q31i4j3R * dp.y - Q31i4j3I * dm.x;
+    x27.x += Q31i4j3R * dp.x - Q31i4j3I * dm.y;
+    x27.y += Q31i4j3R * dp.y + Q31i4j3I * dm.x;
+    x5.x += Q31i5j3R * dp.x + Q31i5j3I * dm.y;
+    x5.y += Q31i5j3R * dp.y - Q31i5j3I * dm.x;
+    x26.x += Q31i5j3R * dp.x - Q31i5j3I * dm.y;
+    x26.y += Q31i5j3R * dp.y + Q31i5j3I * dm.x;
+    x6.x += Q31i6j3R * dp.x + Q31i6j3I * dm.y;
+    x6.y += Q31i6j3R * dp.y - Q31i6j3I * dm.x;
+    x25.x += Q31i6j3R * dp.x - Q31i6j3I * dm.y;
+    x25.y += Q31i6j3R * dp.y + Q31i6j3I * dm.x;
+    x7.x += Q31i7j3R * dp.x + Q31i7j3I * dm.y;
+    x7.y += Q31i7j3R * dp.y - Q31i7j3I * dm.x;
+    x24.x += Q31i7j3R * dp.x - Q31i7j3I * dm.y;
+    x24.y += Q31i7j3R * dp.y + Q31i7j3I * dm.x;
+    x8.x += Q31i8j3R * dp.x + Q31i8j3I * dm.y;
+    x8.y += Q31i8j3R * dp.y - Q31i8j3I * dm.x;
+    x23.x += Q31i8j3R * dp.x - Q31i8j3I * dm.y;
+    x23.y += Q31i8j3R * dp.y + Q31i8j3I * dm.x;
+    x9.x += Q31i9j3R * dp.x + Q31i9j3I * dm.y;
+    x9.y += Q31i9j3R * dp.y - Q31i9j3I * dm.x;
+    x22.x += Q31i9j3R * dp.x - Q31i9j3I * dm.y;
+    x22.y += Q31i9j3R * dp.y + Q31i9j3I * dm.x;
+    x10.x += Q31i10j3R * dp.x + Q31i10j3I * dm.y;
+    x10.y += Q31i10j3R * dp.y - Q31i10j3I * dm.x;
+    x21.x += Q31i10j3R * dp.x - Q31i10j3I * dm.y;
+    x21.y += Q31i10j3R * dp.y + Q31i10j3I * dm.x;
+    x11.x += Q31i11j3R * dp.x + Q31i11j3I * dm.y;
+    x11.y += Q31i11j3R * dp.y - Q31i11j3I * dm.x;
+    x20.x += Q31i11j3R * dp.x - Q31i11j3I * dm.y;
+    x20.y += Q31i11j3R * dp.y + Q31i11j3I * dm.x;
+    x12.x += Q31i12j3R * dp.x + Q31i12j3I * dm.y;
+    x12.y += Q31i12j3R * dp.y - Q31i12j3I * dm.x;
+    x19.x += Q31i12j3R * dp.x - Q31i12j3I * dm.y;
+    x19.y += Q31i12j3R * dp.y + Q31i12j3I * dm.x;
+    x13.x += Q31i13j3R * dp.x + Q31i13j3I * dm.y;
+    x13.y += Q31i13j3R * dp.y - Q31i13j3I * dm.x;
+    x18.x += Q31i13j3R * dp.x - Q31i13j3I * dm.y;
+    x18.y += Q31i13j3R * dp.y + Q31i13j3I * dm.x;
+    x14.x += Q31i14j3R * dp.x + Q31i14j3I * dm.y;
+    x14.y += Q31i14j3R * dp.y - Q31i14j3I * dm.x;
+    x17.x += Q31i14j3R * dp.x - Q31i14j3I * dm.y;
+    x17.y += Q31i14j3R * dp.y + Q31i14j3I * dm.x;
+    x15.x += Q31i15j3R * dp.x + Q31i15j3I * dm.y;
+    x15.y += Q31i15j3R * dp.y - Q31i15j3I * dm.x;
+    x16.x += Q31i15j3R * dp.x - Q31i15j3I * dm.y;
+    x16.y += Q31i15j3R * dp.y + Q31i15j3I * dm.x;
+    dp = (*R4) + (*R27);
+    dm = (*R4) - (*R27);
+    x1.x += Q31i1j4R * dp.x + Q31i1j4I * dm.y;
+    x1.y += Q31i1j4R * dp.y - Q31i1j4I * dm.x;
+    x30.x += Q31i1j4R * dp.x - Q31i1j4I * dm.y;
+    x30.y += Q31i1j4R * dp.y + Q31i1j4I * dm.x;
+    x2.x += Q31i2j4R * dp.x + Q31i2j4I * dm.y;
+    x2.y += Q31i2j4R * dp.y - Q31i2j4I * dm.x;
+    x29.x += Q31i2j4R * dp.x - Q31i2j4I * dm.y;
+    x29.y += Q31i2j4R * dp.y + Q31i2j4I * dm.x;
+    x3.x += Q31i3j4R * dp.x + Q31i3j4I * dm.y;
+    x3.y += Q31i3j4R * dp.y - Q31i3j4I * dm.x;
+    x28.x += Q31i3j4R * dp.x - Q31i3j4I * dm.y;
+    x28.y += Q31i3j4R * dp.y + Q31i3j4I * dm.x;
+    x4.x += Q31i4j4R * dp.x + Q31i4j4I * dm.y;
+    x4.y += Q31i4j4R * dp.y - Q31i4j4I * dm.x;
+    x27.x += Q31i4j4R * dp.x - Q31i4j4I * dm.y;
+    x27.y += Q31i4j4R * dp.y + Q31i4j4I * dm.x;
+    x5.x += Q31i5j4R * dp.x + Q31i5j4I * dm.y;
+    x5.y += Q31i5j4R * dp.y - Q31i5j4I * dm.x;
+    x26.x += Q31i5j4R * dp.x - Q31i5j4I * dm.y;
+    x26.y += Q31i5j4R * dp.y + Q31i5j4I * dm.x;
+    x6.x += Q31i6j4R * dp.x + Q31i6j4I * dm.y;
+    x6.y += Q31i6j4R * dp.y - Q31i6j4I * dm.x;
+    x25.x += Q31i6j4R * dp.x - Q31i6j4I * dm.y;
+    x25.y += Q31i6j4R * dp.y + Q31i6j4I * dm.x;
+    x7.x += Q31i7j4R * dp.x + Q31i7j4I * dm.y;
+    x7.y += Q31i7j4R * dp.y - Q31i7j4I * dm.x;
+    x24.x += Q31i7j4R * dp.x - Q31i7j4I * dm.y;
+    x24.y += Q31i7j4R * dp.y + Q31i7j4I * dm.x;
+    x8.x += Q31i8j4R * dp.x + Q31i8j4I * dm.y;
+    x8.y += Q31i8j4R * dp.y - Q31i8j4I * dm.x;
+    x23.x += Q31i8j4R * dp.x - Q31i8j4I * dm.y;
+    x23.y += Q31i8j4R * dp.y + Q31i8j4I * dm.x;
+    x9.x += Q31i9j4R * dp.x + Q31i9j4I * dm.y;
+    x9.y += Q31i9j4R * dp.y - Q31i9j4I * dm.x;
+    x22.x += Q31i9j4R * dp.x - Q31i9j4I * dm.y;
+    x22.y += Q31i9j4R * dp.y + Q31i9j4I * dm.x;
+    x10.x += Q31i10j4R * dp.x + Q31i10j4I * dm.y;
+    x10.y += Q31i10j4R * dp.y - Q31i10j4I * dm.x;
+    x21.x += Q31i10j4R * dp.x - Q31i10j4I * dm.y;
+    x21.y += Q31i10j4R * dp.y + Q31i10j4I * dm.x;
+    x11.x += Q31i11j4R * dp.x + Q31i11j4I * dm.y;
+    x11.y += Q31i11j4R * dp.y - Q31i11j4I * dm.x;
+    x20.x += Q31i11j4R * dp.x - Q31i11j4I * dm.y;
+    x20.y += Q31i11j4R * dp.y + Q31i11j4I * dm.x;
+    x12.x += Q31i12j4R * dp.x + Q31i12j4I * dm.y;
+    x12.y += Q31i12j4R * dp.y - Q31i12j4I * dm.x;
+    x19.x += Q31i12j4R * dp.x - Q31i12j4I * dm.y;
+    x19.y += Q31i12j4R * dp.y + Q31i12j4I * dm.x;
+    x13.x += Q31i13j4R * dp.x + Q31i13j4I * dm.y;
+    x13.y += Q31i13j4R * dp.y - Q31i13j4I * dm.x;
+    x18.x += Q31i13j4R * dp.x - Q31i13j4I * dm.y;
+    x18.y += Q31i13j4R * dp.y + Q31i13j4I * dm.x;
+    x14.x += Q31i14j4R * dp.x + Q31i14j4I * dm.y;
+    x14.y += Q31i14j4R * dp.y - Q31i14j4I * dm.x;
+    x17.x += Q31i14j4R * dp.x - Q31i14j4I * dm.y;
+    x17.y += Q31i14j4R * dp.y + Q31i14j4I * dm.x;
+    x15.x += Q31i15j4R * dp.x + Q31i15j4I * dm.y;
+    x15.y += Q31i15j4R * dp.y - Q31i15j4I * dm.x;
+    x16.x += Q31i15j4R * dp.x - Q31i15j4I * dm.y;
+    x16.y += Q31i15j4R * dp.y + Q31i15j4I * dm.x;
+    dp = (*R5) + (*R26);
+    dm = (*R5) - (*R26);
+    x1.x += Q31i1j5R * dp.x + Q31i1j5I * dm.y;
+    x1.y += Q31i1j5R * dp.y - Q31i1j5I * dm.x;
+    x30.x += Q31i1j5R * dp.x - Q31i1j5I * dm.y;
+    x30.y += Q31i1j5R * dp.y + Q31i1j5I * dm.x;
+    x2.x += Q31i2j5R * dp.x + Q31i2j5I * dm.y;
+    x2.y += Q31i2j5R * dp.y - Q31i2j5I * dm.x;
+    x29.x += Q31i2j5R * dp.x - Q31i2j5I * dm.y;
+    x29.y += Q31i2j5R * dp.y + Q31i2j5I * dm.x;
+    x3.x += Q31i3j5R * dp.x + Q31i3j5I * dm.y;
+    x3.y += Q31i3j5R * dp.y - Q31i3j5I * dm.x;
+    x28.x += Q31i3j5R * dp.x - Q31i3j5I * dm.y;
+    x28.y += Q31i3j5R * dp.y + Q31i3j5I * dm.x;
+    x4.x += Q31i4j5R * dp.x + Q31i4j5I * dm.y;
+    x4.y += Q31i4j5R * dp.y - Q31i4j5I * dm.x;
+    x27.x += Q31i4j5R * dp.x - Q31i4j5I * dm.y;
+    x27.y += Q31i4j5R * dp.y + Q31i4j5I * dm.x;
+    x5.x += Q31i5j5R * dp.x + Q31i5j5I * dm.y;
+    x5.y += Q31i5j5R * dp.y - Q31i5j5I * dm.x;
+    x26.x += Q31i5j5R * dp.x - Q31i5j5I * dm.y;
+    x26.y += Q31i5j5R * dp.y + Q31i5j5I * dm.x;
+    x6.x += Q31i6j5R * dp.x + Q31i6j5I * dm.y;
+    x6.y += Q31i6j5R * dp.y - Q31i6j5I * dm.x;
+    x25.x += Q31i6j5R * dp.x - Q31i6j5I * dm.y;
+    x25.y += Q31i6j5R * dp.y + Q31i6j5I * dm.x;
+    x7.x += Q31i7j5R * dp.x + Q31i7j5I * dm.y;
+    x7.y += Q31i7j5R * dp.y - Q31i7j5I * dm.x;
+    x24.x += Q31i7j5R * dp.x - Q31i7j5I * dm.y;
+    x24.y += Q31i7j5R * dp.y + Q31i7j5I * dm.x;
+    x8.x += Q31i8j5R * dp.x + Q31i8j5I * dm.y;
+    x8.y += Q31i8j5R * dp.y - Q31i8j5I * dm.x;
+    x23.x += Q31i8j5R * dp.x - Q31i8j5I * dm.y;
+    x23.y += Q31i8j5R * dp.y + Q31i8j5I * dm.x;
+    x9.x += Q31i9j5R * dp.x + Q31i9j5I * dm.y;
+    x9.y += Q31i9j5R * dp.y - Q31i9j5I * dm.x;
+    x22.x += Q31i9j5R * dp.x - Q31i9j5I * dm.y;
+    x22.y += Q31i9j5R * dp.y + Q31i9j5I * dm.x;
+    x10.x += Q31i10j5R * dp.x + Q31i10j5I * dm.y;
+    x10.y += Q31i10j5R * dp.y - Q31i10j5I * dm.x;
+    x21.x += Q31i10j5R * dp.x - Q31i10j5I * dm.y;
+    x21.y += Q31i10j5R * dp.y + Q31i10j5I * dm.x;
+    x11.x += Q31i11j5R * dp.x + Q31i11j5I * dm.y;
+    x11.y += Q31i11j5R * dp.y - Q31i11j5I * dm.x;
+    x20.x += Q31i11j5R * dp.x - Q31i11j5I * dm.y;
+    x20.y += Q31i11j5R * dp.y + Q31i11j5I * dm.x;
+    x12.x += Q31i12j5R * dp.x + Q31i12j5I * dm.y;
+    x12.y += Q31i12j5R * dp.y - Q31i12j5I * dm.x;
+    x19.x += Q31i12j5R * dp.x - Q31i12j5I * dm.y;
+    x19.y += Q31i12j5R * dp.y + Q31i12j5I * dm.x;
+    x13.x += Q31i13j5R * dp.x + Q31i13j5I * dm.y;
+    x13.y += Q31i13j5R * dp.y - Q31i13j5I * dm.x;
+    x18.x += Q31i13j5R * dp.x - Q31i13j5I * dm.y;
+    x18.y += Q31i13j5R * dp.y + Q31i13j5I * dm.x;
+    x14.x += Q31i14j5R * dp.x + Q31i14j5I * dm.y;
+    x14.y += Q31i14j5R * dp.y - Q31i14j5I * dm.x;
+    x17.x += Q31i14j5R * dp.x - Q31i14j5I * dm.y;
+    x17.y += Q31i14j5R * dp.y + Q31i14j5I * dm.x;
+    x15.x += Q31i15j5R * dp.x + Q31i15j5I * dm.y;
+    x15.y += Q31i15j5R * dp.y - Q31i15j5I * dm.x;
+    x16.x += Q31i15j5R * dp.x - Q31i15j5I * dm.y;
+    x16.y += Q31i15j5R * dp.y + Q31i15j5I * dm.x;
+    dp = (*R6) + (*R25);
+    dm = (*R6) - (*R25);
+    x1.x += Q31i1j6R * dp.x + Q31i1j6I * dm.y;
+    x1.y += Q31i1j6R * dp.y - Q31i1j6I * dm.x;
+    x30.x += Q31i1j6R * dp.x - Q31i1j6I * dm.y;
+    x30.y += Q31i1j6R * dp.y + Q31i1j6I * dm.x;
+    x2.x += Q31i2j6R * dp.x + Q31i2j6I * dm.y;
+    x2.y += Q31i2j6R * dp.y - Q31i2j6I * dm.x;
+    x29.x += Q31i2j6R * dp.x - Q31i2j6I * dm.y;
+    x29.y += Q31i2j6R * dp.y + Q31i2j6I * dm.x;
+    x3.x += Q31i3j6R * dp.x + Q31i3j6I * dm.y;
+    x3.y += Q31i3j6R * dp.y - Q31i3j6I * dm.x;
+    x28.x += Q31i3j6R * dp.x - Q31i3j6I * dm.y;
+    x28.y += Q31i3j6R * dp.y + Q31i3j6I * dm.x;
+    x4.x += Q31i4j6R * dp.x + Q31i4j6I * dm.y;
+    x4.y += Q31i4j6R * dp.y - Q31i4j6I * dm.x;
+    x27.x += Q31i4j6R * dp.x - Q31i4j6I * dm.y;
+    x27.y += Q31i4j6R * dp.y + Q31i4j6I * dm.x;
+    x5.x += Q31i5j6R * dp.x + Q31i5j6I * dm.y;
+    x5.y += Q31i5j6R * dp.y - Q31i5j6I * dm.x;
+    x26.x += Q31i5j6R * dp.x - Q31i5j6I * dm.y;
+    x26.y += Q31i5j6R * dp.y + Q31i5j6I * dm.x;
+    x6.x += Q31i6j6R * dp.x + Q31i6j6I * dm.y;
+    x6.y += Q31i6j6R * dp.y - Q31i6j6I * dm.x;
+    x25.x += Q31i6j6R * dp.x - Q31i6j6I * dm.y;
+    x25.y += Q31i6j6R * dp.y + Q31i6j6I * dm.x;
+    x7.x += Q31i7j6R * dp.x + Q31i7j6I * dm.y;
+    x7.y += Q31i7j6R * dp.y - Q31i7j6I * dm.x;
+    x24.x += Q31i7j6R * dp.x - Q31i7j6I * dm.y;
+    x24.y += Q31i7j6R * dp.y + Q31i7j6I * dm.x;
+    x8.x += Q31i8j6R * dp.x + Q31i8j6I * dm.y;
+    x8.y += Q31i8j6R * dp.y - Q31i8j6I * dm.x;
+    x23.x += Q31i8j6R * dp.x - Q31i8j6I * dm.y;
+    x23.y += Q31i8j6R * dp.y + Q31i8j6I * dm.x;
+    x9.x += Q31i9j6R * dp.x + Q31i9j6I * dm.y;
+    x9.y += Q31i9j6R * dp.y - Q31i9j6I * dm.x;
+    x22.x += Q31i9j6R * dp.x - Q31i9j6I * dm.y;
+    x22.y += Q31i9j6R * dp.y + Q31i9j6I * dm.x;
+    x10.x += Q31i10j6R * dp.x + Q31i10j6I * dm.y;
+    x10.y += Q31i10j6R * dp.y - Q31i10j6I * dm.x;
+    x21.x += Q31i10j6R * dp.x - Q31i10j6I * dm.y;
+    x21.y += Q31i10j6R * dp.y + Q31i10j6I * dm.x;
+    x11.x += Q31i11j6R * dp.x + Q31i11j6I * dm.y;
+    x11.y += Q31i11j6R * dp.y - Q31i11j6I * dm.x;
+    x20.x += Q31i11j6R * dp.x - Q31i11j6I * dm.y;
+    x20.y += Q31i11j6R * dp.y + Q31i11j6I * dm.x;
+    x12.x += Q31i12j6R * dp.x + Q31i12j6I * dm.y;
+    x12.y += Q31i12j6R * dp.y - Q31i12j6I * dm.x;
+    x19.x += Q31i12j6R * dp.x - Q31i12j6I * dm.y;
+    x19.y += Q31i12j6R * dp.y + Q31i12j6I * dm.x;
+    x13.x += Q31i13j6R * dp.x + Q31i13j6I * dm.y;
+    x13.y += Q31i13j6R * dp.y - Q31i13j6I * dm.x;
+    x18.x += Q31i13j6R * dp.x - Q31i13j6I * dm.y;
+    x18.y += Q31i13j6R * dp.y + Q31i13j6I * dm.x;
+    x14.x += Q31i14j6R * dp.x + Q31i14j6I * dm.y;
+    x14.y += Q31i14j6R * dp.y - Q31i14j6I * dm.x;
+    x17.x += Q31i14j6R * dp.x - Q31i14j6I * dm.y;
+    x17.y += Q31i14j6R * dp.y + Q31i14j6I * dm.x;
+    x15.x += Q31i15j6R * dp.x + Q31i15j6I * dm.y;
+    x15.y += Q31i15j6R * dp.y - Q31i15j6I * dm.x;
+    x16.x += Q31i15j6R * dp.x - Q31i15j6I * dm.y;
+    x16.y += Q31i15j6R * dp.y + Q31i15j6I * dm.x;
+    dp = (*R7) + (*R24);
+    dm = (*R7) - (*R24);
+    x1.x += Q31i1j7R * dp.x + Q31i1j7I * dm.y;
+    x1.y += Q31i1j7R * dp.y - Q31i1j7I * dm.x;
+    x30.x += Q31i1j7R * dp.x - Q31i1j7I * dm.y;
+    x30.y += Q31i1j7R * dp.y + Q31i1j7I * dm.x;
+    x2.x += Q31i2j7R * dp.x + Q31i2j7I * dm.y;
+    x2.y += Q31i2j7R * dp.y - Q31i2j7I * dm.x;
+    x29.x += Q31i2j7R * dp.x - Q31i2j7I * dm.y;
+    x29.y += Q31i2j7R * dp.y + Q31i2j7I * dm.x;
+    x3.x += Q31i3j7R * dp.x + Q31i3j7I * dm.y;
+    x3.y += Q31i3j7R * dp.y - Q31i3j7I * dm.x;
+    x28.x += Q31i3j7R * dp.x - Q31i3j7I * dm.y;
+    x28.y += Q31i3j7R * dp.y + Q31i3j7I * dm.x;
+    x4.x += Q31i4j7R * dp.x + Q31i4j7I * dm.y;
+    x4.y += Q31i4j7R * dp.y - Q31i4j7I * dm.x;
+    x27.x += Q31i4j7R * dp.x - Q31i4j7I * dm.y;
+    x27.y += Q31i4j7R * dp.y + Q31i4j7I * dm.x;
+    x5.x += Q31i5j7R * dp.x + Q31i5j7I * dm.y;
+    x5.y += Q31i5j7R * dp.y - Q31i5j7I * dm.x;
+    x26.x += Q31i5j7R * dp.x - Q31i5j7I * dm.y;
+    x26.y += Q31i5j7R * dp.y + Q31i5j7I * dm.x;
+    x6.x += Q31i6j7R * dp.x + Q31i6j7I * dm.y;
+    x6.y += Q31i6j7R * dp.y - Q31i6j7I * dm.x;
+    x25.x += Q31i6j7R * dp.x - Q31i6j7I * dm.y;
+    x25.y += Q31i6j7R * dp.y + Q31i6j7I * dm.x;
+    x7.x += Q31i7j7R * dp.x + Q31i7j7I * dm.y;
+    x7.y += Q31i7j7R * dp.y - Q31i7j7I * dm.x;
+    x24.x += Q31i7j7R * dp.x - Q31i7j7I * dm.y;
+    x24.y += Q31i7j7R * dp.y + Q31i7j7I * dm.x;
+    x8.x += Q31i8j7R * dp.x + Q31i8j7I * dm.y;
+    x8.y += Q31i8j7R * dp.y - Q31i8j7I * dm.x;
+    x23.x += Q31i8j7R * dp.x - Q31i8j7I * dm.y;
+    x23.y += Q31i8j7R * dp.y + Q31i8j7I * dm.x;
+    x9.x += Q31i9j7R * dp.x + Q31i9j7I * dm.y;
+    x9.y += Q31i9j7R * dp.y - Q31i9j7I * dm.x;
+    x22.x += Q31i9j7R * dp.x - Q31i9j7I * dm.y;
+    x22.y += Q31i9j7R * dp.y + Q31i9j7I * dm.x;
+    x10.x += Q31i10j7R * dp.x + Q31i10j7I * dm.y;
+    x10.y += Q31i10j7R * dp.y - Q31i10j7I * dm.x;
+    x21.x += Q31i10j7R * dp.x - Q31i10j7I * dm.y;
+    x21.y += Q31i10j7R * dp.y + Q31i10j7I * dm.x;
+    x11.x += Q31i11j7R * dp.x + Q31i11j7I * dm.y;
+    x11.y += Q31i11j7R * dp.y - Q31i11j7I * dm.x;
+    x20.x += Q31i11j7R * dp.x - Q31i11j7I * dm.y;
+    x20.y += Q31i11j7R * dp.y + Q31i11j7I * dm.x;
+    x12.x += Q31i12j7R * dp.x + Q31i12j7I * dm.y;
+    x12.y += Q31i12j7R * dp.y - Q31i12j7I * dm.x;
+    x19.x += Q31i12j7R * dp.x - Q31i12j7I * dm.y;
+    x19.y += Q31i12j7R * dp.y + Q31i12j7I * dm.x;
+    x13.x += Q31i13j7R * dp.x + Q31i13j7I * dm.y;
+    x13.y += Q31i13j7R * dp.y - Q31i13j7I * dm.x;
+    x18.x += Q31i13j7R * dp.x - Q31i13j7I * dm.y;
+    x18.y += Q31i13j7R * dp.y + Q31i13j7I * dm.x;
+    x14.x += Q31i14j7R * dp.x + Q31i14j7I * dm.y;
+    x14.y += Q31i14j7R * dp.y - Q31i14j7I * dm.x;
+    x17.x += Q31i14j7R * dp.x - Q31i14j7I * dm.y;
+    x17.y += Q31i14j7R * dp.y + Q31i14j7I * dm.x;
+    x15.x += Q31i15j7R * dp.x + Q31i15j7I * dm.y;
+    x15.y += Q31i15j7R * dp.y - Q31i15j7I * dm.x;
+    x16.x += Q31i15j7R * dp.x - Q31i15j7I * dm.y;
+    x16.y += Q31i15j7R * dp.y + Q31i15j7I * dm.x;
+    dp = (*R8) + (*R23);
+    dm = (*R8) - (*R23);
+    x1.x += Q31i1j8R * dp.x + Q31i1j8I * dm.y;
+    x1.y += Q31i1j8R * dp.y - Q31i1j8I * dm.x;
+    x30.x += Q31i1j8R * dp.x - Q31i1j8I * dm.y;
+    x30.y += Q31i1j8R * dp.y + Q31i1j8I * dm.x;
+    x2.x += Q31i2j8R * dp.x + Q31i2j8I * dm.y;
+    x2.y += Q31i2j8R * dp.y - Q31i2j8I * dm.x;
+    x29.x += Q31i2j8R * dp.x - Q31i2j8I * dm.y;
+    x29.y += Q31i2j8R * dp.y + Q31i2j8I * dm.x;
+    x3.x += Q31i3j8R * dp.x + Q31i3j8I * dm.y;
+    x3.y += Q31i3j8R * dp.y - Q31i3j8I * dm.x;
+    x28.x += Q31i3j8R * dp.x - Q31i3j8I * dm.y;
+    x28.y += Q31i3j8R * dp.y + Q31i3j8I * dm.x;
+    x4.x += Q31i4j8R * dp.x + Q31i4j8I * dm.y;
+    x4.y += Q31i4j8R * dp.y - Q31i4j8I * dm.x;
+    x27.x += Q31i4j8R * dp.x - Q31i4j8I * dm.y;
+    x27.y += Q31i4j8R * dp.y + Q31i4j8I * dm.x;
+    x5.x += Q31i5j8R * dp.x + Q31i5j8I * dm.y;
+    x5.y += Q31i5j8R * dp.y - Q31i5j8I * dm.x;
+    x26.x += Q31i5j8R * dp.x - Q31i5j8I * dm.y;
+    x26.y += Q31i5j8R * dp.y + Q31i5j8I * dm.x;
+    x6.x += Q31i6j8R * dp.x + Q31i6j8I * dm.y;
+    x6.y += Q31i6j8R * dp.y - Q31i6j8I * dm.x;
+    x25.x += Q31i6j8R * dp.x - Q31i6j8I * dm.y;
+    x25.y += Q31i6j8R * dp.y + Q31i6j8I * dm.x;
+    x7.x += Q31i7j8R * dp.x + Q31i7j8I * dm.y;
+    x7.y += Q31i7j8R * dp.y - Q31i7j8I * dm.x;
+    x24.x += Q31i7j8R * dp.x - Q31i7j8I * dm.y;
+    x24.y += Q31i7j8R * dp.y + Q31i7j8I * dm.x;
+    x8.x += Q31i8j8R * dp.x + Q31i8j8I * dm.y;
+    x8.y += Q31i8j8R * dp.y - Q31i8j8I * dm.x;
+    x23.x += Q31i8j8R * dp.x - Q31i8j8I * dm.y;
+    x23.y += Q31i8j8R * dp.y + Q31i8j8I * dm.x;
+    x9.x += Q31i9j8R * dp.x + Q31i9j8I * dm.y;
+    x9.y += Q31i9j8R * dp.y - Q31i9j8I * dm.x;
+    x22.x += Q31i9j8R * dp.x - Q31i9j8I * dm.y;
+    x22.y += Q31i9j8R * dp.y + Q31i9j8I * dm.x;
+    x10.x += Q31i10j8R * dp.x + Q31i10j8I * dm.y;
+    x10.y += Q31i10j8R * dp.y - Q31i10j8I * dm.x;
+    x21.x += Q31i10j8R * dp.x - Q31i10j8I * dm.y;
+    x21.y += Q31i10j8R * dp.y + Q31i10j8I * dm.x;
+    x11.x += Q31i11j8R * dp.x + Q31i11j8I * dm.y;
+    x11.y += Q31i11j8R * dp.y - Q31i11j8I * dm.x;
+    x20.x += Q31i11j8R * dp.x - Q31i11j8I * dm.y;
+    x20.y += Q31i11j8R * dp.y + Q31i11j8I * dm.x;
+    x12.x += Q31i12j8R * dp.x + Q31i12j8I * dm.y;
+    x12.y += Q31i12j8R * dp.y - Q31i12j8I * dm.x;
+    x19.x += Q31i12j8R * dp.x - Q31i12j8I * dm.y;
+    x19.y += Q31i12j8R * dp.y + Q31i12j8I * dm.x;
+    x13.x += Q31i13j8R * dp.x + Q31i13j8I * dm.y;
+    x13.y += Q31i13j8R * dp.y - Q31i13j8I * dm.x;
+    x18.x += Q31i13j8R * dp.x - Q31i13j8I * dm.y;
+    x18.y += Q31i13j8R * dp.y + Q31i13j8I * dm.x;
+    x14.x += Q31i14j8R * dp.x + Q31i14j8I * dm.y;
+    x14.y += Q31i14j8R * dp.y - Q31i14j8I * dm.x;
+    x17.x += Q31i14j8R * dp.x - Q31i14j8I * dm.y;
+    x17.y += Q31i14j8R * dp.y + Q31i14j8I * dm.x;
+    x15.x += Q31i15j8R * dp.x + Q31i15j8I * dm.y;
+    x15.y += Q31i15j8R * dp.y - Q31i15j8I * dm.x;
+    x16.x += Q31i15j8R * dp.x - Q31i15j8I * dm.y;
+    x16.y += Q31i15j8R * dp.y + Q31i15j8I * dm.x;
+    dp = (*R9) + (*R22);
+    dm = (*R9) - (*R22);
+    x1.x += Q31i1j9R * dp.x + Q31i1j9I * dm.y;
+    x1.y += Q31i1j9R * dp.y - Q31i1j9I * dm.x;
+    x30.x += Q31i1j9R * dp.x - Q31i1j9I * dm.y;
+    x30.y += Q31i1j9R * dp.y + Q31i1j9I * dm.x;
+    x2.x += Q31i2j9R * dp.x + Q31i2j9I * dm.y;
+    x2.y += Q31i2j9R * dp.y - Q31i2j9I * dm.x;
+    x29.x += Q31i2j9R * dp.x - Q31i2j9I * dm.y;
+    x29.y += Q31i2j9R * dp.y + Q31i2j9I * dm.x;
+    x3.x += Q31i3j9R * dp.x + Q31i3j9I * dm.y;
+    x3.y += Q31i3j9R * dp.y - Q31i3j9I * dm.x;
+    x28.x += Q31i3j9R * dp.x - Q31i3j9I * dm.y;
+    x28.y += Q31i3j9R * dp.y + Q31i3j9I * dm.x;
+    x4.x += Q31i4j9R * dp.x + Q31i4j9I * dm.y;
+    x4.y += Q31i4j9R * dp.y - Q31i4j9I * dm.x;
+    x27.x += Q31i4j9R * dp.x - Q31i4j9I * dm.y;
+    x27.y += Q31i4j9R * dp.y + Q31i4j9I * dm.x;
+    x5.x += Q31i5j9R * dp.x + Q31i5j9I * dm.y;
+    x5.y += Q31i5j9R * dp.y - Q31i5j9I * dm.x;
+    x26.x += Q31i5j9R * dp.x - Q31i5j9I * dm.y;
+    x26.y += Q31i5j9R * dp.y + Q31i5j9I * dm.x;
+    x6.x += Q31i6j9R * dp.x + Q31i6j9I * dm.y;
+    x6.y += Q31i6j9R * dp.y - Q31i6j9I * dm.x;
+    x25.x += Q31i6j9R * dp.x - Q31i6j9I * dm.y;
+    x25.y += Q31i6j9R * dp.y + Q31i6j9I * dm.x;
+    x7.x += Q31i7j9R * dp.x + Q31i7j9I * dm.y;
+    x7.y += Q31i7j9R * dp.y - Q31i7j9I * dm.x;
+    x24.x += Q31i7j9R * dp.x - Q31i7j9I * dm.y;
+    x24.y += Q31i7j9R * dp.y + Q31i7j9I * dm.x;
+    x8.x += Q31i8j9R * dp.x + Q31i8j9I * dm.y;
+    x8.y += Q31i8j9R * dp.y - Q31i8j9I * dm.x;
+    x23.x += Q31i8j9R * dp.x - Q31i8j9I * dm.y;
+    x23.y += Q31i8j9R * dp.y + Q31i8j9I * dm.x;
+    x9.x += Q31i9j9R * dp.x + Q31i9j9I * dm.y;
+    x9.y += Q31i9j9R * dp.y - Q31i9j9I * dm.x;
+    x22.x += Q31i9j9R * dp.x - Q31i9j9I * dm.y;
+    x22.y += Q31i9j9R * dp.y + Q31i9j9I * dm.x;
+    x10.x += Q31i10j9R * dp.x + Q31i10j9I * dm.y;
+    x10.y += Q31i10j9R * dp.y - Q31i10j9I * dm.x;
+    x21.x += Q31i10j9R * dp.x - Q31i10j9I * dm.y;
+    x21.y += Q31i10j9R * dp.y + Q31i10j9I * dm.x;
+    x11.x += Q31i11j9R * dp.x + Q31i11j9I * dm.y;
+    x11.y += Q31i11j9R * dp.y - Q31i11j9I * dm.x;
+    x20.x += Q31i11j9R * dp.x - Q31i11j9I * dm.y;
+    x20.y += Q31i11j9R * dp.y + Q31i11j9I * dm.x;
+    x12.x += Q31i12j9R * dp.x + Q31i12j9I * dm.y;
+    x12.y += Q31i12j9R * dp.y - Q31i12j9I * dm.x;
+    x19.x += Q31i12j9R * dp.x - Q31i12j9I * dm.y;
+    x19.y += Q31i12j9R * dp.y + Q31i12j9I * dm.x;
+    x13.x += Q31i13j9R * dp.x + Q31i13j9I * dm.y;
+    x13.y += Q31i13j9R * dp.y - Q31i13j9I * dm.x;
+    x18.x += Q31i13j9R * dp.x - Q31i13j9I * dm.y;
+    x18.y += Q31i13j9R * dp.y + Q31i13j9I * dm.x;
+    x14.x += Q31i14j9R * dp.x + Q31i14j9I * dm.y;
+    x14.y += Q31i14j9R * dp.y - Q31i14j9I * dm.x;
+    x17.x += Q31i14j9R * dp.x - Q31i14j9I * dm.y;
+    x17.y += Q31i14j9R * dp.y + Q31i14j9I * dm.x;
+    x15.x += Q31i15j9R * dp.x + Q31i15j9I * dm.y;
+    x15.y += Q31i15j9R * dp.y - Q31i15j9I * dm.x;
+    x16.x += Q31i15j9R * dp.x - Q31i15j9I * dm.y;
+    x16.y += Q31i15j9R * dp.y + Q31i15j9I * dm.x;
+    dp = (*R10) + (*R21);
+    dm = (*R10) - (*R21);
+    x1.x += Q31i1j10R * dp.x + Q31i1j10I * dm.y;
+    x1.y += Q31i1j10R * dp.y - Q31i1j10I * dm.x;
+    x30.x += Q31i1j10R * dp.x - Q31i1j10I * dm.y;
+    x30.y += Q31i1j10R * dp.y + Q31i1j10I * dm.x;
+    x2.x += Q31i2j10R * dp.x + Q31i2j10I * dm.y;
+    x2.y += Q31i2j10R * dp.y - Q31i2j10I * dm.x;
+    x29.x += Q31i2j10R * dp.x - Q31i2j10I * dm.y;
+    x29.y += Q31i2j10R * dp.y + Q31i2j10I * dm.x;
+    x3.x += Q31i3j10R * dp.x + Q31i3j10I * dm.y;
+    x3.y += Q31i3j10R * dp.y - Q31i3j10I * dm.x;
+    x28.x += Q31i3j10R * dp.x - Q31i3j10I * dm.y;
+    x28.y += Q31i3j10R * dp.y + Q31i3j10I * dm.x;
+    x4.x += Q31i4j10R * dp.x + Q31i4j10I * dm.y;
+    x4.y += Q31i4j10R * dp.y - Q31i4j10I * dm.x;
+    x27.x += Q31i4j10R * dp.x - Q31i4j10I * dm.y;
+    x27.y += Q31i4j10R * dp.y + Q31i4j10I * dm.x;
+    x5.x += Q31i5j10R * dp.x + Q31i5j10I * dm.y;
+    x5.y += Q31i5j10R * dp.y - Q31i5j10I * dm.x;
+    x26.x += Q31i5j10R * dp.x - Q31i5j10I * dm.y;
+    x26.y += Q31i5j10R * dp.y + Q31i5j10I * dm.x;
+    x6.x += Q31i6j10R * dp.x + Q31i6j10I * dm.y;
+    x6.y += Q31i6j10R * dp.y - Q31i6j10I * dm.x;
+    x25.x += Q31i6j10R * dp.x - Q31i6j10I * dm.y;
+    x25.y += Q31i6j10R * dp.y + Q31i6j10I * dm.x;
+    x7.x += Q31i7j10R * dp.x + Q31i7j10I * dm.y;
+    x7.y += Q31i7j10R * dp.y - Q31i7j10I * dm.x;
+    x24.x += Q31i7j10R * dp.x - Q31i7j10I * dm.y;
+    x24.y += Q31i7j10R * dp.y + Q31i7j10I * dm.x;
+    x8.x += Q31i8j10R * dp.x + Q31i8j10I * dm.y;
+    x8.y += Q31i8j10R * dp.y - Q31i8j10I * dm.x;
+    x23.x += Q31i8j10R * dp.x - Q31i8j10I * dm.y;
+    x23.y += Q31i8j10R * dp.y + Q31i8j10I * dm.x;
+    x9.x += Q31i9j10R * dp.x + Q31i9j10I * dm.y;
+    x9.y += Q31i9j10R * dp.y - Q31i9j10I * dm.x;
+    x22.x += Q31i9j10R * dp.x - Q31i9j10I * dm.y;
+    x22.y += Q31i9j10R * dp.y + Q31i9j10I * dm.x;
+    x10.x += Q31i10j10R * dp.x + Q31i10j10I * dm.y;
+    x10.y += Q31i10j10R * dp.y - Q31i10j10I * dm.x;
+    x21.x += Q31i10j10R * dp.x - Q31i10j10I * dm.y;
+    x21.y += Q31i10j10R * dp.y + Q31i10j10I * dm.x;
+    x11.x += Q31i11j10R * dp.x + Q31i11j10I * dm.y;
+    x11.y += Q31i11j10R * dp.y - Q31i11j10I * dm.x;
+    x20.x += Q31i11j10R * dp.x - Q31i11j10I * dm.y;
+    x20.y += Q31i11j10R * dp.y + Q31i11j10I * dm.x;
+    x12.x += Q31i12j10R * dp.x + Q31i12j10I * dm.y;
+    x12.y += Q31i12j10R * dp.y - Q31i12j10I * dm.x;
+    x19.x += Q31i12j10R * dp.x - Q31i12j10I * dm.y;
+    x19.y += Q31i12j10R * dp.y + Q31i12j10I * dm.x;
+    x13.x += Q31i13j10R * dp.x + Q31i13j10I * dm.y;
+    x13.y += Q31i13j10R * dp.y - Q31i13j10I * dm.x;
+    x18.x += Q31i13j10R * dp.x - Q31i13j10I * dm.y;
+    x18.y += Q31i13j10R * dp.y + Q31i13j10I * dm.x;
+    x14.x += Q31i14j10R * dp.x + Q31i14j10I * dm.y;
+    x14.y += Q31i14j10R * dp.y - Q31i14j10I * dm.x;
+    x17.x += Q31i14j10R * dp.x - Q31i14j10I * dm.y;
+    x17.y += Q31i14j10R * dp.y + Q31i14j10I * dm.x;
+    x15.x += Q31i15j10R * dp.x + Q31i15j10I * dm.y;
+    x15.y += Q31i15j10R * dp.y - Q31i15j10I * dm.x;
+    x16.x += Q31i15j10R * dp.x - Q31i15j10I * dm.y;
+    x16.y += Q31i15j10R * dp.y + Q31i15j10I * dm.x;
+    dp = (*R11) + (*R20);
+    dm = (*R11) - (*R20);
+    x1.x += Q31i1j11R * dp.x + Q31i1j11I * dm.y;
+    x1.y += Q31i1j11R * dp.y - Q31i1j11I * dm.x;
+    x30.x += Q31i1j11R * dp.x - Q31i1j11I * dm.y;
+    x30.y += Q31i1j11R * dp.y + Q31i1j11I * dm.x;
+    x2.x += Q31i2j11R * dp.x + Q31i2j11I * dm.y;
+    x2.y += Q31i2j11R * dp.y - Q31i2j11I * dm.x;
+    x29.x += Q31i2j11R * dp.x - Q31i2j11I * dm.y;
+    x29.y += Q31i2j11R * dp.y + Q31i2j11I * dm.x;
+    x3.x += Q31i3j11R * dp.x + Q31i3j11I * dm.y;
+    x3.y += Q31i3j11R * dp.y - Q31i3j11I * dm.x;
+    x28.x += Q31i3j11R * dp.x - Q31i3j11I * dm.y;
+    x28.y += Q31i3j11R * dp.y + Q31i3j11I * dm.x;
+    x4.x += Q31i4j11R * dp.x + Q31i4j11I * dm.y;
+    x4.y += Q31i4j11R * dp.y - Q31i4j11I * dm.x;
+    x27.x += Q31i4j11R * dp.x - Q31i4j11I * dm.y;
+    x27.y += Q31i4j11R * dp.y + Q31i4j11I * dm.x;
+    x5.x += Q31i5j11R * dp.x + Q31i5j11I * dm.y;
+    x5.y += Q31i5j11R * dp.y - Q31i5j11I * dm.x;
+    x26.x += Q31i5j11R * dp.x - Q31i5j11I * dm.y;
+    x26.y += Q31i5j11R * dp.y + Q31i5j11I * dm.x;
+    x6.x += Q31i6j11R * dp.x + Q31i6j11I * dm.y;
+    x6.y += Q31i6j11R * dp.y - Q31i6j11I * dm.x;
+    x25.x += Q31i6j11R * dp.x - Q31i6j11I * dm.y;
+    x25.y += Q31i6j11R * dp.y + Q31i6j11I * dm.x;
+    x7.x += Q31i7j11R * dp.x + Q31i7j11I * dm.y;
+    x7.y += Q31i7j11R * dp.y - Q31i7j11I * dm.x;
+    x24.x += Q31i7j11R * dp.x - Q31i7j11I * dm.y;
+    x24.y += Q31i7j11R * dp.y + Q31i7j11I * dm.x;
+    x8.x += Q31i8j11R * dp.x + Q31i8j11I * dm.y;
+    x8.y += Q31i8j11R * dp.y - Q31i8j11I * dm.x;
+    x23.x += Q31i8j11R * dp.x - Q31i8j11I * dm.y;
+    x23.y += Q31i8j11R * dp.y + Q31i8j11I * dm.x;
+    x9.x += Q31i9j11R * dp.x + Q31i9j11I * dm.y;
+    x9.y += Q31i9j11R * dp.y - Q31i9j11I * dm.x;
+    x22.x += Q31i9j11R * dp.x - Q31i9j11I * dm.y;
+    x22.y += Q31i9j11R * dp.y + Q31i9j11I * dm.x;
+    x10.x += Q31i10j11R * dp.x + Q31i10j11I * dm.y;
+    x10.y += Q31i10j11R * dp.y - Q31i10j11I * dm.x;
+    x21.x += Q31i10j11R * dp.x - Q31i10j11I * dm.y;
+    x21.y += Q31i10j11R * dp.y + Q31i10j11I * dm.x;
+    x11.x += Q31i11j11R * dp.x + Q31i11j11I * dm.y;
+    x11.y += Q31i11j11R * dp.y - Q31i11j11I * dm.x;
+    x20.x += Q31i11j11R * dp.x - Q31i11j11I * dm.y;
+    x20.y += Q31i11j11R * dp.y + Q31i11j11I * dm.x;
+    x12.x += Q31i12j11R * dp.x + Q31i12j11I * dm.y;
+    x12.y += Q31i12j11R * dp.y - Q31i12j11I * dm.x;
+    x19.x += Q31i12j11R * dp.x - Q31i12j11I * dm.y;
+    x19.y += Q31i12j11R * dp.y + Q31i12j11I * dm.x;
+    x13.x += Q31i13j11R * dp.x + Q31i13j11I * dm.y;
+    x13.y += Q31i13j11R * dp.y - Q31i13j11I * dm.x;
+    x18.x += Q31i13j11R * dp.x - Q31i13j11I * dm.y;
+    x18.y += Q31i13j11R * dp.y + Q31i13j11I * dm.x;
+    x14.x += Q31i14j11R * dp.x + Q31i14j11I * dm.y;
+    x14.y += Q31i14j11R * dp.y - Q31i14j11I * dm.x;
+    x17.x += Q31i14j11R * dp.x - Q31i14j11I * dm.y;
+    x17.y += Q31i14j11R * dp.y + Q31i14j11I * dm.x;
+    x15.x += Q31i15j11R * dp.x + Q31i15j11I * dm.y;
+    x15.y += Q31i15j11R * dp.y - Q31i15j11I * dm.x;
+    x16.x += Q31i15j11R * dp.x - Q31i15j11I * dm.y;
+    x16.y += Q31i15j11R * dp.y + Q31i15j11I * dm.x;
+    dp = (*R12) + (*R19);
+    dm = (*R12) - (*R19);
+    x1.x += Q31i1j12R * dp.x + Q31i1j12I * dm.y;
+    x1.y += Q31i1j12R * dp.y - Q31i1j12I * dm.x;
+    x30.x += Q31i1j12R * dp.x - Q31i1j12I * dm.y;
+    x30.y += Q31i1j12R * dp.y + Q31i1j12I * dm.x;
+    x2.x += Q31i2j12R * dp.x + Q31i2j12I * dm.y;
+    x2.y += Q31i2j12R * dp.y - Q31i2j12I * dm.x;
+    x29.x += Q31i2j12R * dp.x - Q31i2j12I * dm.y;
+    x29.y += Q31i2j12R * dp.y + Q31i2j12I * dm.x;
+    x3.x += Q31i3j12R * dp.x + Q31i3j12I * dm.y;
+    x3.y += Q31i3j12R * dp.y - Q31i3j12I * dm.x;
+    x28.x += Q31i3j12R * dp.x - Q31i3j12I * dm.y;
+    x28.y += Q31i3j12R * dp.y + Q31i3j12I * dm.x;
+    x4.x += Q31i4j12R * dp.x + Q31i4j12I * dm.y;
+    x4.y += Q31i4j12R * dp.y - Q31i4j12I * dm.x;
+    x27.x += Q31i4j12R * dp.x - Q31i4j12I * dm.y;
+    x27.y += Q31i4j12R * dp.y + Q31i4j12I * dm.x;
+    x5.x += Q31i5j12R * dp.x + Q31i5j12I * dm.y;
+    x5.y += Q31i5j12R * dp.y - Q31i5j12I * dm.x;
+    x26.x += Q31i5j12R * dp.x - Q31i5j12I * dm.y;
+    x26.y += Q31i5j12R * dp.y + Q31i5j12I * dm.x;
+    x6.x += Q31i6j12R * dp.x + Q31i6j12I * dm.y;
+    x6.y += Q31i6j12R * dp.y - Q31i6j12I * dm.x;
+    x25.x += Q31i6j12R * dp.x - Q31i6j12I * dm.y;
+    x25.y += Q31i6j12R * dp.y + Q31i6j12I * dm.x;
+    x7.x += Q31i7j12R * dp.x + Q31i7j12I * dm.y;
+    x7.y += Q31i7j12R * dp.y - Q31i7j12I * dm.x;
+    x24.x += Q31i7j12R * dp.x - Q31i7j12I * dm.y;
+    x24.y += Q31i7j12R * dp.y + Q31i7j12I * dm.x;
+    x8.x += Q31i8j12R * dp.x + Q31i8j12I * dm.y;
+    x8.y += Q31i8j12R * dp.y - Q31i8j12I * dm.x;
+    x23.x += Q31i8j12R * dp.x - Q31i8j12I * dm.y;
+    x23.y += Q31i8j12R * dp.y + Q31i8j12I * dm.x;
+    x9.x += Q31i9j12R * dp.x + Q31i9j12I * dm.y;
+    x9.y += Q31i9j12R * dp.y - Q31i9j12I * dm.x;
+    x22.x += Q31i9j12R * dp.x - Q31i9j12I * dm.y;
+    x22.y += Q31i9j12R * dp.y + Q31i9j12I * dm.x;
+    x10.x += Q31i10j12R * dp.x + Q31i10j12I * dm.y;
+    x10.y += Q31i10j12R * dp.y - Q31i10j12I * dm.x;
+    x21.x += Q31i10j12R * dp.x - Q31i10j12I * dm.y;
+    x21.y += Q31i10j12R * dp.y + Q31i10j12I * dm.x;
+    x11.x += Q31i11j12R * dp.x + Q31i11j12I * dm.y;
+    x11.y += Q31i11j12R * dp.y - Q31i11j12I * dm.x;
+    x20.x += Q31i11j12R * dp.x - Q31i11j12I * dm.y;
+    x20.y += Q31i11j12R * dp.y + Q31i11j12I * dm.x;
+    x12.x += Q31i12j12R * dp.x + Q31i12j12I * dm.y;
+    x12.y += Q31i12j12R * dp.y - Q31i12j12I * dm.x;
+    x19.x += Q31i12j12R * dp.x - Q31i12j12I * dm.y;
+    x19.y += Q31i12j12R * dp.y + Q31i12j12I * dm.x;
+    x13.x += Q31i13j12R * dp.x + Q31i13j12I * dm.y;
+    x13.y += Q31i13j12R * dp.y - Q31i13j12I * dm.x;
+    x18.x += Q31i13j12R * dp.x - Q31i13j12I * dm.y;
+    x18.y += Q31i13j12R * dp.y + Q31i13j12I * dm.x;
+    x14.x += Q31i14j12R * dp.x + Q31i14j12I * dm.y;
+    x14.y += Q31i14j12R * dp.y - Q31i14j12I * dm.x;
+    x17.x += Q31i14j12R * dp.x - Q31i14j12I * dm.y;
+    x17.y += Q31i14j12R * dp.y + Q31i14j12I * dm.x;
+    x15.x += Q31i15j12R * dp.x + Q31i15j12I * dm.y;
+    x15.y += Q31i15j12R * dp.y - Q31i15j12I * dm.x;
+    x16.x += Q31i15j12R * dp.x - Q31i15j12I * dm.y;
+    x16.y += Q31i15j12R * dp.y + Q31i15j12I * dm.x;
+    dp = (*R13) + (*R18);
+    dm = (*R13) - (*R18);
+    x1.x += Q31i1j13R * dp.x + Q31i1j13I * dm.y;
+    x1.y += Q31i1j13R * dp.y - Q31i1j13I * dm.x;
+    x30.x += Q31i1j13R * dp.x - Q31i1j13I * dm.y;
+    x30.y += Q31i1j13R * dp.y + Q31i1j13I * dm.x;
+    x2.x += Q31i2j13R * dp.x + Q31i2j13I * dm.y;
+    x2.y += Q31i2j13R * dp.y - Q31i2j13I * dm.x;
+    x29.x += Q31i2j13R * dp.x - Q31i2j13I * dm.y;
+    x29.y += Q31i2j13R * dp.y + Q31i2j13I * dm.x;
+    x3.x += Q31i3j13R * dp.x + Q31i3j13I * dm.y;
+    x3.y += Q31i3j13R * dp.y - Q31i3j13I * dm.x;
+    x28.x += Q31i3j13R * dp.x - Q31i3j13I * dm.y;
+    x28.y += Q31i3j13R * dp.y + Q31i3j13I * dm.x;
+    x4.x += Q31i4j13R * dp.x + Q31i4j13I * dm.y;
+    x4.y += Q31i4j13R * dp.y - Q31i4j13I * dm.x;
+    x27.x += Q31i4j13R * dp.x - Q31i4j13I * dm.y;
+    x27.y += Q31i4j13R * dp.y + Q31i4j13I * dm.x;
+    x5.x += Q31i5j13R * dp.x + Q31i5j13I * dm.y;
+    x5.y += Q31i5j13R * dp.y - Q31i5j13I * dm.x;
+    x26.x += Q31i5j13R * dp.x - Q31i5j13I * dm.y;
+    x26.y += Q31i5j13R * dp.y + Q31i5j13I * dm.x;
+    x6.x += Q31i6j13R * dp.x + Q31i6j13I * dm.y;
+    x6.y += Q31i6j13R * dp.y - Q31i6j13I * dm.x;
+    x25.x += Q31i6j13R * dp.x - Q31i6j13I * dm.y;
+    x25.y += Q31i6j13R * dp.y + Q31i6j13I * dm.x;
+    x7.x += Q31i7j13R * dp.x + Q31i7j13I * dm.y;
+    x7.y += Q31i7j13R * dp.y - Q31i7j13I * dm.x;
+    x24.x += Q31i7j13R * dp.x - Q31i7j13I * dm.y;
+    x24.y += Q31i7j13R * dp.y + Q31i7j13I * dm.x;
+    x8.x += Q31i8j13R * dp.x + Q31i8j13I * dm.y;
+    x8.y += Q31i8j13R * dp.y - Q31i8j13I * dm.x;
+    x23.x += Q31i8j13R * dp.x - Q31i8j13I * dm.y;
+    x23.y += Q31i8j13R * dp.y + Q31i8j13I * dm.x;
+    x9.x += Q31i9j13R * dp.x + Q31i9j13I * dm.y;
+    x9.y += Q31i9j13R * dp.y - Q31i9j13I * dm.x;
+    x22.x += Q31i9j13R * dp.x - Q31i9j13I * dm.y;
+    x22.y += Q31i9j13R * dp.y + Q31i9j13I * dm.x;
+    x10.x += Q31i10j13R * dp.x + Q31i10j13I * dm.y;
+    x10.y += Q31i10j13R * dp.y - Q31i10j13I * dm.x;
+    x21.x += Q31i10j13R * dp.x - Q31i10j13I * dm.y;
+    x21.y += Q31i10j13R * dp.y + Q31i10j13I * dm.x;
+    x11.x += Q31i11j13R * dp.x + Q31i11j13I * dm.y;
+    x11.y += Q31i11j13R * dp.y - Q31i11j13I * dm.x;
+    x20.x += Q31i11j13R * dp.x - Q31i11j13I * dm.y;
+    x20.y += Q31i11j13R * dp.y + Q31i11j13I * dm.x;
+    x12.x += Q31i12j13R * dp.x + Q31i12j13I * dm.y;
+    x12.y += Q31i12j13R * dp.y - Q31i12j13I * dm.x;
+    x19.x += Q31i12j13R * dp.x - Q31i12j13I * dm.y;
+    x19.y += Q31i12j13R * dp.y + Q31i12j13I * dm.x;
+    x13.x += Q31i13j13R * dp.x + Q31i13j13I * dm.y;
+    x13.y += Q31i13j13R * dp.y - Q31i13j13I * dm.x;
+    x18.x += Q31i13j13R * dp.x - Q31i13j13I * dm.y;
+    x18.y += Q31i13j13R * dp.y + Q31i13j13I * dm.x;
+    x14.x += Q31i14j13R * dp.x + Q31i14j13I * dm.y;
+    x14.y += Q31i14j13R * dp.y - Q31i14j13I * dm.x;
+    x17.x += Q31i14j13R * dp.x - Q31i14j13I * dm.y;
+    x17.y += Q31i14j13R * dp.y + Q31i14j13I * dm.x;
+    x15.x += Q31i15j13R * dp.x + Q31i15j13I * dm.y;
+    x15.y += Q31i15j13R * dp.y - Q31i15j13I * dm.x;
+    x16.x += Q31i15j13R * dp.x - Q31i15j13I * dm.y;
+    x16.y += Q31i15j13R * dp.y + Q31i15j13I * dm.x;
+    dp = (*R14) + (*R17);
+    dm = (*R14) - (*R17);
+    x1.x += Q31i1j14R * dp.x + Q31i1j14I * dm.y;
+    x1.y += Q31i1j14R * dp.y - Q31i1j14I * dm.x;
+    x30.x += Q31i1j14R * dp.x - Q31i1j14I * dm.y;
+    x30.y += Q31i1j14R * dp.y + Q31i1j14I * dm.x;
+    x2.x += Q31i2j14R * dp.x + Q31i2j14I * dm.y;
+    x2.y += Q31i2j14R * dp.y - Q31i2j14I * dm.x;
+    x29.x += Q31i2j14R * dp.x - Q31i2j14I * dm.y;
+    x29.y += Q31i2j14R * dp.y + Q31i2j14I * dm.x;
+    x3.x += Q31i3j14R * dp.x + Q31i3j14I * dm.y;
+    x3.y += Q31i3j14R * dp.y - Q31i3j14I * dm.x;
+    x28.x += Q31i3j14R * dp.x - Q31i3j14I * dm.y;
+    x28.y += Q31i3j14R * dp.y + Q31i3j14I * dm.x;
+    x4.x += Q31i4j14R * dp.x + Q31i4j14I * dm.y;
+    x4.y += Q31i4j14R * dp.y - Q31i4j14I * dm.x;
+    x27.x += Q31i4j14R * dp.x - Q31i4j14I * dm.y;
+    x27.y += Q31i4j14R * dp.y + Q31i4j14I * dm.x;
+    x5.x += Q31i5j14R * dp.x + Q31i5j14I * dm.y;
+    x5.y += Q31i5j14R * dp.y - Q31i5j14I * dm.x;
+    x26.x += Q31i5j14R * dp.x - Q31i5j14I * dm.y;
+    x26.y += Q31i5j14R * dp.y + Q31i5j14I * dm.x;
+    x6.x += Q31i6j14R * dp.x + Q31i6j14I * dm.y;
+    x6.y += Q31i6j14R * dp.y - Q31i6j14I * dm.x;
+    x25.x += Q31i6j14R * dp.x - Q31i6j14I * dm.y;
+    x25.y += Q31i6j14R * dp.y + Q31i6j14I * dm.x;
+    x7.x += Q31i7j14R * dp.x + Q31i7j14I * dm.y;
+    x7.y += Q31i7j14R * dp.y - Q31i7j14I * dm.x;
+    x24.x += Q31i7j14R * dp.x - Q31i7j14I * dm.y;
+    x24.y += Q31i7j14R * dp.y + Q31i7j14I * dm.x;
+    x8.x += Q31i8j14R * dp.x + Q31i8j14I * dm.y;
+    x8.y += Q31i8j14R * dp.y - Q31i8j14I * dm.x;
+    x23.x += Q31i8j14R * dp.x - Q31i8j14I * dm.y;
+    x23.y += Q31i8j14R * dp.y + Q31i8j14I * dm.x;
+    x9.x += Q31i9j14R * dp.x + Q31i9j14I * dm.y;
+    x9.y += Q31i9j14R * dp.y - Q31i9j14I * dm.x;
+    x22.x += Q31i9j14R * dp.x - Q31i9j14I * dm.y;
+    x22.y += Q31i9j14R * dp.y + Q31i9j14I * dm.x;
+    x10.x += Q31i10j14R * dp.x + Q31i10j14I * dm.y;
+    x10.y += Q31i10j14R * dp.y - Q31i10j14I * dm.x;
+    x21.x += Q31i10j14R * dp.x - Q31i10j14I * dm.y;
+    x21.y += Q31i10j14R * dp.y + Q31i10j14I * dm.x;
+    x11.x += Q31i11j14R * dp.x + Q31i11j14I * dm.y;
+    x11.y += Q31i11j14R * dp.y - Q31i11j14I * dm.x;
+    x20.x += Q31i11j14R * dp.x - Q31i11j14I * dm.y;
+    x20.y += Q31i11j14R * dp.y + Q31i11j14I * dm.x;
+    x12.x += Q31i12j14R * dp.x + Q31i12j14I * dm.y;
+    x12.y += Q31i12j14R * dp.y - Q31i12j14I * dm.x;
+    x19.x += Q31i12j14R * dp.x - Q31i12j14I * dm.y;
+    x19.y += Q31i12j14R * dp.y + Q31i12j14I * dm.x;
+    x13.x += Q31i13j14R * dp.x + Q31i13j14I * dm.y;
+    x13.y += Q31i13j14R * dp.y - Q31i13j14I * dm.x;
+    x18.x += Q31i13j14R * dp.x - Q31i13j14I * dm.y;
+    x18.y += Q31i13j14R * dp.y + Q31i13j14I * dm.x;
+    x14.x += Q31i14j14R * dp.x + Q31i14j14I * dm.y;
+    x14.y += Q31i14j14R * dp.y - Q31i14j14I * dm.x;
+    x17.x += Q31i14j14R * dp.x - Q31i14j14I * dm.y;
+    x17.y += Q31i14j14R * dp.y + Q31i14j14I * dm.x;
+    x15.x += Q31i15j14R * dp.x + Q31i15j14I * dm.y;
+    x15.y += Q31i15j14R * dp.y - Q31i15j14I * dm.x;
+    x16.x += Q31i15j14R * dp.x - Q31i15j14I * dm.y;
+    x16.y += Q31i15j14R * dp.y + Q31i15j14I * dm.x;
+    dp = (*R15) + (*R16);
+    dm = (*R15) - (*R16);
+    x1.x += Q31i1j15R * dp.x + Q31i1j15I * dm.y;
+    x1.y += Q31i1j15R * dp.y - Q31i1j15I * dm.x;
+    x30.x += Q31i1j15R * dp.x - Q31i1j15I * dm.y;
+    x30.y += Q31i1j15R * dp.y + Q31i1j15I * dm.x;
+    x2.x += Q31i2j15R * dp.x + Q31i2j15I * dm.y;
+    x2.y += Q31i2j15R * dp.y - Q31i2j15I * dm.x;
+    x29.x += Q31i2j15R * dp.x - Q31i2j15I * dm.y;
+    x29.y += Q31i2j15R * dp.y + Q31i2j15I * dm.x;
+    x3.x += Q31i3j15R * dp.x + Q31i3j15I * dm.y;
+    x3.y += Q31i3j15R * dp.y - Q31i3j15I * dm.x;
+    x28.x += Q31i3j15R * dp.x - Q31i3j15I * dm.y;
+    x28.y += Q31i3j15R * dp.y + Q31i3j15I * dm.x;
+    x4.x += Q31i4j15R * dp.x + Q31i4j15I * dm.y;
+    x4.y += Q31i4j15R * dp.y - Q31i4j15I * dm.x;
+    x27.x += Q31i4j15R * dp.x - Q31i4j15I * dm.y;
+    x27.y += Q31i4j15R * dp.y + Q31i4j15I * dm.x;
+    x5.x += Q31i5j15R * dp.x + Q31i5j15I * dm.y;
+    x5.y += Q31i5j15R * dp.y - Q31i5j15I * dm.x;
+    x26.x += Q31i5j15R * dp.x - Q31i5j15I * dm.y;
+    x26.y += Q31i5j15R * dp.y + Q31i5j15I * dm.x;
+    x6.x += Q31i6j15R * dp.x + Q31i6j15I * dm.y;
+    x6.y += Q31i6j15R * dp.y - Q31i6j15I * dm.x;
+    x25.x += Q31i6j15R * dp.x - Q31i6j15I * dm.y;
+    x25.y += Q31i6j15R * dp.y + Q31i6j15I * dm.x;
+    x7.x += Q31i7j15R * dp.x + Q31i7j15I * dm.y;
+    x7.y += Q31i7j15R * dp.y - Q31i7j15I * dm.x;
+    x24.x += Q31i7j15R * dp.x - Q31i7j15I * dm.y;
+    x24.y += Q31i7j15R * dp.y + Q31i7j15I * dm.x;
+    x8.x += Q31i8j15R * dp.x + Q31i8j15I * dm.y;
+    x8.y += Q31i8j15R * dp.y - Q31i8j15I * dm.x;
+    x23.x += Q31i8j15R * dp.x - Q31i8j15I * dm.y;
+    x23.y += Q31i8j15R * dp.y + Q31i8j15I * dm.x;
+    x9.x += Q31i9j15R * dp.x + Q31i9j15I * dm.y;
+    x9.y += Q31i9j15R * dp.y - Q31i9j15I * dm.x;
+    x22.x += Q31i9j15R * dp.x - Q31i9j15I * dm.y;
+    x22.y += Q31i9j15R * dp.y + Q31i9j15I * dm.x;
+    x10.x += Q31i10j15R * dp.x + Q31i10j15I * dm.y;
+    x10.y += Q31i10j15R * dp.y - Q31i10j15I * dm.x;
+    x21.x += Q31i10j15R * dp.x - Q31i10j15I * dm.y;
+    x21.y += Q31i10j15R * dp.y + Q31i10j15I * dm.x;
+    x11.x += Q31i11j15R * dp.x + Q31i11j15I * dm.y;
+    x11.y += Q31i11j15R * dp.y - Q31i11j15I * dm.x;
+    x20.x += Q31i11j15R * dp.x - Q31i11j15I * dm.y;
+    x20.y += Q31i11j15R * dp.y + Q31i11j15I * dm.x;
+    x12.x += Q31i12j15R * dp.x + Q31i12j15I * dm.y;
+    x12.y += Q31i12j15R * dp.y - Q31i12j15I * dm.x;
+    x19.x += Q31i12j15R * dp.x - Q31i12j15I * dm.y;
+    x19.y += Q31i12j15R * dp.y + Q31i12j15I * dm.x;
+    x13.x += Q31i13j15R * dp.x + Q31i13j15I * dm.y;
+    x13.y += Q31i13j15R * dp.y - Q31i13j15I * dm.x;
+    x18.x += Q31i13j15R * dp.x - Q31i13j15I * dm.y;
+    x18.y += Q31i13j15R * dp.y + Q31i13j15I * dm.x;
+    x14.x += Q31i14j15R * dp.x + Q31i14j15I * dm.y;
+    x14.y += Q31i14j15R * dp.y - Q31i14j15I * dm.x;
+    x17.x += Q31i14j15R * dp.x - Q31i14j15I * dm.y;
+    x17.y += Q31i14j15R * dp.y + Q31i14j15I * dm.x;
+    x15.x += Q31i15j15R * dp.x + Q31i15j15I * dm.y;
+    x15.y += Q31i15j15R * dp.y - Q31i15j15I * dm.x;
+    x16.x += Q31i15j15R * dp.x - Q31i15j15I * dm.y;
+    x16.y += Q31i15j15R * dp.y + Q31i15j15I * dm.x;
+    (*R0)  = x0;
+    (*R1)  = x1;
+    (*R2)  = x2;
+    (*R3)  = x3;
+    (*R4)  = x4;
+    (*R5)  = x5;
+    (*R6)  = x6;
+    (*R7)  = x7;
+    (*R8)  = x8;
+    (*R9)  = x9;
+    (*R10) = x10;
+    (*R11) = x11;
+    (*R12) = x12;
+    (*R13) = x13;
+    (*R14) = x14;
+    (*R15) = x15;
+    (*R16) = x16;
+    (*R17) = x17;
+    (*R18) = x18;
+    (*R19) = x19;
+    (*R20) = x20;
+    (*R21) = x21;
+    (*R22) = x22;
+    (*R23) = x23;
+    (*R24) = x24;
+    (*R25) = x25;
+    (*R26) = x26;
+    (*R27) = x27;
+    (*R28) = x28;
+    (*R29) = x29;
+    (*R30) = x30;
+}
@@ -84,3 +84,76 @@ __device__ void InvRad8B1(T* R0, T* R4, T* R2, T* R6, T* R1, T* R5, T* R3, T* R7
     (*R3) = (*R6);
     (*R6) = res;
 }
+
+// Conjugate-pair split-radix butterflies: a length-4 DFT of the even
+// inputs, plus length-2 DFTs of the inputs at 4n+1 and 4n-1 that are
+// twiddled by w^k and w^-k.  Only the two odd terms need multiplies.
+template <typename T>
+__device__ void FwdRad8B1SplitRadix(T* R0, T* R1, T* R2, T* R3, T* R4, T* R5, T* R6, T* R7)
+{
+    T t0 = (*R0) + (*R4);
+    T t1 = (*R0) - (*R4);
+    T t2 = (*R2) + (*R6);
+    T t3 = (*R2) - (*R6);
+    T u0 = t0 + t2;
+    T u2 = t0 - t2;
+    T u1 = t1 + T(t3.y, -t3.x);
+    T u3 = t1 - T(t3.y, -t3.x);
+
+    T z0  = (*R1) + (*R5);
+    T z1  = (*R1) - (*R5);
+    T zc0 = (*R7) + (*R3);
+    T zc1 = (*R7) - (*R3);
+
+    T a = C8Q * T(z1.x + z1.y, z1.y - z1.x);
+    T b = C8Q * T(zc1.x - zc1.y, zc1.y + zc1.x);
+
+    T s0 = z0 + zc0;
+    T d0 = z0 - zc0;
+    T s1 = a + b;
+    T d1 = a - b;
+
+    (*R0) = u0 + s0;
+    (*R4) = u0 - s0;
+    (*R2) = u2 + T(d0.y, -d0.x);
+    (*R6) = u2 - T(d0.y, -d0.x);
+    (*R1) = u1 + s1;
+    (*R5) = u1 - s1;
+    (*R3) = u3 + T(d1.y, -d1.x);
+    (*R7) = u3 - T(d1.y, -d1.x);
+}
+
+template <typename T>
+__device__ void InvRad8B1SplitRadix(T* R0, T* R1, T* R2, T* R3, T* R4, T* R5, T* R6, T* R7)
+{
+    T t0 = (*R0) + (*R4);
+    T t1 = (*R0) - (*R4);
+    T t2 = (*R2) + (*R6);
+    T t3 = (*R2) - (*R6);
+    T u0 = t0 + t2;
+    T u2 = t0 - t2;
+    T u1 = t1 + T(-t3.y, t3.x);
+    T u3 = t1 - T(-t3.y, t3.x);
+
+    T z0  = (*R1) + (*R5);
+    T z1  = (*R1) - (*R5);
+    T zc0 = (*R7) + (*R3);
+    T zc1 = (*R7) - (*R3);
+
+    T a = C8Q * T(z1.x - z1.y, z1.y + z1.x);
+    T b = C8Q * T(zc1.x + zc1.y, zc1.y - zc1.x);
+
+    T s0 = z0 + zc0;
+    T d0 = z0 - zc0;
+    T s1 = a + b;
+    T d1 = a - b;
+
+    (*R0) = u0 + s0;
+    (*R4) = u0 - s0;
+    (*R2) = u2 + T(-d0.y, d0.x);
+    (*R6) = u2 - T(-d0.y, d0.x);
+    (*R1) = u1 + s1;
+    (*R5) = u1 - s1;
+    (*R3) = u3 + T(-d1.y, d1.x);
+    (*R7) = u3 - T(-d1.y, d1.x);
+}
@@ -53,6 +53,8 @@ struct StockhamGeneratorSpecs
     unsigned int threads_per_transform = 0;
     bool         half_lds              = false;
     bool         direct_to_from_reg    = false;
+    // use split-radix butterflies for radices that have them
+    bool split_radix = false;
     // dimension of the kernel - 0 if the generated kernel accepts a
     // 'dim' argument at runtime; otherwise the dimension is
     // statically defined for the kernel
@@ -463,7 +463,7 @@ struct StockhamKernel : public StockhamGeneratorSpecs
         std::vector<Expression> args;
         for(unsigned int w = 0; w < width; ++w)
             args.push_back(R + (hr * width + w));
-        return {Butterfly{true, args}};
+        return {Butterfly{true, args, split_radix && Butterfly::split_radix_supported(width)}};
     }
 
     StatementList load_global_generator(unsigned int h,
@@ -46,6 +46,10 @@ extern const char* radix_11_h;
 extern const char* radix_13_h;
 extern const char* radix_16_h;
 extern const char* radix_17_h;
+extern const char* radix_19_h;
+extern const char* radix_23_h;
+extern const char* radix_29_h;
+extern const char* radix_31_h;
 
 extern const char* device_properties_h;
 extern const char* rocfft_hip_h;
@@ -71,7 +75,11 @@ static void append_radix_h(std::string& src, const std::vector<unsigned int>& fa
                                                                             {11, radix_11_h},
                                                                             {13, radix_13_h},
                                                                             {16, radix_16_h},
-                                                                            {17, radix_17_h}};
+                                                                            {17, radix_17_h},
+                                                                            {19, radix_19_h},
+                                                                            {23, radix_23_h},
+                                                                            {29, radix_29_h},
+                                                                            {31, radix_31_h}};
 
     // factors may contain duplicates, so uniquify them
     std::vector<unsigned int> factors_uniq = factors;
@@ -245,25 +245,31 @@ def list_small_kernels():
         NS(length=  16, workgroup_size= 64, threads_per_transform=  4, factors=(4, 4), runtime_compile=True),
         NS(length=  17, workgroup_size=256, threads_per_transform=  1, factors=(17,), runtime_compile=True),
         NS(length=  18, workgroup_size= 64, threads_per_transform=  6, factors=(3, 6), runtime_compile=True),
+        NS(length=  19, workgroup_size=256, threads_per_transform=  1, factors=(19,), runtime_compile=True),
         NS(length=  20, workgroup_size=256, threads_per_transform= 10, factors=(5, 4), runtime_compile=True),
         NS(length=  21, workgroup_size=128, threads_per_transform=  7, factors=(3, 7), runtime_compile=True),
         NS(length=  22, workgroup_size= 64, threads_per_transform=  2, factors=(11, 2), runtime_compile=True),
+        NS(length=  23, workgroup_size=256, threads_per_transform=  1, factors=(23,), runtime_compile=True),
         NS(length=  24, workgroup_size=256, threads_per_transform=  8, factors=(8, 3), runtime_compile=True),
         NS(length=  25, workgroup_size=256, threads_per_transform=  5, factors=(5, 5), runtime_compile=True),
         NS(length=  26, workgroup_size= 64, threads_per_transform=  2, factors=(13, 2), runtime_compile=True),
         NS(length=  27, workgroup_size=256, threads_per_transform=  9, factors=(3, 3, 3), runtime_compile=True),
         NS(length=  28, workgroup_size= 64, threads_per_transform=  4, factors=(7, 4), runtime_compile=True),
+        NS(length=  29, workgroup_size=256, threads_per_transform=  1, factors=(29,), runtime_compile=True),
         NS(length=  30, workgroup_size=128, threads_per_transform= 10, factors=(10, 3), runtime_compile=True),
+        NS(length=  31, workgroup_size=256, threads_per_transform=  1, factors=(31,), runtime_compile=True),
         NS(length=  32, workgroup_size=128, threads_per_transform= 16, factors=(8, 4)),
         NS(length=  33, workgroup_size=256, threads_per_transform= 11, factors=(11, 3), runtime_compile=True),
         NS(length=  34, workgroup_size=256, threads_per_transform= 17, factors=(17, 2), runtime_compile=True),
         NS(length=  35, workgroup_size=256, threads_per_transform=  7, factors=(5, 7), half_lds=False, runtime_compile=True),
         NS(length=  36, workgroup_size= 64, threads_per_transform=  6, factors=(6, 6)),
+        NS(length=  38, workgroup_size=256, threads_per_transform= 19, factors=(19, 2), runtime_compile=True),
         NS(length=  39, workgroup_size=256, threads_per_transform= 13, factors=(13, 3), runtime_compile=True),
         NS(length=  40, workgroup_size=128, threads_per_transform= 10, factors=(10, 4)),
         NS(length=  42, workgroup_size=256, threads_per_transform=  7, factors=(7, 6)),
         NS(length=  44, workgroup_size= 64, threads_per_transform=  4, factors=(11, 4)),
         NS(length=  45, workgroup_size=128, threads_per_transform= 15, factors=(5, 3, 3)),
+        NS(length=  46, workgroup_size=256, threads_per_transform= 23, factors=(23, 2), runtime_compile=True),
         NS(length=  48, workgroup_size= 64, threads_per_transform= 16, factors=(4, 3, 4)),
         NS(length=  49, workgroup_size= 64, threads_per_transform=  7, factors=(7, 7)),
         NS(length=  50, workgroup_size=256, threads_per_transform= 10, factors=(10, 5)),
@@ -272,24 +278,32 @@ def list_small_kernels():
         NS(length=  54, workgroup_size=256, threads_per_transform= 18, factors=(6, 3, 3)),
         NS(length=  55, workgroup_size=256, threads_per_transform= 11, factors=(5, 11), half_lds=False, runtime_compile=True),
         NS(length=  56, workgroup_size=128, threads_per_transform=  8, factors=(7, 8)),
+        NS(length=  57, workgroup_size=256, threads_per_transform= 19, factors=(19, 3), runtime_compile=True),
+        NS(length=  58, workgroup_size=256, threads_per_transform= 29, factors=(29, 2), runtime_compile=True),
         NS(length=  60, workgroup_size= 64, threads_per_transform= 10, factors=(6, 10)),
+        NS(length=  62, workgroup_size=256, threads_per_transform= 31, factors=(31, 2), runtime_compile=True),
         NS(length=  63, workgroup_size=256, threads_per_transform= 21, factors=(3, 3, 7), half_lds=False, runtime_compile=True),
         NS(length=  64, workgroup_size= 64, threads_per_transform= 16, factors=(4, 4, 4), half_lds=False, direct_to_from_reg=True),
         NS(length=  65, workgroup_size=256, threads_per_transform= 13, factors=(13, 5), runtime_compile=True),
         NS(length=  66, workgroup_size=256, threads_per_transform= 11, factors=(6, 11), half_lds=False, runtime_compile=True),
         NS(length=  68, workgroup_size=256, threads_per_transform= 17, factors=(17, 4), runtime_compile=True),
+        NS(length=  69, workgroup_size=256, threads_per_transform= 23, factors=(23, 3), runtime_compile=True),
         NS(length=  70, workgroup_size=256, threads_per_transform= 14, factors=(2, 5, 7), runtime_compile=True),
         NS(length=  72, workgroup_size= 64, threads_per_transform=  9, factors=(8, 3, 3)),
         NS(length=  75, workgroup_size=256, threads_per_transform= 25, factors=(5, 5, 3)),
+        NS(length=  76, workgroup_size=256, threads_per_transform= 19, factors=(19, 4), runtime_compile=True),
         NS(length=  77, workgroup_size=256, threads_per_transform= 11, factors=(7, 11), runtime_compile=True),
         NS(length=  78, workgroup_size=256, threads_per_transform= 13, factors=(6, 13), half_lds=False, runtime_compile=True),
         NS(length=  80, workgroup_size= 64, threads_per_transform= 10, factors=(5, 2, 8)),
         NS(length=  81, workgroup_size=128, threads_per_transform= 27, factors=(3, 3, 3, 3)),
         NS(length=  84, workgroup_size=128, threads_per_transform= 12, factors=(7, 2, 6)),
         NS(length=  85, workgroup_size=256, threads_per_transform= 17, factors=(17, 5), runtime_compile=True),
+        NS(length=  87, workgroup_size=256, threads_per_transform= 29, factors=(29, 3), runtime_compile=True),
         NS(length=  88, workgroup_size=128, threads_per_transform= 11, factors=(11, 8)),
         NS(length=  90, workgroup_size= 64, threads_per_transform=  9, factors=(3, 3, 10)),
         NS(length=  91, workgroup_size=256, threads_per_transform= 13, factors=(7, 13), half_lds=False, runtime_compile=True),
+        NS(length=  92, workgroup_size=256, threads_per_transform= 23, factors=(23, 4), runtime_compile=True),
+        NS(length=  93, workgroup_size=256, threads_per_transform= 31, factors=(31, 3), runtime_compile=True),
         NS(length=  96, workgroup_size=128, threads_per_transform= 16, factors=(6, 16), half_lds=False, direct_to_from_reg=False),
         NS(length=  98, workgroup_size= 256, threads_per_transform= 14, factors=(2, 7, 7), half_lds=False, runtime_compile=True),
         NS(length=  99, workgroup_size= 256, threads_per_transform= 11, factors=(3, 3, 11), half_lds=False, runtime_compile=True),
@@ -300,10 +314,12 @@ def list_small_kernels():
         NS(length= 108, workgroup_size=256, threads_per_transform= 36, factors=(6, 6, 3)),
         NS(length= 110, workgroup_size=256, threads_per_transform= 11, factors=(2, 5, 11), half_lds=False, runtime_compile=True),
         NS(length= 112, workgroup_size=256, threads_per_transform= 16, factors=(16, 7), half_lds=False, direct_to_from_reg=False),
+        NS(length= 116, workgroup_size=256, threads_per_transform= 29, factors=(29, 4), runtime_compile=True),
         NS(length= 117, workgroup_size= 64, threads_per_transform= 13, factors=(13, 9), runtime_compile=True),
         NS(length= 119, workgroup_size=256, threads_per_transform= 17, factors=(17, 7), runtime_compile=True),
         NS(length= 120, workgroup_size= 64, threads_per_transform= 12, factors=(6, 10, 2), runtime_compile=True),
         NS(length= 121, workgroup_size=128, threads_per_transform= 11, factors=(11, 11), runtime_compile=True),
+        NS(length= 124, workgroup_size=256, threads_per_transform= 31, factors=(31, 4), runtime_compile=True),
         NS(length= 125, workgroup_size=256, threads_per_transform= 25, factors=(5, 5, 5), half_lds=False, direct_to_from_reg=False),
         NS(length= 126, workgroup_size= 256, threads_per_transform= 42, factors=(6, 7, 3), half_lds=False, runtime_compile=True),
         NS(length= 128, workgroup_size=256, threads_per_transform= 16, factors=(16, 8)),
@@ -96,6 +96,10 @@ class KernelConfig(BaseNode):
         kc += ', true' if (buffer_inst is not None
                            and buffer_inst == True) else ', false'
 
+        split_radix = self.config.get('split_radix')
+        kc += ', true' if (split_radix is not None
+                           and split_radix == True) else ', false'
+
         kc += ', StrToEBType("' + str(self.config['ebtype']) + '")'
         kc += ', ' + str(self.config['direction'])
         kc += ', ' + str(self.config['static_dim'])
@@ -22,17 +22,71 @@
 #define ASSIGNMENT_POLICY_H
 
 #include "tree_node.h"
+#include <optional>
 #include <vector>
 
 /****************************************************************************
- * A expanding tree recording all the legal assignments
- * For each path, from root to each leaf-node, we store information
- * of the assignment in this struct, (curr-Node, i/oBuf, i/oAryType, IP/OP)
- * and also update some accumulated values which will be propagated to leaves.
- * (total numbuer of IP, FusedNodes, ArrayTypeSwitching...)
- * NOTE:
- *   the tree is not a complete tree, since we have lots of tests that do early
- *   rejection which can stop growing the branches
+ * Buffer assignment is a search over paths through the execSeq: each
+ * node reads the buffer + array type the previous node wrote, and
+ * picks an output buffer + array type (or runs in-place).
+ *
+ * A path is scored by, in order of importance:
+ *   more fused kernels, fewer buffers used, more paddable temp buffer
+ *   accesses, more in-place kernels, fewer array type switches.
+ *
+ * Every part of the score except the number of buffers is a sum over
+ * the nodes of the path, and the number of buffers only depends on
+ * the set of buffers used so far.  So the best score reachable from
+ * a partial path only depends on a small PlacementState, which lets
+ * us memoize it instead of expanding every path.
+ ****************************************************************************/
+struct PlacementCost
+{
+    size_t numFusedNodes      = 0;
+    size_t numUsedBuffers     = 0;
+    size_t numPaddableTempOps = 0;
+    size_t numInplace         = 0;
+    size_t numTypeSwitching   = 0;
+
+    PlacementCost& operator+=(const PlacementCost& other);
+
+    // return true if this is a strictly better score than other
+    bool Better(const PlacementCost& other) const;
+    bool operator==(const PlacementCost& other) const;
+};
+
+// Output assignment chosen for one node on a path.  The input is
+// whatever the previous node wrote.
+struct PlacementMove
+{
+    OperatingBuffer   outBuf = OB_UNINIT;
+    rocfft_array_type oType  = rocfft_array_type_unset;
+};
+
+struct PlacementState
+{
+    // index into AssignmentPolicy::placementNodes of the next node to assign
+    size_t step = 0;
+    // buffer + array type written by the previous node
+    OperatingBuffer   buf  = OB_UNINIT;
+    rocfft_array_type type = rocfft_array_type_unset;
+    // OperatingBuffer bits of all buffers used so far
+    unsigned int usedBuffers = 0;
+    // in/out buffers of the first node of a fuse shim whose last node
+    // isn't assigned yet, to decide if that shim can be fused
+    OperatingBuffer shimInBuf  = OB_UNINIT;
+    OperatingBuffer shimOutBuf = OB_UNINIT;
+
+    uint64_t Key() const;
+};
+
+/****************************************************************************
+ * Exhaustive search that the memoized search replaced.  It builds a
+ * tree recording every legal assignment, one PlacementTrace per
+ * node of each path, and scores complete paths by walking back to
+ * the root.  It's exponential in the number of nodes, so it's only
+ * used when ROCFFT_INTERNAL_EXHAUSTIVE_ASSIGNMENT=1 is set, to test
+ * that both searches choose the same assignments.
  ****************************************************************************/
 struct PlacementTrace
 {
@@ -69,22 +123,15 @@ struct PlacementTrace
         isInplace        = (iB == oB);
         numInplace       = parent->numInplace + (isInplace ? 1 : 0);
         numTypeSwitching = parent->numTypeSwitching + (inType != outType ? 1 : 0);
-        // using set to record the used buffers. (we have 5 buffers at most)
-        usedBuffers = parent->usedBuffers;
+        usedBuffers      = parent->usedBuffers;
         usedBuffers.insert(iB);
         usedBuffers.insert(oB);
     }
 
-    // print the [in->out] for this placement
-    void Print(rocfft_ostream& os);
-
     // Starting from the tail (leaf of each branch) back to the head (root),
     // Calculate how many kernel fusions can be done with this assignment.
     size_t BackwardCalcFusions(ExecPlan& execPlan, int curFuseShimID, PlacementTrace* shimLastNode);
 
-    // How many buffers are used in this assignment
-    size_t NumUsedBuffers() const;
-
     // How many beneficial padded temp operations are possible in this assignment
     size_t NumPaddableTempOps() const;
 
@@ -145,21 +192,65 @@ private:
 
     static bool CheckAssignmentValid(ExecPlan& execPlan);
 
+    // Collect the nodes of execSeq that need assignment (i.e. all
+    // but disconnected chirp setup nodes) and where fuse shims start
+    // and end among them
+    void CollectPlacementNodes(ExecPlan& execPlan);
+
+    // Valid output assignments for the next node from a state, in the
+    // order we prefer them when paths are otherwise tied
+    std::vector<PlacementMove> PlacementMoves(ExecPlan& execPlan, const PlacementState& state);
+
+    // Apply a move to a state, returning the score of that one node
+    PlacementCost ApplyMove(ExecPlan&             execPlan,
+                            const PlacementState& state,
+                            const PlacementMove&  move,
+                            PlacementState&       next);
+
+    // Best score of any valid way to finish the path from this state,
+    // or empty if there is none
+    std::optional<PlacementCost> BestCost(ExecPlan& execPlan, const PlacementState& state);
+
+    // Try valid paths from best to worst score, stopping at the first
+    // one that passes CheckAssignmentValid
     void UpdateWinnerFromValidPaths(ExecPlan& execPlan);
 
+    // fill the assignment from a path into the tree nodes
+    void ApplyPath(ExecPlan& execPlan, const std::vector<PlacementMove>& path);
+
+    // Find the best valid path with the available buffers, using
+    // either the memoized or the exhaustive search
+    void SearchPaths(ExecPlan& execPlan);
+
+    // Exhaustive search: enumerate every path into winnerCandidates,
+    // then try them from best to worst score
     void Enumerate(PlacementTrace*   parent,
                    ExecPlan&         execPlan,
                    size_t            curSeqID,
                    OperatingBuffer   startBuf,
                    rocfft_array_type startType);
+    void UpdateWinnerFromCandidates(ExecPlan& execPlan);
 
-    std::vector<PlacementTrace*> winnerCandidates;
-    std::set<OperatingBuffer>    availableBuffers;
-    std::set<rocfft_array_type>  availableArrayTypes;
+    std::set<OperatingBuffer>   availableBuffers;
+    std::set<rocfft_array_type> availableArrayTypes;
     int  numCurWinnerFusions; // -1 means no winner, else = curr winner's #-fusions
     bool mustUseTBuffer = false;
     bool mustUseCBuffer = false;
 
+    // execSeq indexes of nodes that need assignment
+    std::vector<size_t> placementNodes;
+    // for each of placementNodes, the shim that begins or ends at
+    // that node (if any)
+    std::vector<FuseShim*> shimBegin;
+    std::vector<FuseShim*> shimEnd;
+    // fuse shims are not in execution order
+    bool shimOrderError = false;
+
+    std::map<uint64_t, std::optional<PlacementCost>> bestCostCache;
+
+    bool                         exhaustiveSearch = false;
+    std::vector<PlacementTrace*> winnerCandidates;
+
     std::map<NodeBufTestCacheKey, bool, CmpNodeBufTestCacheKey> node_buf_test_cache;
 };
 
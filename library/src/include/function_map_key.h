@@ -36,6 +36,7 @@ struct KernelConfig
     bool                half_lds              = false;
     bool                direct_to_from_reg    = false;
     bool                intrinsic_buffer_inst = false;
+    bool                split_radix           = false;
     unsigned int        transforms_per_block  = 0;
     int                 workgroup_size        = 0;
     std::array<int, 2>  threads_per_transform = {0, 0};
@@ -74,6 +75,7 @@ struct KernelConfig
                  bool                  half_lds              = false,
                  bool                  direct_to_from_reg    = false,
                  bool                  intrinsic_buffer_inst = false,
+                 bool                  split_radix           = false,
                  EmbeddedType          ebType                = EmbeddedType::NONE,
                  int                   direction             = -1,
                  int                   static_dim            = 0,
@@ -84,6 +86,7 @@ struct KernelConfig
         , half_lds(half_lds)
         , direct_to_from_reg(direct_to_from_reg)
         , intrinsic_buffer_inst(intrinsic_buffer_inst)
+        , split_radix(split_radix)
         , transforms_per_block(tpb)
         , workgroup_size(wgs)
         , threads_per_transform(tpt)
@@ -105,6 +108,7 @@ struct KernelConfig
                         half_lds,
                         direct_to_from_reg,
                         intrinsic_buffer_inst,
+                        split_radix,
                         transforms_per_block,
                         workgroup_size,
                         threads_per_transform,
@@ -113,6 +117,7 @@ struct KernelConfig
                            rhs.half_lds,
                            rhs.direct_to_from_reg,
                            rhs.intrinsic_buffer_inst,
+                           rhs.split_radix,
                            rhs.transforms_per_block,
                            rhs.workgroup_size,
                            rhs.threads_per_transform,
@@ -125,6 +130,7 @@ struct KernelConfig
                         half_lds,
                         direct_to_from_reg,
                         intrinsic_buffer_inst,
+                        split_radix,
                         transforms_per_block,
                         workgroup_size,
                         threads_per_transform,
@@ -133,6 +139,7 @@ struct KernelConfig
                           rhs.half_lds,
                           rhs.direct_to_from_reg,
                           rhs.intrinsic_buffer_inst,
+                          rhs.split_radix,
                           rhs.transforms_per_block,
                           rhs.workgroup_size,
                           rhs.threads_per_transform,
@@ -148,6 +155,7 @@ struct KernelConfig
            << ", half_lds: " << (half_lds ? "true" : "false")
            << ", direct_reg: " << (direct_to_from_reg ? "true" : "false")
            << ", try_use_buf_inst: " << (intrinsic_buffer_inst ? "true" : "false")
+           << ", split_radix: " << (split_radix ? "true" : "false")
            << ", tpb: " << transforms_per_block << ", wgs: " << workgroup_size << ", tpt: ["
            << threads_per_transform[0] << "," << threads_per_transform[1] << "], factors: [";
 
@@ -184,6 +192,7 @@ namespace std
             h ^= std::hash<bool>{}(config.half_lds);
             h ^= std::hash<bool>{}(config.direct_to_from_reg);
             h ^= std::hash<bool>{}(config.intrinsic_buffer_inst);
+            h ^= std::hash<bool>{}(config.split_radix);
             h ^= std::hash<unsigned int>{}(config.transforms_per_block);
             h ^= std::hash<int>{}(config.workgroup_size);
             for(auto& v : config.threads_per_transform)
@@ -215,6 +224,7 @@ struct ToString<KernelConfig>
         str += FieldDescriptor<bool>().describe("half_lds", value.half_lds) + ",";
         str += FieldDescriptor<bool>().describe("dir_reg", value.direct_to_from_reg) + ",";
         str += FieldDescriptor<bool>().describe("buffer_inst", value.intrinsic_buffer_inst) + ",";
+        str += FieldDescriptor<bool>().describe("split_radix", value.split_radix) + ",";
         str += FieldDescriptor<unsigned int>().describe("tpb", value.transforms_per_block) + ",";
         str += FieldDescriptor<int>().describe("wgs", value.workgroup_size) + ",";
         str += VectorFieldDescriptor<int>().describe("tpt", tpt) + ",";
@@ -248,6 +258,10 @@ struct FromString<KernelConfig>
         FieldParser<bool>().parse("half_lds", ret.half_lds, current);
         FieldParser<bool>().parse("dir_reg", ret.direct_to_from_reg, current);
         FieldParser<bool>().parse("buffer_inst", ret.intrinsic_buffer_inst, current);
+        if(DescriptorFormatVersion::UsingVersion < 4)
+            ret.split_radix = false;
+        else
+            FieldParser<bool>().parse("split_radix", ret.split_radix, current);
         FieldParser<size_t>().parse("tpb", tpb, current);
 
         FieldParser<int>().parse("wgs", ret.workgroup_size, current);
@@ -26,6 +26,12 @@
 #include "../../../shared/rocfft_complex.h"
 #include "../device/kernels/common.h"
 #include "tree_node.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <unordered_map>
 
@@ -60,6 +66,7 @@ struct FFTKernel
     bool               use_3steps_large_twd  = false;
     bool               half_lds              = false;
     bool               direct_to_from_reg    = false;
+    bool               split_radix           = false;
     // true if this kernel is compiled ahead of time (i.e. at library
     // build time), using runtime compilation.
     bool aot_rtc = false;
@@ -98,6 +105,7 @@ struct FFTKernel
         , use_3steps_large_twd(config.use_3steps_large_twd)
         , half_lds(config.half_lds)
         , direct_to_from_reg(config.direct_to_from_reg)
+        , split_radix(config.split_radix)
     {
     }
 
@@ -110,6 +118,7 @@ struct FFTKernel
         config.use_3steps_large_twd  = use_3steps_large_twd;
         config.half_lds              = half_lds;
         config.direct_to_from_reg    = direct_to_from_reg;
+        config.split_radix           = split_radix;
         config.factors               = factors;
 
         return config;
@@ -118,15 +127,77 @@ struct FFTKernel
 
 class function_pool
 {
+public:
+    // Lengths of the 1D kernels in the pool for one precision and
+    // scheme.  Decomposing a length asks about the same set of
+    // kernels many times, so this is built once and only read
+    // afterwards, until a kernel is added to the pool.
+    struct LengthIndex
+    {
+        // lengths of all the kernels, largest first
+        std::vector<size_t> lengths;
+        // lengths that have a kernel with the default config (i.e.
+        // has_function would find them without a config), smallest
+        // first
+        std::vector<size_t> default_lengths;
+
+        bool has_default_kernel(size_t length) const
+        {
+            return std::binary_search(default_lengths.begin(), default_lengths.end(), length);
+        }
+
+        // Return the largest kernel length where
+        // is_supported_factor(length) returns true, searching down
+        // from slightly smaller than sqrt(length).  Returns 0 if no
+        // kernel length is supported.
+        //
+        // This checks the kernel lengths one at a time rather than
+        // looking up the divisors of length in a table.  There are
+        // only a couple of hundred kernel lengths and a plan does a
+        // handful of searches, so the scan costs far less than the
+        // rest of plan creation.
+        size_t search(size_t length, const std::function<bool(size_t)>& is_supported_factor) const
+        {
+            auto comparison = std::greater<size_t>();
+
+            if(lengths.empty())
+                return 0;
+
+            // start search slightly smaller than sqrt(length)
+            auto v     = static_cast<size_t>(std::sqrt(length));
+            auto lower = std::lower_bound(lengths.cbegin(), lengths.cend(), v, comparison);
+            if((lower == lengths.cend() || *lower < std::sqrt(length)) && lower != lengths.cbegin())
+                lower--;
+
+            auto itr = std::find_if(lower, lengths.cend(), is_supported_factor);
+            if(itr != lengths.cend())
+                return *itr;
+
+            return 0;
+        }
+    };
+
+private:
     // when AOT generator adds a default key-kernel,
     // we get the keys of two version: empty-config vs full-config
     // make the pair as an entry in a map so that we know they are the same things
     std::unordered_map<FMKey, FMKey, SimpleHash>     def_key_pool;
     std::unordered_map<FMKey, FFTKernel, SimpleHash> function_map;
 
+    // length indexes built so far, cleared when kernels are added
+    std::map<std::pair<rocfft_precision, ComputeScheme>, std::shared_ptr<const LengthIndex>>
+               length_indexes;
+    std::mutex length_indexes_mutex;
+
     ROCFFT_DEVICE_EXPORT function_pool();
 
-private:
+    // forget length indexes after the set of kernels changes
+    void clear_length_indexes()
+    {
+        std::lock_guard<std::mutex> lck(length_indexes_mutex);
+        length_indexes.clear();
+    }
+
     static const FMKey& get_actual_key(const FMKey& key)
     {
         function_pool& func_pool = get_function_pool();
@@ -179,8 +250,11 @@ public:
             return true;
 
         function_pool& func_pool = get_function_pool();
-        return std::get<1>(
+        bool           added     = std::get<1>(
             func_pool.function_map.emplace(new_key, FFTKernel(new_key.kernel_config)));
+        if(added)
+            func_pool.clear_length_indexes();
+        return added;
     }
 
     // add an alternative kernel with different kernel config from base FMKey
@@ -196,7 +270,10 @@ public:
         out_FMKey->kernel_config = alt_config;
 
         function_pool& func_pool = get_function_pool();
-        return std::get<1>(func_pool.function_map.emplace(*out_FMKey, FFTKernel(alt_config)));
+        bool added = std::get<1>(func_pool.function_map.emplace(*out_FMKey, FFTKernel(alt_config)));
+        if(added)
+            func_pool.clear_length_indexes();
+        return added;
     }
 
     static bool has_function(const FMKey& key)
@@ -209,10 +286,9 @@ public:
 
     static size_t get_largest_length(rocfft_precision precision)
     {
-        auto supported = function_pool::get_lengths(precision, CS_KERNEL_STOCKHAM);
-        auto itr       = std::max_element(supported.cbegin(), supported.cend());
-        if(itr != supported.cend())
-            return *itr;
+        auto index = function_pool::get_length_index(precision, CS_KERNEL_STOCKHAM);
+        if(!index->lengths.empty())
+            return index->lengths.front();
         return 0;
     }
 
@@ -232,6 +308,38 @@ public:
         return lengths;
     }
 
+    // Return the index of 1D kernel lengths for a precision and
+    // scheme, building it if necessary.  The index stays valid for
+    // the caller even if kernels are added later.
+    static std::shared_ptr<const LengthIndex> get_length_index(rocfft_precision precision,
+                                                               ComputeScheme    scheme)
+    {
+        function_pool& func_pool = get_function_pool();
+
+        std::lock_guard<std::mutex> lck(func_pool.length_indexes_mutex);
+
+        auto& index = func_pool.length_indexes[std::make_pair(precision, scheme)];
+        if(index)
+            return index;
+
+        auto newIndex     = std::make_shared<LengthIndex>();
+        newIndex->lengths = get_lengths(precision, scheme);
+        std::sort(newIndex->lengths.begin(), newIndex->lengths.end(), std::greater<size_t>());
+        // alternative configs of a length each have their own entry
+        newIndex->lengths.erase(std::unique(newIndex->lengths.begin(), newIndex->lengths.end()),
+                                newIndex->lengths.end());
+
+        for(auto len : newIndex->lengths)
+        {
+            if(has_function(FMKey(len, precision, scheme)))
+                newIndex->default_lengths.push_back(len);
+        }
+        std::reverse(newIndex->default_lengths.begin(), newIndex->default_lengths.end());
+
+        index = newIndex;
+        return index;
+    }
+
     static DevFnCall get_function(const FMKey& key)
     {
         function_pool& func_pool = get_function_pool();
@@ -0,0 +1,177 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_KERNEL_PROFILE_H
+#define ROCFFT_KERNEL_PROFILE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Static estimate of the work a generated kernel does, counted from
+// its source without running it.  Everything except lds_bytes is
+// per thread, and takes the most expensive path through branches
+// whose outcome isn't known when the kernel is generated.
+struct KernelProfile
+{
+    // floating-point operations done by butterflies and complex
+    // multiplies
+    double flops = 0.0;
+    // complex elements read from and written to global memory
+    size_t global_loads  = 0;
+    size_t global_stores = 0;
+    // LDS reads and writes, and the LDS a threadblock allocates
+    size_t lds_reads  = 0;
+    size_t lds_writes = 0;
+    size_t lds_bytes  = 0;
+    // __syncthreads() barriers executed
+    size_t syncthreads = 0;
+    // complex values held in registers at the same time
+    size_t registers = 0;
+    // average LDS bank conflict degree of the kernel's worst
+    // exchange step, or 0 if LDS accesses weren't simulated
+    double lds_conflict_degree = 0.0;
+
+    bool empty() const
+    {
+        return flops == 0.0 && global_loads == 0 && global_stores == 0 && lds_reads == 0
+               && lds_writes == 0 && syncthreads == 0 && registers == 0;
+    }
+
+    size_t lds_transactions() const
+    {
+        return lds_reads + lds_writes;
+    }
+
+    // add the work done by code that runs after this code.  values
+    // declared by both are assumed to be live at the same time.
+    KernelProfile& operator+=(const KernelProfile& other)
+    {
+        flops += other.flops;
+        global_loads += other.global_loads;
+        global_stores += other.global_stores;
+        lds_reads += other.lds_reads;
+        lds_writes += other.lds_writes;
+        lds_bytes = std::max(lds_bytes, other.lds_bytes);
+        syncthreads += other.syncthreads;
+        registers += other.registers;
+        lds_conflict_degree = std::max(lds_conflict_degree, other.lds_conflict_degree);
+        return *this;
+    }
+
+    // repeat the work, e.g. for a loop with a known trip count
+    KernelProfile& operator*=(size_t count)
+    {
+        flops *= count;
+        global_loads *= count;
+        global_stores *= count;
+        lds_reads *= count;
+        lds_writes *= count;
+        syncthreads *= count;
+        return *this;
+    }
+
+    // keep the larger of each count, e.g. for alternative branches
+    void max(const KernelProfile& other)
+    {
+        flops         = std::max(flops, other.flops);
+        global_loads  = std::max(global_loads, other.global_loads);
+        global_stores = std::max(global_stores, other.global_stores);
+        lds_reads     = std::max(lds_reads, other.lds_reads);
+        lds_writes    = std::max(lds_writes, other.lds_writes);
+        lds_bytes     = std::max(lds_bytes, other.lds_bytes);
+        syncthreads   = std::max(syncthreads, other.syncthreads);
+        registers     = std::max(registers, other.registers);
+
+        lds_conflict_degree = std::max(lds_conflict_degree, other.lds_conflict_degree);
+    }
+
+    std::string Print() const
+    {
+        std::stringstream ss;
+        ss << "KernelProfile: {flops: " << flops << ", global_loads: " << global_loads
+           << ", global_stores: " << global_stores << ", lds_reads: " << lds_reads
+           << ", lds_writes: " << lds_writes << ", lds_bytes: " << lds_bytes
+           << ", syncthreads: " << syncthreads << ", registers: " << registers
+           << ", lds_conflict_degree: " << lds_conflict_degree << "}";
+        return ss.str();
+    }
+};
+
+// Bank conflicts in one exchange step of a kernel: the LDS accesses
+// a threadblock makes between two barriers.
+struct LDSConflictStep
+{
+    // barriers each thread executed before this step
+    size_t barrier = 0;
+    // LDS instructions executed, counted once per wavefront
+    size_t reads  = 0;
+    size_t writes = 0;
+    // cycles the instructions take, and would take without bank
+    // conflicts
+    size_t cycles       = 0;
+    size_t ideal_cycles = 0;
+    // conflict degree of the worst instruction
+    size_t max_degree = 0;
+
+    // 1 if the step is conflict-free, 2 if its accesses take twice
+    // as long as they would without conflicts, and so on
+    double degree() const
+    {
+        return ideal_cycles ? static_cast<double>(cycles) / ideal_cycles : 1.0;
+    }
+};
+
+// LDS bank conflicts of a threadblock, simulated from a kernel's
+// generated source.
+struct LDSConflictReport
+{
+    std::vector<LDSConflictStep> steps;
+    // LDS accesses and branches (summed over threads) that couldn't
+    // be simulated, because they depend on values that aren't known
+    size_t unresolved = 0;
+
+    // degree of the step with the most conflicts
+    double worst_degree() const
+    {
+        double worst = 1.0;
+        for(const auto& step : steps)
+            worst = std::max(worst, step.degree());
+        return worst;
+    }
+
+    std::string Print() const
+    {
+        std::stringstream ss;
+        ss << "LDSConflictReport: {";
+        for(const auto& step : steps)
+        {
+            ss << "step " << step.barrier << ": {reads: " << step.reads
+               << ", writes: " << step.writes << ", degree: " << step.degree()
+               << ", max_degree: " << step.max_degree << "}, ";
+        }
+        ss << "unresolved: " << unresolved << "}";
+        return ss.str();
+    }
+};
+
+#endif
@@ -134,19 +134,21 @@ extern int log_kernelio_fd;
 extern int log_rtc_fd;
 extern int log_tuning_fd;
 extern int log_graph_fd;
+extern int log_plan_profile_fd;
 
 /*! \brief Indicates if layer is active with bitmask*/
 typedef enum rocfft_layer_mode_
 {
-    rocfft_layer_mode_none         = 0b0000000000,
-    rocfft_layer_mode_log_trace    = 0b0000000001, //  1
-    rocfft_layer_mode_log_bench    = 0b0000000010, //  2
-    rocfft_layer_mode_log_profile  = 0b0000000100, //  4
-    rocfft_layer_mode_log_plan     = 0b0000001000, //  8
-    rocfft_layer_mode_log_kernelio = 0b0000010000, // 16
-    rocfft_layer_mode_log_rtc      = 0b0000100000, // 32
-    rocfft_layer_mode_log_tuning   = 0b0001000000, // 64
-    rocfft_layer_mode_log_graph    = 0b0010000000, //128
+    rocfft_layer_mode_none             = 0b0000000000,
+    rocfft_layer_mode_log_trace        = 0b0000000001, //  1
+    rocfft_layer_mode_log_bench        = 0b0000000010, //  2
+    rocfft_layer_mode_log_profile      = 0b0000000100, //  4
+    rocfft_layer_mode_log_plan         = 0b0000001000, //  8
+    rocfft_layer_mode_log_kernelio     = 0b0000010000, // 16
+    rocfft_layer_mode_log_rtc          = 0b0000100000, // 32
+    rocfft_layer_mode_log_tuning       = 0b0001000000, // 64
+    rocfft_layer_mode_log_graph        = 0b0010000000, //128
+    rocfft_layer_mode_log_plan_profile = 0b0100000000, //256
 } rocfft_layer_mode;
 
 class LogSingleton
@@ -231,6 +233,13 @@ public:
         static thread_local rocfft_ostream log_graph_os(log_graph_fd);
         return &log_graph_os;
     }
+    rocfft_ostream* GetPlanProfileOS()
+    {
+        if(log_plan_profile_fd == -1)
+            return &rocfft_cerr;
+        static thread_local rocfft_ostream log_plan_profile_os(log_plan_profile_fd);
+        return &log_plan_profile_os;
+    }
 };
 
 #define LOG_TRACE_ENABLED() \
@@ -247,6 +256,8 @@ public:
     (LogSingleton::GetInstance().GetLayerMode() & rocfft_layer_mode_log_tuning)
 #define LOG_GRAPH_ENABLED() \
     (LogSingleton::GetInstance().GetLayerMode() & rocfft_layer_mode_log_graph)
+#define LOG_PLAN_PROFILE_ENABLED() \
+    (LogSingleton::GetInstance().GetLayerMode() & rocfft_layer_mode_log_plan_profile)
 
 // if profile logging is turned on with
 // (layer_mode & rocfft_layer_mode_log_profile) != 0
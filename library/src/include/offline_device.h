@@ -0,0 +1,50 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_OFFLINE_DEVICE_H
+#define ROCFFT_OFFLINE_DEVICE_H
+
+#include <hip/hip_runtime_api.h>
+
+// Offline planning builds plans for the device described in the
+// device profile named by ROCFFT_OFFLINE_DEVICE_PROFILE, instead of
+// the current HIP device.  No device is needed: plans are decomposed,
+// fused, assigned buffers and padded as usual, but kernels are not
+// compiled and no device memory is allocated, so the plans can be
+// inspected (e.g. through the plan log and work buffer size) but not
+// executed.
+
+// Read the profile named by ROCFFT_OFFLINE_DEVICE_PROFILE, if set.
+// Called from rocfft_setup.  Throws std::runtime_error if the
+// profile can't be read.
+void offline_device_setup();
+
+// Forget the profile.  Called from rocfft_cleanup.
+void offline_device_cleanup();
+
+// Return the offline device profile, or nullptr if plans are built
+// for real devices.
+const hipDeviceProp_t* offline_device_profile();
+
+// Return the properties of the device that plans are built for - the
+// offline device profile if set, otherwise the current device.
+hipDeviceProp_t get_plan_device_prop();
+
+#endif
@@ -0,0 +1,110 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_PLAN_CACHE_H
+#define ROCFFT_PLAN_CACHE_H
+
+#include "plan.h"
+#include "tree_node.h"
+#include <array>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Process-wide cache of built single-device plans.
+//
+// Applications often create plans for the same problem many times.
+// Building the ExecPlan (decomposing the tree, fusing kernels,
+// assigning buffers, padding, looking up kernels and setting up
+// kernel arguments) is most of the work of creating a plan.  Once
+// built, the tree is not modified by executing it, so later plans for
+// the same problem on the same device share the tree of a cached
+// plan.  Each plan still gets its own ExecPlan, which owns the
+// per-plan stream and event.
+//
+// Cached trees keep their kernel arguments and twiddles allocated
+// after the user destroys the plans that used them.  The number of
+// cached plans is limited by ROCFFT_PLAN_CACHE_LIMIT, and setting it
+// to 0 disables the cache.
+class PlanCache
+{
+public:
+    PlanCache(const PlanCache&) = delete;
+    PlanCache& operator=(const PlanCache&) = delete;
+
+    static PlanCache& GetInstance();
+
+    // Return a new ExecPlan sharing the tree of the cached plan for
+    // this problem, or nullptr if no plan is cached.
+    std::unique_ptr<ExecPlan> Get(const rocfft_plan_t& plan, const rocfft_location_t& location);
+
+    // Remember a plan that was just built for this problem.
+    void
+        Put(const rocfft_plan_t& plan, const rocfft_location_t& location, const ExecPlan& execPlan);
+
+    // Forget all cached plans.
+    void Clear();
+
+private:
+    PlanCache();
+    ~PlanCache();
+
+    // Everything about a problem that can change the plan built for
+    // it.  Plans are only cached after sort() and init_defaults(),
+    // so equivalent problems given in different ways have the same
+    // key.
+    struct Key
+    {
+        rocfft_location_t       location;
+        std::vector<size_t>     lengths;
+        std::vector<size_t>     outputLengths;
+        size_t                  batch;
+        rocfft_result_placement placement;
+        rocfft_transform_type   transformType;
+        rocfft_precision        precision;
+        rocfft_array_type       inArrayType;
+        rocfft_array_type       outArrayType;
+        std::vector<size_t>     inStrides;
+        std::vector<size_t>     outStrides;
+        size_t                  inDist;
+        size_t                  outDist;
+        std::array<size_t, 2>   inOffset;
+        std::array<size_t, 2>   outOffset;
+        double                  scale_factor;
+
+        Key(const rocfft_plan_t& plan, const rocfft_location_t& location);
+        bool operator<(const Key& other) const;
+    };
+
+    // false if plans can't be cached at the moment (e.g. while
+    // tuning)
+    bool Enabled() const;
+
+    // most recently used plan is at the front
+    typedef std::list<std::pair<Key, std::unique_ptr<ExecPlan>>> lru_list_t;
+    lru_list_t                          lru_list;
+    std::map<Key, lru_list_t::iterator> lru_index;
+    size_t                              limit = 0;
+    std::mutex                          mutex;
+};
+
+#endif
@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_PLAN_PROFILE_H
+#define ROCFFT_PLAN_PROFILE_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Phases of plan creation that are timed when plan profile logging
+// is enabled.
+enum class PlanPhase
+{
+    VALIDATE,
+    SOLUTION_MAP,
+    BUILD_TREE,
+    DECIDE_NODE_SCHEME,
+    FUSION,
+    ASSIGN_BUFFERS,
+    PAD_PLAN,
+    TWIDDLES,
+    RTC_CACHE_LOOKUP,
+    RTC_GENERATE,
+    RTC_COMPILE,
+    RTC_WAIT,
+    COUNT,
+};
+
+const char* PrintPlanPhase(PlanPhase phase);
+
+// Time spent in each phase while creating one plan.
+//
+// Kernels are compiled on other threads, so the RTC cache lookup,
+// generate and compile phases are summed over those threads and
+// overlap with the time the plan spends waiting for compiles to
+// finish.  Phases timed on the thread creating the plan add up to
+// at most the total time.
+struct PlanProfile
+{
+    PlanProfile();
+
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(PlanPhase::COUNT)> ns;
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(PlanPhase::COUNT)> calls;
+
+    // true if the plan reused a plan from PlanCache
+    bool cached = false;
+
+    std::chrono::steady_clock::time_point start;
+
+    void Add(PlanPhase phase, uint64_t elapsed_ns);
+
+    // Write the profile to the plan profile log as one line of
+    // comma-separated name,value pairs.
+    void Log(const std::string& problem) const;
+
+    // Profile that timers on this thread are currently adding to, or
+    // nullptr if this thread isn't creating a plan with plan
+    // profiling enabled.
+    static std::shared_ptr<PlanProfile>& Current();
+};
+
+// Make a profile current on this thread for the lifetime of this
+// object.  Compile threads use this to add to the profile of the
+// plan that asked for the kernel.
+class PlanProfileScope
+{
+public:
+    explicit PlanProfileScope(std::shared_ptr<PlanProfile> profile);
+    ~PlanProfileScope();
+
+    PlanProfileScope(const PlanProfileScope&) = delete;
+    PlanProfileScope& operator=(const PlanProfileScope&) = delete;
+
+private:
+    std::shared_ptr<PlanProfile> prev;
+};
+
+// Add the time between construction and destruction to a phase of
+// this thread's current profile.  Does nothing if there is no
+// current profile.
+//
+// Time spent in timers nested inside this one is only added to the
+// inner phase, so recursive and nested phases are not counted
+// twice.
+class PlanPhaseTimer
+{
+public:
+    explicit PlanPhaseTimer(PlanPhase phase);
+    ~PlanPhaseTimer();
+
+    PlanPhaseTimer(const PlanPhaseTimer&) = delete;
+    PlanPhaseTimer& operator=(const PlanPhaseTimer&) = delete;
+
+private:
+    PlanPhase                             phase;
+    std::shared_ptr<PlanProfile>          profile;
+    PlanPhaseTimer*                       parent = nullptr;
+    std::chrono::steady_clock::time_point start;
+    // time spent in timers nested inside this one
+    uint64_t nested_ns = 0;
+};
+
+#endif
@@ -22,14 +22,18 @@
 #define ROCFFT_RTC_CACHE_H
 
 #include "rocfft/rocfft.h"
+#include "rtc_cache_flat.h"
 #include "rtc_generator.h"
 #include "sqlite3.h"
 #include <array>
+#include <condition_variable>
 #include <future>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #if __has_include(<filesystem>)
@@ -62,23 +66,55 @@ struct sqlite3_stmt_deleter
 typedef std::unique_ptr<sqlite3, sqlite3_deleter>           sqlite3_ptr;
 typedef std::unique_ptr<sqlite3_stmt, sqlite3_stmt_deleter> sqlite3_stmt_ptr;
 
+// selects kernels to serialize - empty lists match every kernel
+struct rocfft_cache_filter_t
+{
+    std::vector<std::string> archs;
+    std::vector<std::string> kernel_prefixes;
+    // only kernels stored at or after this time (in seconds since
+    // the epoch) match
+    size_t watermark = 0;
+
+    bool matches(const std::string& kernel_name, const std::string& arch) const;
+};
+
 struct RTCCache
 {
     // Get compiled code object for a kernel.  Checks the cache to
     // see if the kernel has already been compiled and returns the
     // cached kernel if present.
     //
-    // Otherwise, calls "generate_src" to generate the source, compiles
-    // the source, and updates the cache before returning the compiled
-    // kernel.  Tries in-process compile first and falls back to
-    // subprocess if necessary.
-    static std::vector<char> cached_compile(const std::string&          kernel_name,
-                                            const std::string&          gpu_arch_with_flags,
-                                            kernel_src_gen_t            generate_src,
-                                            const std::array<char, 32>& generator_sum);
+    // Kernels are cached under a digest of their generated source
+    // (see source_sum).  The digest is looked up by kernel name (see
+    // get_source_sum), and "generate_src" is only called to find it
+    // if the current code generator hasn't seen the kernel before.
+    //
+    // On a cache miss, compiles the source and updates the cache
+    // before returning the compiled kernel.  Tries in-process
+    // compile first and falls back to subprocess if necessary.
+    static std::vector<char> cached_compile(const std::string& kernel_name,
+                                            const std::string& gpu_arch_with_flags,
+                                            kernel_src_gen_t   generate_src);
+
+    // digest of a kernel's generated source, which is the key
+    // (generator_sum column) that the kernel is cached under
+    static std::array<char, 32> source_sum(const std::string& kernel_src);
+
+    // remember the source digest of a kernel, so that later requests
+    // for the kernel needn't generate its source.  digests are kept
+    // for this process, and in an index in the user cache for later
+    // processes.  the index is keyed on the kernel name and the
+    // checksum of the code generator (generator_sum) and normalizer
+    // state, so a new generator doesn't reuse an old generator's
+    // digests.
+    //
+    // get_source_sum also checks the system cache's index, and
+    // returns false if the kernel hasn't been seen.
+    bool get_source_sum(const std::string& kernel_name, std::array<char, 32>& sum);
+    void set_source_sum(const std::string& kernel_name, const std::array<char, 32>& sum);
 
     RTCCache();
-    ~RTCCache() = default;
+    ~RTCCache();
 
     // get bytes for a matching code object from the cache.
     // returns empty vector if a matching kernel was not found.
@@ -86,14 +122,40 @@ struct RTCCache
                                       const std::string&          gpu_arch,
                                       const std::array<char, 32>& generator_sum);
 
-    // store the code object into the cache.
+    // store the code object into the cache.  the object is
+    // immediately visible to get_code_object, but is written to the
+    // database in the background.
     void store_code_object(const std::string&          kernel_name,
                            const std::string&          gpu_arch,
                            const std::array<char, 32>& generator_sum,
                            const std::vector<char>&    code);
 
+    // wait for all pending stores to be written to the database
+    void flush();
+
+    // coordinate compilation of a kernel with other processes that
+    // share the user cache.  returns the code object if another
+    // process compiled it while we waited.  otherwise returns an
+    // empty vector, and sets have_lease if this process now holds
+    // the lease to compile the kernel.  the lease must be given
+    // back with release_compile_lease after the code object is
+    // stored.
+    std::vector<char> wait_compile_lease(const std::string&          kernel_name,
+                                         const std::string&          gpu_arch,
+                                         const std::array<char, 32>& generator_sum,
+                                         bool&                       have_lease);
+    void              release_compile_lease(const std::string&          kernel_name,
+                                            const std::string&          gpu_arch,
+                                            const std::array<char, 32>& generator_sum);
+
     // allocates buffer, call serialize_free to free it
     rocfft_status serialize(void** buffer, size_t* buffer_len_bytes);
+    // serialize just the kernels that match the filter.  watermark
+    // (if not null) is set to the cache's current time.
+    rocfft_status serialize(const rocfft_cache_filter_t& filter,
+                            void**                       buffer,
+                            size_t*                      buffer_len_bytes,
+                            size_t*                      watermark);
     static void   serialize_free(void* buffer);
     rocfft_status deserialize(const void* buffer, size_t buffer_len_bytes);
 
@@ -102,19 +164,57 @@ struct RTCCache
     void enable_write_mostly();
 
     // write out kernels in the current cache to the output path.
-    // this copies the kernels in a consistent order and clears out
-    // the timestamp fields so that the resulting file is a
-    // reproducible build artifact, suitable for use as an AOT cache.
-    void write_aot_cache(const std::string&              output_path,
-                         const std::array<char, 32>&     generator_sum,
-                         const std::vector<std::string>& gpu_archs);
+    // only the kernels requested through cached_compile in this
+    // process are written.  this copies the kernels in a consistent
+    // order and clears out the timestamp fields so that the
+    // resulting file is a reproducible build artifact, suitable for
+    // use as an AOT cache.
+    void write_aot_cache(const std::string& output_path, const std::vector<std::string>& gpu_archs);
+
+    // same as write_aot_cache, but write the kernels in the
+    // memory-mapped flat format (see RTCFlatCache)
+    void write_aot_flat_cache(const std::string&              output_path,
+                              const std::vector<std::string>& gpu_archs);
 
     // remove kernels in the current cache to keep it roughly under a
-    // target size - this counts just the kernel name and code
-    // length, and ignores other overhead like indexes and other
-    // metadata about the kernels
+    // target size - this counts the kernel's key columns and code
+    // length, and ignores other overhead like indexes.  kernels that
+    // are used often and recently are kept in preference to kernels
+    // that are rarely used.
     void cleanup_cache(sqlite3_int64 target_size_bytes);
 
+    // shrink a user cache file that has grown past the limit set by
+    // ROCFFT_RTC_CACHE_SIZE_LIMIT.  called by rocfft_cleanup.  the
+    // file size is checked first, so the kernels are only counted
+    // (and possibly removed) when the file is over the limit.
+    // failures are logged but not thrown, since a cache that's too
+    // big is still usable.
+    void enforce_size_limit();
+
+    // summary of what's in the user cache.  unused kernels have not
+    // been looked up since they were stored, and bytes is the total
+    // size as counted by cleanup_cache.
+    struct cache_composition
+    {
+        size_t        kernels        = 0;
+        size_t        code_objects   = 0;
+        size_t        unused_kernels = 0;
+        sqlite3_int64 hits           = 0;
+        sqlite3_int64 code_bytes     = 0;
+        sqlite3_int64 bytes          = 0;
+    };
+    cache_composition get_cache_composition();
+
+    // counters for the in-memory code object cache
+    struct memory_cache_stats
+    {
+        size_t hits    = 0;
+        size_t misses  = 0;
+        size_t entries = 0;
+        size_t bytes   = 0;
+    };
+    memory_cache_stats get_memory_cache_stats();
+
     // singleton allocated in rocfft_setup and freed in rocfft_cleanup
     static std::unique_ptr<RTCCache> single;
 
@@ -126,6 +226,12 @@ private:
     // be located.
     sqlite3_ptr db_sys;
     sqlite3_ptr db_user;
+    // system cache may instead be in the flat format, in which case
+    // db_sys is null
+    std::unique_ptr<RTCFlatCache> flat_sys;
+    // true if the user cache is a file that other processes may
+    // also be using
+    bool db_user_shared = false;
 
     // query handles, with mutexes to prevent concurrent queries that
     // might stomp on one another's bound values
@@ -134,7 +240,111 @@ private:
     sqlite3_stmt_ptr get_stmt_user;
     std::mutex       get_mutex_user;
     sqlite3_stmt_ptr store_stmt_user;
+    sqlite3_stmt_ptr store_code_stmt_user;
     std::mutex       store_mutex_user;
+    // source digest index queries share the get mutexes.  the
+    // system cache might predate the index, in which case
+    // get_sum_stmt_sys is null.
+    sqlite3_stmt_ptr get_sum_stmt_sys;
+    sqlite3_stmt_ptr get_sum_stmt_user;
+    sqlite3_stmt_ptr store_sum_stmt_user;
+
+    // bounded in-memory LRU of code objects that sits in front of
+    // the sqlite caches, so that repeated lookups of the same kernel
+    // in a process don't need to query the database.  most recently
+    // used entries are at the front of the list.
+    struct code_object_key
+    {
+        std::string          kernel_name;
+        std::string          gpu_arch;
+        std::array<char, 32> generator_sum;
+        bool                 operator<(const code_object_key& other) const
+        {
+            if(kernel_name != other.kernel_name)
+                return kernel_name < other.kernel_name;
+            if(gpu_arch != other.gpu_arch)
+                return gpu_arch < other.gpu_arch;
+            return generator_sum < other.generator_sum;
+        }
+    };
+    typedef std::list<std::pair<code_object_key, std::vector<char>>> lru_list_t;
+    lru_list_t                                      lru_list;
+    std::map<code_object_key, lru_list_t::iterator> lru_index;
+    size_t                                          lru_bytes       = 0;
+    size_t                                          lru_bytes_limit = 0;
+    memory_cache_stats                              lru_stats;
+    std::mutex                                      lru_mutex;
+
+    // look up a code object in the LRU, returns empty vector on miss
+    std::vector<char> lru_get(const code_object_key& key);
+    // add a code object to the LRU, evicting old entries to stay
+    // under the byte limit
+    void lru_put(const code_object_key& key, const std::vector<char>& code);
+
+    // queue of code objects waiting to be written to the user
+    // cache, and background thread that writes them out in batches
+    std::map<code_object_key, std::vector<char>> store_queue;
+    std::vector<code_object_key>                 lease_release_queue;
+    std::map<std::string, std::array<char, 32>>  source_sum_queue;
+    std::mutex                                   store_queue_mutex;
+    std::condition_variable                      store_queue_cv;
+    bool                                         store_writing = false;
+    bool                                         store_stop    = false;
+    std::thread                                  store_thread;
+
+    // lookups of user cache kernels that haven't been written to the
+    // database yet.  these are written along with the next batch of
+    // stores, or on their own once enough have accumulated.
+    struct access_record
+    {
+        sqlite3_int64 hits        = 0;
+        sqlite3_int64 last_access = 0;
+    };
+    typedef std::map<code_object_key, access_record> access_map_t;
+    access_map_t                                     access_queue;
+    bool                                             access_flush = false;
+
+    void record_access(const code_object_key& key);
+
+    void store_writer();
+    // write a batch of code objects, access counts and source
+    // digests in a single transaction, and release compile leases
+    // once their code objects are written
+    void store_code_objects_impl(const std::map<code_object_key, std::vector<char>>& batch,
+                                 const std::vector<code_object_key>&         lease_releases,
+                                 const access_map_t&                         accesses,
+                                 const std::map<std::string, std::array<char, 32>>& source_sums);
+
+    // identifies the compile leases taken by this process
+    std::string lease_owner;
+
+    // result of trying to take the compile lease for a kernel
+    enum class CompileLeaseStatus
+    {
+        // this process now holds the lease
+        ACQUIRED,
+        // another process holds the lease
+        HELD,
+        // the cache was too busy to tell - try again later
+        BUSY,
+        // leases can't be written to the cache
+        UNAVAILABLE,
+    };
+    CompileLeaseStatus try_acquire_compile_lease(const code_object_key& key);
+
+    // cleanup_cache and get_cache_composition, for callers that
+    // already hold store_mutex_user
+    void              cleanup_cache_impl(sqlite3_int64 target_size_bytes);
+    cache_composition get_cache_composition_impl();
+
+    // source digests of kernels requested in this process, by
+    // kernel name
+    std::map<std::string, std::array<char, 32>> source_sums;
+    std::mutex                                   source_sums_mutex;
+
+    // copy the kernels in source_sums for the given archs into a
+    // temp table, for write_aot_cache to select from
+    void fill_aot_kernel_table(const std::vector<std::string>& gpu_archs);
 
     // lock around deserialization, since that attaches a fixed-name
     // schema to the db and we don't want a collision
@@ -0,0 +1,117 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_RTC_CACHE_FLAT_H
+#define ROCFFT_RTC_CACHE_FLAT_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+#else
+#include <experimental/filesystem>
+namespace std
+{
+    namespace filesystem = experimental::filesystem;
+}
+#endif
+
+// Immutable, memory-mapped kernel cache file.  This is an
+// alternative format for the read-only system cache that avoids
+// the overhead of SQL queries.  The file contains:
+//
+// - a header
+// - an index of entries, sorted by a hash of the kernel's key
+// - an index of kernels' source digests, sorted the same way
+// - the keys, code objects and digests that the indexes point to
+//
+// Lookups binary-search the index and return a pointer into the
+// mapped file, so they need no locks and no copies.
+struct RTCFlatCache
+{
+    // open and map a flat cache file.  returns nullptr if the file
+    // does not exist or is not a flat cache.
+    static std::unique_ptr<RTCFlatCache> open(const std::filesystem::path& path);
+
+    ~RTCFlatCache();
+
+    RTCFlatCache(const RTCFlatCache&) = delete;
+    void operator=(const RTCFlatCache&) = delete;
+
+    // find a code object in the cache.  returns a pointer to the
+    // code object and sets code_len if found, or nullptr if not
+    // found.  the returned pointer is valid until this object is
+    // destroyed.
+    const char* lookup(const std::string&          kernel_name,
+                       const std::string&          gpu_arch,
+                       int64_t                     hip_version,
+                       const std::array<char, 32>& generator_sum,
+                       size_t&                     code_len) const;
+
+    // find the digest of a kernel's source, as generated by the code
+    // generator with the given checksum.  returns false if the
+    // kernel's digest is not in the cache.
+    bool lookup_source_sum(const std::string&          kernel_name,
+                           const std::array<char, 32>& generator_version,
+                           std::array<char, 32>&       source_sum) const;
+
+    // a code object to write to a flat cache file
+    struct entry
+    {
+        std::string          kernel_name;
+        std::string          gpu_arch;
+        int64_t              hip_version;
+        std::array<char, 32> generator_sum;
+        std::vector<char>    code;
+    };
+
+    // a kernel's source digest to write to a flat cache file
+    struct source_sum_entry
+    {
+        std::string          kernel_name;
+        std::array<char, 32> generator_version;
+        std::array<char, 32> source_sum;
+    };
+
+    // write entries out to a flat cache file.  the output is
+    // reproducible given the same set of entries.  an existing file
+    // is replaced, not overwritten, so processes that have it open
+    // keep their view of it.
+    static void write(const std::filesystem::path&         path,
+                      const std::vector<entry>&            entries,
+                      const std::vector<source_sum_entry>& source_sums);
+
+private:
+    RTCFlatCache() = default;
+
+    // start and length of the mapped file
+    const char* data = nullptr;
+    size_t      len  = 0;
+#ifdef WIN32
+    void* file_handle    = nullptr;
+    void* mapping_handle = nullptr;
+#endif
+};
+
+#endif
@@ -24,6 +24,11 @@
 #include <string>
 #include <vector>
 
+// options passed to the runtime compiler, apart from the GPU
+// architecture.  these contribute to the digest that kernels are
+// cached under, since changing them changes the code objects.
+const std::vector<const char*>& compile_options();
+
 // compile source to a code object, in the current process.
 std::vector<char> compile_inprocess(const std::string& kernel_src, const std::string& gpu_arch);
 
@@ -0,0 +1,119 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_RTC_COMPILE_POOL_H
+#define ROCFFT_RTC_COMPILE_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Priority of work submitted to the compile pool.  Kernels that a
+// plan needs before it can execute are compiled ahead of speculative
+// work, like kernel variants that are only needed if the user sets
+// callbacks on the plan.
+enum class RTCCompilePriority
+{
+    CRITICAL,
+    SPECULATIVE,
+};
+
+// Bounded pool of threads that runtime compilation work is
+// submitted to.  This prevents many concurrent plan creations (or
+// plans with many kernels) from oversubscribing the host with
+// compiler threads.
+struct RTCCompilePool
+{
+    explicit RTCCompilePool(size_t num_threads);
+    // waits for queued critical work to finish.  speculative work
+    // that hasn't started is cancelled instead: its future holds an
+    // exception.
+    ~RTCCompilePool();
+
+    RTCCompilePool(const RTCCompilePool&) = delete;
+    void operator=(const RTCCompilePool&) = delete;
+
+    // queue a function to run on the pool, returning a future for
+    // its result
+    template <typename Tfunc>
+    auto submit(RTCCompilePriority priority, Tfunc&& func)
+        -> std::shared_future<decltype(func())>
+    {
+        typedef decltype(func()) result_t;
+        // the task is told whether to run or to cancel
+        auto task = std::make_shared<std::packaged_task<result_t(bool)>>(
+            [func = std::forward<Tfunc>(func)](bool cancel) mutable -> result_t {
+                if(cancel)
+                    throw std::runtime_error("compile pool stopped before work started");
+                return func();
+            });
+        auto result = task->get_future().share();
+        push(priority, [task](bool cancel) { (*task)(cancel); });
+        return result;
+    }
+
+    // number of items waiting for a free thread
+    size_t queue_depth();
+
+    // singleton allocated in rocfft_setup and freed in rocfft_cleanup
+    static std::unique_ptr<RTCCompilePool> single;
+    // small pool that builds plans for rocfft_cache_prefetch.  the
+    // kernels those plans need are compiled on the single pool, so
+    // this pool's threads mostly wait.  also allocated in
+    // rocfft_setup and freed in rocfft_cleanup.
+    static std::unique_ptr<RTCCompilePool> prefetch;
+
+private:
+    struct work_item
+    {
+        RTCCompilePriority                    priority;
+        size_t                                seq;
+        std::chrono::steady_clock::time_point enqueue_time;
+        std::function<void(bool)>             func;
+
+        // std::priority_queue puts the "largest" item on top, so
+        // order higher priority and then earlier submission last
+        bool operator<(const work_item& other) const
+        {
+            if(priority != other.priority)
+                return priority > other.priority;
+            return seq > other.seq;
+        }
+    };
+
+    void push(RTCCompilePriority priority, std::function<void(bool)>&& func);
+    void worker();
+
+    std::priority_queue<work_item> items;
+    size_t                         next_seq = 0;
+    bool                           stop     = false;
+    std::mutex                     queue_mutex;
+    std::condition_variable        queue_cv;
+    std::vector<std::thread>       threads;
+};
+
+#endif
@@ -112,11 +112,16 @@ struct RTCKernel
     // node if successful.  returns nullptr if there is no matching
     // supported scheme + problem size.  throws runtime_error on
     // error.
+    //
+    // if compile_only is true, the kernel is compiled into the cache
+    // at low priority but not loaded, and the future's value is
+    // always nullptr.
     static std::shared_future<std::unique_ptr<RTCKernel>>
         runtime_compile(const TreeNode&    node,
                         const std::string& gpu_arch,
                         std::string&       kernel_name,
-                        bool               enable_callbacks = false);
+                        bool               enable_callbacks = false,
+                        bool               compile_only     = false);
 
     // take already-compiled code object and prepare to launch the
     // named kernel
@@ -267,20 +272,25 @@ static const char* rtc_cbtype_name(CallbackType cbtype)
 
 // realDataAsComplex is true if we're treating real data as complex
 // (in an even-length real-complex FFT)
-static const std::string rtc_const_cbtype_decl(CallbackType cbtype)
+static const char* rtc_cbtype_value(CallbackType cbtype)
 {
     switch(cbtype)
     {
     case CallbackType::NONE:
-        return "static const CallbackType cbtype = CallbackType::NONE;\n";
+        return "CallbackType::NONE";
     case CallbackType::USER_LOAD_STORE:
-        return "static const CallbackType cbtype = CallbackType::USER_LOAD_STORE;\n";
+        return "CallbackType::USER_LOAD_STORE";
     case CallbackType::USER_LOAD_STORE_R2C:
-        return "static const CallbackType cbtype = CallbackType::USER_LOAD_STORE_R2C;\n";
+        return "CallbackType::USER_LOAD_STORE_R2C";
     case CallbackType::USER_LOAD_STORE_C2R:
-        return "static const CallbackType cbtype = CallbackType::USER_LOAD_STORE_C2R;\n";
+        return "CallbackType::USER_LOAD_STORE_C2R";
     }
 }
+
+static const std::string rtc_const_cbtype_decl(CallbackType cbtype)
+{
+    return std::string("static const CallbackType cbtype = ") + rtc_cbtype_value(cbtype) + ";\n";
+}
 #endif
 
 #endif
@@ -0,0 +1,66 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_RTC_NORMALIZE_H
+#define ROCFFT_RTC_NORMALIZE_H
+
+#include <cstddef>
+#include <string>
+
+struct RTCNormalizeStats
+{
+    size_t original_bytes   = 0;
+    size_t normalized_bytes = 0;
+    // number of helper functions and macros that nothing referred to
+    size_t removed_definitions = 0;
+};
+
+// Normalize generated kernel source before handing it to the
+// runtime compiler.  Generated kernels concatenate whole helper
+// headers, most of which any one kernel doesn't use.  This:
+//
+// - strips comments
+// - collapses whitespace to what's needed to separate tokens
+// - removes definitions of free functions and macros that are never
+//   referred to by anything else in the source
+//
+// Kernel entry points, other preprocessor directives and everything
+// that isn't a plain function or macro definition are always kept,
+// and names are never changed, so the result compiles to the same
+// code.
+//
+// Stats about the normalization are written to stats if non-null.
+std::string rtc_normalize_source(const std::string& src, RTCNormalizeStats* stats = nullptr);
+
+// Return false if the user has disabled normalization by setting
+// ROCFFT_RTC_NORMALIZE_DISABLE in the environment.
+bool rtc_normalize_enabled();
+
+// Version of the normalizer's output.  Bump this whenever a change
+// to rtc_normalize_source changes its output for some source, so that
+// code objects compiled from the old output are not reused.
+static const unsigned int RTC_NORMALIZE_VERSION = 1;
+
+// Describe how kernel source is turned into the source that's
+// compiled: the normalizer version, or that normalization is
+// disabled.  This is folded into kernels' cache keys.
+std::string rtc_normalize_state();
+
+#endif
@@ -25,6 +25,7 @@
 
 #include "../device/generator/stockham_gen.h"
 #include "compute_scheme.h"
+#include "kernel_profile.h"
 #include "load_store_ops.h"
 #include "rocfft/rocfft.h"
 #include "rtc_kernel.h"
@@ -79,4 +80,42 @@ std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
                          const LoadOps&                loadOps,
                          const StoreOps&               storeOps);
 
+// true if any of the factors has a split-radix butterfly, so that
+// split_radix changes a kernel with those factors
+bool stockham_has_split_radix(const std::vector<size_t>& factors);
+
+// estimate the work done by a stockham kernel, without compiling
+// or running it.  the profile is of a unit-stride kernel with no
+// callbacks or large twiddles, and includes the LDS bank conflicts
+// of its worst exchange step.
+KernelProfile stockham_rtc_profile(const StockhamGeneratorSpecs& specs,
+                                   const StockhamGeneratorSpecs& specs2d,
+                                   ComputeScheme                 scheme,
+                                   rocfft_precision              precision);
+
+// simulate the LDS accesses of one threadblock of a stockham
+// kernel, and report the bank conflicts in each exchange step.  the
+// kernel is the same unit-stride variant that stockham_rtc_profile
+// looks at.
+LDSConflictReport stockham_rtc_lds_conflicts(const StockhamGeneratorSpecs& specs,
+                                             const StockhamGeneratorSpecs& specs2d,
+                                             ComputeScheme                 scheme,
+                                             rocfft_precision              precision);
+
+// generate C++17 source that runs a stockham kernel on the host.
+// the source defines an extern "C" function named kernel_name that
+// takes the same arguments as the GPU kernel, plus the number of
+// blocks to run.  each block does one transform, so the number of
+// blocks is the number of transforms.
+//
+// only single and double precision, interleaved, CS_KERNEL_STOCKHAM
+// kernels without callbacks are supported.
+std::string stockham_host(const StockhamGeneratorSpecs& specs,
+                          const std::string&            kernel_name,
+                          ComputeScheme                 scheme,
+                          int                           direction,
+                          rocfft_precision              precision,
+                          rocfft_result_placement       placement,
+                          bool                          unit_stride);
+
 #endif
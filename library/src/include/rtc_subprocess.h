@@ -21,10 +21,46 @@
 #ifndef ROCFFT_RTC_SUBPROCESS_H
 #define ROCFFT_RTC_SUBPROCESS_H
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
 // spawn a subprocess to do a compile, to get around process-wide locks in hipRTC
 std::vector<char> compile_subprocess(const std::string& kernel_src, const std::string& gpu_arch);
 
+// Pool of long-lived rocfft_rtc_helper processes running in server
+// mode, so that each out-of-process compile doesn't need to start
+// a new process and initialize the compiler.  Helpers are started
+// on demand, up to max_helpers at once.
+//
+// compile_subprocess uses the pool if one exists.
+struct RTCHelperPool
+{
+    explicit RTCHelperPool(size_t max_helpers);
+    ~RTCHelperPool();
+
+    RTCHelperPool(const RTCHelperPool&) = delete;
+    void operator=(const RTCHelperPool&) = delete;
+
+    // compile on an idle helper, waiting for one if max_helpers are
+    // already busy.  throws std::runtime_error with the compiler's
+    // message if compilation fails.
+    std::vector<char> compile(const std::string& kernel_src, const std::string& gpu_arch);
+
+    // singleton allocated in rocfft_setup and freed in rocfft_cleanup
+    static std::unique_ptr<RTCHelperPool> single;
+
+private:
+    struct helper;
+
+    std::vector<std::unique_ptr<helper>> idle;
+    // number of helpers started, whether idle or busy
+    size_t                  running = 0;
+    size_t                  max_helpers;
+    std::mutex              mutex;
+    std::condition_variable cv;
+};
+
 #endif
@@ -0,0 +1,161 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCFFT_SHA256_H
+#define ROCFFT_SHA256_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Minimal SHA-256 implementation, used to compute digests of
+// kernel code objects and sources.
+struct SHA256
+{
+    SHA256()
+    {
+        static const uint32_t init[8] = {0x6a09e667,
+                                         0xbb67ae85,
+                                         0x3c6ef372,
+                                         0xa54ff53a,
+                                         0x510e527f,
+                                         0x9b05688c,
+                                         0x1f83d9ab,
+                                         0x5be0cd19};
+        memcpy(state, init, sizeof(state));
+    }
+
+    void update(const void* data, size_t len)
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        total_len += len;
+        while(len)
+        {
+            size_t n = std::min(len, sizeof(block) - block_len);
+            memcpy(block + block_len, bytes, n);
+            block_len += n;
+            bytes += n;
+            len -= n;
+            if(block_len == sizeof(block))
+            {
+                transform();
+                block_len = 0;
+            }
+        }
+    }
+
+    std::array<char, 32> digest()
+    {
+        uint64_t bit_len = total_len * 8;
+        uint8_t  pad     = 0x80;
+        update(&pad, 1);
+        pad = 0;
+        while(block_len != 56)
+            update(&pad, 1);
+        uint8_t len_bytes[8];
+        for(int i = 0; i < 8; ++i)
+            len_bytes[i] = static_cast<uint8_t>(bit_len >> (56 - 8 * i));
+        update(len_bytes, 8);
+
+        std::array<char, 32> out;
+        for(int i = 0; i < 8; ++i)
+            for(int j = 0; j < 4; ++j)
+                out[i * 4 + j] = static_cast<char>(state[i] >> (24 - 8 * j));
+        return out;
+    }
+
+    static std::array<char, 32> hash(const void* data, size_t len)
+    {
+        SHA256 h;
+        h.update(data, len);
+        return h.digest();
+    }
+
+private:
+    static uint32_t rotr(uint32_t x, int n)
+    {
+        return (x >> n) | (x << (32 - n));
+    }
+
+    void transform()
+    {
+        static const uint32_t k[64]
+            = {0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+               0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+               0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+               0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+               0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+               0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+               0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+               0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+               0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+               0xc67178f2};
+
+        uint32_t w[64];
+        for(int i = 0; i < 16; ++i)
+            w[i] = (static_cast<uint32_t>(block[i * 4]) << 24)
+                   | (static_cast<uint32_t>(block[i * 4 + 1]) << 16)
+                   | (static_cast<uint32_t>(block[i * 4 + 2]) << 8)
+                   | static_cast<uint32_t>(block[i * 4 + 3]);
+        for(int i = 16; i < 64; ++i)
+        {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i]        = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for(int i = 0; i < 64; ++i)
+        {
+            uint32_t s1    = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+            uint32_t ch    = (e & f) ^ (~e & g);
+            uint32_t temp1 = h + s1 + ch + k[i] + w[i];
+            uint32_t s0    = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+            uint32_t maj   = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t temp2 = s0 + maj;
+            h              = g;
+            g              = f;
+            f              = e;
+            e              = d + temp1;
+            d              = c;
+            c              = b;
+            b              = a;
+            a              = temp1 + temp2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+
+    uint32_t state[8];
+    uint8_t  block[64];
+    size_t   block_len = 0;
+    uint64_t total_len = 0;
+};
+
+#endif
@@ -39,6 +39,7 @@
 #include "function_map_key.h"
 #include "kargs.h"
 #include "load_store_ops.h"
+#include "offline_device.h"
 #include "rtc_kernel.h"
 #include <hip/hip_runtime_api.h>
 
@@ -389,9 +390,6 @@ public:
     size_t           chirp_size          = 0;
     gpubuf_t<size_t> devKernArg;
 
-    // callback parameters
-    UserCallbacks callbacks;
-
     hipDeviceProp_t deviceProp = {};
 
     // comments inserted by optimization passes to explain changes done
@@ -710,10 +708,13 @@ struct rocfft_location_t
     {
     }
 
-    // return a location for the current device on comm rank 0
+    // return a location for the current device on comm rank 0.
+    // offline plans are built for device 0.
     static rocfft_location_t rank0_current_device()
     {
         rocfft_location_t id;
+        if(offline_device_profile())
+            return id;
         if(hipGetDevice(&id.device) != hipSuccess)
             throw std::runtime_error("hipGetDevice failed");
         return id;
@@ -1232,6 +1233,11 @@ struct ExecPlan : public MultiPlanItem
     // we could allow users to set in the later PR
     rocfft_optimize_strategy assignOptStrategy = rocfft_optimize_balance;
 
+    // only compile this plan's kernels into the cache - the plan
+    // will never be executed, so kernels are not loaded and no
+    // device memory is allocated
+    bool compileOnly = false;
+
     // these sizes count in complex elements
     size_t workBufSize      = 0;
     size_t tmpWorkBufSize   = 0;
@@ -25,6 +25,8 @@
 #include "fuse_shim.h"
 #include "hip/hip_runtime_api.h"
 #include "logging.h"
+#include "offline_device.h"
+#include "plan_profile.h"
 #include "tree_node_1D.h"
 #include "tree_node_2D.h"
 #include "tree_node_3D.h"
@@ -214,48 +216,21 @@ NodeFactory::Map1DLength const NodeFactory::map1DLengthDouble = {
 // reversed.  This improves performance for some lengths.
 inline bool reverse_factors(size_t length)
 {
-    std::set<size_t> reverse_factors_lengths = {32256, 43008};
+    static const std::set<size_t> reverse_factors_lengths = {32256, 43008};
     return reverse_factors_lengths.count(length) == 1;
 }
 
-// Search function pool for length where is_supported_factor(length) returns true.
-inline size_t search_pool(rocfft_precision                   precision,
-                          size_t                             length,
-                          const std::function<bool(size_t)>& is_supported_factor)
-{
-    // query supported lengths from function pool, largest to smallest
-    auto supported  = function_pool::get_lengths(precision, CS_KERNEL_STOCKHAM);
-    auto comparison = std::greater<size_t>();
-    std::sort(supported.begin(), supported.end(), comparison);
-
-    if(supported.empty())
-        return 0;
-
-    // start search slightly smaller than sqrt(length)
-    auto v     = (size_t)sqrt(length);
-    auto lower = std::lower_bound(supported.cbegin(), supported.cend(), v, comparison);
-    if(*lower < sqrt(length) && lower != supported.cbegin())
-        lower--;
-
-    auto upper = supported.cend();
-
-    // search!
-    auto itr = std::find_if(lower, upper, is_supported_factor);
-    if(itr != supported.cend())
-        return *itr;
-
-    return 0;
-}
-
 // Return largest factor that has BOTH functions in the pool.
 inline size_t get_explicitly_supported_factor(rocfft_precision precision, size_t length)
 {
-    auto supported_factor = [length, precision = precision](size_t factor) -> bool {
+    auto index = function_pool::get_length_index(precision, CS_KERNEL_STOCKHAM);
+
+    auto supported_factor = [length, &index](size_t factor) -> bool {
         bool is_factor        = length % factor == 0;
-        bool has_other_kernel = function_pool::has_function(FMKey(length / factor, precision));
+        bool has_other_kernel = index->has_default_kernel(length / factor);
         return is_factor && has_other_kernel;
     };
-    auto factor = search_pool(precision, length, supported_factor);
+    auto factor = index->search(length, supported_factor);
     if(factor > 0 && reverse_factors(length))
         return length / factor;
     return factor;
@@ -268,7 +243,8 @@ inline size_t get_largest_supported_factor(rocfft_precision precision, size_t le
         bool is_factor = length % factor == 0;
         return is_factor;
     };
-    return search_pool(precision, length, supported_factor);
+    return function_pool::get_length_index(precision, CS_KERNEL_STOCKHAM)
+        ->search(length, supported_factor);
 }
 
 bool NodeFactory::Large1DLengthsValid(const NodeFactory::Map1DLength& map1DLength,
@@ -361,6 +337,14 @@ bool NodeFactory::SupportedLength(rocfft_precision precision, size_t len)
         p /= 13;
     while(!(p % 17))
         p /= 17;
+    while(!(p % 19))
+        p /= 19;
+    while(!(p % 23))
+        p /= 23;
+    while(!(p % 29))
+        p /= 29;
+    while(!(p % 31))
+        p /= 31;
 
     if(p == 1)
         return true;
@@ -538,6 +522,8 @@ std::unique_ptr<FuseShim> NodeFactory::CreateFuseShim(FuseType
 
 ComputeScheme NodeFactory::DecideNodeScheme(NodeMetaData& nodeData, TreeNode* parent)
 {
+    PlanPhaseTimer timer(PlanPhase::DECIDE_NODE_SCHEME);
+
     if((parent == nullptr)
        && ((nodeData.inArrayType == rocfft_array_type_real)
            || (nodeData.outArrayType == rocfft_array_type_real)))
@@ -848,22 +834,32 @@ bool NodeFactory::use_CS_2D_SINGLE(NodeMetaData& nodeData)
     // it's vastly more common to have multiples of the same
     // device in the real world.
     int ldsSize;
-    int deviceid;
-    // if this fails, device 0 is a reasonable default
-    if(hipGetDevice(&deviceid) != hipSuccess)
+    if(auto profile = offline_device_profile())
     {
-        log_trace(__func__, "warning", "hipGetDevice failed - using device 0");
-        deviceid = 0;
+        // offline plans take the LDS size from the device profile
+        ldsSize = static_cast<int>(profile->maxSharedMemoryPerMultiProcessor);
     }
-    // if this fails, giving 0 to Single2DSizes will assume
-    // normal size for contemporary hardware
-    if(hipDeviceGetAttribute(&ldsSize, hipDeviceAttributeMaxSharedMemoryPerMultiprocessor, deviceid)
-       != hipSuccess)
+    else
     {
-        log_trace(__func__,
-                  "warning",
-                  "hipDeviceGetAttribute failed - assuming normal LDS size for current hardware");
-        ldsSize = 0;
+        int deviceid;
+        // if this fails, device 0 is a reasonable default
+        if(hipGetDevice(&deviceid) != hipSuccess)
+        {
+            log_trace(__func__, "warning", "hipGetDevice failed - using device 0");
+            deviceid = 0;
+        }
+        // if this fails, giving 0 to Single2DSizes will assume
+        // normal size for contemporary hardware
+        if(hipDeviceGetAttribute(
+               &ldsSize, hipDeviceAttributeMaxSharedMemoryPerMultiprocessor, deviceid)
+           != hipSuccess)
+        {
+            log_trace(
+                __func__,
+                "warning",
+                "hipDeviceGetAttribute failed - assuming normal LDS size for current hardware");
+            ldsSize = 0;
+        }
     }
 
     auto kernel = function_pool::get_kernel(
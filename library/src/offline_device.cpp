@@ -0,0 +1,56 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "offline_device.h"
+#include "../../shared/device_profile.h"
+#include "../../shared/device_properties.h"
+#include "../../shared/environment.h"
+
+#include <memory>
+
+// set once by rocfft_setup, and only read while plans are built
+static std::unique_ptr<hipDeviceProp_t> offline_profile;
+
+void offline_device_setup()
+{
+    offline_profile.reset();
+
+    auto path = rocfft_getenv("ROCFFT_OFFLINE_DEVICE_PROFILE");
+    if(path.empty())
+        return;
+    offline_profile = std::make_unique<hipDeviceProp_t>(device_profile_read(path));
+}
+
+void offline_device_cleanup()
+{
+    offline_profile.reset();
+}
+
+const hipDeviceProp_t* offline_device_profile()
+{
+    return offline_profile.get();
+}
+
+hipDeviceProp_t get_plan_device_prop()
+{
+    if(offline_profile)
+        return *offline_profile;
+    return get_curr_device_prop();
+}
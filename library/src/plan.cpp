@@ -31,9 +31,13 @@
 #include "hip/hip_runtime_api.h"
 #include "logging.h"
 #include "node_factory.h"
+#include "offline_device.h"
+#include "plan_cache.h"
+#include "plan_profile.h"
 #include "rocfft/rocfft-version.h"
 #include "rocfft/rocfft.h"
 #include "rocfft_ostream.hpp"
+#include "rtc_compile_pool.h"
 #include "rtc_kernel.h"
 #include "solution_map.h"
 #include "tuning_helper.h"
@@ -45,7 +49,10 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -1625,17 +1632,22 @@ static std::unique_ptr<ExecPlan> BuildSingleDevicePlan(NodeMetaData&         roo
                                                        rocfft_location_t     location,
                                                        rocfft_transform_type transformType,
                                                        LoadOps&              loadOps,
-                                                       StoreOps&             storeOps)
+                                                       StoreOps&             storeOps,
+                                                       bool                  compileOnly = false)
 {
-    rocfft_scoped_device dev(location.device);
+    // offline plans are built without touching any device
+    std::optional<rocfft_scoped_device> dev;
+    if(!offline_device_profile())
+        dev.emplace(location.device);
 
     auto      execPlanMultiItem = std::make_unique<ExecPlan>();
     ExecPlan& execPlan          = *execPlanMultiItem;
     try
     {
-        execPlan.location   = location;
-        execPlan.deviceProp = rootPlanData.deviceProp;
-        execPlan.rootPlan   = NodeFactory::CreateExplicitNode(rootPlanData, nullptr);
+        execPlan.location    = location;
+        execPlan.deviceProp  = rootPlanData.deviceProp;
+        execPlan.compileOnly = compileOnly;
+        execPlan.rootPlan    = NodeFactory::CreateExplicitNode(rootPlanData, nullptr);
 
         // TODO: some solutions require the problems to be unit_stride, otherwise the
         //   scheme-tree may not be applicable. In this case, we can't apply the solutions.
@@ -1646,7 +1658,10 @@ static std::unique_ptr<ExecPlan> BuildSingleDevicePlan(NodeMetaData&         roo
         // since we are trying enumerating solutions now
         if(TuningBenchmarker::GetSingleton().IsInitializingTuning() == false)
         {
-            execPlan.rootScheme = ApplySolution(execPlan);
+            {
+                PlanPhaseTimer solutionMapTimer(PlanPhase::SOLUTION_MAP);
+                execPlan.rootScheme = ApplySolution(execPlan);
+            }
             if(execPlan.rootScheme)
             {
                 execPlan.rootPlan = nullptr;
@@ -1687,7 +1702,12 @@ static std::unique_ptr<ExecPlan> BuildSingleDevicePlan(NodeMetaData&         roo
         ProcessNode(execPlan);
 
         // Plan is compiled, no need to alloc twiddles + kargs etc
-        if(rocfft_getenv("ROCFFT_INTERNAL_COMPILE_ONLY") == "1")
+        if(compileOnly || rocfft_getenv("ROCFFT_INTERNAL_COMPILE_ONLY") == "1")
+            return execPlanMultiItem;
+
+        // Offline plans can't run, so there are no device resources
+        // to set up either
+        if(offline_device_profile())
             return execPlanMultiItem;
 
         if(!PlanPowX(execPlan)) // PlanPowX enqueues the GPU kernels by function
@@ -1763,7 +1783,7 @@ static size_t C2CBrickOneDimension(rocfft_plan_t&             plan,
     rootPlanData.precision    = plan.precision;
     rootPlanData.inArrayType  = rocfft_array_type_complex_interleaved;
     rootPlanData.outArrayType = rocfft_array_type_complex_interleaved;
-    rootPlanData.deviceProp   = get_curr_device_prop();
+    rootPlanData.deviceProp   = get_plan_device_prop();
 
     auto singlePlan       = BuildSingleDevicePlan(rootPlanData,
                                             plan.get_local_comm_rank(),
@@ -2713,6 +2733,40 @@ int rocfft_plan_t::get_local_comm_size() const
 #endif
 }
 
+// set the FFT parameters on a newly-allocated plan
+static void set_plan_params(rocfft_plan                   plan,
+                            const rocfft_result_placement placement,
+                            const rocfft_transform_type   transform_type,
+                            const rocfft_precision        precision,
+                            const size_t                  dimensions,
+                            const size_t*                 lengths,
+                            const size_t                  number_of_transforms,
+                            const rocfft_plan_description description)
+{
+    plan->rank = dimensions;
+    std::copy(lengths, lengths + dimensions, std::back_inserter(plan->lengths));
+    plan->batch         = number_of_transforms;
+    plan->placement     = placement;
+    plan->precision     = precision;
+    plan->transformType = transform_type;
+
+    plan->outputLengths = plan->lengths;
+    if(transform_type == rocfft_transform_type_real_forward
+       || transform_type == rocfft_transform_type_real_inverse)
+    {
+        plan->outputLengths.front() = plan->outputLengths.front() / 2 + 1;
+    }
+    if(transform_type == rocfft_transform_type_real_inverse)
+        std::swap(plan->outputLengths, plan->lengths);
+
+    if(description != nullptr)
+    {
+        plan->desc = *description;
+    }
+    plan->desc.init_defaults(
+        plan->transformType, plan->placement, plan->lengths, plan->outputLengths);
+}
+
 rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
                                           const rocfft_result_placement placement,
                                           const rocfft_transform_type   transform_type,
@@ -2725,76 +2779,93 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
     if(dimensions > 3)
         return rocfft_status_invalid_dimensions;
 
+    // time each phase of plan creation if plan profiling is enabled
+    std::shared_ptr<PlanProfile> profile;
+    if(LOG_PLAN_PROFILE_ENABLED())
+        profile = std::make_shared<PlanProfile>();
+    PlanProfileScope profileScope(profile);
+
     try
     {
-        plan->rank = dimensions;
-        std::copy(lengths, lengths + dimensions, std::back_inserter(plan->lengths));
-        plan->batch         = number_of_transforms;
-        plan->placement     = placement;
-        plan->precision     = precision;
-        plan->transformType = transform_type;
-
-        plan->outputLengths = plan->lengths;
-        if(transform_type == rocfft_transform_type_real_forward
-           || transform_type == rocfft_transform_type_real_inverse)
         {
-            plan->outputLengths.front() = plan->outputLengths.front() / 2 + 1;
-        }
-        if(transform_type == rocfft_transform_type_real_inverse)
-            std::swap(plan->outputLengths, plan->lengths);
+            PlanPhaseTimer validateTimer(PlanPhase::VALIDATE);
 
-        if(description != nullptr)
-        {
-            plan->desc = *description;
-        }
-        plan->desc.init_defaults(
-            plan->transformType, plan->placement, plan->lengths, plan->outputLengths);
+            set_plan_params(plan,
+                            placement,
+                            transform_type,
+                            precision,
+                            dimensions,
+                            lengths,
+                            number_of_transforms,
+                            description);
 
-        auto rcfft = rocfft_status_success;
+            auto rcfft = rocfft_status_success;
 
-        if(plan->desc.comm_type == rocfft_comm_mpi)
-        {
-            // Each rank needs to know the global data distribution for plan generation, so we gather
-            // all the brick information here.
-            rcfft = allgather_brick_params_mpi(plan);
-            if(rcfft != rocfft_status_success)
-                throw std::runtime_error("gather brick params failed");
-        }
+            if(plan->desc.comm_type == rocfft_comm_mpi)
+            {
+                // Each rank needs to know the global data distribution for plan generation, so we
+                // gather all the brick information here.
+                rcfft = allgather_brick_params_mpi(plan);
+                if(rcfft != rocfft_status_success)
+                    throw std::runtime_error("gather brick params failed");
+            }
 
-        // Sort the parameters to be row major, in case they're not
-        plan->sort();
+            // Sort the parameters to be row major, in case they're not
+            plan->sort();
 
-        rcfft = check_array_type_validity(plan);
-        if(rcfft != rocfft_status_success)
-            return rcfft;
+            rcfft = check_array_type_validity(plan);
+            if(rcfft != rocfft_status_success)
+                return rcfft;
 
-        log_bench(rocfft_bench_command(plan));
+            log_bench(rocfft_bench_command(plan));
 
-        // Construct the plan
+            // Construct the plan
 
-        // Build an optimized multi-device plan, if possible
-        plan->ValidateFields();
+            // Build an optimized multi-device plan, if possible
+            plan->ValidateFields();
+        }
 
         // If we have no input/output fields, then the single ExecPlan is
         // exactly what we need to do/
         // FIXME: this check should actually be single-brick/no bricks.
         if(plan->desc.inFields.empty() && plan->desc.outFields.empty())
         {
-            NodeMetaData rootPlanData(nullptr);
-            set_rootplan_params(plan, rootPlanData);
-            set_bluestein_strides(plan, rootPlanData);
-            rootPlanData.deviceProp = get_curr_device_prop();
-
-            auto singleDevicePlan = BuildSingleDevicePlan(rootPlanData,
-                                                          0,
-                                                          rocfft_location_t::rank0_current_device(),
-                                                          plan->transformType,
-                                                          plan->desc.loadOps,
-                                                          plan->desc.storeOps);
+            auto location = rocfft_location_t::rank0_current_device();
+
+            // reuse the tree of an identical plan if we've already built one
+            auto singleDevicePlan = PlanCache::GetInstance().Get(*plan, location);
+            if(profile)
+                profile->cached = singleDevicePlan != nullptr;
+            if(!singleDevicePlan)
+            {
+                NodeMetaData rootPlanData(nullptr);
+                set_rootplan_params(plan, rootPlanData);
+                set_bluestein_strides(plan, rootPlanData);
+                rootPlanData.deviceProp = get_plan_device_prop();
+
+                singleDevicePlan = BuildSingleDevicePlan(rootPlanData,
+                                                         0,
+                                                         location,
+                                                         plan->transformType,
+                                                         plan->desc.loadOps,
+                                                         plan->desc.storeOps);
+                PlanCache::GetInstance().Put(*plan, location, *singleDevicePlan);
+            }
             plan->AddMultiPlanItem(std::move(singleDevicePlan), {});
+
+            // offline plans are never executed, so log the plan now
+            // instead of at execution time
+            if(offline_device_profile())
+                plan->LogSortedPlan({0});
         }
         else
         {
+            // multi-device plans need to know about all of the
+            // devices involved, which one offline profile can't
+            // describe
+            if(offline_device_profile())
+                throw std::runtime_error("multi-device plans can't be built offline");
+
             if(!plan->BuildOptMultiDevicePlan())
             {
                 // If optimized multi-device was not possible (either because
@@ -2803,7 +2874,7 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
 
                 NodeMetaData rootPlanData(nullptr);
                 set_rootplan_params(plan, rootPlanData);
-                rootPlanData.deviceProp = get_curr_device_prop();
+                rootPlanData.deviceProp = get_plan_device_prop();
                 set_bluestein_strides(plan, rootPlanData);
 
                 auto singleDevicePlan
@@ -2819,6 +2890,9 @@ rocfft_status rocfft_plan_create_internal(rocfft_plan                   plan,
         }
 
         plan->AllocateInternalTempBuffers();
+
+        if(profile)
+            profile->Log(rocfft_bench_command(plan));
         return rocfft_status_success;
     }
     catch(std::exception& e)
@@ -2884,6 +2958,131 @@ rocfft_status rocfft_plan_create(rocfft_plan*                  plan,
                                        description);
 }
 
+// prefetches that have been queued but not yet waited for
+static std::mutex                            prefetch_mutex;
+static std::vector<std::shared_future<void>> prefetches;
+
+rocfft_status rocfft_cache_prefetch(const rocfft_result_placement placement,
+                                    const rocfft_transform_type   transform_type,
+                                    const rocfft_precision        precision,
+                                    const size_t                  dimensions,
+                                    const size_t*                 lengths,
+                                    const size_t                  number_of_transforms,
+                                    const rocfft_plan_description description)
+{
+    if(!lengths)
+        return rocfft_status_invalid_arg_value;
+
+    log_trace(__func__,
+              "placement",
+              placement,
+              "transform_type",
+              transform_type,
+              "precision",
+              precision,
+              "dimensions",
+              dimensions,
+              "lengths",
+              std::make_pair(lengths, dimensions),
+              "number_of_transforms",
+              number_of_transforms,
+              "description",
+              description);
+
+    if(dimensions > 3)
+        return rocfft_status_invalid_dimensions;
+    // only single-device plans can be prefetched
+    if(description
+       && (!description->inFields.empty() || !description->outFields.empty()
+           || description->comm_type != rocfft_comm_none))
+        return rocfft_status_invalid_arg_value;
+
+    if(!RTCCompilePool::prefetch)
+        return rocfft_status_failure;
+
+    try
+    {
+        // check parameters now, so that the caller finds out about
+        // bad ones right away
+        auto plan = std::make_shared<rocfft_plan_t>();
+        set_plan_params(plan.get(),
+                        placement,
+                        transform_type,
+                        precision,
+                        dimensions,
+                        lengths,
+                        number_of_transforms,
+                        description);
+        plan->sort();
+
+        auto rcfft = check_array_type_validity(plan.get());
+        if(rcfft != rocfft_status_success)
+            return rcfft;
+
+        // device properties and location are for the caller's
+        // current device
+        auto rootPlanData = std::make_shared<NodeMetaData>(nullptr);
+        set_rootplan_params(plan.get(), *rootPlanData);
+        set_bluestein_strides(plan.get(), *rootPlanData);
+        rootPlanData->deviceProp = get_plan_device_prop();
+        auto location            = rocfft_location_t::rank0_current_device();
+
+        // build the plan in the background, just far enough to
+        // compile its kernels
+        auto prefetch = RTCCompilePool::prefetch->submit(
+            RTCCompilePriority::SPECULATIVE, [plan, rootPlanData, location]() {
+                BuildSingleDevicePlan(*rootPlanData,
+                                      0,
+                                      location,
+                                      plan->transformType,
+                                      plan->desc.loadOps,
+                                      plan->desc.storeOps,
+                                      true);
+            });
+
+        std::lock_guard<std::mutex> lock(prefetch_mutex);
+        prefetches.push_back(prefetch);
+        return rocfft_status_success;
+    }
+    catch(std::exception& e)
+    {
+        if(LOG_TRACE_ENABLED())
+        {
+            (*LogSingleton::GetInstance().GetTraceOS()) << e.what() << std::endl;
+        }
+        return rocfft_status_failure;
+    }
+}
+
+rocfft_status rocfft_cache_prefetch_wait()
+{
+    log_trace(__func__);
+
+    std::vector<std::shared_future<void>> waiting;
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex);
+        waiting.swap(prefetches);
+    }
+
+    auto ret = rocfft_status_success;
+    for(auto& prefetch : waiting)
+    {
+        try
+        {
+            prefetch.get();
+        }
+        catch(std::exception& e)
+        {
+            if(LOG_TRACE_ENABLED())
+            {
+                (*LogSingleton::GetInstance().GetTraceOS()) << e.what() << std::endl;
+            }
+            ret = rocfft_status_failure;
+        }
+    }
+    return ret;
+}
+
 rocfft_status rocfft_plan_destroy(rocfft_plan plan)
 {
     delete plan;
@@ -3800,8 +3999,8 @@ void RuntimeCompilePlan(ExecPlan& execPlan)
 
         // If this isn't for the local rank, don't compile.
 
-        node->compiledKernel
-            = RTCKernel::runtime_compile(*node, execPlan.deviceProp.gcnArchName, kernel_name);
+        node->compiledKernel = RTCKernel::runtime_compile(
+            *node, execPlan.deviceProp.gcnArchName, kernel_name, false, execPlan.compileOnly);
 
         // Log kernel name when tuning
         if(is_tuning)
@@ -3825,18 +4024,23 @@ void RuntimeCompilePlan(ExecPlan& execPlan)
     if(need_callbacks && !is_tuning)
     {
         load_node->compiledKernelWithCallbacks = RTCKernel::runtime_compile(
-            *load_node, execPlan.deviceProp.gcnArchName, kernel_name, true);
+            *load_node, execPlan.deviceProp.gcnArchName, kernel_name, true, execPlan.compileOnly);
 
         if(store_node != load_node)
         {
-            store_node->compiledKernelWithCallbacks = RTCKernel::runtime_compile(
-                *store_node, execPlan.deviceProp.gcnArchName, kernel_name, true);
+            store_node->compiledKernelWithCallbacks
+                = RTCKernel::runtime_compile(*store_node,
+                                             execPlan.deviceProp.gcnArchName,
+                                             kernel_name,
+                                             true,
+                                             execPlan.compileOnly);
         }
     }
 
     // All of the compilations are started in parallel (via futures),
     // so resolve the futures now.  That ensures that the plan is
     // ready to run as soon as the caller gets the plan back.
+    PlanPhaseTimer waitTimer(PlanPhase::RTC_WAIT);
     for(auto& node : execPlan.execSeq)
     {
         if(node->compiledKernel.valid())
@@ -4102,7 +4306,10 @@ void ProcessNode(ExecPlan& execPlan)
     SchemeTree* rootScheme = (execPlan.rootScheme) ? execPlan.rootScheme.get() : nullptr;
     bool        noSolution = (rootScheme == nullptr);
 
-    execPlan.rootPlan->RecursiveBuildTree(rootScheme);
+    {
+        PlanPhaseTimer buildTreeTimer(PlanPhase::BUILD_TREE);
+        execPlan.rootPlan->RecursiveBuildTree(rootScheme);
+    }
 
     assert(execPlan.rootPlan->length.size() == execPlan.rootPlan->inStride.size());
     assert(execPlan.rootPlan->length.size() == execPlan.rootPlan->outStride.size());
@@ -4130,12 +4337,18 @@ void ProcessNode(ExecPlan& execPlan)
     // try to use all buffer to get most fusion
     //execPlan.assignOptStrategy = rocfft_optimize_max_fusion;
     AssignmentPolicy policy;
-    policy.AssignBuffers(execPlan);
+    {
+        PlanPhaseTimer assignBuffersTimer(PlanPhase::ASSIGN_BUFFERS);
+        policy.AssignBuffers(execPlan);
+    }
 
     if(TuningBenchmarker::GetSingleton().IsProcessingTuning() == false)
     {
         // Apply the fusion after buffer, strides are assigned
-        execPlan.rootPlan->ApplyFusion();
+        {
+            PlanPhaseTimer fusionTimer(PlanPhase::FUSION);
+            execPlan.rootPlan->ApplyFusion();
+        }
 
         // collect the execSeq since we've fused some kernels
         execPlan.rootPlan->CollectLeaves(execPlan.execSeq, execPlan.fuseShims);
@@ -4146,7 +4359,10 @@ void ProcessNode(ExecPlan& execPlan)
     execPlan.rootPlan->RefreshTree();
 
     // add padding if necessary
-    policy.PadPlan(execPlan);
+    {
+        PlanPhaseTimer padPlanTimer(PlanPhase::PAD_PLAN);
+        policy.PadPlan(execPlan);
+    }
 
     // Collapse high dims on leaf nodes where possible
     execPlan.rootPlan->CollapseContiguousDims();
@@ -4203,8 +4419,10 @@ void ProcessNode(ExecPlan& execPlan)
         (*store_node)->storeOps = execPlan.rootPlan->storeOps;
     }
 
-    // compile kernels for applicable nodes
-    RuntimeCompilePlan(execPlan);
+    // compile kernels for applicable nodes.  offline plans stop
+    // short of compiling, since the kernels can't be launched.
+    if(!offline_device_profile())
+        RuntimeCompilePlan(execPlan);
 
     execPlan.workBufSize      = tmpBufSize + cmplxForRealSize + blueSize + chirpSize;
     execPlan.tmpWorkBufSize   = tmpBufSize;
@@ -0,0 +1,212 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "plan_cache.h"
+#include "../../shared/environment.h"
+#include "logging.h"
+#include "tuning_helper.h"
+
+#include <tuple>
+
+// default number of plans to keep
+static const size_t default_plan_cache_limit = 64;
+
+static size_t plan_cache_limit()
+{
+    auto env_limit = rocfft_getenv("ROCFFT_PLAN_CACHE_LIMIT");
+    if(env_limit.empty())
+        return default_plan_cache_limit;
+    try
+    {
+        return std::stoull(env_limit);
+    }
+    catch(std::exception&)
+    {
+        return default_plan_cache_limit;
+    }
+}
+
+PlanCache::Key::Key(const rocfft_plan_t& plan, const rocfft_location_t& location)
+    : location(location)
+    , lengths(plan.lengths)
+    , outputLengths(plan.outputLengths)
+    , batch(plan.batch)
+    , placement(plan.placement)
+    , transformType(plan.transformType)
+    , precision(plan.precision)
+    , inArrayType(plan.desc.inArrayType)
+    , outArrayType(plan.desc.outArrayType)
+    , inStrides(plan.desc.inStrides)
+    , outStrides(plan.desc.outStrides)
+    , inDist(plan.desc.inDist)
+    , outDist(plan.desc.outDist)
+    , inOffset(plan.desc.inOffset)
+    , outOffset(plan.desc.outOffset)
+    , scale_factor(plan.desc.storeOps.scale_factor)
+{
+}
+
+bool PlanCache::Key::operator<(const Key& other) const
+{
+    auto tie = [](const Key& k) {
+        return std::tie(k.location,
+                        k.lengths,
+                        k.outputLengths,
+                        k.batch,
+                        k.placement,
+                        k.transformType,
+                        k.precision,
+                        k.inArrayType,
+                        k.outArrayType,
+                        k.inStrides,
+                        k.outStrides,
+                        k.inDist,
+                        k.outDist,
+                        k.inOffset,
+                        k.outOffset,
+                        k.scale_factor);
+    };
+    return tie(*this) < tie(other);
+}
+
+// Make a new ExecPlan that shares the tree and launch parameters of
+// src.  The stream and event are not shared.
+static std::unique_ptr<ExecPlan> SharePlan(const ExecPlan& src)
+{
+    auto dst = std::make_unique<ExecPlan>();
+
+    dst->description = src.description;
+    dst->group       = src.group;
+
+    dst->location          = src.location;
+    dst->mgpuPlan          = src.mgpuPlan;
+    dst->inputPtr          = src.inputPtr;
+    dst->outputPtr         = src.outputPtr;
+    dst->rootPlan          = src.rootPlan;
+    dst->execSeq           = src.execSeq;
+    dst->solution_kernels  = src.solution_kernels;
+    dst->fuseShims         = src.fuseShims;
+    dst->devFnCall         = src.devFnCall;
+    dst->gridParam         = src.gridParam;
+    dst->deviceProp        = src.deviceProp;
+    dst->iLength           = src.iLength;
+    dst->oLength           = src.oLength;
+    dst->IsChirpPlan       = src.IsChirpPlan;
+    dst->assignOptStrategy = src.assignOptStrategy;
+    dst->compileOnly       = src.compileOnly;
+    dst->workBufSize       = src.workBufSize;
+    dst->tmpWorkBufSize    = src.tmpWorkBufSize;
+    dst->copyWorkBufSize   = src.copyWorkBufSize;
+    dst->blueWorkBufSize   = src.blueWorkBufSize;
+    dst->chirpWorkBufSize  = src.chirpWorkBufSize;
+    dst->isUnitStride      = src.isUnitStride;
+    return dst;
+}
+
+PlanCache::PlanCache()
+    : limit(plan_cache_limit())
+{
+}
+
+PlanCache::~PlanCache()
+{
+    // This is only destroyed at static deinitialization, when the
+    // runtime might already be gone, so don't try to free the device
+    // memory and code objects the cached plans hold.  rocfft_cleanup
+    // frees them properly.
+    for(auto& entry : lru_list)
+        entry.second.release();
+}
+
+PlanCache& PlanCache::GetInstance()
+{
+    static PlanCache cache;
+    return cache;
+}
+
+bool PlanCache::Enabled() const
+{
+    if(limit == 0)
+        return false;
+    // tuning builds different plans for the same problem on purpose
+    auto& tuning = TuningBenchmarker::GetSingleton();
+    if(tuning.IsInitializingTuning() || tuning.IsProcessingTuning())
+        return false;
+    // compile-only plans can't be executed
+    if(rocfft_getenv("ROCFFT_INTERNAL_COMPILE_ONLY") == "1")
+        return false;
+    return true;
+}
+
+std::unique_ptr<ExecPlan> PlanCache::Get(const rocfft_plan_t&     plan,
+                                         const rocfft_location_t& location)
+{
+    if(!Enabled())
+        return nullptr;
+
+    Key key(plan, location);
+
+    std::lock_guard<std::mutex> lck(mutex);
+
+    auto it = lru_index.find(key);
+    if(it == lru_index.end())
+        return nullptr;
+
+    // move to front
+    lru_list.splice(lru_list.begin(), lru_list, it->second);
+
+    if(LOG_PLAN_ENABLED())
+        *LogSingleton::GetInstance().GetPlanOS() << "using cached plan" << std::endl;
+
+    return SharePlan(*it->second->second);
+}
+
+void PlanCache::Put(const rocfft_plan_t&     plan,
+                    const rocfft_location_t& location,
+                    const ExecPlan&          execPlan)
+{
+    if(!Enabled() || execPlan.compileOnly)
+        return;
+
+    Key key(plan, location);
+
+    std::lock_guard<std::mutex> lck(mutex);
+
+    // another thread might have built the same plan at the same time
+    auto it = lru_index.find(key);
+    if(it != lru_index.end())
+        return;
+
+    lru_list.emplace_front(key, SharePlan(execPlan));
+    lru_index.emplace(key, lru_list.begin());
+
+    while(lru_list.size() > limit)
+    {
+        lru_index.erase(lru_list.back().first);
+        lru_list.pop_back();
+    }
+}
+
+void PlanCache::Clear()
+{
+    std::lock_guard<std::mutex> lck(mutex);
+    lru_index.clear();
+    lru_list.clear();
+}
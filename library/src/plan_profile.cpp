@@ -0,0 +1,138 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "plan_profile.h"
+#include "logging.h"
+
+#include <stdexcept>
+
+const char* PrintPlanPhase(PlanPhase phase)
+{
+    switch(phase)
+    {
+    case PlanPhase::VALIDATE:
+        return "validate";
+    case PlanPhase::SOLUTION_MAP:
+        return "solution_map";
+    case PlanPhase::BUILD_TREE:
+        return "build_tree";
+    case PlanPhase::DECIDE_NODE_SCHEME:
+        return "decide_node_scheme";
+    case PlanPhase::FUSION:
+        return "fusion";
+    case PlanPhase::ASSIGN_BUFFERS:
+        return "assign_buffers";
+    case PlanPhase::PAD_PLAN:
+        return "pad_plan";
+    case PlanPhase::TWIDDLES:
+        return "twiddles";
+    case PlanPhase::RTC_CACHE_LOOKUP:
+        return "rtc_cache_lookup";
+    case PlanPhase::RTC_GENERATE:
+        return "rtc_generate";
+    case PlanPhase::RTC_COMPILE:
+        return "rtc_compile";
+    case PlanPhase::RTC_WAIT:
+        return "rtc_wait";
+    case PlanPhase::COUNT:
+        break;
+    }
+    throw std::runtime_error("unknown plan phase");
+}
+
+static double ns_to_ms(uint64_t ns)
+{
+    return static_cast<double>(ns) / 1e6;
+}
+
+PlanProfile::PlanProfile()
+    : start(std::chrono::steady_clock::now())
+{
+    for(auto& n : ns)
+        n = 0;
+    for(auto& c : calls)
+        c = 0;
+}
+
+void PlanProfile::Add(PlanPhase phase, uint64_t elapsed_ns)
+{
+    auto idx = static_cast<size_t>(phase);
+    ns[idx] += elapsed_ns;
+    calls[idx] += 1;
+}
+
+void PlanProfile::Log(const std::string& problem) const
+{
+    std::chrono::duration<double, std::milli> total_ms = std::chrono::steady_clock::now() - start;
+
+    auto& os = *LogSingleton::GetInstance().GetPlanProfileOS();
+    os << "rocfft_plan_create"
+       << ",problem," << problem << ",cached," << cached << ",total_ms," << total_ms.count();
+    for(size_t i = 0; i < static_cast<size_t>(PlanPhase::COUNT); ++i)
+    {
+        auto name = PrintPlanPhase(static_cast<PlanPhase>(i));
+        os << "," << name << "_ms," << ns_to_ms(ns[i]) << "," << name << "_calls," << calls[i];
+    }
+    os << std::endl;
+}
+
+std::shared_ptr<PlanProfile>& PlanProfile::Current()
+{
+    static thread_local std::shared_ptr<PlanProfile> current;
+    return current;
+}
+
+PlanProfileScope::PlanProfileScope(std::shared_ptr<PlanProfile> profile)
+{
+    auto& current = PlanProfile::Current();
+    prev          = std::move(current);
+    current       = std::move(profile);
+}
+
+PlanProfileScope::~PlanProfileScope()
+{
+    PlanProfile::Current() = std::move(prev);
+}
+
+// innermost timer running on this thread
+static thread_local PlanPhaseTimer* active_timer = nullptr;
+
+PlanPhaseTimer::PlanPhaseTimer(PlanPhase phase)
+    : phase(phase)
+    , profile(PlanProfile::Current())
+{
+    if(!profile)
+        return;
+    parent       = active_timer;
+    active_timer = this;
+    start        = std::chrono::steady_clock::now();
+}
+
+PlanPhaseTimer::~PlanPhaseTimer()
+{
+    if(!profile)
+        return;
+    auto     end     = std::chrono::steady_clock::now();
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    profile->Add(phase, elapsed > nested_ns ? elapsed - nested_ns : 0);
+    if(parent)
+        parent->nested_ns += elapsed;
+    active_timer = parent;
+}
@@ -548,20 +548,12 @@ void TransformPowX(const ExecPlan&       execPlan,
         max_memory_bw = max_memory_bandwidth_GB_per_s();
     }
 
-    // assign callbacks to the node that are actually doing the
-    // loading and storing to/from global memory
+    // find the nodes that are actually doing the loading and storing
+    // to/from global memory, to give them the callbacks
     TreeNode* load_node             = nullptr;
     TreeNode* store_node            = nullptr;
     std::tie(load_node, store_node) = execPlan.get_load_store_nodes();
 
-    load_node->callbacks.load_cb_fn        = info->callbacks.load_cb_fn;
-    load_node->callbacks.load_cb_data      = info->callbacks.load_cb_data;
-    load_node->callbacks.load_cb_lds_bytes = info->callbacks.load_cb_lds_bytes;
-
-    store_node->callbacks.store_cb_fn        = info->callbacks.store_cb_fn;
-    store_node->callbacks.store_cb_data      = info->callbacks.store_cb_data;
-    store_node->callbacks.store_cb_lds_bytes = info->callbacks.store_cb_lds_bytes;
-
     for(size_t i = 0; i < execPlan.execSeq.size(); i++)
     {
         DeviceCallIn data;
@@ -722,19 +714,33 @@ void TransformPowX(const ExecPlan&       execPlan,
                             + (execPlan.tmpWorkBufSize + execPlan.copyWorkBufSize) * complexTSize);
         }
 
+        // give callback parameters to kernel launcher.  These are
+        // only kept for this launch and not stored on the node,
+        // since plans for the same problem can share a tree (see
+        // PlanCache).
+        if(data.node == load_node)
+        {
+            data.callbacks.load_cb_fn        = info->callbacks.load_cb_fn;
+            data.callbacks.load_cb_data      = info->callbacks.load_cb_data;
+            data.callbacks.load_cb_lds_bytes = info->callbacks.load_cb_lds_bytes;
+        }
+        if(data.node == store_node)
+        {
+            data.callbacks.store_cb_fn        = info->callbacks.store_cb_fn;
+            data.callbacks.store_cb_data      = info->callbacks.store_cb_data;
+            data.callbacks.store_cb_lds_bytes = info->callbacks.store_cb_lds_bytes;
+        }
+
         // if callbacks are enabled, make sure load_cb_fn and store_cb_fn are not nullptrs
-        if((data.node->callbacks.load_cb_fn == nullptr
-            && data.node->callbacks.store_cb_fn != nullptr))
+        if((data.callbacks.load_cb_fn == nullptr && data.callbacks.store_cb_fn != nullptr))
         {
             // set default load callback
-            SetDefaultCallback(data.node, SetCallbackType::LOAD, &data.node->callbacks.load_cb_fn);
+            SetDefaultCallback(data.node, SetCallbackType::LOAD, &data.callbacks.load_cb_fn);
         }
-        else if((data.node->callbacks.load_cb_fn != nullptr
-                 && data.node->callbacks.store_cb_fn == nullptr))
+        else if((data.callbacks.load_cb_fn != nullptr && data.callbacks.store_cb_fn == nullptr))
         {
             // set default store callback
-            SetDefaultCallback(
-                data.node, SetCallbackType::STORE, &data.node->callbacks.store_cb_fn);
+            SetDefaultCallback(data.node, SetCallbackType::STORE, &data.callbacks.store_cb_fn);
         }
 
         data.gridParam = execPlan.gridParam[i];
@@ -820,9 +826,6 @@ void TransformPowX(const ExecPlan&       execPlan,
 
             DeviceCallOut back;
 
-            // give callback parameters to kernel launcher
-            data.callbacks = execPlan.execSeq[i]->callbacks;
-
             // choose which compiled kernel to run
             RTCKernel* localCompiledKernel
                 = data.get_callback_type() == CallbackType::NONE
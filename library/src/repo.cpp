@@ -29,6 +29,7 @@
 #include "logging.h"
 #include "node_factory.h"
 #include "plan.h"
+#include "plan_profile.h"
 #include "repo.h"
 #include "rocfft/rocfft.h"
 #include "twiddles.h"
@@ -175,6 +176,7 @@ std::pair<void*, size_t> Repo::GetTwiddles1D(size_t                     length,
                                              bool                       attach_halfN,
                                              const std::vector<size_t>& radices)
 {
+    PlanPhaseTimer              timer(PlanPhase::TWIDDLES);
     std::lock_guard<std::mutex> lck(mtx);
     Repo&                       repo = Repo::GetRepo();
 
@@ -201,6 +203,7 @@ std::pair<void*, size_t> Repo::GetTwiddles2D(size_t                     length0,
                                              const std::vector<size_t>& radices1,
                                              const std::vector<size_t>& radices2)
 {
+    PlanPhaseTimer              timer(PlanPhase::TWIDDLES);
     std::lock_guard<std::mutex> lck(mtx);
     Repo&                       repo = Repo::GetRepo();
 
@@ -222,6 +225,7 @@ std::pair<void*, size_t> Repo::GetTwiddles2D(size_t                     length0,
 std::pair<void*, size_t>
     Repo::GetChirp(size_t length, rocfft_precision precision, const hipDeviceProp_t& deviceProp)
 {
+    PlanPhaseTimer              timer(PlanPhase::TWIDDLES);
     std::lock_guard<std::mutex> lck(mtx);
     Repo&                       repo = Repo::GetRepo();
 
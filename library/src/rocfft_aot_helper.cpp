@@ -18,6 +18,8 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <thread>
@@ -29,13 +31,13 @@ using namespace std::placeholders;
 #include "../../shared/work_queue.h"
 #include "function_pool.h"
 #include "rtc_cache.h"
+#include "rtc_normalize.h"
 #include "rtc_realcomplex_gen.h"
 #include "rtc_stockham_gen.h"
+#include "rtc_subprocess.h"
 #include "rtc_twiddle_gen.h"
 #include "solution_map.h"
 
-#include "device/kernel-generator-embed.h"
-
 #if __has_include(<filesystem>)
 #include <filesystem>
 #else
@@ -249,6 +251,7 @@ void build_stockham_function_pool(CompileQueue& queue)
         specs.threads_per_transform = i.second.threads_per_transform[0];
         specs.half_lds              = i.second.half_lds;
         specs.direct_to_from_reg    = i.second.direct_to_from_reg;
+        specs.split_radix           = i.second.split_radix;
 
         stockham_combo(
             scheme,
@@ -310,6 +313,7 @@ void build_stockham_function_pool(CompileQueue& queue)
                     specs.threads_per_transform = i.second.threads_per_transform[0];
                     specs.half_lds              = i.second.half_lds;
                     specs.direct_to_from_reg    = i.second.direct_to_from_reg;
+                    specs.split_radix           = i.second.split_radix;
                     return stockham_rtc(specs,
                                         specs,
                                         nullptr,
@@ -670,6 +674,7 @@ void build_solution_kernels(CompileQueue& queue)
                 specs.threads_per_transform = config.threads_per_transform[0];
                 specs.half_lds              = config.half_lds;
                 specs.direct_to_from_reg    = config.direct_to_from_reg;
+                specs.split_radix           = config.split_radix;
                 specs.wgs_is_derived        = true;
                 // kernel_sol should specify the static_dim, need to set here,
                 // so move specs to local instead of captured (need mutable if captured)
@@ -726,12 +731,69 @@ void build_solution_kernels(CompileQueue& queue)
     }
 }
 
+// generate source for every kernel we would compile, without
+// compiling anything, and report how long generation took
+int time_generation()
+{
+    CompileQueue queue;
+    build_stockham_function_pool(queue);
+    build_realcomplex(queue);
+    build_twiddle(queue);
+    build_solution_kernels(queue);
+    queue.push({});
+
+    std::vector<std::pair<double, std::string>> times;
+    double                                      total_ms         = 0.0;
+    size_t                                      src_bytes        = 0;
+    size_t                                      normalized_bytes = 0;
+    while(true)
+    {
+        auto item = queue.pop();
+        if(item.kernel_name.empty())
+            break;
+
+        auto start = std::chrono::steady_clock::now();
+        auto src   = item.generate_src(item.kernel_name);
+        std::chrono::duration<double, std::milli> duration
+            = std::chrono::steady_clock::now() - start;
+
+        total_ms += duration.count();
+        src_bytes += src.size();
+        normalized_bytes += rtc_normalize_source(src).size();
+        times.emplace_back(duration.count(), item.kernel_name);
+    }
+
+    std::sort(times.begin(), times.end(), std::greater<std::pair<double, std::string>>());
+    static const size_t NUM_SLOWEST = 10;
+    std::cout << "slowest kernels:" << std::endl;
+    for(size_t i = 0; i < std::min(NUM_SLOWEST, times.size()); ++i)
+        std::cout << "  " << times[i].first << " ms " << times[i].second << std::endl;
+    std::cout << times.size() << " kernels, " << src_bytes << " bytes of source generated in "
+              << total_ms << " ms, " << normalized_bytes << " bytes after normalization"
+              << std::endl;
+    return 0;
+}
+
 int main(int argc, char** argv)
 {
+    // just time source generation, if asked
+    if(argc == 2 && std::string(argv[1]) == "--time-generation")
+        return time_generation();
+
+    // optionally also write the output in flat format
+    std::string flat_cache_file;
+    if(argc > 2 && std::string(argv[1]) == "--flat-output")
+    {
+        flat_cache_file = argv[2];
+        argc -= 2;
+        argv += 2;
+    }
+
     if(argc < 5)
     {
-        puts("Usage: rocfft_aot_helper temp_cachefile.db output_cachefile.db "
-             "path/to/rocfft_rtc_helper gfx000 gfx001 ...");
+        puts("Usage: rocfft_aot_helper [--flat-output output_cachefile.kdb] temp_cachefile.db "
+             "output_cachefile.db path/to/rocfft_rtc_helper gfx000 gfx001 ...");
+        puts("       rocfft_aot_helper --time-generation");
         return 1;
     }
 
@@ -768,6 +830,11 @@ int main(int argc, char** argv)
     static const size_t      NUM_THREADS = rocfft_concurrency();
     std::vector<std::thread> threads;
     threads.reserve(NUM_THREADS);
+
+    // keep a helper process running for each thread, since most
+    // compiles happen out of process
+    RTCHelperPool::single = std::make_unique<RTCHelperPool>(NUM_THREADS);
+
     for(size_t i = 0; i < NUM_THREADS; ++i)
     {
         threads.emplace_back([&queue, &gpu_archs]() {
@@ -781,15 +848,13 @@ int main(int argc, char** argv)
                 {
                     if(item.sol_arch_name.empty())
                     {
-                        RTCCache::cached_compile(
-                            item.kernel_name, gpu_arch, item.generate_src, generator_sum());
+                        RTCCache::cached_compile(item.kernel_name, gpu_arch, item.generate_src);
                     }
                     else if(gpu_arch.find(item.sol_arch_name) != std::string::npos)
                     {
                         // std::cout << "arch: " << gpu_arch
                         //           << ", solution-kernel: " << item.kernel_name << std::endl;
-                        RTCCache::cached_compile(
-                            item.kernel_name, gpu_arch, item.generate_src, generator_sum());
+                        RTCCache::cached_compile(item.kernel_name, gpu_arch, item.generate_src);
                     }
                 }
             }
@@ -806,10 +871,13 @@ int main(int argc, char** argv)
         queue.push({});
     for(size_t i = 0; i < NUM_THREADS; ++i)
         threads[i].join();
+    RTCHelperPool::single.reset();
 
     // write the output file using what we collected in the temporary
     // cache
-    RTCCache::single->write_aot_cache(output_cache_file, generator_sum(), gpu_archs);
+    RTCCache::single->write_aot_cache(output_cache_file, gpu_archs);
+    if(!flat_cache_file.empty())
+        RTCCache::single->write_aot_flat_cache(flat_cache_file, gpu_archs);
 
     // try to shrink the temp cache file to 10 GiB
     try
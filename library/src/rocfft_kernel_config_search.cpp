@@ -45,7 +45,7 @@
 #include <set>
 
 static const std::vector<unsigned int> supported_factors
-    = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 16, 17};
+    = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 16, 17, 19, 23, 29, 31};
 static const std::vector<unsigned int> supported_wgs{64, 128, 256};
 
 // recursively find all unique factorizations of given length.  each
@@ -19,6 +19,7 @@
 // THE SOFTWARE.
 
 #include "rtc_compile.h"
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 
@@ -27,6 +28,52 @@
 #include <io.h>
 #endif
 
+// read a size-prefixed string from stdin, returns false at end of input
+static bool read_string(std::string& str)
+{
+    uint64_t size = 0;
+    if(!std::cin.read(reinterpret_cast<char*>(&size), sizeof(size)))
+        return false;
+    str.resize(size);
+    return static_cast<bool>(std::cin.read(str.data(), size));
+}
+
+// compile a stream of kernels, for the library's RTCHelperPool.  see
+// rtc_subprocess.cpp for the protocol.
+static int serve()
+{
+    std::string gpu_arch;
+    std::string kernel_src;
+    // the library closes our stdin when it's done with us
+    while(read_string(gpu_arch))
+    {
+        if(!read_string(kernel_src))
+            return 1;
+
+        char              status = 0;
+        std::vector<char> output;
+        try
+        {
+            output = compile_inprocess(kernel_src, gpu_arch);
+        }
+        catch(std::exception& e)
+        {
+            status           = 1;
+            std::string what = e.what();
+            output.assign(what.begin(), what.end());
+        }
+
+        uint64_t output_size = output.size();
+        std::cout.put(status);
+        std::cout.write(reinterpret_cast<const char*>(&output_size), sizeof(output_size));
+        std::cout.write(output.data(), output.size());
+        std::cout.flush();
+        if(!std::cout.good())
+            return 1;
+    }
+    return 0;
+}
+
 int main(int argc, const char* const* argv)
 {
 #ifdef WIN32
@@ -40,10 +87,13 @@ int main(int argc, const char* const* argv)
         {
             // GPU architecture is passed as a command line argument
             std::cerr << "usage: rocfft_rtc_helper gfxNNN\n";
+            std::cerr << "       rocfft_rtc_helper --server\n";
             throw std::runtime_error("rocfft_rtc_helper: invalid command line");
         }
 
         std::string gpu_arch = argv[1];
+        if(gpu_arch == "--server")
+            return serve();
 
         // collect stdin as kernel source
         std::string kernel_src;
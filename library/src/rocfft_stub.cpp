@@ -22,13 +22,14 @@
 
 // declare things that RTC needs to link a standalone executable
 // without the rest of rocFFT
-int log_trace_fd    = -1;
-int log_bench_fd    = -1;
-int log_profile_fd  = -1;
-int log_plan_fd     = -1;
-int log_kernelio_fd = -1;
-int log_rtc_fd      = -1;
-int log_tuning_fd   = -1;
+int log_trace_fd        = -1;
+int log_bench_fd        = -1;
+int log_profile_fd      = -1;
+int log_plan_fd         = -1;
+int log_kernelio_fd     = -1;
+int log_rtc_fd          = -1;
+int log_tuning_fd       = -1;
+int log_plan_profile_fd = -1;
 
 #ifndef ROCFFT_BUILD_OFFLINE_TUNER
 extern "C" rocfft_status rocfft_plan_create(rocfft_plan*                  plan,
@@ -130,8 +130,11 @@ std::string bluestein_single_rtc(const std::string& kernel_name, const Bluestein
     }
 
     func = make_callback_realcomplex(func, specs.cbtype);
+    func = make_cse(make_simplify(func,
+                                  {{"cbtype", rtc_cbtype_value(specs.cbtype)},
+                                   {"dim", std::to_string(specs.dim) + "u"}}));
 
-    src += func.render();
+    func.render(src);
 
     write_standalone_test_harness(func, src);
     return src;
@@ -389,8 +392,9 @@ std::string bluestein_multi_rtc(const std::string& kernel_name, const BluesteinM
         func = make_planar(func, "input");
     if(array_type_is_planar(specs.outArrayType))
         func = make_planar(func, "output");
+    func = make_cse(make_simplify(func, {{"cbtype", rtc_cbtype_value(specs.cbtype)}}));
 
-    src += func.render();
+    func.render(src);
     write_standalone_test_harness(func, src);
     return src;
 }
@@ -19,25 +19,45 @@
 // THE SOFTWARE.
 
 #include "../../shared/environment.h"
+#include "device/kernel-generator-embed.h"
 
 #include "library_path.h"
 #include "logging.h"
+#include "plan_profile.h"
 #include "rtc_cache.h"
 #include "rtc_compile.h"
+#include "rtc_normalize.h"
 #include "rtc_subprocess.h"
+#include "sha256.h"
 #include "sqlite3.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <future>
 #include <hip/hip_version.h>
 #include <hip/hiprtc.h>
 #include <mutex>
 #include <optional>
+#include <random>
+#include <set>
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace fs = std::filesystem;
 
 std::unique_ptr<RTCCache> RTCCache::single;
 
-static const char* default_cache_filename = "rocfft_kernel_cache.db";
+static const char* default_cache_filename      = "rocfft_kernel_cache.db";
+static const char* default_flat_cache_filename = "rocfft_kernel_cache.kdb";
+
+// default size of the in-memory code object cache
+static const size_t default_memory_cache_bytes = 128 * 1024 * 1024;
 
 // Lock for in-process compilation - due to limits in ROCclr, we
 // can do at most one compilation in a process before we have to
@@ -61,8 +81,11 @@ static std::vector<fs::path> rtccache_db_sys_paths()
         auto lib_path = get_library_path();
         if(!lib_path.empty())
         {
-            // try next to the library, and in rocfft subdir
+            // try next to the library, and in rocfft subdir.
+            // prefer the flat format if it's present.
             fs::path library_parent_path = lib_path.parent_path();
+            paths.push_back(library_parent_path / default_flat_cache_filename);
+            paths.push_back(library_parent_path / "rocfft" / default_flat_cache_filename);
             paths.push_back(library_parent_path / default_cache_filename);
             paths.push_back(library_parent_path / "rocfft" / default_cache_filename);
         }
@@ -86,6 +109,13 @@ static std::vector<fs::path> rtccache_db_user_paths()
     return paths;
 }
 
+// size of a kernel row and a code object row, as counted when
+// deciding how big the cache is.  this ignores indexes and other
+// per-row overhead.
+#define KERNEL_KEY_LENGTH \
+    "(LENGTH(kernel_name) + LENGTH(arch) + LENGTH(generator_sum) + LENGTH(code_digest))"
+#define CODE_OBJECT_LENGTH "(LENGTH(code) + LENGTH(digest))"
+
 static sqlite3_stmt_ptr prepare_stmt(sqlite3_ptr& db, const char* sql)
 {
     sqlite3_stmt* stmt = nullptr;
@@ -120,30 +150,112 @@ sqlite3_ptr RTCCache::connect_db(const fs::path& path, bool readonly)
 
     if(!readonly)
     {
-        // create the default table
+        // create the default tables.  code objects are stored once
+        // per unique digest, and kernels refer to them by digest,
+        // since many kernels compile to identical code.  kernels
+        // also record how often and how recently they were used, to
+        // decide what to keep when cleaning up the cache.
         auto create = prepare_stmt(db,
-                                   "CREATE TABLE IF NOT EXISTS cache_v1 ("
+                                   "CREATE TABLE IF NOT EXISTS cache_v2 ("
                                    "  kernel_name TEXT NOT NULL,"
                                    "  arch TEXT NOT NULL,"
                                    "  hip_version INTEGER NOT NULL,"
                                    "  generator_sum BLOB NOT NULL,"
-                                   "  code BLOB NOT NULL,"
+                                   "  code_digest BLOB NOT NULL,"
                                    "  timestamp INTEGER NOT NULL,"
+                                   "  last_access INTEGER NOT NULL DEFAULT 0,"
+                                   "  hit_count INTEGER NOT NULL DEFAULT 0,"
                                    "  PRIMARY KEY ("
                                    "      kernel_name, arch, hip_version, generator_sum"
                                    "      ))");
         if(sqlite3_step(create.get()) != SQLITE_DONE)
             return nullptr;
+
+        auto create_code = prepare_stmt(db,
+                                        "CREATE TABLE IF NOT EXISTS code_v2 ("
+                                        "  digest BLOB NOT NULL PRIMARY KEY,"
+                                        "  code BLOB NOT NULL"
+                                        "  )");
+        if(sqlite3_step(create_code.get()) != SQLITE_DONE)
+            return nullptr;
+
+        // leases on kernels that a process is currently compiling,
+        // so that other processes sharing this cache can wait for
+        // the result instead of compiling the same kernel
+        auto create_lease = prepare_stmt(db,
+                                         "CREATE TABLE IF NOT EXISTS compile_lease_v1 ("
+                                         "  kernel_name TEXT NOT NULL,"
+                                         "  arch TEXT NOT NULL,"
+                                         "  hip_version INTEGER NOT NULL,"
+                                         "  generator_sum BLOB NOT NULL,"
+                                         "  expires INTEGER NOT NULL,"
+                                         "  owner TEXT NOT NULL,"
+                                         "  PRIMARY KEY ("
+                                         "      kernel_name, arch, hip_version, generator_sum"
+                                         "      ))");
+        if(sqlite3_step(create_lease.get()) != SQLITE_DONE)
+            return nullptr;
+
+        // digests of kernel source by name and code generator
+        // checksum, so that a process can find a kernel's key
+        // without generating its source
+        auto create_sum = prepare_stmt(db,
+                                       "CREATE TABLE IF NOT EXISTS source_sum_v1 ("
+                                       "  kernel_name TEXT NOT NULL,"
+                                       "  generator_version BLOB NOT NULL,"
+                                       "  source_sum BLOB NOT NULL,"
+                                       "  PRIMARY KEY ("
+                                       "      kernel_name, generator_version"
+                                       "      ))");
+        if(sqlite3_step(create_sum.get()) != SQLITE_DONE)
+            return nullptr;
     }
 
     return db;
 }
 
+// Get the byte limit for the in-memory code object cache.  Setting
+// the limit to 0 disables the in-memory cache.
+static size_t rtccache_memory_limit()
+{
+    auto env_limit = rocfft_getenv("ROCFFT_RTC_CACHE_MEMORY_LIMIT");
+    if(env_limit.empty())
+        return default_memory_cache_bytes;
+    try
+    {
+        return std::stoull(env_limit);
+    }
+    catch(std::exception&)
+    {
+        return default_memory_cache_bytes;
+    }
+}
+
+// identify this process's compile leases.  the pid alone could be
+// reused by another process sharing the cache, so add a random nonce.
+static std::string compile_lease_owner()
+{
+#ifdef WIN32
+    auto pid = GetCurrentProcessId();
+#else
+    auto pid = getpid();
+#endif
+    std::random_device rd;
+    uint64_t           nonce = (static_cast<uint64_t>(rd()) << 32) | rd();
+    return std::to_string(pid) + "-" + std::to_string(nonce);
+}
+
 RTCCache::RTCCache()
+    : lru_bytes_limit(rtccache_memory_limit())
+    , lease_owner(compile_lease_owner())
 {
     auto sys_paths = rtccache_db_sys_paths();
     for(const auto& p : sys_paths)
     {
+        // system cache could be either a flat file or a database
+        flat_sys = RTCFlatCache::open(p);
+        if(flat_sys)
+            break;
         db_sys = connect_db(p, true);
         if(db_sys)
             break;
@@ -154,23 +266,28 @@ RTCCache::RTCCache()
     {
         db_user = connect_db(p, false);
         if(db_user)
+        {
+            db_user_shared = !p.empty() && p != ":memory:";
             break;
+        }
     }
 
     static const char* get_stmt_text = "SELECT code "
-                                       "FROM cache_v1 "
+                                       "FROM cache_v2 "
+                                       "JOIN code_v2 ON code_digest = digest "
                                        "WHERE"
                                        "  kernel_name = :kernel_name "
                                        "  AND arch = :arch "
                                        "  AND hip_version = :hip_version "
                                        "  AND generator_sum = :generator_sum ";
 
-    static const char* store_stmt_text = "INSERT OR REPLACE INTO cache_v1 ("
+    // replacing a kernel keeps its usage history
+    static const char* store_stmt_text = "INSERT INTO cache_v2 ("
                                          "    kernel_name,"
                                          "    arch,"
                                          "    hip_version,"
                                          "    generator_sum,"
-                                         "    code,"
+                                         "    code_digest,"
                                          "    timestamp"
                                          ")"
                                          "VALUES ("
@@ -178,9 +295,38 @@ RTCCache::RTCCache()
                                          "    :arch,"
                                          "    :hip_version,"
                                          "    :generator_sum,"
-                                         "    :code,"
+                                         "    :code_digest,"
                                          "    CAST(STRFTIME('%s','now') AS INTEGER)"
-                                         ")";
+                                         ")"
+                                         "ON CONFLICT DO UPDATE SET "
+                                         "    code_digest = excluded.code_digest,"
+                                         "    timestamp = excluded.timestamp";
+
+    static const char* store_code_stmt_text = "INSERT OR IGNORE INTO code_v2 ("
+                                              "    digest,"
+                                              "    code"
+                                              ")"
+                                              "VALUES ("
+                                              "    :digest,"
+                                              "    :code"
+                                              ")";
+
+    static const char* get_sum_stmt_text = "SELECT source_sum "
+                                           "FROM source_sum_v1 "
+                                           "WHERE"
+                                           "  kernel_name = :kernel_name "
+                                           "  AND generator_version = :generator_version ";
+
+    static const char* store_sum_stmt_text = "INSERT OR REPLACE INTO source_sum_v1 ("
+                                             "    kernel_name,"
+                                             "    generator_version,"
+                                             "    source_sum"
+                                             ")"
+                                             "VALUES ("
+                                             "    :kernel_name,"
+                                             "    :generator_version,"
+                                             "    :source_sum"
+                                             ")";
 
     // prepare get/store statements once so they can be called many
     // times
@@ -196,14 +342,188 @@ RTCCache::RTCCache()
         {
             db_sys.reset();
         }
+        // system caches built before the source digest index don't
+        // have the table, but their kernels are still usable
+        if(db_sys)
+        {
+            try
+            {
+                get_sum_stmt_sys = prepare_stmt(db_sys, get_sum_stmt_text);
+            }
+            catch(std::exception&)
+            {
+            }
+        }
     }
     if(db_user)
     {
-        get_stmt_user   = prepare_stmt(db_user, get_stmt_text);
-        store_stmt_user = prepare_stmt(db_user, store_stmt_text);
+        get_stmt_user        = prepare_stmt(db_user, get_stmt_text);
+        store_stmt_user      = prepare_stmt(db_user, store_stmt_text);
+        store_code_stmt_user = prepare_stmt(db_user, store_code_stmt_text);
+        get_sum_stmt_user    = prepare_stmt(db_user, get_sum_stmt_text);
+        store_sum_stmt_user  = prepare_stmt(db_user, store_sum_stmt_text);
+
+        // start the background writer for the user cache
+        store_thread = std::thread([this]() { store_writer(); });
     }
 }
 
+RTCCache::~RTCCache()
+{
+    // write out anything that's still pending and stop the writer
+    if(store_thread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(store_queue_mutex);
+            store_stop = true;
+        }
+        store_queue_cv.notify_all();
+        store_thread.join();
+    }
+
+    if(LOG_RTC_ENABLED())
+    {
+        auto stats = get_memory_cache_stats();
+        (*LogSingleton::GetInstance().GetRTCOS())
+            << "// memory cache hits: " << stats.hits << " misses: " << stats.misses
+            << " entries: " << stats.entries << " bytes: " << stats.bytes << std::endl;
+    }
+}
+
+std::vector<char> RTCCache::lru_get(const code_object_key& key)
+{
+    std::lock_guard<std::mutex> lock(lru_mutex);
+
+    auto it = lru_index.find(key);
+    if(it == lru_index.end())
+    {
+        ++lru_stats.misses;
+        return {};
+    }
+    ++lru_stats.hits;
+    // move the entry to the front, to mark it most recently used
+    lru_list.splice(lru_list.begin(), lru_list, it->second);
+    return it->second->second;
+}
+
+void RTCCache::lru_put(const code_object_key& key, const std::vector<char>& code)
+{
+    // don't bother with objects that could never fit
+    if(code.empty() || code.size() > lru_bytes_limit)
+        return;
+
+    std::lock_guard<std::mutex> lock(lru_mutex);
+
+    auto it = lru_index.find(key);
+    if(it != lru_index.end())
+    {
+        lru_bytes -= it->second->second.size();
+        lru_list.erase(it->second);
+        lru_index.erase(it);
+    }
+
+    // evict least recently used entries until the new one fits
+    while(!lru_list.empty() && lru_bytes + code.size() > lru_bytes_limit)
+    {
+        lru_bytes -= lru_list.back().second.size();
+        lru_index.erase(lru_list.back().first);
+        lru_list.pop_back();
+    }
+
+    lru_list.emplace_front(key, code);
+    lru_index.emplace(key, lru_list.begin());
+    lru_bytes += code.size();
+}
+
+RTCCache::memory_cache_stats RTCCache::get_memory_cache_stats()
+{
+    std::lock_guard<std::mutex> lock(lru_mutex);
+
+    memory_cache_stats stats = lru_stats;
+    stats.entries            = lru_list.size();
+    stats.bytes              = lru_bytes;
+    return stats;
+}
+
+// bind the columns that identify a kernel to the first four
+// parameters of a statement
+static bool bind_kernel_key(sqlite3_stmt*               s,
+                            const std::string&          kernel_name,
+                            const std::string&          gpu_arch,
+                            const std::array<char, 32>& generator_sum)
+{
+    return sqlite3_bind_text(s, 1, kernel_name.c_str(), kernel_name.size(), SQLITE_TRANSIENT)
+               == SQLITE_OK
+           && sqlite3_bind_text(s, 2, gpu_arch.c_str(), gpu_arch.size(), SQLITE_TRANSIENT)
+                  == SQLITE_OK
+           && sqlite3_bind_int64(s, 3, HIP_VERSION) == SQLITE_OK
+           && sqlite3_bind_blob(s, 4, generator_sum.data(), generator_sum.size(), SQLITE_TRANSIENT)
+                  == SQLITE_OK;
+}
+
+// version that source digests are indexed under.  digests depend
+// on the code generator, and on whether normalization is enabled
+// (see source_sum).
+static std::array<char, 32> source_sum_version()
+{
+    auto   sum             = generator_sum();
+    auto   normalize_state = rtc_normalize_state();
+    SHA256 h;
+    h.update(sum.data(), sum.size());
+    h.update(normalize_state.data(), normalize_state.size());
+    return h.digest();
+}
+
+// how long a compile lease is honoured before other processes give
+// up waiting and compile the kernel themselves, in case the process
+// holding the lease died
+static const int compile_lease_seconds = 60;
+
+// take the lease if nobody holds it, or if the current holder's
+// lease has expired
+static const char* acquire_lease_stmt_text
+    = "INSERT INTO compile_lease_v1 ("
+      "    kernel_name,"
+      "    arch,"
+      "    hip_version,"
+      "    generator_sum,"
+      "    expires,"
+      "    owner"
+      ")"
+      "VALUES ("
+      "    :kernel_name,"
+      "    :arch,"
+      "    :hip_version,"
+      "    :generator_sum,"
+      "    CAST(STRFTIME('%s','now') AS INTEGER) + :lease_seconds,"
+      "    :owner"
+      ")"
+      "ON CONFLICT DO UPDATE SET expires = excluded.expires, owner = excluded.owner "
+      "WHERE expires < CAST(STRFTIME('%s','now') AS INTEGER)";
+
+// only release a lease we still hold - if ours expired, another
+// process may have taken it over
+static const char* release_lease_stmt_text = "DELETE FROM compile_lease_v1 "
+                                             "WHERE"
+                                             "  kernel_name = :kernel_name "
+                                             "  AND arch = :arch "
+                                             "  AND hip_version = :hip_version "
+                                             "  AND generator_sum = :generator_sum "
+                                             "  AND owner = :owner";
+
+// add to the usage of a kernel.  parameters are numbered so that
+// the kernel key can be bound to the first four, as with the other
+// statements
+static const char* access_stmt_text = "UPDATE cache_v2 "
+                                      "SET"
+                                      "  hit_count = hit_count + ?5,"
+                                      "  last_access = MAX(last_access, ?6) "
+                                      "WHERE"
+                                      "  kernel_name = ?1 "
+                                      "  AND arch = ?2 "
+                                      "  AND hip_version = ?3 "
+                                      "  AND generator_sum = ?4 ";
+
 static std::vector<char> get_code_object_impl(const std::string&          kernel_name,
                                               const std::string&          gpu_arch,
                                               const std::array<char, 32>& generator_sum,
@@ -223,12 +543,7 @@ static std::vector<char> get_code_object_impl(const std::string&          kernel
     sqlite3_reset(s);
 
     // bind arguments to the query and execute
-    if(sqlite3_bind_text(s, 1, kernel_name.c_str(), kernel_name.size(), SQLITE_TRANSIENT)
-           != SQLITE_OK
-       || sqlite3_bind_text(s, 2, gpu_arch.c_str(), gpu_arch.size(), SQLITE_TRANSIENT) != SQLITE_OK
-       || sqlite3_bind_int64(s, 3, HIP_VERSION) != SQLITE_OK
-       || sqlite3_bind_blob(s, 4, generator_sum.data(), generator_sum.size(), SQLITE_TRANSIENT)
-              != SQLITE_OK)
+    if(!bind_kernel_key(s, kernel_name, gpu_arch, generator_sum))
     {
         throw std::runtime_error(std::string("get_code_object bind: ") + sqlite3_errmsg(db.get()));
     }
@@ -247,15 +562,60 @@ std::vector<char> RTCCache::get_code_object(const std::string&          kernel_n
                                             const std::string&          gpu_arch,
                                             const std::array<char, 32>& generator_sum)
 {
-    std::vector<char> code;
+    // allow env variable to disable reads
+    if(!rocfft_getenv("ROCFFT_RTC_CACHE_READ_DISABLE").empty())
+        return {};
+
+    // check the in-memory cache before going to the databases
+    const code_object_key key{kernel_name, gpu_arch, generator_sum};
+    std::vector<char>     code;
+    if(lru_bytes_limit)
+    {
+        code = lru_get(key);
+        if(!code.empty())
+        {
+            record_access(key);
+            return code;
+        }
+    }
+
+    // code objects that haven't been written out yet
+    {
+        std::lock_guard<std::mutex> lock(store_queue_mutex);
+        auto                        pending = store_queue.find(key);
+        if(pending != store_queue.end())
+            code = pending->second;
+    }
+    if(!code.empty())
+    {
+        record_access(key);
+        return code;
+    }
+
     // try user cache first
     if(get_stmt_user)
+    {
         code = get_code_object_impl(
             kernel_name, gpu_arch, generator_sum, db_user, get_stmt_user, get_mutex_user);
-    // fall back to system cache
+        if(!code.empty())
+            record_access(key);
+    }
+    // fall back to system cache.  lookups in a flat system cache
+    // are cheap, so those don't need to go into the LRU.
+    if(code.empty() && flat_sys)
+    {
+        size_t      code_len = 0;
+        const char* code_ptr
+            = flat_sys->lookup(kernel_name, gpu_arch, HIP_VERSION, generator_sum, code_len);
+        if(code_ptr)
+            return std::vector<char>(code_ptr, code_ptr + code_len);
+    }
     if(code.empty() && get_stmt_sys)
         code = get_code_object_impl(
             kernel_name, gpu_arch, generator_sum, db_sys, get_stmt_sys, get_mutex_sys);
+
+    if(lru_bytes_limit)
+        lru_put(key, code);
     return code;
 }
 
@@ -268,38 +628,351 @@ void RTCCache::store_code_object(const std::string&          kernel_name,
     if(!rocfft_getenv("ROCFFT_RTC_CACHE_WRITE_DISABLE").empty())
         return;
 
+    const code_object_key key{kernel_name, gpu_arch, generator_sum};
+    if(lru_bytes_limit)
+        lru_put(key, code);
+
+    if(!store_thread.joinable())
+        return;
+
+    // hand the object off to the writer, so that slow storage for
+    // the user cache doesn't hold up the caller
+    {
+        std::lock_guard<std::mutex> lock(store_queue_mutex);
+        store_queue[key] = code;
+    }
+    store_queue_cv.notify_all();
+}
+
+// number of distinct kernels whose lookups are remembered before
+// they're written to the user cache on their own
+static const size_t access_batch_size = 256;
+
+void RTCCache::record_access(const code_object_key& key)
+{
+    // usage is only tracked in the user cache
+    if(!store_thread.joinable())
+        return;
+
+    bool wake_writer = false;
+    {
+        std::lock_guard<std::mutex> lock(store_queue_mutex);
+        auto&                       record = access_queue[key];
+        ++record.hits;
+        record.last_access = time(nullptr);
+        wake_writer        = access_queue.size() >= access_batch_size;
+    }
+    if(wake_writer)
+        store_queue_cv.notify_all();
+}
+
+void RTCCache::store_writer()
+{
+    std::unique_lock<std::mutex> lock(store_queue_mutex);
+    while(true)
+    {
+        // lookups are not urgent, so don't wake up for those until
+        // there are enough of them or someone is waiting for them
+        store_queue_cv.wait(lock, [this]() {
+            return store_stop || !store_queue.empty() || !lease_release_queue.empty()
+                   || !source_sum_queue.empty()
+                   || (!access_queue.empty()
+                       && (access_flush || access_queue.size() >= access_batch_size));
+        });
+        if(store_queue.empty() && lease_release_queue.empty() && access_queue.empty()
+           && source_sum_queue.empty())
+        {
+            // nothing left to write, so stop was requested
+            return;
+        }
+
+        // take everything that's queued up and write it in one batch
+        std::map<code_object_key, std::vector<char>> batch;
+        std::vector<code_object_key>                 lease_releases;
+        access_map_t                                 accesses;
+        std::map<std::string, std::array<char, 32>>  source_sums;
+        batch.swap(store_queue);
+        lease_releases.swap(lease_release_queue);
+        accesses.swap(access_queue);
+        source_sums.swap(source_sum_queue);
+        access_flush  = false;
+        store_writing = true;
+        lock.unlock();
+
+        try
+        {
+            store_code_objects_impl(batch, lease_releases, accesses, source_sums);
+        }
+        catch(std::exception& e)
+        {
+            if(LOG_RTC_ENABLED())
+                (*LogSingleton::GetInstance().GetRTCOS()) << e.what() << std::endl;
+        }
+
+        lock.lock();
+        store_writing = false;
+        store_queue_cv.notify_all();
+    }
+}
+
+void RTCCache::flush()
+{
+    std::unique_lock<std::mutex> lock(store_queue_mutex);
+    if(!access_queue.empty())
+    {
+        access_flush = true;
+        store_queue_cv.notify_all();
+    }
+    store_queue_cv.wait(lock, [this]() {
+        return store_queue.empty() && lease_release_queue.empty() && access_queue.empty()
+               && source_sum_queue.empty() && !store_writing;
+    });
+}
+
+void RTCCache::store_code_objects_impl(
+    const std::map<code_object_key, std::vector<char>>& batch,
+    const std::vector<code_object_key>&                 lease_releases,
+    const access_map_t&                                 accesses,
+    const std::map<std::string, std::array<char, 32>>&  source_sums)
+{
     std::lock_guard<std::mutex> lock(store_mutex_user);
 
-    auto s = store_stmt_user.get();
-    sqlite3_reset(s);
+    // write the whole batch in one transaction - ignore failure to
+    // begin, as each insert can still be done on its own
+    bool in_transaction
+        = sqlite3_exec(db_user.get(), "BEGIN IMMEDIATE", nullptr, nullptr, nullptr) == SQLITE_OK;
 
-    // bind arguments to the query and execute
-    if(sqlite3_bind_text(s, 1, kernel_name.c_str(), kernel_name.size(), SQLITE_TRANSIENT)
-           != SQLITE_OK
-       || sqlite3_bind_text(s, 2, gpu_arch.c_str(), gpu_arch.size(), SQLITE_TRANSIENT) != SQLITE_OK
-       || sqlite3_bind_int64(s, 3, HIP_VERSION) != SQLITE_OK
-       || sqlite3_bind_blob(s, 4, generator_sum.data(), generator_sum.size(), SQLITE_TRANSIENT)
-              != SQLITE_OK
-       || sqlite3_bind_blob(s, 5, code.data(), code.size(), SQLITE_TRANSIENT))
+    auto s      = store_stmt_user.get();
+    auto s_code = store_code_stmt_user.get();
+    for(const auto& [key, code] : batch)
     {
-        throw std::runtime_error(std::string("store_code_object bind: ")
-                                 + sqlite3_errmsg(db_user.get()));
+        auto digest = SHA256::hash(code.data(), code.size());
+
+        sqlite3_reset(s_code);
+        sqlite3_reset(s);
+
+        // bind arguments to the queries and execute - the code
+        // object is only inserted if no identical one is present
+        if(sqlite3_bind_blob(s_code, 1, digest.data(), digest.size(), SQLITE_TRANSIENT)
+               != SQLITE_OK
+           || sqlite3_bind_blob(s_code, 2, code.data(), code.size(), SQLITE_TRANSIENT) != SQLITE_OK
+           || !bind_kernel_key(s, key.kernel_name, key.gpu_arch, key.generator_sum)
+           || sqlite3_bind_blob(s, 5, digest.data(), digest.size(), SQLITE_TRANSIENT) != SQLITE_OK)
+        {
+            std::string err = sqlite3_errmsg(db_user.get());
+            if(in_transaction)
+                sqlite3_exec(db_user.get(), "ROLLBACK", nullptr, nullptr, nullptr);
+            throw std::runtime_error(std::string("store_code_object bind: ") + err);
+        }
+        if(sqlite3_step(s_code) != SQLITE_DONE || sqlite3_step(s) != SQLITE_DONE)
+        {
+            std::cerr << "Error: failed to store code object for " << key.kernel_name << ": "
+                      << sqlite3_errmsg(db_user.get()) << std::endl;
+            // some kind of problem storing the row?  log it
+            if(LOG_RTC_ENABLED())
+                (*LogSingleton::GetInstance().GetRTCOS())
+                    << "Error: failed to store code object for " << key.kernel_name << ": "
+                    << sqlite3_errmsg(db_user.get()) << std::flush;
+        }
+        sqlite3_reset(s_code);
+        sqlite3_reset(s);
     }
-    if(sqlite3_step(s) != SQLITE_DONE)
+
+    // update usage of kernels that were looked up.  kernels that
+    // were found in the system cache have no row here, so are
+    // ignored.
+    if(!accesses.empty())
+    {
+        auto access_stmt = prepare_stmt(db_user, access_stmt_text);
+        for(const auto& [key, record] : accesses)
+        {
+            sqlite3_reset(access_stmt.get());
+            if(!bind_kernel_key(
+                   access_stmt.get(), key.kernel_name, key.gpu_arch, key.generator_sum)
+               || sqlite3_bind_int64(access_stmt.get(), 5, record.hits) != SQLITE_OK
+               || sqlite3_bind_int64(access_stmt.get(), 6, record.last_access) != SQLITE_OK
+               || sqlite3_step(access_stmt.get()) != SQLITE_DONE)
+            {
+                if(LOG_RTC_ENABLED())
+                    (*LogSingleton::GetInstance().GetRTCOS())
+                        << "Error: failed to update usage for " << key.kernel_name << ": "
+                        << sqlite3_errmsg(db_user.get()) << std::endl;
+            }
+        }
+    }
+
+    // index the source digests of kernels generated by this process
+    if(!source_sums.empty())
+    {
+        auto s_sum   = store_sum_stmt_user.get();
+        auto version = source_sum_version();
+        for(const auto& [kernel_name, sum] : source_sums)
+        {
+            sqlite3_reset(s_sum);
+            if(sqlite3_bind_text(s_sum, 1, kernel_name.c_str(), -1, SQLITE_TRANSIENT) != SQLITE_OK
+               || sqlite3_bind_blob(s_sum, 2, version.data(), version.size(), SQLITE_TRANSIENT)
+                      != SQLITE_OK
+               || sqlite3_bind_blob(s_sum, 3, sum.data(), sum.size(), SQLITE_TRANSIENT)
+                      != SQLITE_OK
+               || sqlite3_step(s_sum) != SQLITE_DONE)
+            {
+                if(LOG_RTC_ENABLED())
+                    (*LogSingleton::GetInstance().GetRTCOS())
+                        << "Error: failed to index source digest for " << kernel_name << ": "
+                        << sqlite3_errmsg(db_user.get()) << std::endl;
+            }
+        }
+        sqlite3_reset(s_sum);
+    }
+
+    // release leases in the same transaction, so that other
+    // processes see the code object as soon as the lease is gone
+    if(!lease_releases.empty())
     {
-        std::cerr << "Error: failed to store code object for " << kernel_name << ": "
-                  << sqlite3_errmsg(db_user.get()) << std::endl;
-        // some kind of problem storing the row?  log it
+        auto release_stmt = prepare_stmt(db_user, release_lease_stmt_text);
+        for(const auto& key : lease_releases)
+        {
+            sqlite3_reset(release_stmt.get());
+            if(!bind_kernel_key(
+                   release_stmt.get(), key.kernel_name, key.gpu_arch, key.generator_sum)
+               || sqlite3_bind_text(release_stmt.get(),
+                                    5,
+                                    lease_owner.c_str(),
+                                    lease_owner.size(),
+                                    SQLITE_TRANSIENT)
+                      != SQLITE_OK
+               || sqlite3_step(release_stmt.get()) != SQLITE_DONE)
+            {
+                if(LOG_RTC_ENABLED())
+                    (*LogSingleton::GetInstance().GetRTCOS())
+                        << "Error: failed to release compile lease for " << key.kernel_name << ": "
+                        << sqlite3_errmsg(db_user.get()) << std::endl;
+            }
+        }
+    }
+
+    if(in_transaction
+       && sqlite3_exec(db_user.get(), "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK)
+    {
+        std::cerr << "Error: failed to commit code objects: " << sqlite3_errmsg(db_user.get())
+                  << std::endl;
         if(LOG_RTC_ENABLED())
             (*LogSingleton::GetInstance().GetRTCOS())
-                << "Error: failed to store code object for " << kernel_name << ": "
-                << sqlite3_errmsg(db_user.get()) << std::flush;
+                << "Error: failed to commit code objects: " << sqlite3_errmsg(db_user.get())
+                << std::flush;
+        sqlite3_exec(db_user.get(), "ROLLBACK", nullptr, nullptr, nullptr);
+    }
+}
+
+RTCCache::CompileLeaseStatus RTCCache::try_acquire_compile_lease(const code_object_key& key)
+{
+    // don't interleave with a batch of stores, since the lease needs
+    // to be visible to other processes right away
+    std::lock_guard<std::mutex> lock(store_mutex_user);
+
+    auto acquire_stmt = prepare_stmt(db_user, acquire_lease_stmt_text);
+    if(!bind_kernel_key(acquire_stmt.get(), key.kernel_name, key.gpu_arch, key.generator_sum)
+       || sqlite3_bind_int64(acquire_stmt.get(), 5, compile_lease_seconds) != SQLITE_OK
+       || sqlite3_bind_text(
+              acquire_stmt.get(), 6, lease_owner.c_str(), lease_owner.size(), SQLITE_TRANSIENT)
+              != SQLITE_OK)
+        throw std::runtime_error(std::string("acquire_compile_lease bind: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    switch(sqlite3_step(acquire_stmt.get()))
+    {
+    case SQLITE_DONE:
+        return sqlite3_changes(db_user.get()) > 0 ? CompileLeaseStatus::ACQUIRED
+                                                  : CompileLeaseStatus::HELD;
+    case SQLITE_BUSY:
+    case SQLITE_LOCKED:
+        return CompileLeaseStatus::BUSY;
+    default:
+        return CompileLeaseStatus::UNAVAILABLE;
     }
-    sqlite3_reset(s);
+}
+
+std::vector<char> RTCCache::wait_compile_lease(const std::string&          kernel_name,
+                                               const std::string&          gpu_arch,
+                                               const std::array<char, 32>& generator_sum,
+                                               bool&                       have_lease)
+{
+    have_lease = false;
+
+    // leases only matter if other processes could be looking at the
+    // same cache, and if we're allowed to read and write the cache
+    if(!db_user_shared || !rocfft_getenv("ROCFFT_RTC_CACHE_READ_DISABLE").empty()
+       || !rocfft_getenv("ROCFFT_RTC_CACHE_WRITE_DISABLE").empty())
+        return {};
+
+    const code_object_key key{kernel_name, gpu_arch, generator_sum};
+    bool                  logged_wait = false;
+    // give up on a cache that stays busy for as long as a lease
+    // would last, and compile without a lease
+    std::optional<std::chrono::steady_clock::time_point> busy_deadline;
+    while(true)
+    {
+        auto status = try_acquire_compile_lease(key);
+
+        // whatever happened to the lease, the kernel might have been
+        // written by the previous lease holder
+        auto code = get_code_object_impl(
+            kernel_name, gpu_arch, generator_sum, db_user, get_stmt_user, get_mutex_user);
+        if(!code.empty())
+        {
+            if(status == CompileLeaseStatus::ACQUIRED)
+                release_compile_lease(kernel_name, gpu_arch, generator_sum);
+            if(lru_bytes_limit)
+                lru_put(key, code);
+            return code;
+        }
+        if(status == CompileLeaseStatus::ACQUIRED)
+        {
+            have_lease = true;
+            return {};
+        }
+        // if we can't write the lease for some reason, just compile
+        // without it
+        if(status == CompileLeaseStatus::UNAVAILABLE)
+            return {};
+        if(status == CompileLeaseStatus::BUSY)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if(!busy_deadline)
+                busy_deadline = now + std::chrono::seconds(compile_lease_seconds);
+            else if(now > *busy_deadline)
+                return {};
+        }
+        else
+            busy_deadline.reset();
+
+        if(!logged_wait && LOG_RTC_ENABLED())
+        {
+            (*LogSingleton::GetInstance().GetRTCOS())
+                << "// waiting for another process to compile " << kernel_name << std::endl;
+            logged_wait = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+}
+
+void RTCCache::release_compile_lease(const std::string&          kernel_name,
+                                     const std::string&          gpu_arch,
+                                     const std::array<char, 32>& generator_sum)
+{
+    // the writer releases the lease after any pending store of the
+    // code object is written
+    {
+        std::lock_guard<std::mutex> lock(store_queue_mutex);
+        lease_release_queue.push_back({kernel_name, gpu_arch, generator_sum});
+    }
+    store_queue_cv.notify_all();
 }
 
 rocfft_status RTCCache::serialize(void** buffer, size_t* buffer_len_bytes)
 {
+    flush();
+
+    std::lock_guard<std::mutex> lock(store_mutex_user);
     sqlite3_int64 db_size = 0;
     auto          ptr     = sqlite3_serialize(db_user.get(), "main", &db_size, 0);
     if(ptr)
@@ -311,21 +984,213 @@ rocfft_status RTCCache::serialize(void** buffer, size_t* buffer_len_bytes)
     return rocfft_status_failure;
 }
 
+static std::string gpu_arch_strip_flags(const std::string gpu_arch_with_flags);
+
+bool rocfft_cache_filter_t::matches(const std::string& kernel_name, const std::string& arch) const
+{
+    if(!archs.empty()
+       && std::none_of(archs.begin(), archs.end(), [&arch](const std::string& filter_arch) {
+              return gpu_arch_strip_flags(filter_arch) == arch;
+          }))
+        return false;
+    if(!kernel_prefixes.empty()
+       && std::none_of(kernel_prefixes.begin(),
+                       kernel_prefixes.end(),
+                       [&kernel_name](const std::string& prefix) {
+                           return kernel_name.compare(0, prefix.size(), prefix) == 0;
+                       }))
+        return false;
+    return true;
+}
+
+rocfft_status RTCCache::serialize(const rocfft_cache_filter_t& filter,
+                                  void**                       buffer,
+                                  size_t*                      buffer_len_bytes,
+                                  size_t*                      watermark)
+{
+    flush();
+
+    // the background writer shares the user db connection, so keep
+    // it from opening a transaction while we read
+    std::lock_guard<std::mutex> lock(store_mutex_user);
+
+    // note the time on the same clock as kernel timestamps.  the
+    // writer can't store anything while we hold the lock, so every
+    // kernel stored later is picked up by the next delta, and only
+    // kernels stored in this same second are serialized twice.
+    if(watermark)
+    {
+        auto now_stmt = prepare_stmt(db_user, "SELECT CAST(STRFTIME('%s','now') AS INTEGER)");
+        *watermark    = sqlite3_step(now_stmt.get()) == SQLITE_ROW
+                            ? sqlite3_column_int64(now_stmt.get(), 0)
+                            : 0;
+    }
+
+    // copy matching kernels to a new in-memory database, and
+    // serialize that instead
+    auto filtered = connect_db("", false);
+    if(!filtered)
+        return rocfft_status_failure;
+
+    auto kernel_stmt = prepare_stmt(db_user,
+                                    "SELECT "
+                                    "  kernel_name, "
+                                    "  arch, "
+                                    "  hip_version, "
+                                    "  generator_sum, "
+                                    "  code_digest, "
+                                    "  timestamp "
+                                    "FROM cache_v2 "
+                                    "WHERE timestamp >= :watermark");
+    auto code_stmt = prepare_stmt(db_user, "SELECT code FROM code_v2 WHERE digest = :digest");
+    auto sum_stmt  = prepare_stmt(db_user,
+                                 "SELECT "
+                                 "  kernel_name, "
+                                 "  generator_version, "
+                                 "  source_sum "
+                                 "FROM source_sum_v1 "
+                                 "WHERE kernel_name = :kernel_name AND source_sum = :source_sum");
+
+    auto insert_kernel_stmt = prepare_stmt(filtered,
+                                           "INSERT INTO cache_v2 ("
+                                           "    kernel_name,"
+                                           "    arch,"
+                                           "    hip_version,"
+                                           "    generator_sum,"
+                                           "    code_digest,"
+                                           "    timestamp"
+                                           ")"
+                                           "VALUES ( ?, ?, ?, ?, ?, ? )");
+    auto insert_code_stmt
+        = prepare_stmt(filtered, "INSERT OR IGNORE INTO code_v2 (digest, code) VALUES ( ?, ? )");
+    auto insert_sum_stmt = prepare_stmt(filtered,
+                                        "INSERT OR IGNORE INTO source_sum_v1 ("
+                                        "    kernel_name,"
+                                        "    generator_version,"
+                                        "    source_sum"
+                                        ")"
+                                        "VALUES ( ?, ?, ? )");
+
+    if(sqlite3_bind_int64(kernel_stmt.get(), 1, filter.watermark) != SQLITE_OK)
+        return rocfft_status_failure;
+
+    sqlite3_exec(filtered.get(), "BEGIN", nullptr, nullptr, nullptr);
+    std::set<std::string> copied_digests;
+    int                   rc;
+    while((rc = sqlite3_step(kernel_stmt.get())) == SQLITE_ROW)
+    {
+        auto s = kernel_stmt.get();
+
+        std::string kernel_name = reinterpret_cast<const char*>(sqlite3_column_text(s, 0));
+        std::string arch        = reinterpret_cast<const char*>(sqlite3_column_text(s, 1));
+        if(!filter.matches(kernel_name, arch))
+            continue;
+
+        // copy the kernel's row
+        sqlite3_reset(insert_kernel_stmt.get());
+        for(int col = 0; col < 6; ++col)
+        {
+            if(sqlite3_bind_value(insert_kernel_stmt.get(), col + 1, sqlite3_column_value(s, col))
+               != SQLITE_OK)
+                return rocfft_status_failure;
+        }
+        if(sqlite3_step(insert_kernel_stmt.get()) != SQLITE_DONE)
+            return rocfft_status_failure;
+
+        // the index entries that lead to it
+        sqlite3_reset(sum_stmt.get());
+        if(sqlite3_bind_value(sum_stmt.get(), 1, sqlite3_column_value(s, 0)) != SQLITE_OK
+           || sqlite3_bind_value(sum_stmt.get(), 2, sqlite3_column_value(s, 3)) != SQLITE_OK)
+            return rocfft_status_failure;
+        while(sqlite3_step(sum_stmt.get()) == SQLITE_ROW)
+        {
+            sqlite3_reset(insert_sum_stmt.get());
+            for(int col = 0; col < 3; ++col)
+            {
+                if(sqlite3_bind_value(
+                       insert_sum_stmt.get(), col + 1, sqlite3_column_value(sum_stmt.get(), col))
+                   != SQLITE_OK)
+                    return rocfft_status_failure;
+            }
+            if(sqlite3_step(insert_sum_stmt.get()) != SQLITE_DONE)
+                return rocfft_status_failure;
+        }
+
+        // and its code object, if it's not already there
+        std::string digest(static_cast<const char*>(sqlite3_column_blob(s, 4)),
+                           sqlite3_column_bytes(s, 4));
+        if(!copied_digests.insert(digest).second)
+            continue;
+        sqlite3_reset(code_stmt.get());
+        if(sqlite3_bind_value(code_stmt.get(), 1, sqlite3_column_value(s, 4)) != SQLITE_OK
+           || sqlite3_step(code_stmt.get()) != SQLITE_ROW)
+            return rocfft_status_failure;
+        sqlite3_reset(insert_code_stmt.get());
+        auto code = sqlite3_column_value(code_stmt.get(), 0);
+        if(sqlite3_bind_value(insert_code_stmt.get(), 1, sqlite3_column_value(s, 4)) != SQLITE_OK
+           || sqlite3_bind_value(insert_code_stmt.get(), 2, code) != SQLITE_OK
+           || sqlite3_step(insert_code_stmt.get()) != SQLITE_DONE)
+            return rocfft_status_failure;
+    }
+    if(rc != SQLITE_DONE
+       || sqlite3_exec(filtered.get(), "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK)
+        return rocfft_status_failure;
+
+    // statements need to be finalized before the db can be serialized
+    insert_kernel_stmt.reset();
+    insert_code_stmt.reset();
+    insert_sum_stmt.reset();
+
+    sqlite3_int64 db_size = 0;
+    auto          ptr     = sqlite3_serialize(filtered.get(), "main", &db_size, 0);
+    if(ptr)
+    {
+        *buffer           = ptr;
+        *buffer_len_bytes = db_size;
+        return rocfft_status_success;
+    }
+    return rocfft_status_failure;
+}
+
 void RTCCache::serialize_free(void* buffer)
 {
     sqlite3_free(buffer);
 }
 
+// merging in a kernel that's already present keeps its usage
+// history, like storing it does.  "WHERE true" lets sqlite tell the
+// upsert clause apart from a join on the SELECT.
+#define DESERIALIZE_UPSERT                                                  \
+    "ON CONFLICT(kernel_name, arch, hip_version, generator_sum) DO UPDATE " \
+    "SET"                                                                   \
+    "  code_digest = excluded.code_digest,"                                 \
+    "  timestamp = MAX(timestamp, excluded.timestamp)"
+
 rocfft_status RTCCache::deserialize(const void* buffer, size_t buffer_len_bytes)
 {
     std::lock_guard<std::mutex> lock(deserialize_mutex);
 
+    // the database can't be attached while the background writer
+    // has a transaction open on the connection, so finish pending
+    // writes and keep the writer out until we're done
+    flush();
+    std::lock_guard<std::mutex> store_lock(store_mutex_user);
+
     // attach an empty database named "deserialized"
-    sqlite3_exec(
-        db_user.get(), "ATTACH DATABASE ':memory:' AS deserialized", nullptr, nullptr, nullptr);
-    // the attach might fail if somehow this is our second
-    // deserialize and the db already existed.  later steps will
-    // notice this, so we can skip this error check
+    if(sqlite3_exec(
+           db_user.get(), "ATTACH DATABASE ':memory:' AS deserialized", nullptr, nullptr, nullptr)
+       != SQLITE_OK)
+        return rocfft_status_failure;
+
+    // RAII type to detach the temp db on every exit path
+    struct DetachDeserialized
+    {
+        sqlite3* db;
+        ~DetachDeserialized()
+        {
+            sqlite3_exec(db, "DETACH DATABASE deserialized", nullptr, nullptr, nullptr);
+        }
+    } detach{db_user.get()};
 
     // sqlite's API is prepared to write to the pointer, but we tell
     // it to be read-only
@@ -340,16 +1205,35 @@ rocfft_status RTCCache::deserialize(const void* buffer, size_t buffer_len_bytes)
     if(sql_err != SQLITE_OK)
         return rocfft_status_failure;
 
-    // now the deserialized db is in memory.  run an additive query to
+    // buffers serialized before kernels were keyed on their source
+    // only hold kernels that can never be found, so there is nothing
+    // to import from them
+    auto v2_stmt = prepare_stmt(db_user,
+                                "SELECT 1 FROM deserialized.sqlite_master "
+                                "WHERE type = 'table' AND name = 'cache_v2'");
+    if(sqlite3_step(v2_stmt.get()) != SQLITE_ROW)
+        return rocfft_status_success;
+    v2_stmt.reset();
+
+    // now the deserialized db is in memory.  run additive queries to
     // update the real db with the temp contents.
-    sql_err           = sqlite3_exec(db_user.get(),
-                           "INSERT OR REPLACE INTO cache_v1 ("
+    sqlite3_exec(db_user.get(), "BEGIN IMMEDIATE", nullptr, nullptr, nullptr);
+    sql_err = sqlite3_exec(db_user.get(),
+                           "INSERT OR IGNORE INTO code_v2 ("
+                           "    digest,"
+                           "    code"
+                           ")"
+                           "SELECT"
+                           "    digest,"
+                           "    code "
+                           "FROM deserialized.code_v2;"
+                           "INSERT INTO cache_v2 ("
                            "    kernel_name,"
                            "    arch,"
                            "    hip_version,"
                            "    generator_sum,"
                            "    timestamp,"
-                           "    code"
+                           "    code_digest"
                            ")"
                            "SELECT"
                            "    kernel_name,"
@@ -357,17 +1241,35 @@ rocfft_status RTCCache::deserialize(const void* buffer, size_t buffer_len_bytes)
                            "    hip_version,"
                            "    generator_sum,"
                            "    timestamp,"
-                           "    code "
-                           "FROM deserialized.cache_v1",
+                           "    code_digest "
+                           "FROM deserialized.cache_v2 "
+                           "WHERE true "
+                           DESERIALIZE_UPSERT,
                            nullptr,
                            nullptr,
                            nullptr);
-    rocfft_status ret = sql_err == SQLITE_OK ? rocfft_status_success : rocfft_status_failure;
-
-    // detach the temp db
-    sqlite3_exec(db_user.get(), "DETACH DATABASE deserialized", nullptr, nullptr, nullptr);
-
-    return ret;
+    if(sql_err == SQLITE_OK)
+    {
+        // the source digest index is optional, since buffers
+        // serialized before it was added don't have it
+        sqlite3_exec(db_user.get(),
+                     "INSERT OR IGNORE INTO source_sum_v1 ("
+                     "    kernel_name,"
+                     "    generator_version,"
+                     "    source_sum"
+                     ")"
+                     "SELECT"
+                     "    kernel_name,"
+                     "    generator_version,"
+                     "    source_sum "
+                     "FROM deserialized.source_sum_v1",
+                     nullptr,
+                     nullptr,
+                     nullptr);
+    }
+    sqlite3_exec(
+        db_user.get(), sql_err == SQLITE_OK ? "COMMIT" : "ROLLBACK", nullptr, nullptr, nullptr);
+    return sql_err == SQLITE_OK ? rocfft_status_success : rocfft_status_failure;
 }
 
 // allow user control of whether RTC is done in-process or out-of-process
@@ -405,15 +1307,193 @@ static std::string gpu_arch_strip_flags(const std::string gpu_arch_with_flags)
     return gpu_arch_with_flags.substr(0, gpu_arch_with_flags.find(':'));
 }
 
-static std::vector<char> cached_compile_impl(const std::string&          kernel_name,
-                                             const std::string&          gpu_arch,
-                                             kernel_src_gen_t            generate_src,
-                                             const std::array<char, 32>& generator_sum)
+// RAII type to release a compile lease at scope exit
+struct CompileLeaseRelease
+{
+    CompileLeaseRelease(const std::string&          kernel_name,
+                        const std::string&          gpu_arch,
+                        const std::array<char, 32>& generator_sum)
+        : kernel_name(kernel_name)
+        , gpu_arch(gpu_arch)
+        , generator_sum(generator_sum)
+    {
+    }
+    ~CompileLeaseRelease()
+    {
+        if(RTCCache::single)
+            RTCCache::single->release_compile_lease(kernel_name, gpu_arch, generator_sum);
+    }
+    const std::string&          kernel_name;
+    const std::string&          gpu_arch;
+    const std::array<char, 32>& generator_sum;
+};
+
+std::array<char, 32> RTCCache::source_sum(const std::string& kernel_src)
+{
+    SHA256 h;
+    for(auto option : compile_options())
+    {
+        h.update(option, strlen(option));
+        h.update("\n", 1);
+    }
+    // the source that's compiled also depends on the normalizer
+    auto normalize_state = rtc_normalize_state();
+    h.update(normalize_state.data(), normalize_state.size());
+    h.update("\n", 1);
+
+    // hash each line without its surrounding whitespace, skipping
+    // blank lines and lines that are only a comment
+    static const char* whitespace = " \t\r";
+    size_t             line_begin = 0;
+    while(line_begin < kernel_src.size())
+    {
+        auto line_end = kernel_src.find('\n', line_begin);
+        if(line_end == std::string::npos)
+            line_end = kernel_src.size();
+
+        auto first = kernel_src.find_first_not_of(whitespace, line_begin);
+        if(first < line_end && kernel_src.compare(first, 2, "//") != 0)
+        {
+            auto last = kernel_src.find_last_not_of(whitespace, line_end - 1);
+            h.update(kernel_src.data() + first, last + 1 - first);
+            h.update("\n", 1);
+        }
+        line_begin = line_end + 1;
+    }
+    return h.digest();
+}
+
+static bool get_source_sum_impl(const std::string&          kernel_name,
+                                const std::array<char, 32>& generator_version,
+                                sqlite3_ptr&                db,
+                                sqlite3_stmt_ptr&           get_stmt,
+                                std::mutex&                 get_mutex,
+                                std::array<char, 32>&       sum)
+{
+    std::lock_guard<std::mutex> lock(get_mutex);
+
+    auto s = get_stmt.get();
+    sqlite3_reset(s);
+
+    if(sqlite3_bind_text(s, 1, kernel_name.c_str(), kernel_name.size(), SQLITE_TRANSIENT)
+           != SQLITE_OK
+       || sqlite3_bind_blob(
+              s, 2, generator_version.data(), generator_version.size(), SQLITE_TRANSIENT)
+              != SQLITE_OK)
+    {
+        throw std::runtime_error(std::string("get_source_sum bind: ") + sqlite3_errmsg(db.get()));
+    }
+    bool found = false;
+    if(sqlite3_step(s) == SQLITE_ROW
+       && sqlite3_column_bytes(s, 0) == static_cast<int>(sum.size()))
+    {
+        const char* data = static_cast<const char*>(sqlite3_column_blob(s, 0));
+        std::copy(data, data + sum.size(), sum.begin());
+        found = true;
+    }
+    sqlite3_reset(s);
+    return found;
+}
+
+bool RTCCache::get_source_sum(const std::string& kernel_name, std::array<char, 32>& sum)
+{
+    {
+        std::lock_guard<std::mutex> lock(source_sums_mutex);
+        auto                        it = source_sums.find(kernel_name);
+        if(it != source_sums.end())
+        {
+            sum = it->second;
+            return true;
+        }
+    }
+
+    // allow env variable to disable reads
+    if(!rocfft_getenv("ROCFFT_RTC_CACHE_READ_DISABLE").empty())
+        return false;
+
+    // digests are only valid for the code generator that produced
+    // them
+    auto version = source_sum_version();
+    bool found   = false;
+    if(get_sum_stmt_user)
+        found = get_source_sum_impl(
+            kernel_name, version, db_user, get_sum_stmt_user, get_mutex_user, sum);
+    if(!found && flat_sys)
+        found = flat_sys->lookup_source_sum(kernel_name, version, sum);
+    if(!found && get_sum_stmt_sys)
+        found = get_source_sum_impl(
+            kernel_name, version, db_sys, get_sum_stmt_sys, get_mutex_sys, sum);
+    if(!found)
+        return false;
+
+    std::lock_guard<std::mutex> lock(source_sums_mutex);
+    source_sums[kernel_name] = sum;
+    return true;
+}
+
+void RTCCache::set_source_sum(const std::string& kernel_name, const std::array<char, 32>& sum)
+{
+    {
+        std::lock_guard<std::mutex> lock(source_sums_mutex);
+        source_sums[kernel_name] = sum;
+    }
+
+    if(!store_thread.joinable() || !rocfft_getenv("ROCFFT_RTC_CACHE_WRITE_DISABLE").empty())
+        return;
+
+    // index the digest in the user cache for later processes
+    {
+        std::lock_guard<std::mutex> lock(store_queue_mutex);
+        source_sum_queue[kernel_name] = sum;
+    }
+    store_queue_cv.notify_all();
+}
+
+static std::vector<char> cached_compile_impl(const std::string& kernel_name,
+                                             const std::string& gpu_arch,
+                                             kernel_src_gen_t   generate_src)
 {
+    std::string       kernel_src;
+    float             generate_ms = 0.0f;
+    RTCNormalizeStats normalize_stats;
+    auto              generate = [&]() {
+        if(!kernel_src.empty())
+            return;
+        PlanPhaseTimer timer(PlanPhase::RTC_GENERATE);
+        // callbacks are always potentially enabled, and activated by
+        // checking the enable_callbacks variable later
+        auto generate_begin = std::chrono::steady_clock::now();
+        kernel_src          = "#define ROCFFT_CALLBACKS_ENABLED\n" + generate_src(kernel_name);
+        auto generate_end   = std::chrono::steady_clock::now();
+
+        std::chrono::duration<float, std::milli> duration = generate_end - generate_begin;
+        generate_ms                                       = duration.count();
+
+        if(LOG_RTC_ENABLED())
+            (*LogSingleton::GetInstance().GetRTCOS())
+                << "// " << kernel_name << " source generated" << std::endl;
+    };
+
+    // kernels are cached under their source digest.  the digest of
+    // a kernel name only changes with the code generator, so it's
+    // indexed by name and only found by generating the source if
+    // this generator hasn't seen the kernel before.
+    std::array<char, 32> generator_sum;
+    bool                 sum_from_source = false;
+    if(!RTCCache::single || !RTCCache::single->get_source_sum(kernel_name, generator_sum))
+    {
+        generate();
+        generator_sum   = RTCCache::source_sum(kernel_src);
+        sum_from_source = true;
+        if(RTCCache::single)
+            RTCCache::single->set_source_sum(kernel_name, generator_sum);
+    }
+
     // check cache first
     std::vector<char> code;
     if(RTCCache::single)
     {
+        PlanPhaseTimer timer(PlanPhase::RTC_CACHE_LOOKUP);
         code = RTCCache::single->get_code_object(kernel_name, gpu_arch, generator_sum);
     }
 
@@ -442,29 +1522,86 @@ static std::vector<char> cached_compile_impl(const std::string&          kernel_
         }
     }
 
-    // callbacks are always potentially enabled, and activated by
-    // checking the enable_callbacks variable later
-    std::string kernel_src{"#define ROCFFT_CALLBACKS_ENABLED\n"};
+    // another process sharing the user cache might already be
+    // compiling this kernel - if so, wait for its result
+    bool have_lease = false;
+    if(RTCCache::single)
+    {
+        PlanPhaseTimer timer(PlanPhase::RTC_CACHE_LOOKUP);
+        code = RTCCache::single->wait_compile_lease(
+            kernel_name, gpu_arch, generator_sum, have_lease);
+        if(!code.empty())
+        {
+            if(LOG_RTC_ENABLED())
+            {
+                (*LogSingleton::GetInstance().GetRTCOS())
+                    << "// cache hit for " << kernel_name << " from another process" << std::endl;
+            }
+            return code;
+        }
+    }
+    // give the lease back when we're done, even if compilation fails
+    std::optional<CompileLeaseRelease> lease_release;
+    if(have_lease)
+        lease_release.emplace(kernel_name, gpu_arch, generator_sum);
+
+    generate();
+
+    // the code object is stored under the digest of the source that
+    // was actually compiled.  an indexed digest should match, but
+    // if it doesn't, correct the index rather than store code under
+    // the wrong key.  (generator_sum itself has to stay put, since
+    // the lease release refers to it.)
+    std::array<char, 32> store_sum = generator_sum;
+    if(!sum_from_source)
+    {
+        store_sum = RTCCache::source_sum(kernel_src);
+        if(store_sum != generator_sum)
+        {
+            if(LOG_RTC_ENABLED())
+                (*LogSingleton::GetInstance().GetRTCOS())
+                    << "// " << kernel_name << " indexed source digest is stale" << std::endl;
+            if(RTCCache::single)
+                RTCCache::single->set_source_sum(kernel_name, store_sum);
+        }
+    }
 
-    auto generate_begin = std::chrono::steady_clock::now();
-    kernel_src += generate_src(kernel_name);
-    auto generate_end = std::chrono::steady_clock::now();
+    // normalize only once we know the kernel needs compiling, so
+    // that cache hits don't pay for it.  the digest is taken from the
+    // generated source and the normalizer state, so it still tells
+    // apart code objects compiled from different normalized source.
+    if(rtc_normalize_enabled())
+    {
+        PlanPhaseTimer timer(PlanPhase::RTC_GENERATE);
+        kernel_src = rtc_normalize_source(kernel_src, &normalize_stats);
+    }
 
     if(LOG_RTC_ENABLED())
     {
-        std::chrono::duration<float, std::milli> generate_ms = generate_end - generate_begin;
-
         (*LogSingleton::GetInstance().GetRTCOS())
             << "// ROCFFT_RTC_BEGIN " << kernel_name << "\n"
             << kernel_src << "\n// ROCFFT_RTC_END " << kernel_name << "\n// " << kernel_name
-            << " generate duration: " << static_cast<int>(generate_ms.count()) << " ms"
-            << std::endl;
+            << " generate duration: " << static_cast<int>(generate_ms) << " ms" << std::endl;
+        if(normalize_stats.original_bytes)
+        {
+            (*LogSingleton::GetInstance().GetRTCOS())
+                << "// " << kernel_name << " normalized source: "
+                << normalize_stats.original_bytes - normalize_stats.normalized_bytes
+                << " of " << normalize_stats.original_bytes << " bytes saved, "
+                << normalize_stats.removed_definitions << " unused definitions removed"
+                << std::endl;
+        }
     }
 
     // try to set compile_begin time right when we're really
     // about to compile (i.e. after acquiring any locks)
     std::chrono::time_point<std::chrono::steady_clock> compile_begin;
 
+    // waiting for the compile lock counts as compile time in the
+    // plan profile
+    std::optional<PlanPhaseTimer> compile_timer;
+    compile_timer.emplace(PlanPhase::RTC_COMPILE);
+
     RTCProcessType process_type = get_rtc_process_type();
     switch(process_type)
     {
@@ -520,6 +1657,7 @@ static std::vector<char> cached_compile_impl(const std::string&          kernel_
     }
     }
     auto compile_end = std::chrono::steady_clock::now();
+    compile_timer.reset();
 
     if(LOG_RTC_ENABLED())
     {
@@ -533,7 +1671,7 @@ static std::vector<char> cached_compile_impl(const std::string&          kernel_
 
     if(RTCCache::single)
     {
-        RTCCache::single->store_code_object(kernel_name, gpu_arch, generator_sum, code);
+        RTCCache::single->store_code_object(kernel_name, gpu_arch, store_sum, code);
     }
     return code;
 }
@@ -557,10 +1695,9 @@ struct PendingCompileCleanup
     const RTCCache::pending_key& key;
 };
 
-std::vector<char> RTCCache::cached_compile(const std::string&          kernel_name,
-                                           const std::string&          gpu_arch_with_flags,
-                                           kernel_src_gen_t            generate_src,
-                                           const std::array<char, 32>& generator_sum)
+std::vector<char> RTCCache::cached_compile(const std::string& kernel_name,
+                                           const std::string& gpu_arch_with_flags,
+                                           kernel_src_gen_t   generate_src)
 {
     // Supplied gpu arch may have extra flags on it
     // (e.g. gfx90a:sramecc+:xnack-), Strip those from the arch name
@@ -574,8 +1711,13 @@ std::vector<char> RTCCache::cached_compile(const std::string&          kernel_na
 
     std::shared_future<std::vector<char>> result;
 
+    // task to look up the kernel in the cache or compile it
+    std::packaged_task<std::vector<char>()> compile_task(
+        [&]() { return cached_compile_impl(kernel_name, gpu_arch, generate_src); });
+
     const pending_key                    key{kernel_name, gpu_arch};
     std::optional<PendingCompileCleanup> cleanup;
+    bool                                 run_task = true;
     if(RTCCache::single)
     {
         // check the map of pending work for this compile
@@ -583,28 +1725,28 @@ std::vector<char> RTCCache::cached_compile(const std::string&          kernel_na
         auto                        pc = RTCCache::single->pending_compiles.find(key);
         if(pc == RTCCache::single->pending_compiles.end())
         {
-            // not in the pending map, so add a future and launch the
-            // work to look up the kernel in the cache or compile it.
+            // not in the pending map, so add a future that other
+            // requests for the same kernel can wait on.
             pc = RTCCache::single->pending_compiles
-                     .emplace(key,
-                              std::async(std::launch::async,
-                                         cached_compile_impl,
-                                         kernel_name,
-                                         gpu_arch,
-                                         generate_src,
-                                         generator_sum))
+                     .emplace(key, compile_task.get_future().share())
                      .first;
             cleanup.emplace(key);
         }
+        else
+            run_task = false;
         result = pc->second;
     }
     else
     {
         // no cache?  just directly compile
-        std::promise<std::vector<char>> p;
-        p.set_value(cached_compile_impl(kernel_name, gpu_arch, generate_src, generator_sum));
-        result = p.get_future();
+        result = compile_task.get_future().share();
     }
+
+    // do the work on this thread if nobody else is already doing it.
+    // the caller is already running asynchronously, so there's no
+    // need to start another thread.
+    if(run_task)
+        compile_task();
     return result.get();
 }
 
@@ -622,10 +1764,55 @@ void RTCCache::enable_write_mostly()
     sqlite3_step(wal_stmt.get());
 }
 
+void RTCCache::fill_aot_kernel_table(const std::vector<std::string>& gpu_archs)
+{
+    auto create_temp_stmt = prepare_stmt(db_user,
+                                         "CREATE TABLE IF NOT EXISTS temp.aot_kernel ("
+                                         "  kernel_name TEXT NOT NULL,"
+                                         "  arch TEXT NOT NULL,"
+                                         "  generator_sum BLOB NOT NULL )");
+    if(sqlite3_step(create_temp_stmt.get()) != SQLITE_DONE)
+        throw std::runtime_error(std::string("write_aot_cache create temp table: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    auto clear_temp_stmt = prepare_stmt(db_user, "DELETE FROM temp.aot_kernel");
+    if(sqlite3_step(clear_temp_stmt.get()) != SQLITE_DONE)
+        throw std::runtime_error(std::string("write_aot_cache clear temp table: ")
+                                 + sqlite3_errmsg(db_user.get()));
+
+    auto insert_temp_stmt
+        = prepare_stmt(db_user, "INSERT INTO temp.aot_kernel VALUES ( :kernel_name, :arch, :sum )");
+
+    std::lock_guard<std::mutex> lock(source_sums_mutex);
+    for(const auto& gpu_arch_with_flags : gpu_archs)
+    {
+        std::string gpu_arch = gpu_arch_strip_flags(gpu_arch_with_flags);
+
+        for(const auto& [kernel_name, sum] : source_sums)
+        {
+            auto s = insert_temp_stmt.get();
+            if(sqlite3_bind_text(s, 1, kernel_name.c_str(), kernel_name.size(), SQLITE_TRANSIENT)
+                   != SQLITE_OK
+               || sqlite3_bind_text(s, 2, gpu_arch.c_str(), gpu_arch.size(), SQLITE_TRANSIENT)
+                      != SQLITE_OK
+               || sqlite3_bind_blob(s, 3, sum.data(), sum.size(), SQLITE_TRANSIENT) != SQLITE_OK)
+                throw std::runtime_error(std::string("write_aot_cache temp bind: ")
+                                         + sqlite3_errmsg(db_user.get()));
+            if(sqlite3_step(s) != SQLITE_DONE)
+                throw std::runtime_error(std::string("write_aot_cache temp step: ")
+                                         + sqlite3_errmsg(db_user.get()));
+            sqlite3_reset(s);
+        }
+    }
+}
+
 void RTCCache::write_aot_cache(const std::string&              output_path,
-                               const std::array<char, 32>&     generator_sum,
                                const std::vector<std::string>& gpu_archs)
 {
+    flush();
+
+    // ATTACH can't happen inside the background writer's transaction
+    std::lock_guard<std::mutex> lock(store_mutex_user);
+
     // remove the path if it already exists, since we want to output a
     // cleanly created file
     if(fs::exists(output_path))
@@ -648,54 +1835,29 @@ void RTCCache::write_aot_cache(const std::string&              output_path,
                                  + sqlite3_errmsg(db_user.get()));
     sqlite3_reset(attach_stmt.get());
 
-    // copy only the required arches, in case more are present in the
-    // cache than we need
-    auto create_temp_stmt = prepare_stmt(db_user,
-                                         "CREATE TABLE IF NOT EXISTS temp.aot_arch ("
-                                         "  arch TEXT NOT NULL )");
-    if(sqlite3_step(create_temp_stmt.get()) != SQLITE_DONE)
-        throw std::runtime_error(std::string("write_aot_cache create temp table: ")
-                                 + sqlite3_errmsg(db_user.get()));
-
-    auto insert_temp_stmt = prepare_stmt(db_user, "INSERT INTO temp.aot_arch VALUES ( ? )");
-    for(const auto& gpu_arch_with_flags : gpu_archs)
-    {
-        std::string gpu_arch = gpu_arch_strip_flags(gpu_arch_with_flags);
-
-        if(sqlite3_bind_text(
-               insert_temp_stmt.get(), 1, gpu_arch.c_str(), gpu_arch.size(), SQLITE_TRANSIENT)
-           != SQLITE_OK)
-            throw std::runtime_error(std::string("write_aot_cache temp bind: ")
-                                     + sqlite3_errmsg(db_user.get()));
-        if(sqlite3_step(insert_temp_stmt.get()) != SQLITE_DONE)
-            throw std::runtime_error(std::string("write_aot_cache temp step: ")
-                                     + sqlite3_errmsg(db_user.get()));
-        sqlite3_reset(insert_temp_stmt.get());
-    }
+    // copy only the kernels this process asked for, for the
+    // required arches, in case more are present in the cache than
+    // we need
+    fill_aot_kernel_table(gpu_archs);
 
     // copy the kernels over in a consistent order and zero out the timestamps
     auto copy_stmt = prepare_stmt(db_user,
-                                  "INSERT INTO out_db.cache_v1 ("
+                                  "INSERT INTO out_db.cache_v2 ("
                                   "    kernel_name,"
                                   "    arch,"
                                   "    hip_version,"
                                   "    generator_sum,"
-                                  "    code,"
+                                  "    code_digest,"
                                   "    timestamp"
                                   ")"
-                                  "SELECT kernel_name, arch, hip_version, generator_sum, code, 0 "
-                                  "FROM cache_v1 "
+                                  "SELECT kernel_name, arch, hip_version, generator_sum, "
+                                  "code_digest, 0 "
+                                  "FROM cache_v2 "
+                                  "JOIN temp.aot_kernel USING (kernel_name, arch, generator_sum) "
                                   "WHERE "
-                                  "  generator_sum = :generator_sum "
-                                  "  AND hip_version = :hip_version "
-                                  "  AND arch IN ("
-                                  "    SELECT arch FROM temp.aot_arch "
-                                  "  ) "
+                                  "  hip_version = :hip_version "
                                   "ORDER BY kernel_name, arch, hip_version");
-    if(sqlite3_bind_blob(
-           copy_stmt.get(), 1, generator_sum.data(), generator_sum.size(), SQLITE_TRANSIENT)
-           != SQLITE_OK
-       || sqlite3_bind_int64(copy_stmt.get(), 2, HIP_VERSION) != SQLITE_OK)
+    if(sqlite3_bind_int64(copy_stmt.get(), 1, HIP_VERSION) != SQLITE_OK)
         throw std::runtime_error(std::string("write_aot_cache copy bind: ")
                                  + sqlite3_errmsg(db_user.get()));
 
@@ -703,44 +1865,242 @@ void RTCCache::write_aot_cache(const std::string&              output_path,
         throw std::runtime_error(std::string("write_aot_cache copy step: ")
                                  + sqlite3_errmsg(db_user.get()));
     sqlite3_reset(copy_stmt.get());
+
+    // copy the code objects those kernels refer to
+    auto copy_code_stmt = prepare_stmt(db_user,
+                                       "INSERT INTO out_db.code_v2 ("
+                                       "    digest,"
+                                       "    code"
+                                       ")"
+                                       "SELECT digest, code "
+                                       "FROM code_v2 "
+                                       "WHERE digest IN ("
+                                       "  SELECT code_digest FROM out_db.cache_v2 "
+                                       "  ) "
+                                       "ORDER BY digest");
+    if(sqlite3_step(copy_code_stmt.get()) != SQLITE_DONE)
+        throw std::runtime_error(std::string("write_aot_cache copy code step: ")
+                                 + sqlite3_errmsg(db_user.get()));
+
+    // index the kernels' source digests, so that processes using
+    // the AOT cache don't need to generate source to find them
+    auto copy_sum_stmt = prepare_stmt(db_user,
+                                      "INSERT INTO out_db.source_sum_v1 ("
+                                      "    kernel_name,"
+                                      "    generator_version,"
+                                      "    source_sum"
+                                      ")"
+                                      "SELECT DISTINCT kernel_name, :generator_version, "
+                                      "generator_sum "
+                                      "FROM out_db.cache_v2 "
+                                      "ORDER BY kernel_name");
+    auto version       = source_sum_version();
+    if(sqlite3_bind_blob(
+           copy_sum_stmt.get(), 1, version.data(), version.size(), SQLITE_TRANSIENT)
+       != SQLITE_OK)
+        throw std::runtime_error(std::string("write_aot_cache copy sum bind: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    if(sqlite3_step(copy_sum_stmt.get()) != SQLITE_DONE)
+        throw std::runtime_error(std::string("write_aot_cache copy sum step: ")
+                                 + sqlite3_errmsg(db_user.get()));
 }
 
-void RTCCache::cleanup_cache(sqlite3_int64 target_size_bytes)
+void RTCCache::write_aot_flat_cache(const std::string&              output_path,
+                                    const std::vector<std::string>& gpu_archs)
 {
-    // delete any kernels that are older than the newest
-    // target-size-worth of kernels
-    auto delete_stmt = prepare_stmt(db_user,
-                                    "DELETE "
-                                    "FROM cache_v1 "
+    flush();
+
+    std::lock_guard<std::mutex> lock(store_mutex_user);
+    fill_aot_kernel_table(gpu_archs);
+
+    auto select_stmt = prepare_stmt(db_user,
+                                    "SELECT kernel_name, arch, generator_sum, code "
+                                    "FROM cache_v2 "
+                                    "JOIN temp.aot_kernel USING (kernel_name, arch, generator_sum) "
+                                    "JOIN code_v2 ON code_digest = digest "
                                     "WHERE "
-                                    "  ROWID NOT IN ( "
-                                    "    SELECT "
-                                    "      rid "
-                                    "    FROM "
-                                    "      ( "
-                                    "      SELECT "
-                                    "        ROWID AS rid, "
-                                    "        kernel_name "
-                                    "        timestamp, "
-                                    "        SUM(LENGTH(code) + LENGTH(kernel_name)) "
-                                    "          OVER "
-                                    "          ( "
-                                    "          ORDER BY "
-                                    "            timestamp DESC, "
-                                    "            kernel_name "
-                                    "          ) AS total_code_length "
-                                    "      FROM cache_v1 "
-                                    "      ) totals "
-                                    "    WHERE total_code_length < :target_size_bytes "
-                                    "    ) ");
+                                    "  hip_version = :hip_version");
+
+    std::vector<RTCFlatCache::entry> entries;
+
+    auto s = select_stmt.get();
+    if(sqlite3_bind_int64(s, 1, HIP_VERSION) != SQLITE_OK)
+        throw std::runtime_error(std::string("write_aot_flat_cache bind: ")
+                                 + sqlite3_errmsg(db_user.get()));
+
+    int step_result;
+    while((step_result = sqlite3_step(s)) == SQLITE_ROW)
+    {
+        auto name = reinterpret_cast<const char*>(sqlite3_column_text(s, 0));
+        auto arch = reinterpret_cast<const char*>(sqlite3_column_text(s, 1));
+
+        std::array<char, 32> sum;
+        auto                 sum_ptr = static_cast<const char*>(sqlite3_column_blob(s, 2));
+        if(sqlite3_column_bytes(s, 2) != static_cast<int>(sum.size()))
+            throw std::runtime_error("write_aot_flat_cache: unexpected source digest length");
+        std::copy_n(sum_ptr, sum.size(), sum.begin());
+
+        auto code = static_cast<const char*>(sqlite3_column_blob(s, 3));
+        int  len  = sqlite3_column_bytes(s, 3);
+        entries.push_back({name, arch, HIP_VERSION, sum, {code, code + len}});
+    }
+    if(step_result != SQLITE_DONE)
+        throw std::runtime_error(std::string("write_aot_flat_cache step: ")
+                                 + sqlite3_errmsg(db_user.get()));
+
+    // index the kernels' source digests, so that processes using
+    // the AOT cache don't need to generate source to find them
+    std::set<std::string> kernel_names;
+    for(const auto& e : entries)
+        kernel_names.insert(e.kernel_name);
+
+    std::vector<RTCFlatCache::source_sum_entry> source_sum_entries;
+    {
+        auto                        version = source_sum_version();
+        std::lock_guard<std::mutex> sums_lock(source_sums_mutex);
+        for(const auto& [kernel_name, sum] : source_sums)
+        {
+            if(kernel_names.count(kernel_name))
+                source_sum_entries.push_back({kernel_name, version, sum});
+        }
+    }
+
+    RTCFlatCache::write(output_path, entries, source_sum_entries);
+}
+
+void RTCCache::cleanup_cache(sqlite3_int64 target_size_bytes)
+{
+    flush();
+
+    // hold the store lock for the whole cleanup, so that the
+    // deletes don't land in the background writer's transaction and
+    // VACUUM isn't attempted inside one
+    std::lock_guard<std::mutex> lock(store_mutex_user);
+    cleanup_cache_impl(target_size_bytes);
+}
+
+void RTCCache::cleanup_cache_impl(sqlite3_int64 target_size_bytes)
+{
+    // rank kernels by how often they've been used, discounted by
+    // how long it's been since they were last used, and delete any
+    // kernels that rank below the top target-size-worth of kernels.
+    // a code object shared by many kernels is only counted once, for
+    // the highest ranked kernel that uses it.
+    auto delete_stmt = prepare_stmt(
+        db_user,
+        "WITH "
+        "  ranked AS ( "
+        "    SELECT "
+        "      cache_v2.ROWID AS rid, "
+        "      kernel_name, "
+        "      arch, "
+        "      timestamp, "
+        "      code_digest, "
+        "      (hit_count + 1.0) "
+        "        / (1.0 + MAX(0, CAST(STRFTIME('%s','now') AS INTEGER) "
+        "                        - MAX(last_access, timestamp)) / 86400.0) AS score, "
+        "      " KERNEL_KEY_LENGTH " AS key_length, "
+        "      " CODE_OBJECT_LENGTH " AS code_length "
+        "    FROM cache_v2 "
+        "    JOIN code_v2 ON code_digest = digest "
+        "    ), "
+        "  sized AS ( "
+        "    SELECT "
+        "      rid, "
+        "      kernel_name, "
+        "      arch, "
+        "      timestamp, "
+        "      score, "
+        "      key_length "
+        "      + CASE ROW_NUMBER() "
+        "          OVER "
+        "          ( "
+        "          PARTITION BY code_digest "
+        "          ORDER BY "
+        "            score DESC, "
+        "            timestamp DESC, "
+        "            kernel_name, "
+        "            arch "
+        "          ) "
+        "        WHEN 1 THEN code_length "
+        "        ELSE 0 "
+        "        END AS row_length "
+        "    FROM ranked "
+        "    ), "
+        "  totals AS ( "
+        "    SELECT "
+        "      rid, "
+        "      SUM(row_length) "
+        "        OVER "
+        "        ( "
+        "        ORDER BY "
+        "          score DESC, "
+        "          timestamp DESC, "
+        "          kernel_name, "
+        "          arch "
+        "        ) AS total_length "
+        "    FROM sized "
+        "    ) "
+        "DELETE "
+        "FROM cache_v2 "
+        "WHERE "
+        "  ROWID NOT IN ( "
+        "    SELECT rid "
+        "    FROM totals "
+        "    WHERE total_length < :target_size_bytes "
+        "    ) ");
     if(sqlite3_bind_int64(delete_stmt.get(), 1, target_size_bytes) != SQLITE_OK)
         throw std::runtime_error(std::string("cleanup_cache delete bind: ")
                                  + sqlite3_errmsg(db_user.get()));
     if(sqlite3_step(delete_stmt.get()) != SQLITE_DONE)
         throw std::runtime_error(std::string("cleanup_cache delete step: ")
                                  + sqlite3_errmsg(db_user.get()));
+    if(LOG_RTC_ENABLED())
+        (*LogSingleton::GetInstance().GetRTCOS())
+            << "// cleanup_cache removed " << sqlite3_changes(db_user.get()) << " kernels"
+            << std::endl;
     delete_stmt.reset();
 
+    // delete code objects that no remaining kernel refers to
+    auto delete_code_stmt = prepare_stmt(db_user,
+                                         "DELETE "
+                                         "FROM code_v2 "
+                                         "WHERE "
+                                         "  digest NOT IN ( "
+                                         "    SELECT code_digest FROM cache_v2 "
+                                         "    ) ");
+    if(sqlite3_step(delete_code_stmt.get()) != SQLITE_DONE)
+        throw std::runtime_error(std::string("cleanup_cache delete code step: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    delete_code_stmt.reset();
+
+    // and index entries for kernels that are gone, which also drops
+    // entries left behind by older code generators
+    auto delete_sum_stmt
+        = prepare_stmt(db_user,
+                       "DELETE "
+                       "FROM source_sum_v1 "
+                       "WHERE "
+                       "  NOT EXISTS ( "
+                       "    SELECT 1 FROM cache_v2 "
+                       "    WHERE "
+                       "      cache_v2.kernel_name = source_sum_v1.kernel_name "
+                       "      AND cache_v2.generator_sum = source_sum_v1.source_sum "
+                       "    ) ");
+    if(sqlite3_step(delete_sum_stmt.get()) != SQLITE_DONE)
+        throw std::runtime_error(std::string("cleanup_cache delete sum step: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    delete_sum_stmt.reset();
+
+    // kernels in the old cache_v1 table are keyed by a checksum of
+    // the generator rather than of their source, so this version
+    // never finds them.  older versions sharing the cache might, so
+    // they're only dropped when the cache is being trimmed anyway.
+    if(sqlite3_exec(db_user.get(), "DROP TABLE IF EXISTS cache_v1", nullptr, nullptr, nullptr)
+       != SQLITE_OK)
+        throw std::runtime_error(std::string("cleanup_cache drop v1: ")
+                                 + sqlite3_errmsg(db_user.get()));
+
     // check if we can reclaim 20% or more of the file's space by vacuuming
     auto          page_count_stmt = prepare_stmt(db_user, "PRAGMA page_count");
     sqlite3_int64 page_count      = 0;
@@ -762,3 +2122,119 @@ void RTCCache::cleanup_cache(sqlite3_int64 target_size_bytes)
                                      + sqlite3_errmsg(db_user.get()));
     }
 }
+
+RTCCache::cache_composition RTCCache::get_cache_composition()
+{
+    if(!db_user)
+        return {};
+
+    // make sure usage that's only in memory is counted
+    flush();
+
+    std::lock_guard<std::mutex> lock(store_mutex_user);
+    return get_cache_composition_impl();
+}
+
+RTCCache::cache_composition RTCCache::get_cache_composition_impl()
+{
+    cache_composition composition;
+
+    auto kernel_stmt = prepare_stmt(db_user,
+                                    "SELECT "
+                                    "  COUNT(*), "
+                                    "  SUM(hit_count = 0), "
+                                    "  SUM(hit_count), "
+                                    "  SUM(" KERNEL_KEY_LENGTH ") "
+                                    "FROM cache_v2");
+    if(sqlite3_step(kernel_stmt.get()) != SQLITE_ROW)
+        throw std::runtime_error(std::string("get_cache_composition kernel step: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    composition.kernels        = sqlite3_column_int64(kernel_stmt.get(), 0);
+    composition.unused_kernels = sqlite3_column_int64(kernel_stmt.get(), 1);
+    composition.hits           = sqlite3_column_int64(kernel_stmt.get(), 2);
+    composition.bytes          = sqlite3_column_int64(kernel_stmt.get(), 3);
+
+    auto code_stmt = prepare_stmt(db_user,
+                                  "SELECT "
+                                  "  COUNT(*), "
+                                  "  SUM(LENGTH(code)), "
+                                  "  SUM(" CODE_OBJECT_LENGTH ") "
+                                  "FROM code_v2");
+    if(sqlite3_step(code_stmt.get()) != SQLITE_ROW)
+        throw std::runtime_error(std::string("get_cache_composition code step: ")
+                                 + sqlite3_errmsg(db_user.get()));
+    composition.code_objects = sqlite3_column_int64(code_stmt.get(), 0);
+    composition.code_bytes   = sqlite3_column_int64(code_stmt.get(), 1);
+    composition.bytes += sqlite3_column_int64(code_stmt.get(), 2);
+
+    return composition;
+}
+
+// Get the size limit for the user cache file.  The cache grows
+// without bound unless a limit is set, since trimming throws away
+// kernels that would otherwise have to be compiled again.
+static sqlite3_int64 rtccache_size_limit()
+{
+    auto env_limit = rocfft_getenv("ROCFFT_RTC_CACHE_SIZE_LIMIT");
+    if(env_limit.empty())
+        return 0;
+    try
+    {
+        return std::stoll(env_limit);
+    }
+    catch(std::exception&)
+    {
+        return 0;
+    }
+}
+
+void RTCCache::enforce_size_limit()
+{
+    // in-memory caches go away with the process anyway
+    if(!db_user || !db_user_shared)
+        return;
+
+    auto limit = rtccache_size_limit();
+    if(limit <= 0)
+        return;
+
+    try
+    {
+        // count usage that's only in memory, then keep the
+        // background writer out until we're done
+        flush();
+        std::lock_guard<std::mutex> lock(store_mutex_user);
+
+        // the file can't hold more than its own size in kernels, so
+        // skip counting them when the file is under the limit
+        auto          page_count_stmt = prepare_stmt(db_user, "PRAGMA page_count");
+        sqlite3_int64 page_count      = 0;
+        if(sqlite3_step(page_count_stmt.get()) == SQLITE_ROW)
+            page_count = sqlite3_column_int64(page_count_stmt.get(), 0);
+        page_count_stmt.reset();
+
+        auto          page_size_stmt = prepare_stmt(db_user, "PRAGMA page_size");
+        sqlite3_int64 page_size      = 0;
+        if(sqlite3_step(page_size_stmt.get()) == SQLITE_ROW)
+            page_size = sqlite3_column_int64(page_size_stmt.get(), 0);
+        page_size_stmt.reset();
+
+        if(page_count * page_size <= limit)
+            return;
+
+        auto composition = get_cache_composition_impl();
+        if(LOG_RTC_ENABLED())
+            (*LogSingleton::GetInstance().GetRTCOS())
+                << "// user cache: " << composition.kernels << " kernels, "
+                << composition.unused_kernels << " unused, " << composition.code_objects
+                << " code objects, " << composition.bytes << " bytes" << std::endl;
+
+        if(composition.bytes > limit)
+            cleanup_cache_impl(limit);
+    }
+    catch(std::exception& e)
+    {
+        if(LOG_RTC_ENABLED())
+            (*LogSingleton::GetInstance().GetRTCOS()) << e.what() << std::endl;
+    }
+}
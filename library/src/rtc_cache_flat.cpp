@@ -0,0 +1,397 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "rtc_cache_flat.h"
+#include "sha256.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+static const char     flat_cache_magic[8] = {'R', 'O', 'C', 'F', 'F', 'T', 'K', 'C'};
+static const uint32_t flat_cache_version  = 2;
+
+struct flat_cache_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t entry_count;
+    // offset of the index from the start of the file
+    uint64_t index_offset;
+    uint64_t source_sum_count;
+    // offset of the source digest index from the start of the file
+    uint64_t source_sum_index_offset;
+};
+
+struct flat_cache_index_entry
+{
+    uint64_t hash;
+    uint64_t key_offset;
+    uint64_t key_len;
+    uint64_t code_offset;
+    uint64_t code_len;
+};
+
+// keys are the kernel name and arch as null-terminated strings,
+// followed by the HIP version and generator checksum
+static std::string flat_cache_key(const std::string&          kernel_name,
+                                  const std::string&          gpu_arch,
+                                  int64_t                     hip_version,
+                                  const std::array<char, 32>& generator_sum)
+{
+    std::string key;
+    key.reserve(kernel_name.size() + gpu_arch.size() + 2 + sizeof(hip_version)
+                + generator_sum.size());
+    key.append(kernel_name);
+    key.push_back('\0');
+    key.append(gpu_arch);
+    key.push_back('\0');
+    key.append(reinterpret_cast<const char*>(&hip_version), sizeof(hip_version));
+    key.append(generator_sum.data(), generator_sum.size());
+    return key;
+}
+
+// source digest keys are the kernel name as a null-terminated
+// string, followed by the checksum of the generator that produced
+// the source
+static std::string flat_cache_source_sum_key(const std::string&          kernel_name,
+                                             const std::array<char, 32>& generator_version)
+{
+    std::string key;
+    key.reserve(kernel_name.size() + 1 + generator_version.size());
+    key.append(kernel_name);
+    key.push_back('\0');
+    key.append(generator_version.data(), generator_version.size());
+    return key;
+}
+
+// FNV-1a hash of a key
+static uint64_t flat_cache_hash(const char* key, size_t key_len)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for(size_t i = 0; i < key_len; ++i)
+    {
+        hash ^= static_cast<unsigned char>(key[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// find the entry for a key in one of the file's indexes.  returns
+// nullptr if the key is not present.
+static const flat_cache_index_entry* flat_cache_find(const char*        data,
+                                                     uint64_t           index_offset,
+                                                     uint64_t           count,
+                                                     const std::string& key)
+{
+    auto hash = flat_cache_hash(key.data(), key.size());
+
+    const auto index_begin = reinterpret_cast<const flat_cache_index_entry*>(data + index_offset);
+    const auto index_end   = index_begin + count;
+
+    auto entry = std::lower_bound(
+        index_begin, index_end, hash, [](const flat_cache_index_entry& e, uint64_t h) {
+            return e.hash < h;
+        });
+    // hashes might collide, so compare full keys
+    for(; entry != index_end && entry->hash == hash; ++entry)
+    {
+        if(entry->key_len == key.size()
+           && memcmp(data + entry->key_offset, key.data(), key.size()) == 0)
+            return entry;
+    }
+    return nullptr;
+}
+
+std::unique_ptr<RTCFlatCache> RTCFlatCache::open(const fs::path& path)
+{
+    if(path.empty())
+        return nullptr;
+
+    std::unique_ptr<RTCFlatCache> cache(new RTCFlatCache);
+
+#ifdef WIN32
+    HANDLE file = CreateFileW(path.wstring().c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        return nullptr;
+    cache->file_handle = file;
+
+    LARGE_INTEGER file_size;
+    if(!GetFileSizeEx(file, &file_size))
+        return nullptr;
+    if(static_cast<size_t>(file_size.QuadPart) < sizeof(flat_cache_header))
+        return nullptr;
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(!mapping)
+        return nullptr;
+    cache->mapping_handle = mapping;
+
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if(!view)
+        return nullptr;
+    cache->data = static_cast<const char*>(view);
+    cache->len  = file_size.QuadPart;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return nullptr;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(flat_cache_header))
+    {
+        close(fd);
+        return nullptr;
+    }
+    // the mapping stays valid after the descriptor is closed
+    auto mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(mapped == MAP_FAILED)
+        return nullptr;
+    cache->data = static_cast<const char*>(mapped);
+    cache->len  = st.st_size;
+#endif
+
+    // check that the header and index are sane before trusting
+    // anything else in the file
+    flat_cache_header header;
+    memcpy(&header, cache->data, sizeof(header));
+    if(memcmp(header.magic, flat_cache_magic, sizeof(flat_cache_magic)) != 0
+       || header.version != flat_cache_version)
+        return nullptr;
+
+    // the index is read in place, so it must also be aligned
+    auto index_valid = [&cache](uint64_t index_offset, uint64_t count) {
+        if(index_offset % alignof(flat_cache_index_entry) != 0 || index_offset > cache->len
+           || count > (cache->len - index_offset) / sizeof(flat_cache_index_entry))
+            return false;
+
+        const auto index
+            = reinterpret_cast<const flat_cache_index_entry*>(cache->data + index_offset);
+        for(size_t i = 0; i < count; ++i)
+        {
+            if(index[i].key_offset > cache->len
+               || index[i].key_len > cache->len - index[i].key_offset
+               || index[i].code_offset > cache->len
+               || index[i].code_len > cache->len - index[i].code_offset)
+                return false;
+        }
+        return true;
+    };
+    if(!index_valid(header.index_offset, header.entry_count)
+       || !index_valid(header.source_sum_index_offset, header.source_sum_count))
+        return nullptr;
+    return cache;
+}
+
+RTCFlatCache::~RTCFlatCache()
+{
+#ifdef WIN32
+    if(data)
+        UnmapViewOfFile(data);
+    if(mapping_handle)
+        CloseHandle(mapping_handle);
+    if(file_handle)
+        CloseHandle(file_handle);
+#else
+    if(data)
+        munmap(const_cast<char*>(data), len);
+#endif
+}
+
+const char* RTCFlatCache::lookup(const std::string&          kernel_name,
+                                 const std::string&          gpu_arch,
+                                 int64_t                     hip_version,
+                                 const std::array<char, 32>& generator_sum,
+                                 size_t&                     code_len) const
+{
+    flat_cache_header header;
+    memcpy(&header, data, sizeof(header));
+
+    auto entry = flat_cache_find(data,
+                                 header.index_offset,
+                                 header.entry_count,
+                                 flat_cache_key(kernel_name, gpu_arch, hip_version, generator_sum));
+    if(!entry)
+        return nullptr;
+    code_len = entry->code_len;
+    return data + entry->code_offset;
+}
+
+bool RTCFlatCache::lookup_source_sum(const std::string&          kernel_name,
+                                     const std::array<char, 32>& generator_version,
+                                     std::array<char, 32>&       source_sum) const
+{
+    flat_cache_header header;
+    memcpy(&header, data, sizeof(header));
+
+    auto entry = flat_cache_find(data,
+                                 header.source_sum_index_offset,
+                                 header.source_sum_count,
+                                 flat_cache_source_sum_key(kernel_name, generator_version));
+    if(!entry || entry->code_len != source_sum.size())
+        return false;
+    std::copy_n(data + entry->code_offset, source_sum.size(), source_sum.begin());
+    return true;
+}
+
+void RTCFlatCache::write(const fs::path&                      path,
+                         const std::vector<entry>&            entries,
+                         const std::vector<source_sum_entry>& source_sums)
+{
+    // source digests are laid out like code objects, with the
+    // digest in place of the code
+    struct keyed_entry
+    {
+        std::string key;
+        uint64_t    hash;
+        const char* value;
+        size_t      value_len;
+    };
+    auto by_hash = [](const keyed_entry& a, const keyed_entry& b) {
+        if(a.hash != b.hash)
+            return a.hash < b.hash;
+        return a.key < b.key;
+    };
+
+    std::vector<keyed_entry> keyed;
+    keyed.reserve(entries.size() + source_sums.size());
+    for(const auto& e : entries)
+    {
+        auto key  = flat_cache_key(e.kernel_name, e.gpu_arch, e.hip_version, e.generator_sum);
+        auto hash = flat_cache_hash(key.data(), key.size());
+        keyed.push_back({std::move(key), hash, e.code.data(), e.code.size()});
+    }
+    std::sort(keyed.begin(), keyed.end(), by_hash);
+
+    const size_t source_sums_begin = keyed.size();
+    for(const auto& s : source_sums)
+    {
+        auto key  = flat_cache_source_sum_key(s.kernel_name, s.generator_version);
+        auto hash = flat_cache_hash(key.data(), key.size());
+        keyed.push_back({std::move(key), hash, s.source_sum.data(), s.source_sum.size()});
+    }
+    std::sort(keyed.begin() + source_sums_begin, keyed.end(), by_hash);
+
+    // lay out the indexes right after the header, then the keys and
+    // values.  values are aligned to 8 bytes.  identical values are
+    // only written once, and all index entries for them point at the
+    // same bytes.
+    auto align = [](uint64_t offset) { return (offset + 7) & ~static_cast<uint64_t>(7); };
+
+    flat_cache_header header;
+    memcpy(header.magic, flat_cache_magic, sizeof(flat_cache_magic));
+    header.version          = flat_cache_version;
+    header.reserved         = 0;
+    header.entry_count      = source_sums_begin;
+    header.index_offset     = sizeof(header);
+    header.source_sum_count = keyed.size() - source_sums_begin;
+    header.source_sum_index_offset
+        = header.index_offset + source_sums_begin * sizeof(flat_cache_index_entry);
+
+    std::vector<flat_cache_index_entry> index(keyed.size());
+    // whether each entry's value is written after its key
+    std::vector<bool>                        write_value(keyed.size());
+    std::map<std::array<char, 32>, uint64_t> value_offsets;
+
+    uint64_t offset = header.index_offset + index.size() * sizeof(flat_cache_index_entry);
+    for(size_t i = 0; i < keyed.size(); ++i)
+    {
+        index[i].hash       = keyed[i].hash;
+        index[i].key_offset = offset;
+        index[i].key_len    = keyed[i].key.size();
+        offset += keyed[i].key.size();
+
+        index[i].code_len   = keyed[i].value_len;
+        auto digest         = SHA256::hash(keyed[i].value, keyed[i].value_len);
+        auto existing_value = value_offsets.find(digest);
+        if(existing_value != value_offsets.end())
+        {
+            index[i].code_offset = existing_value->second;
+            continue;
+        }
+        offset               = align(offset);
+        index[i].code_offset = offset;
+        write_value[i]       = true;
+        value_offsets.emplace(digest, offset);
+        offset += keyed[i].value_len;
+    }
+
+    // other processes might have the file mapped, so write a new
+    // file next to it and rename that into place instead of
+    // truncating it under them
+    auto tmp_path = path;
+    tmp_path += ".tmp" + std::to_string(std::random_device()());
+
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if(!out)
+        throw std::runtime_error("unable to open flat cache file " + tmp_path.string());
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(index.data()),
+              index.size() * sizeof(flat_cache_index_entry));
+
+    static const char padding[8] = {};
+    for(size_t i = 0; i < keyed.size(); ++i)
+    {
+        out.write(keyed[i].key.data(), keyed[i].key.size());
+        if(!write_value[i])
+            continue;
+        auto pos = static_cast<uint64_t>(out.tellp());
+        out.write(padding, index[i].code_offset - pos);
+        out.write(keyed[i].value, keyed[i].value_len);
+    }
+    out.close();
+
+    std::error_code err;
+    if(!out)
+    {
+        fs::remove(tmp_path, err);
+        throw std::runtime_error("failed to write flat cache file " + tmp_path.string());
+    }
+    fs::rename(tmp_path, path, err);
+    if(err)
+    {
+        std::error_code remove_err;
+        fs::remove(tmp_path, remove_err);
+        throw std::runtime_error("failed to rename flat cache file to " + path.string() + ": "
+                                 + err.message());
+    }
+}
@@ -19,7 +19,6 @@
 // THE SOFTWARE.
 
 #include "rtc_chirp_kernel.h"
-#include "device/kernel-generator-embed.h"
 #include "rtc_cache.h"
 
 RTCKernelChirp RTCKernelChirp::generate(const std::string& gpu_arch, rocfft_precision precision)
@@ -29,7 +28,7 @@ RTCKernelChirp RTCKernelChirp::generate(const std::string& gpu_arch, rocfft_prec
     kernel_src_gen_t generator{
         [=](const std::string& kernel_name) { return chirp_rtc(kernel_name, precision); }};
 
-    auto code = RTCCache::cached_compile(kernel_name, gpu_arch, generator, generator_sum());
+    auto code = RTCCache::cached_compile(kernel_name, gpu_arch, generator);
 
     return RTCKernelChirp{kernel_name, code, {}, {}};
 }
@@ -23,6 +23,12 @@
 #include <hip/hiprtc.h>
 #include <stdexcept>
 
+const std::vector<const char*>& compile_options()
+{
+    static const std::vector<const char*> options = {"-O3", "-std=c++14", "-mcumode"};
+    return options;
+}
+
 std::vector<char> compile_inprocess(const std::string& kernel_src, const std::string& gpu_arch)
 {
     hiprtcProgram prog;
@@ -35,12 +41,8 @@ std::vector<char> compile_inprocess(const std::string& kernel_src, const std::st
 
     std::string gpu_arch_arg = "--gpu-architecture=" + gpu_arch;
 
-    std::vector<const char*> options;
-    options.reserve(4);
-    options.push_back("-O3");
-    options.push_back("-std=c++14");
+    std::vector<const char*> options = compile_options();
     options.push_back(gpu_arch_arg.c_str());
-    options.push_back("-mcumode");
 
     auto compileResult = hiprtcCompileProgram(prog, options.size(), options.data());
     if(compileResult != HIPRTC_SUCCESS)
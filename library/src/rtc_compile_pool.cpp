@@ -0,0 +1,105 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "rtc_compile_pool.h"
+#include "logging.h"
+
+#include <algorithm>
+
+std::unique_ptr<RTCCompilePool> RTCCompilePool::single;
+std::unique_ptr<RTCCompilePool> RTCCompilePool::prefetch;
+
+RTCCompilePool::RTCCompilePool(size_t num_threads)
+{
+    num_threads = std::max<size_t>(num_threads, 1);
+    threads.reserve(num_threads);
+    for(size_t i = 0; i < num_threads; ++i)
+        threads.emplace_back([this]() { worker(); });
+}
+
+RTCCompilePool::~RTCCompilePool()
+{
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        stop = true;
+    }
+    queue_cv.notify_all();
+    for(auto& t : threads)
+        t.join();
+}
+
+size_t RTCCompilePool::queue_depth()
+{
+    std::lock_guard<std::mutex> lock(queue_mutex);
+    return items.size();
+}
+
+void RTCCompilePool::push(RTCCompilePriority priority, std::function<void(bool)>&& func)
+{
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        items.push({priority, next_seq++, std::chrono::steady_clock::now(), std::move(func)});
+    }
+    queue_cv.notify_one();
+}
+
+void RTCCompilePool::worker()
+{
+    while(true)
+    {
+        work_item item;
+        size_t    depth  = 0;
+        bool      cancel = false;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock, [this]() { return stop || !items.empty(); });
+            // at shutdown, finish critical work still queued, since
+            // plans are waiting for it.  speculative work isn't
+            // needed yet, so cancel it rather than make shutdown wait
+            // for it.  either way, nobody waiting on the work gets a
+            // broken promise.
+            if(items.empty())
+                return;
+            item = items.top();
+            items.pop();
+            depth  = items.size();
+            cancel = stop && item.priority == RTCCompilePriority::SPECULATIVE;
+        }
+
+        if(cancel)
+        {
+            item.func(true);
+            continue;
+        }
+
+        if(LOG_RTC_ENABLED())
+        {
+            std::chrono::duration<float, std::milli> wait_ms
+                = std::chrono::steady_clock::now() - item.enqueue_time;
+            (*LogSingleton::GetInstance().GetRTCOS())
+                << "// compile queue wait: " << static_cast<int>(wait_ms.count())
+                << " ms, priority: "
+                << (item.priority == RTCCompilePriority::CRITICAL ? "critical" : "speculative")
+                << ", queue depth: " << depth << std::endl;
+        }
+
+        item.func(false);
+    }
+}
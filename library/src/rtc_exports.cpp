@@ -49,3 +49,80 @@ rocfft_status rocfft_cache_deserialize(const void* buffer, size_t buffer_len_byt
 
     return RTCCache::single->deserialize(buffer, buffer_len_bytes);
 }
+
+rocfft_status rocfft_cache_filter_create(rocfft_cache_filter* filter)
+{
+    if(!filter)
+        return rocfft_status_invalid_arg_value;
+    *filter = new rocfft_cache_filter_t;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_cache_filter_destroy(rocfft_cache_filter filter)
+{
+    delete filter;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_cache_filter_add_arch(rocfft_cache_filter filter, const char* arch)
+{
+    if(!filter || !arch)
+        return rocfft_status_invalid_arg_value;
+    filter->archs.emplace_back(arch);
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_cache_filter_add_kernel_prefix(rocfft_cache_filter filter, const char* prefix)
+{
+    if(!filter || !prefix)
+        return rocfft_status_invalid_arg_value;
+    filter->kernel_prefixes.emplace_back(prefix);
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_cache_filter_set_watermark(rocfft_cache_filter filter, size_t watermark)
+{
+    if(!filter)
+        return rocfft_status_invalid_arg_value;
+    filter->watermark = watermark;
+    return rocfft_status_success;
+}
+
+rocfft_status rocfft_cache_serialize_filtered(rocfft_cache_filter filter,
+                                              void**              buffer,
+                                              size_t*             buffer_len_bytes,
+                                              size_t*             watermark)
+{
+    if(!filter || !buffer || !buffer_len_bytes)
+        return rocfft_status_invalid_arg_value;
+
+    if(!RTCCache::single)
+        return rocfft_status_failure;
+
+    return RTCCache::single->serialize(*filter, buffer, buffer_len_bytes, watermark);
+}
+
+rocfft_status rocfft_cache_get_composition(rocfft_cache_composition* composition)
+{
+    if(!composition)
+        return rocfft_status_invalid_arg_value;
+
+    if(!RTCCache::single)
+        return rocfft_status_failure;
+
+    try
+    {
+        auto cache_composition       = RTCCache::single->get_cache_composition();
+        composition->kernels        = cache_composition.kernels;
+        composition->unused_kernels = cache_composition.unused_kernels;
+        composition->hits           = cache_composition.hits;
+        composition->code_objects   = cache_composition.code_objects;
+        composition->code_bytes     = cache_composition.code_bytes;
+        composition->total_bytes    = cache_composition.bytes;
+    }
+    catch(std::exception&)
+    {
+        return rocfft_status_failure;
+    }
+    return rocfft_status_success;
+}
@@ -24,11 +24,12 @@
 #include "../../shared/environment.h"
 #include "device/generator/stockham_gen.h"
 
-#include "device/kernel-generator-embed.h"
 #include "kernel_launch.h"
 #include "logging.h"
+#include "plan_profile.h"
 #include "rtc_bluestein_kernel.h"
 #include "rtc_cache.h"
+#include "rtc_compile_pool.h"
 #include "rtc_realcomplex_kernel.h"
 #include "rtc_stockham_kernel.h"
 #include "rtc_transpose_kernel.h"
@@ -126,7 +127,8 @@ std::shared_future<std::unique_ptr<RTCKernel>>
     RTCKernel::runtime_compile(const TreeNode&    node,
                                const std::string& gpu_arch,
                                std::string&       kernel_name,
-                               bool               enable_callbacks)
+                               bool               enable_callbacks,
+                               bool               compile_only)
 {
 #ifndef ROCFFT_DEBUG_GENERATE_KERNEL_HARNESS
     int deviceId = 0;
@@ -155,15 +157,22 @@ std::shared_future<std::unique_ptr<RTCKernel>>
     {
         kernel_name = generator.generate_name();
 
+        // compile threads add to the profile of the plan that wants
+        // this kernel
+        auto profile = PlanProfile::Current();
+
         auto compile = [=]() {
             if(hipSetDevice(deviceId) != hipSuccess)
             {
                 throw std::runtime_error("failed to set device");
             }
+            PlanProfileScope profileScope(profile);
             try
             {
                 std::vector<char> code = RTCCache::cached_compile(
-                    kernel_name, gpu_arch, generator.generate_src, generator_sum());
+                    kernel_name, gpu_arch, generator.generate_src);
+                if(compile_only)
+                    return std::unique_ptr<RTCKernel>();
                 return generator.construct_rtckernel(
                     kernel_name, code, generator.gridDim, generator.blockDim);
             }
@@ -175,7 +184,15 @@ std::shared_future<std::unique_ptr<RTCKernel>>
             }
         };
 
-        // compile to code object
+        // compile to code object on the shared compile pool if it's
+        // available.  callback variants are only needed if the user
+        // sets callbacks, and compile-only kernels aren't needed by
+        // any plan yet, so they can wait for other kernels.
+        if(RTCCompilePool::single)
+            return RTCCompilePool::single->submit(enable_callbacks || compile_only
+                                                      ? RTCCompilePriority::SPECULATIVE
+                                                      : RTCCompilePriority::CRITICAL,
+                                                  compile);
         return std::async(std::launch::async, compile);
     }
     // a pre-compiled rtc-stockham-kernel goes here
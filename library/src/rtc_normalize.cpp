@@ -0,0 +1,482 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "rtc_normalize.h"
+#include "../../shared/environment.h"
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <vector>
+
+static bool is_ident_char(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+// If a string or character literal starts at src[pos], return the
+// index just past its end.  Otherwise, return pos.  Literals may
+// start with an encoding prefix (u8, u, U or L), and strings may be
+// raw.
+static size_t literal_end(const std::string& src, size_t pos)
+{
+    // a prefix is only part of a literal at the start of a token
+    size_t quote = pos;
+    if(pos == 0 || !is_ident_char(src[pos - 1]))
+    {
+        while(quote < src.size() && is_ident_char(src[quote]))
+            ++quote;
+    }
+    if(quote == src.size() || (src[quote] != '"' && src[quote] != '\''))
+        return pos;
+    const char c = src[quote];
+
+    auto prefix = src.substr(pos, quote - pos);
+    bool raw    = !prefix.empty() && prefix.back() == 'R';
+    if(raw)
+        prefix.pop_back();
+    if(!prefix.empty() && prefix != "u8" && prefix != "u" && prefix != "U" && prefix != "L")
+        return pos;
+    // character literals can't be raw, and a quote following a
+    // digit is a digit separator
+    if(c == '\'' && (raw || (quote == pos && pos > 0 && is_ident_char(src[pos - 1]))))
+        return pos;
+
+    if(raw)
+    {
+        auto open = src.find('(', quote + 1);
+        if(open == std::string::npos)
+            return pos;
+        auto delim = ")" + src.substr(quote + 1, open - quote - 1) + "\"";
+        auto close = src.find(delim, open);
+        return close == std::string::npos ? src.size() : close + delim.size();
+    }
+    for(pos = quote + 1; pos < src.size() && src[pos] != c && src[pos] != '\n'; ++pos)
+    {
+        if(src[pos] == '\\')
+            ++pos;
+    }
+    return std::min(pos + 1, src.size());
+}
+
+// Splice lines ending in a backslash and remove comments.  Block
+// comments become a single space so they still separate tokens.
+static std::string strip_comments(const std::string& src)
+{
+    std::string spliced;
+    spliced.reserve(src.size());
+    for(size_t i = 0; i < src.size(); ++i)
+    {
+        if(src[i] == '\\' && i + 1 < src.size() && src[i + 1] == '\n')
+            ++i;
+        else
+            spliced += src[i];
+    }
+
+    std::string out;
+    out.reserve(spliced.size());
+    for(size_t i = 0; i < spliced.size();)
+    {
+        auto end = literal_end(spliced, i);
+        if(end != i)
+        {
+            out.append(spliced, i, end - i);
+            i = end;
+        }
+        else if(spliced.compare(i, 2, "//") == 0)
+            i = std::min(spliced.find('\n', i), spliced.size());
+        else if(spliced.compare(i, 2, "/*") == 0)
+        {
+            end = spliced.find("*/", i + 2);
+            i   = end == std::string::npos ? spliced.size() : end + 2;
+            out += ' ';
+        }
+        else
+            out += spliced[i++];
+    }
+    return out;
+}
+
+// Return true if whitespace between characters a and b is needed to
+// keep the tokens on either side of it apart.
+static bool need_space(char a, char b)
+{
+    if(is_ident_char(a) && is_ident_char(b))
+        return true;
+    static const std::string separators = ",;(){}";
+    if(separators.find(a) != std::string::npos || separators.find(b) != std::string::npos)
+        return false;
+    // punctuation next to punctuation might form a different token
+    // once joined
+    if(!is_ident_char(a) && !is_ident_char(b))
+        return true;
+    // literal prefixes and suffixes are part of the literal
+    if(a == '"' || a == '\'' || b == '"' || b == '\'')
+        return true;
+    // a number like 0x1e followed by + or - would become one token
+    if((b == '+' || b == '-') && std::string("eEpP").find(a) != std::string::npos)
+        return true;
+    return false;
+}
+
+// Collapse whitespace in one line of source.  Directives keep one
+// space wherever there was any, since whether a macro name is
+// followed by a space changes its meaning.
+static std::string collapse_line(const std::string& line, bool directive)
+{
+    std::string out;
+    bool        pending_space = false;
+    for(size_t i = 0; i < line.size();)
+    {
+        if(std::isspace(static_cast<unsigned char>(line[i])))
+        {
+            pending_space = true;
+            ++i;
+            continue;
+        }
+        if(pending_space && !out.empty() && (directive || need_space(out.back(), line[i])))
+            out += ' ';
+        pending_space = false;
+
+        auto end = literal_end(line, i);
+        if(end == i)
+            ++end;
+        out.append(line, i, end - i);
+        i = end;
+    }
+    return out;
+}
+
+// A top-level declaration or definition, or a preprocessor
+// directive outside of any braces.
+struct SourceUnit
+{
+    std::string text;
+    // units containing directives are never removed as functions,
+    // and only directives that are a unit of their own are
+    // considered as macro definitions
+    bool pinned = false;
+    // name of the function or macro this unit defines, if it's
+    // removable
+    std::string definition_name;
+    // identifiers used in this unit, with their counts
+    std::map<std::string, size_t> identifiers;
+    bool                          removed = false;
+};
+
+static std::vector<std::string> split_lines(const std::string& src)
+{
+    std::vector<std::string> lines;
+    size_t                   begin = 0;
+    while(begin <= src.size())
+    {
+        auto end = std::min(src.find('\n', begin), src.size());
+        lines.push_back(src.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    return lines;
+}
+
+static std::vector<SourceUnit> split_units(const std::vector<std::string>& lines)
+{
+    std::vector<SourceUnit> units(1);
+    size_t                  depth = 0;
+
+    auto end_unit = [&]() {
+        if(!units.back().text.empty())
+            units.emplace_back();
+    };
+
+    for(const auto& line : lines)
+    {
+        if(line.empty())
+            continue;
+        if(line.front() == '#')
+        {
+            if(depth == 0 && units.back().text.empty())
+            {
+                units.back().text   = line;
+                units.back().pinned = true;
+                end_unit();
+            }
+            else
+            {
+                units.back().text += '\n' + line + '\n';
+                units.back().pinned = true;
+            }
+            continue;
+        }
+
+        for(size_t i = 0; i < line.size();)
+        {
+            auto& unit = units.back();
+            auto  end  = literal_end(line, i);
+            if(end != i)
+            {
+                unit.text.append(line, i, end - i);
+                i = end;
+                continue;
+            }
+
+            const char c = line[i++];
+            if(unit.text.empty() && c == ' ')
+                continue;
+            unit.text += c;
+            if(c == '{')
+                ++depth;
+            else if(c == '}' && depth > 0)
+            {
+                if(--depth == 0)
+                    end_unit();
+            }
+            else if(c == ';' && depth == 0)
+                end_unit();
+        }
+        if(!units.back().text.empty())
+            units.back().text += '\n';
+    }
+    if(units.back().text.empty())
+        units.pop_back();
+    return units;
+}
+
+// Split text into identifiers and single punctuation characters,
+// ignoring literals.
+static std::vector<std::string> tokenize(const std::string& text)
+{
+    std::vector<std::string> tokens;
+    for(size_t i = 0; i < text.size();)
+    {
+        auto end = literal_end(text, i);
+        if(end != i)
+        {
+            tokens.emplace_back("\"\"");
+            i = end;
+        }
+        else if(is_ident_char(text[i]))
+        {
+            for(end = i; end < text.size() && is_ident_char(text[end]); ++end)
+                ;
+            tokens.push_back(text.substr(i, end - i));
+            i = end;
+        }
+        else if(std::isspace(static_cast<unsigned char>(text[i])))
+            ++i;
+        else
+            tokens.emplace_back(1, text[i++]);
+    }
+    return tokens;
+}
+
+static bool is_identifier(const std::string& token)
+{
+    return !token.empty() && is_ident_char(token.front())
+           && !std::isdigit(static_cast<unsigned char>(token.front()));
+}
+
+// Return the name of the function that the unit defines, or an
+// empty string if the unit isn't a plain function definition.
+static std::string function_definition_name(const std::string& text)
+{
+    auto last = text.find_last_not_of(" \n");
+    if(last == std::string::npos || text[last] != '}')
+        return {};
+
+    auto tokens = tokenize(text);
+    auto body   = std::find(tokens.begin(), tokens.end(), "{");
+
+    // skip over balanced brackets starting at tok, returning the
+    // position just past the closing bracket
+    auto skip_balanced = [&](std::vector<std::string>::iterator tok,
+                             const char*                        open,
+                             const char*                        close) {
+        size_t nesting = 0;
+        for(; tok != body; ++tok)
+        {
+            if(*tok == open)
+                ++nesting;
+            else if(*tok == close && --nesting == 0)
+                return tok + 1;
+        }
+        return body;
+    };
+
+    std::string name;
+    for(auto tok = tokens.begin(); tok != body;)
+    {
+        if(*tok == "template" && tok + 1 != body && *(tok + 1) == "<")
+        {
+            tok = skip_balanced(tok + 1, "<", ">");
+            continue;
+        }
+        if(*tok == "=" || *tok == "operator" || *tok == "struct" || *tok == "class"
+           || *tok == "union" || *tok == "enum" || *tok == "namespace" || *tok == "typedef"
+           || *tok == "using" || *tok == "extern" || *tok == "__global__")
+            return {};
+        if(*tok == "__attribute__" || *tok == "__launch_bounds__" || *tok == "alignas"
+           || *tok == "__declspec" || *tok == "decltype")
+        {
+            tok = skip_balanced(tok + 1, "(", ")");
+            continue;
+        }
+        if(*tok == "(")
+        {
+            if(tok == tokens.begin() || !is_identifier(*(tok - 1)))
+                return {};
+            name = *(tok - 1);
+            break;
+        }
+        ++tok;
+    }
+    return name;
+}
+
+// Return the name of the macro that the directive defines, or an
+// empty string if the directive isn't a macro definition.
+static std::string macro_definition_name(const std::string& text)
+{
+    auto tokens = tokenize(text);
+    if(tokens.size() < 3 || tokens[0] != "#" || tokens[1] != "define")
+        return {};
+    return tokens[2];
+}
+
+std::string rtc_normalize_source(const std::string& src, RTCNormalizeStats* stats)
+{
+    auto lines = split_lines(strip_comments(src));
+    for(auto& line : lines)
+    {
+        auto first = line.find_first_not_of(" \t\r\f\v");
+        if(first == std::string::npos)
+            line.clear();
+        else
+            line = collapse_line(line.substr(first), line[first] == '#');
+    }
+
+    auto units = split_units(lines);
+
+    // a macro might be read by a header included after it, so only
+    // macros defined after the last include can be removed
+    size_t first_macro_candidate = 0;
+    for(size_t i = 0; i < units.size(); ++i)
+    {
+        auto tokens = tokenize(units[i].text);
+        for(size_t j = 0; j + 1 < tokens.size(); ++j)
+        {
+            if(tokens[j] == "#" && tokens[j + 1] == "include")
+                first_macro_candidate = i + 1;
+        }
+    }
+
+    for(size_t i = 0; i < units.size(); ++i)
+    {
+        auto& unit = units[i];
+        for(const auto& token : tokenize(unit.text))
+        {
+            if(is_identifier(token))
+                ++unit.identifiers[token];
+        }
+        if(unit.text.front() == '#')
+        {
+            if(i >= first_macro_candidate && unit.text.find('\n') == std::string::npos)
+                unit.definition_name = macro_definition_name(unit.text);
+        }
+        else if(!unit.pinned)
+            unit.definition_name = function_definition_name(unit.text);
+    }
+
+    // removing a definition may leave others unreferenced, so keep
+    // going until nothing else can be removed
+    size_t removed_definitions = 0;
+    for(bool changed = true; changed;)
+    {
+        changed = false;
+
+        std::map<std::string, size_t> references;
+        for(const auto& unit : units)
+        {
+            if(unit.removed)
+                continue;
+            for(const auto& ident : unit.identifiers)
+                references[ident.first] += ident.second;
+        }
+
+        // subtract references that the definitions make to their
+        // own name, including overloads and redefinitions that share
+        // it
+        std::map<std::string, std::vector<SourceUnit*>> definitions;
+        for(auto& unit : units)
+        {
+            if(unit.removed || unit.definition_name.empty())
+                continue;
+            definitions[unit.definition_name].push_back(&unit);
+            references[unit.definition_name] -= unit.identifiers[unit.definition_name];
+        }
+
+        for(auto& def : definitions)
+        {
+            if(references[def.first] != 0)
+                continue;
+            for(auto unit : def.second)
+                unit->removed = true;
+            removed_definitions += def.second.size();
+            changed = true;
+        }
+    }
+
+    std::string out;
+    out.reserve(src.size());
+    for(const auto& unit : units)
+    {
+        if(unit.removed)
+            continue;
+        auto last = unit.text.find_last_not_of('\n');
+        if(last == std::string::npos)
+            continue;
+        for(const auto& line : split_lines(unit.text.substr(0, last + 1)))
+        {
+            if(!line.empty())
+            {
+                out += line;
+                out += '\n';
+            }
+        }
+    }
+
+    if(stats)
+    {
+        stats->original_bytes      = src.size();
+        stats->normalized_bytes    = out.size();
+        stats->removed_definitions = removed_definitions;
+    }
+    return out;
+}
+
+bool rtc_normalize_enabled()
+{
+    return rocfft_getenv("ROCFFT_RTC_NORMALIZE_DISABLE").empty();
+}
+
+std::string rtc_normalize_state()
+{
+    if(!rtc_normalize_enabled())
+        return "normalize disabled";
+    return "normalize v" + std::to_string(RTC_NORMALIZE_VERSION);
+}
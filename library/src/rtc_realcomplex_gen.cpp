@@ -291,8 +291,11 @@ std::string r2c_copy_rtc(const std::string& kernel_name, const RealComplexSpecs&
         func = make_planar(func, "input");
     if(array_type_is_planar(specs.outArrayType))
         func = make_planar(func, "output");
+    func = make_simplify(func,
+                         {{"cbtype", rtc_cbtype_value(specs.cbtype)},
+                          {"dim", std::to_string(specs.dim) + "u"}});
 
-    src += func.render();
+    func.render(src);
     write_standalone_test_harness(func, src);
     return src;
 }
@@ -566,8 +569,12 @@ std::string realcomplex_even_rtc(const std::string& kernel_name, const RealCompl
         func = make_planar(func, "input");
     if(array_type_is_planar(specs.outArrayType))
         func = make_planar(func, "output");
+    func = make_simplify(func,
+                         {{"cbtype", rtc_cbtype_value(specs.cbtype)},
+                          {"dim", std::to_string(specs.dim) + "u"},
+                          {"Ndiv4", specs.Ndiv4 ? "true" : "false"}});
 
-    src += func.render();
+    func.render(src);
     write_standalone_test_harness(func, src);
     return src;
 }
@@ -990,8 +997,9 @@ std::string realcomplex_even_transpose_rtc(const std::string&
         func = make_planar(func, "input");
     if(array_type_is_planar(specs.outArrayType))
         func = make_planar(func, "output");
+    func = make_simplify(func, {{"cbtype", rtc_cbtype_value(specs.cbtype)}});
 
-    src += func.render();
+    func.render(src);
     write_standalone_test_harness(func, src);
     return src;
 }
@@ -21,6 +21,7 @@
 #include <functional>
 
 #include "../../shared/array_predicate.h"
+#include "../../shared/precision_type.h"
 #include "rtc_stockham_gen.h"
 #include "rtc_test_harness.h"
 
@@ -40,6 +41,11 @@ using namespace std::placeholders;
 
 #include "device/kernel-generator-embed.h"
 
+bool stockham_has_split_radix(const std::vector<size_t>& factors)
+{
+    return std::any_of(factors.begin(), factors.end(), Butterfly::split_radix_supported);
+}
+
 // generate name for RTC stockham kernel
 std::string stockham_rtc_kernel_name(const StockhamGeneratorSpecs& specs,
                                      const StockhamGeneratorSpecs& specs2d,
@@ -100,6 +106,12 @@ std::string stockham_rtc_kernel_name(const StockhamGeneratorSpecs& specs,
     if(specs.half_lds)
         kernel_name += "_halfLds";
 
+    auto uses_split_radix = [](const StockhamGeneratorSpecs& s) {
+        return s.split_radix && stockham_has_split_radix({s.factors.begin(), s.factors.end()});
+    };
+    if(uses_split_radix(specs) || (scheme == CS_KERNEL_2D_SINGLE && uses_split_radix(specs2d)))
+        kernel_name += "_splitRadix";
+
     if(specs.static_dim)
     {
         kernel_name += "_dim";
@@ -236,6 +248,31 @@ std::string stockham_rtc_kernel_name(const StockhamGeneratorSpecs& specs,
     return kernel_name;
 }
 
+// construct the generator for a stockham kernel that does 1D
+// transforms
+static std::unique_ptr<StockhamKernel> make_stockham_kernel(const StockhamGeneratorSpecs& specs,
+                                                           ComputeScheme                 scheme,
+                                                           bool largeTwdBatchIsTransformCount,
+                                                           bool fuseBluestein)
+{
+    if(scheme == CS_KERNEL_STOCKHAM)
+        return std::make_unique<StockhamKernelRR>(specs);
+    else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
+        return std::make_unique<StockhamKernelCC>(
+            specs, largeTwdBatchIsTransformCount, fuseBluestein);
+    else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CR)
+        return std::make_unique<StockhamKernelCR>(specs);
+    else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
+        return std::make_unique<StockhamKernelRC>(specs, fuseBluestein);
+    else if(scheme == CS_KERNEL_STOCKHAM_TRANSPOSE_XY_Z)
+        return std::make_unique<StockhamKernelRC>(specs, false);
+    else if(scheme == CS_KERNEL_STOCKHAM_TRANSPOSE_Z_XY)
+        return std::make_unique<StockhamKernelRC>(specs, false);
+    else if(scheme == CS_KERNEL_STOCKHAM_R_TO_CMPLX_TRANSPOSE_Z_XY)
+        return std::make_unique<StockhamKernelRC>(specs, false);
+    throw std::runtime_error("unhandled scheme");
+}
+
 std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
                          const StockhamGeneratorSpecs& specs2d,
                          unsigned int*                 transforms_per_block,
@@ -295,24 +332,8 @@ std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
     }
     else
     {
-        std::unique_ptr<StockhamKernel> kernel;
-        if(scheme == CS_KERNEL_STOCKHAM)
-            kernel = std::make_unique<StockhamKernelRR>(specs);
-        else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CC)
-            kernel = std::make_unique<StockhamKernelCC>(
-                specs, largeTwdBatchIsTransformCount, fuseBluestein);
-        else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_CR)
-            kernel = std::make_unique<StockhamKernelCR>(specs);
-        else if(scheme == CS_KERNEL_STOCKHAM_BLOCK_RC)
-            kernel = std::make_unique<StockhamKernelRC>(specs, fuseBluestein);
-        else if(scheme == CS_KERNEL_STOCKHAM_TRANSPOSE_XY_Z)
-            kernel = std::make_unique<StockhamKernelRC>(specs, false);
-        else if(scheme == CS_KERNEL_STOCKHAM_TRANSPOSE_Z_XY)
-            kernel = std::make_unique<StockhamKernelRC>(specs, false);
-        else if(scheme == CS_KERNEL_STOCKHAM_R_TO_CMPLX_TRANSPOSE_Z_XY)
-            kernel = std::make_unique<StockhamKernelRC>(specs, false);
-        else
-            throw std::runtime_error("unhandled scheme");
+        auto kernel
+            = make_stockham_kernel(specs, scheme, largeTwdBatchIsTransformCount, fuseBluestein);
         if(transforms_per_block)
             *transforms_per_block = kernel->transforms_per_block;
         lds2reg = std::make_unique<Function>(kernel->generate_lds_to_reg_input_function());
@@ -371,6 +392,23 @@ std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
     if(fuseBluestein)
         *global = make_bluestein(scheme, fuseBlue, *global);
 
+    // fold constants, and hoist index arithmetic that the generated
+    // functions repeat
+    for(auto f : {&lds2reg,
+                  &reg2lds,
+                  &device,
+                  &lds2reg1,
+                  &reg2lds1,
+                  &device1,
+                  &bluestein_load,
+                  &bluestein_intrinsic_load,
+                  &bluestein_store,
+                  &bluestein_intrinsic_store})
+    {
+        if(*f)
+            **f = make_cse(make_simplify(**f));
+    }
+
     // start off with includes
     std::string src;
     src += rocfft_complex_h;
@@ -388,42 +426,47 @@ std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
     if(scheme != CS_KERNEL_STOCKHAM_BLOCK_CC)
         src += real2complex_device_h;
 
-    src += lds2reg->render();
-    src += reg2lds->render();
-    src += device->render();
+    lds2reg->render(src);
+    reg2lds->render(src);
+    device->render(src);
     if(lds2reg1)
-        src += lds2reg1->render();
+        lds2reg1->render(src);
     if(reg2lds1)
-        src += reg2lds1->render();
+        reg2lds1->render(src);
     if(device1)
-        src += device1->render();
+        device1->render(src);
     if(bluestein_load)
-        src += bluestein_load->render();
+        bluestein_load->render(src);
     if(bluestein_intrinsic_load)
-        src += bluestein_intrinsic_load->render();
+        bluestein_intrinsic_load->render(src);
     if(bluestein_store)
-        src += bluestein_store->render();
+        bluestein_store->render(src);
     if(bluestein_intrinsic_store)
-        src += bluestein_intrinsic_store->render();
+        bluestein_intrinsic_store->render(src);
 
     // make_rtc removes templates from global function - add typedefs
-    // and constants to replace them
+    // and constants to replace them.  remember the constants'
+    // values so the global function can be simplified with them.
+    std::map<std::string, std::string> globals;
+    auto add_global
+        = [&](const std::string& type, const std::string& name, const std::string& value) {
+              src += "static const " + type + " " + name + " = " + value + ";\n";
+              globals[name] = value;
+          };
+
     src += rtc_precision_type_decl(precision);
-    if(unit_stride)
-        src += "static const StrideBin sb = SB_UNIT;\n";
-    else
-        src += "static const StrideBin sb = SB_NONUNIT;\n";
+    add_global("StrideBin", "sb", unit_stride ? "SB_UNIT" : "SB_NONUNIT");
 
     switch(ebtype)
     {
     case EmbeddedType::NONE:
-        src += "static const EmbeddedType ebtype = EmbeddedType::NONE;\n";
+        add_global("EmbeddedType", "ebtype", "EmbeddedType::NONE");
         break;
     case EmbeddedType::Real2C_POST:
-        src += "static const EmbeddedType ebtype = EmbeddedType::Real2C_POST;\n";
+        add_global("EmbeddedType", "ebtype", "EmbeddedType::Real2C_POST");
         break;
     case EmbeddedType::C2Real_PRE:
-        src += "static const EmbeddedType ebtype = EmbeddedType::C2Real_PRE;\n";
+        add_global("EmbeddedType", "ebtype", "EmbeddedType::C2Real_PRE");
         break;
     }
 
@@ -431,47 +474,48 @@ std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
     switch(scheme)
     {
     case CS_KERNEL_STOCKHAM_TRANSPOSE_XY_Z:
-        src += "static const SBRC_TYPE sbrc_type = SBRC_3D_FFT_TRANS_XY_Z;\n";
+        add_global("SBRC_TYPE", "sbrc_type", "SBRC_3D_FFT_TRANS_XY_Z");
         break;
     case CS_KERNEL_STOCKHAM_TRANSPOSE_Z_XY:
-        src += "static const SBRC_TYPE sbrc_type = SBRC_3D_FFT_TRANS_Z_XY;\n";
+        add_global("SBRC_TYPE", "sbrc_type", "SBRC_3D_FFT_TRANS_Z_XY");
         break;
     case CS_KERNEL_STOCKHAM_R_TO_CMPLX_TRANSPOSE_Z_XY:
-        src += "static const SBRC_TYPE sbrc_type = SBRC_3D_FFT_ERC_TRANS_Z_XY;\n";
+        add_global("SBRC_TYPE", "sbrc_type", "SBRC_3D_FFT_ERC_TRANS_Z_XY");
         break;
     default:
-        src += "static const SBRC_TYPE sbrc_type = SBRC_2D;\n";
+        add_global("SBRC_TYPE", "sbrc_type", "SBRC_2D");
     }
     switch(transpose_type)
     {
     case NONE:
-        src += "static const SBRC_TRANSPOSE_TYPE transpose_type = NONE;\n";
+        add_global("SBRC_TRANSPOSE_TYPE", "transpose_type", "NONE");
         break;
     case DIAGONAL:
-        src += "static const SBRC_TRANSPOSE_TYPE transpose_type = DIAGONAL;\n";
+        add_global("SBRC_TRANSPOSE_TYPE", "transpose_type", "DIAGONAL");
         break;
     case TILE_ALIGNED:
-        src += "static const SBRC_TRANSPOSE_TYPE transpose_type = TILE_ALIGNED;\n";
+        add_global("SBRC_TRANSPOSE_TYPE", "transpose_type", "TILE_ALIGNED");
         break;
     case TILE_UNALIGNED:
-        src += "static const SBRC_TRANSPOSE_TYPE transpose_type = TILE_UNALIGNED;\n";
+        add_global("SBRC_TRANSPOSE_TYPE", "transpose_type", "TILE_UNALIGNED");
         break;
     }
 
-    src += rtc_const_cbtype_decl(cbtype);
+    add_global("CallbackType", "cbtype", rtc_cbtype_value(cbtype));
 
     switch(dir2regMode)
     {
     case DirectRegType::FORCE_OFF_OR_NOT_SUPPORT:
-        src += "static const DirectRegType drtype = DirectRegType::FORCE_OFF_OR_NOT_SUPPORT;\n";
+        add_global("DirectRegType", "drtype", "DirectRegType::FORCE_OFF_OR_NOT_SUPPORT");
         break;
     case DirectRegType::TRY_ENABLE_IF_SUPPORT:
-        src += "static const DirectRegType drtype = DirectRegType::TRY_ENABLE_IF_SUPPORT;\n";
+        add_global("DirectRegType", "drtype", "DirectRegType::TRY_ENABLE_IF_SUPPORT");
         break;
     }
 
-    src += "static const bool apply_large_twiddle = ";
-    src += (largeTwdBase > 0 && largeTwdSteps > 0) ? "true;\n" : "false;\n";
+    add_global("bool",
+               "apply_large_twiddle",
+               (largeTwdBase > 0 && largeTwdSteps > 0) ? "true" : "false");
 
     // callback kernels need to disable buffer load/store
     if(cbtype != CallbackType::NONE || dir2regMode == DirectRegType::FORCE_OFF_OR_NOT_SUPPORT)
@@ -480,26 +524,279 @@ std::string stockham_rtc(const StockhamGeneratorSpecs& specs,
     switch(intrinsicMode)
     {
     case IntrinsicAccessType::DISABLE_BOTH:
-        src += "static const IntrinsicAccessType intrinsic_mode = "
-               "IntrinsicAccessType::DISABLE_BOTH;\n";
+        add_global(
+            "IntrinsicAccessType", "intrinsic_mode", "IntrinsicAccessType::DISABLE_BOTH");
         break;
     case IntrinsicAccessType::ENABLE_BOTH:
-        src += "static const IntrinsicAccessType intrinsic_mode = "
-               "IntrinsicAccessType::ENABLE_BOTH;\n";
+        add_global("IntrinsicAccessType", "intrinsic_mode", "IntrinsicAccessType::ENABLE_BOTH");
         break;
     case IntrinsicAccessType::ENABLE_LOAD_ONLY:
-        src += "static const IntrinsicAccessType intrinsic_mode = "
-               "IntrinsicAccessType::ENABLE_LOAD_ONLY;\n";
+        add_global(
+            "IntrinsicAccessType", "intrinsic_mode", "IntrinsicAccessType::ENABLE_LOAD_ONLY");
         break;
     }
 
-    src += "static const size_t large_twiddle_base = " + std::to_string(largeTwdBase) + ";\n";
-    src += "static const size_t large_twiddle_steps = " + std::to_string(largeTwdSteps) + ";\n";
+    // size_t values need a suffix, so the simplifier folds them as
+    // unsigned
+    add_global("size_t", "large_twiddle_base", std::to_string(largeTwdBase) + "ull");
+    add_global("size_t", "large_twiddle_steps", std::to_string(largeTwdSteps) + "ull");
 
     *global = make_callback_realcomplex(*global, cbtype);
 
     *global = make_rtc(*global, kernel_name);
-    src += global->render();
+    *global = make_cse(make_simplify(*global, globals));
+    global->render(src);
     write_standalone_test_harness(*global, src);
     return src;
 }
+
+// a stockham kernel's functions, simplified for static analysis
+struct StockhamAnalysis
+{
+    std::vector<Function>        device_functions;
+    std::vector<const Function*> callees;
+    std::unique_ptr<Function>    global;
+    // values of the global function's template parameters
+    std::map<std::string, std::string> globals;
+
+    // lengths of the kernel's dimensions
+    std::vector<size_t> lengths;
+    unsigned int        workgroup_size       = 0;
+    unsigned int        transforms_per_block = 0;
+    size_t              lds_elements         = 0;
+    bool                half_lds             = false;
+};
+
+static StockhamAnalysis make_stockham_analysis(const StockhamGeneratorSpecs& specs,
+                                               const StockhamGeneratorSpecs& specs2d,
+                                               ComputeScheme                 scheme)
+{
+    StockhamAnalysis analysis;
+    auto&            device_functions = analysis.device_functions;
+
+    if(scheme == CS_KERNEL_2D_SINGLE)
+    {
+        StockhamKernelFused2D kernel(specs, specs2d);
+        device_functions.push_back(kernel.kernel0.generate_lds_to_reg_input_function());
+        device_functions.push_back(kernel.kernel0.generate_lds_from_reg_output_function());
+        device_functions.push_back(kernel.kernel0.generate_device_function());
+        if(kernel.kernel0.length != kernel.kernel1.length)
+        {
+            device_functions.push_back(kernel.kernel1.generate_lds_to_reg_input_function());
+            device_functions.push_back(kernel.kernel1.generate_lds_from_reg_output_function());
+            device_functions.push_back(kernel.kernel1.generate_device_function());
+        }
+        analysis.global = std::make_unique<Function>(kernel.generate_global_function());
+
+        analysis.lengths              = {kernel.kernel0.length, kernel.kernel1.length};
+        analysis.workgroup_size       = kernel.workgroup_size;
+        analysis.transforms_per_block = kernel.transforms_per_block;
+        analysis.lds_elements
+            = kernel.kernel0.length * kernel.kernel1.length * kernel.transforms_per_block;
+        analysis.half_lds = kernel.half_lds;
+    }
+    else
+    {
+        auto kernel = make_stockham_kernel(specs, scheme, false, false);
+        device_functions.push_back(kernel->generate_lds_to_reg_input_function());
+        device_functions.push_back(kernel->generate_lds_from_reg_output_function());
+        device_functions.push_back(kernel->generate_device_function());
+        analysis.global = std::make_unique<Function>(kernel->generate_global_function());
+
+        analysis.lengths              = {kernel->length};
+        analysis.workgroup_size       = kernel->workgroup_size;
+        analysis.transforms_per_block = kernel->transforms_per_block;
+        analysis.lds_elements         = kernel->length * kernel->transforms_per_block;
+        analysis.half_lds             = kernel->half_lds;
+    }
+
+    // analyze the variant that gets tuned: unit stride with no
+    // callbacks or large twiddles, so branches for those don't count
+    auto& globals = analysis.globals;
+    globals       = {
+        {"sb", "SB_UNIT"},
+        {"ebtype", "EmbeddedType::NONE"},
+        {"sbrc_type", "SBRC_2D"},
+        {"transpose_type", "TILE_ALIGNED"},
+        {"cbtype", rtc_cbtype_value(CallbackType::NONE)},
+        {"drtype",
+         specs.direct_to_from_reg ? "DirectRegType::TRY_ENABLE_IF_SUPPORT"
+                                  : "DirectRegType::FORCE_OFF_OR_NOT_SUPPORT"},
+        {"apply_large_twiddle", "false"},
+        {"intrinsic_mode", "IntrinsicAccessType::DISABLE_BOTH"},
+        {"large_twiddle_base", "0ull"},
+        {"large_twiddle_steps", "0ull"},
+    };
+    *analysis.global = make_simplify(*analysis.global, globals);
+
+    for(auto& f : device_functions)
+    {
+        f = make_simplify(f);
+        analysis.callees.push_back(&f);
+    }
+    return analysis;
+}
+
+static LDSConflictReport simulate_stockham_lds(const StockhamAnalysis& analysis,
+                                               ComputeScheme           scheme,
+                                               rocfft_precision        precision)
+{
+    // simulate the first block of a contiguous batch of transforms.
+    // the higher dimension of a column or tiled kernel is as long as
+    // a block's worth of transforms, so the block's tile is full.
+    auto lengths = analysis.lengths;
+    if(scheme != CS_KERNEL_STOCKHAM && scheme != CS_KERNEL_2D_SINGLE)
+        lengths.push_back(analysis.transforms_per_block);
+
+    LDSSimulation sim;
+    sim.block_size = analysis.workgroup_size;
+    sim.real_bytes = complex_type_size(precision) / 2;
+    sim.globals    = analysis.globals;
+
+    std::vector<long long> sim_lengths(lengths.begin(), lengths.end());
+    std::vector<long long> sim_strides{1};
+    for(auto len : lengths)
+        sim_strides.push_back(sim_strides.back() * static_cast<long long>(len));
+    sim.arrays["lengths"]      = sim_lengths;
+    sim.arrays["stride"]       = sim_strides;
+    sim.scalars["dim"]         = static_cast<long long>(lengths.size());
+    sim.scalars["nbatch"]      = analysis.transforms_per_block;
+    sim.scalars["lds_padding"] = 0;
+
+    return simulate_lds_conflicts(*analysis.global, analysis.callees, sim);
+}
+
+KernelProfile stockham_rtc_profile(const StockhamGeneratorSpecs& specs,
+                                   const StockhamGeneratorSpecs& specs2d,
+                                   ComputeScheme                 scheme,
+                                   rocfft_precision              precision)
+{
+    auto analysis = make_stockham_analysis(specs, specs2d, scheme);
+
+    auto profile      = profile_function(*analysis.global, analysis.callees);
+    profile.lds_bytes = analysis.lds_elements * complex_type_size(precision);
+    if(analysis.half_lds)
+        profile.lds_bytes /= 2;
+    profile.lds_conflict_degree
+        = simulate_stockham_lds(analysis, scheme, precision).worst_degree();
+    return profile;
+}
+
+LDSConflictReport stockham_rtc_lds_conflicts(const StockhamGeneratorSpecs& specs,
+                                             const StockhamGeneratorSpecs& specs2d,
+                                             ComputeScheme                 scheme,
+                                             rocfft_precision              precision)
+{
+    return simulate_stockham_lds(make_stockham_analysis(specs, specs2d, scheme), scheme, precision);
+}
+
+// definitions that let the device code in the generated source build
+// as plain host C++
+static const char* host_kernel_preamble = R"_HOST_(
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+#define __device__
+#define __host__
+#define __forceinline__ inline
+struct rocfft_host_dim3
+{
+    unsigned int x = 0;
+    unsigned int y = 0;
+    unsigned int z = 0;
+};
+)_HOST_";
+
+std::string stockham_host(const StockhamGeneratorSpecs& specs,
+                          const std::string&            kernel_name,
+                          ComputeScheme                 scheme,
+                          int                           direction,
+                          rocfft_precision              precision,
+                          rocfft_result_placement       placement,
+                          bool                          unit_stride)
+{
+    // other schemes share LDS between the threads working on a
+    // tile of transforms, which needs barriers
+    if(scheme != CS_KERNEL_STOCKHAM)
+        throw std::runtime_error("host kernels are only generated for CS_KERNEL_STOCKHAM");
+    if(precision == rocfft_precision_half)
+        throw std::runtime_error("host kernels do not support half precision");
+
+    // each thread does a whole transform and each block is one
+    // thread, so threads never need to wait for each other
+    auto host_specs                  = specs;
+    host_specs.threads_per_transform = 1;
+    host_specs.workgroup_size        = 1;
+    host_specs.wgs_is_derived        = true;
+    host_specs.half_lds              = false;
+
+    StockhamKernelRR kernel(host_specs);
+    auto             lds_elements = kernel.length * kernel.transforms_per_block;
+
+    auto lds2reg = kernel.generate_lds_to_reg_input_function();
+    auto reg2lds = kernel.generate_lds_from_reg_output_function();
+    auto device  = kernel.generate_device_function();
+    auto global  = kernel.generate_global_function();
+
+    if(direction == 1)
+    {
+        device = make_inverse(device);
+        global = make_inverse(global);
+    }
+    if(placement == rocfft_placement_notinplace)
+        global = make_outofplace(global);
+
+    std::string src = host_kernel_preamble;
+    src += rocfft_complex_h;
+    src += common_h;
+    src += butterfly_constant_h;
+    append_radix_h(src, kernel.factors);
+
+    for(const auto& f : {lds2reg, reg2lds, device})
+        make_host(make_cse(make_simplify(f)), lds_elements).render(src);
+
+    // the global function's templates are all known, so simplify
+    // them away instead of declaring them.  callbacks are always
+    // off, so callback.h is not needed.
+    std::map<std::string, std::string> globals = {
+        {"sb", unit_stride ? "SB_UNIT" : "SB_NONUNIT"},
+        {"ebtype", "EmbeddedType::NONE"},
+        {"cbtype", rtc_cbtype_value(CallbackType::NONE)},
+        {"drtype",
+         kernel.direct_to_from_reg ? "DirectRegType::TRY_ENABLE_IF_SUPPORT"
+                                   : "DirectRegType::FORCE_OFF_OR_NOT_SUPPORT"},
+    };
+    src += rtc_precision_type_decl(precision);
+
+    auto thread_name = kernel_name + "_thread";
+    global           = make_rtc(global, thread_name);
+    global           = make_host(make_cse(make_simplify(global, globals)), lds_elements);
+    global.render(src);
+
+    // the kernel entry point runs each block in turn
+    Function launcher{kernel_name};
+    launcher.qualifier = "extern \"C\"";
+
+    Variable num_blocks{"num_blocks", "size_t"};
+    Variable block{"block", "unsigned int"};
+
+    std::vector<Expression> args;
+    for(const auto& arg : global.arguments.arguments)
+    {
+        if(arg.name == "blockIdx")
+            args.push_back(Literal{"rocfft_host_dim3{block}"});
+        else if(arg.name == "threadIdx")
+            args.push_back(Literal{"rocfft_host_dim3{}"});
+        else
+        {
+            launcher.arguments.append(arg);
+            args.push_back(Variable{arg.name, arg.type});
+        }
+    }
+    launcher.arguments.append(num_blocks);
+    launcher.body += For{block, 0, block < num_blocks, 1, {Call{thread_name, args}}};
+    launcher.render(src);
+    return src;
+}
@@ -94,6 +94,7 @@ RTCKernel::RTCGenerator RTCKernelStockham::generate_from_node(const TreeNode&
         specs->threads_per_transform = kernel->threads_per_transform[0];
         specs->half_lds              = kernel->half_lds;
         specs->direct_to_from_reg    = kernel->direct_to_from_reg;
+        specs->split_radix           = kernel->split_radix;
         break;
     }
     case CS_KERNEL_2D_SINGLE:
@@ -131,6 +132,7 @@ RTCKernel::RTCGenerator RTCKernelStockham::generate_from_node(const TreeNode&
                       PrintScheme(node.scheme));
         specs->threads_per_transform = kernel->threads_per_transform[0];
         specs->half_lds              = kernel->half_lds;
+        specs->split_radix           = kernel->split_radix;
 
         specs2d.emplace(factors2d,
                         factors1d,
@@ -139,6 +141,7 @@ RTCKernel::RTCGenerator RTCKernelStockham::generate_from_node(const TreeNode&
                         PrintScheme(node.scheme));
         specs2d->threads_per_transform = kernel->threads_per_transform[1];
         specs2d->half_lds              = kernel->half_lds;
+        specs2d->split_radix           = kernel->split_radix;
         break;
     }
     default:
@@ -22,6 +22,13 @@
 #include "../../shared/environment.h"
 #include "../../shared/subprocess.h"
 #include "library_path.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+
+#ifndef WIN32
+#include <sys/socket.h>
+#endif
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -76,16 +83,213 @@ static fs::path find_rtc_helper()
     throw std::runtime_error("unable to find rtc helper");
 }
 
-std::vector<char> compile_subprocess(const std::string& kernel_src, const std::string& gpu_arch)
+static const std::string& rtc_helper_exe()
 {
-    static std::string rtc_helper_exe = find_rtc_helper().string();
+    static std::string exe = find_rtc_helper().string();
+    return exe;
+}
 
+// start a new helper for each compile
+static std::vector<char> compile_oneshot(const std::string& kernel_src,
+                                         const std::string& gpu_arch)
+{
     // HACK: on Windows, rtc_helper_exe seems to have an embedded NUL
     // byte at the end.  Append c_str() to hide this.
-    auto code = execute_subprocess(rtc_helper_exe.c_str(), {gpu_arch}, kernel_src);
+    auto code = execute_subprocess(rtc_helper_exe().c_str(), {gpu_arch}, kernel_src);
     if(code.empty())
     {
         throw std::runtime_error("child process failed to produce code");
     }
     return code;
 }
+
+std::vector<char> compile_subprocess(const std::string& kernel_src, const std::string& gpu_arch)
+{
+    if(RTCHelperPool::single)
+        return RTCHelperPool::single->compile(kernel_src, gpu_arch);
+    return compile_oneshot(kernel_src, gpu_arch);
+}
+
+std::unique_ptr<RTCHelperPool> RTCHelperPool::single;
+
+#ifdef WIN32
+struct RTCHelperPool::helper
+{
+};
+#else
+// A helper started with --server reads requests from stdin and
+// writes responses to stdout, until stdin is closed.  Sizes are
+// uint64_t in native byte order, since both ends are on the same
+// machine.
+//
+// request:  arch size, arch, source size, source
+// response: status byte (0 on success), size, code object (or error
+//           message on failure)
+//
+// The helper's stdin and stdout are both connected to one end of a
+// socket pair.  Unlike a pipe, a socket can be written with
+// MSG_NOSIGNAL, so a helper that crashes gives us an error instead
+// of SIGPIPE.
+struct RTCHelperPool::helper
+{
+    explicit helper(const std::string& exe)
+    {
+        int fds[2] = {-1, -1};
+        if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+            throw std::runtime_error("failed to create rtc helper socket");
+        sock.fd = fds[0];
+        file_handle_wrapper child_sock(fds[1]);
+
+        const char* child_argv[] = {exe.c_str(), "--server", nullptr};
+
+        posix_spawn_file_actions_t spawn_file_actions;
+        posix_spawn_file_actions_init(&spawn_file_actions);
+        posix_spawn_file_actions_adddup2(&spawn_file_actions, child_sock, STDIN_FILENO);
+        posix_spawn_file_actions_adddup2(&spawn_file_actions, child_sock, STDOUT_FILENO);
+
+        int spawn_result = posix_spawn(&pid,
+                                       exe.c_str(),
+                                       &spawn_file_actions,
+                                       nullptr,
+                                       const_cast<char* const*>(child_argv),
+                                       environ);
+        posix_spawn_file_actions_destroy(&spawn_file_actions);
+        if(spawn_result != 0)
+            throw std::runtime_error("failed to spawn rtc helper");
+    }
+    ~helper()
+    {
+        // closing the socket tells the helper to exit
+        sock.close();
+        if(pid != -1)
+            waitpid(pid, nullptr, 0);
+    }
+
+    // send a compile request and wait for the response.  returns
+    // true and the code object if compilation succeeded, or false
+    // and the compiler's message.  throws if the helper can't be
+    // talked to, in which case the helper should not be reused.
+    bool compile(const std::string& kernel_src,
+                 const std::string& gpu_arch,
+                 std::vector<char>& output)
+    {
+        send_string(gpu_arch);
+        send_string(kernel_src);
+
+        char status = 0;
+        recv_bytes(&status, 1);
+        uint64_t output_size = 0;
+        recv_bytes(&output_size, sizeof(output_size));
+        output.resize(output_size);
+        recv_bytes(output.data(), output.size());
+        return status == 0;
+    }
+
+private:
+    void send_string(const std::string& str)
+    {
+        uint64_t size = str.size();
+        send_bytes(&size, sizeof(size));
+        send_bytes(str.data(), str.size());
+    }
+    void send_bytes(const void* data, size_t len)
+    {
+        auto ptr = static_cast<const char*>(data);
+        while(len)
+        {
+            ssize_t sent = send(sock, ptr, len, MSG_NOSIGNAL);
+            if(sent < 0 && errno == EINTR)
+                continue;
+            if(sent <= 0)
+                throw std::runtime_error("failed to send to rtc helper");
+            ptr += sent;
+            len -= sent;
+        }
+    }
+    void recv_bytes(void* data, size_t len)
+    {
+        auto ptr = static_cast<char*>(data);
+        while(len)
+        {
+            ssize_t received = recv(sock, ptr, len, 0);
+            if(received < 0 && errno == EINTR)
+                continue;
+            if(received <= 0)
+                throw std::runtime_error("failed to receive from rtc helper");
+            ptr += received;
+            len -= received;
+        }
+    }
+
+    pid_t               pid = -1;
+    file_handle_wrapper sock;
+};
+#endif
+
+RTCHelperPool::RTCHelperPool(size_t max_helpers)
+    : max_helpers(std::max<size_t>(max_helpers, 1))
+{
+}
+
+RTCHelperPool::~RTCHelperPool()
+{
+    // helpers only get destroyed while idle, since compiles hold a
+    // helper until they finish
+    idle.clear();
+}
+
+std::vector<char> RTCHelperPool::compile(const std::string& kernel_src,
+                                         const std::string& gpu_arch)
+{
+#ifdef WIN32
+    // helpers can't be kept running on Windows yet, so start one for
+    // each compile
+    return compile_oneshot(kernel_src, gpu_arch);
+#else
+    // take an idle helper, or reserve a slot to start a new one
+    std::unique_ptr<helper> h;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return !idle.empty() || running < max_helpers; });
+        if(!idle.empty())
+        {
+            h = std::move(idle.back());
+            idle.pop_back();
+        }
+        else
+            ++running;
+    }
+
+    std::vector<char> output;
+    bool              compiled = false;
+    try
+    {
+        if(!h)
+            h = std::make_unique<helper>(rtc_helper_exe());
+        compiled = h->compile(kernel_src, gpu_arch, output);
+    }
+    catch(std::exception&)
+    {
+        // helper is unusable (or never started), so give up its slot
+        h.reset();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --running;
+        }
+        cv.notify_one();
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle.push_back(std::move(h));
+    }
+    cv.notify_one();
+
+    if(!compiled)
+        throw std::runtime_error(std::string(output.begin(), output.end()));
+    if(output.empty())
+        throw std::runtime_error("child process failed to produce code");
+    return output;
+#endif
+}
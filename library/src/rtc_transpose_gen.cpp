@@ -317,8 +317,9 @@ std::string transpose_rtc(const std::string& kernel_name, const TransposeSpecs&
         func = make_planar(func, "output");
 
     func = make_callback_realcomplex(func, specs.cbtype);
+    func = make_simplify(func, {{"cbtype", rtc_cbtype_value(specs.cbtype)}});
 
-    src += func.render();
+    func.render(src);
 
     write_standalone_test_harness(func, src);
 
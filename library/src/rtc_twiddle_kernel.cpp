@@ -19,7 +19,6 @@
 // THE SOFTWARE.
 
 #include "rtc_twiddle_kernel.h"
-#include "device/kernel-generator-embed.h"
 #include "rtc_cache.h"
 
 RTCKernelTwiddle RTCKernelTwiddle::generate(const std::string& gpu_arch,
@@ -31,7 +30,7 @@ RTCKernelTwiddle RTCKernelTwiddle::generate(const std::string& gpu_arch,
     kernel_src_gen_t generator{
         [=](const std::string& kernel_name) { return twiddle_rtc(kernel_name, type, precision); }};
 
-    auto code = RTCCache::cached_compile(kernel_name, gpu_arch, generator, generator_sum());
+    auto code = RTCCache::cached_compile(kernel_name, gpu_arch, generator);
 
     return RTCKernelTwiddle{kernel_name, code, {}, {}};
 }
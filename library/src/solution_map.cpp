@@ -35,7 +35,7 @@ namespace fs = std::filesystem;
 
 static const char* def_solution_map_path = "rocfft_solution_map.dat";
 
-const int   solution_map::VERSION                       = 3;
+const int   solution_map::VERSION                       = 4;
 const char* solution_map::KERNEL_TOKEN_BUILTIN_KERNEL   = "kernel_token_builtin_kernel";
 const char* solution_map::LEAFNODE_TOKEN_BUILTIN_KERNEL = "leafnode_token_builtin_kernel";
 
@@ -695,7 +695,7 @@ bool solution_map::read_solution_map_data(const fs::path& sol_map_in_path, bool
             dst_map.emplace(probKey, solutionVec);
         }
     }
-    else if(self_version == 1 || self_version == 2)
+    else if(self_version >= 1 && self_version <= 3)
     {
         try
         {
@@ -28,6 +28,7 @@
 #include "../../shared/array_predicate.h"
 #include "../../shared/precision_type.h"
 #include "logging.h"
+#include "offline_device.h"
 #include "plan.h"
 #include "rocfft/rocfft.h"
 #include "transform.h"
@@ -255,6 +256,10 @@ void rocfft_plan_t::LogSortedPlan(const std::vector<size_t>& sortedIdx) const
 
 void rocfft_plan_t::Execute(void* in_buffer[], void* out_buffer[], rocfft_execution_info info)
 {
+    // offline plans have no kernels or device resources
+    if(offline_device_profile())
+        throw std::runtime_error("plans built from an offline device profile can't be executed");
+
     // Vector of topologically sorted indexes to the items in multiPlan
     auto sortedIdx = MultiPlanTopologicalSort();
 
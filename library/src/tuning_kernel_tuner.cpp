@@ -24,24 +24,32 @@
 #include "function_pool.h"
 #include "logging.h"
 #include "rocfft/rocfft.h"
+#include "rtc_stockham_gen.h"
 #include "solution_map.h"
 #include "tuning_helper.h"
 #include "twiddles.h"
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <random>
 #include <regex>
 #include <set>
 
 static const char* candidates_folder = "TuningCandidates";
 
-static const std::vector<size_t> supported_factors = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 16, 17};
+static const std::vector<size_t> supported_factors
+    = {2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 16, 17, 19, 23, 29, 31};
 
 // TODO- support half precision
 static const size_t LDS_BYTE_LIMIT    = 32 * 1024;
 static const size_t BYTES_PER_FLOAT2  = sizeof(float) * 2;
 static const size_t BYTES_PER_DOUBLE2 = sizeof(double) * 2;
+// VGPRs a thread can use before the compiler has to spill
+static const size_t VGPR_LIMIT = 256;
+// how much worse a candidate's LDS bank conflicts can be than the
+// best candidate with the same factors
+static const double LDS_CONFLICT_TOLERANCE = 2.0;
 
 // use_ltwd_3steps: if use_ltwd_3steps and ltwd_base < 8, then ltwd table will take some lds ,
 // tpt: threads_per_transform
@@ -299,6 +307,179 @@ std::set<std::vector<size_t>>
     return ret;
 }
 
+// estimate the work done by a candidate 1D kernel from its
+// generated source
+KernelProfile ProfileKernelConfig(const KernelConfig& config,
+                                  ComputeScheme       scheme,
+                                  bool                is_single)
+{
+    auto precision = is_single ? rocfft_precision_single : rocfft_precision_double;
+
+    std::vector<unsigned int> factors(config.factors.begin(), config.factors.end());
+    StockhamGeneratorSpecs    specs(factors,
+                                 {},
+                                 {static_cast<unsigned int>(precision)},
+                                 static_cast<unsigned int>(config.workgroup_size),
+                                 PrintScheme(scheme));
+    specs.threads_per_transform = config.threads_per_transform[0];
+    specs.half_lds              = config.half_lds;
+    specs.direct_to_from_reg    = config.direct_to_from_reg;
+    specs.split_radix           = config.split_radix;
+    specs.wgs_is_derived        = true;
+
+    return stockham_rtc_profile(specs, specs, scheme, precision);
+}
+
+// rough relative cost of doing one transform with a candidate
+// kernel, from its static profile.  memory accesses are weighted
+// above arithmetic, LDS accesses are slowed down by bank conflicts,
+// and barriers stall every thread in the block.
+double EstimatedKernelCost(const KernelConfig& config, const KernelProfile& p)
+{
+    double lds_slowdown = std::max(1.0, p.lds_conflict_degree);
+    double per_thread   = p.flops + 4.0 * (p.global_loads + p.global_stores)
+                        + 2.0 * p.lds_transactions() * lds_slowdown + 8.0 * p.syncthreads;
+    return per_thread * config.threads_per_transform[0];
+}
+
+// [reduce search space]
+// use a static profile of each candidate to keep only the cheapest
+// max_candidates (if non-zero).  the profile is only an estimate, so
+// removing other candidates is opt-in: if reject_spills is set,
+// candidates that the profile says would spill registers are
+// removed, and if reject_lds_conflicts is set, candidates whose
+// threads per block or half-LDS choice cause many more LDS bank
+// conflicts than other candidates with the same factors are removed.
+// generating kernels to profile them is not free, so nothing is
+// profiled unless one of those options is set.
+void ProfileKernelConfigs(std::set<KernelConfig>& configs,
+                          ComputeScheme           scheme,
+                          bool                    is_single,
+                          size_t                  max_candidates,
+                          bool                    reject_spills,
+                          bool                    reject_lds_conflicts,
+                          bool                    print_reject)
+{
+    if(!reject_spills && !reject_lds_conflicts && max_candidates == 0)
+        return;
+
+    // intrinsic and large twiddle variants generate the same kernel
+    // body as far as the profile is concerned, so only profile that
+    // once
+    auto profile_key = [](KernelConfig config) {
+        config.intrinsic_buffer_inst = false;
+        config.use_3steps_large_twd  = false;
+        return config;
+    };
+
+    std::map<KernelConfig, KernelProfile> profiles;
+    for(const auto& config : configs)
+    {
+        auto key = profile_key(config);
+        if(profiles.count(key))
+            continue;
+        KernelProfile p;
+        try
+        {
+            p = ProfileKernelConfig(config, scheme, is_single);
+        }
+        catch(std::exception&)
+        {
+            // leave the profile empty, so the candidate is not
+            // ranked or removed
+        }
+        profiles.emplace(key, p);
+    }
+    auto profile_of = [&](const KernelConfig& config) -> const KernelProfile& {
+        return profiles.at(profile_key(config));
+    };
+
+    // remove candidates whose registers won't fit, as long as some
+    // candidates are left
+    size_t vgprs_per_complex = (is_single ? BYTES_PER_FLOAT2 : BYTES_PER_DOUBLE2) / sizeof(float);
+    auto   spills            = [&](const KernelConfig& config) {
+        return profile_of(config).registers * vgprs_per_complex > VGPR_LIMIT;
+    };
+    if(reject_spills && !std::all_of(configs.begin(), configs.end(), spills))
+    {
+        for(auto config = configs.begin(), last = configs.end(); config != last;)
+        {
+            if(spills(*config))
+            {
+                PrintRejectionMsg("reject: registers would spill\n" + config->Print() + "\n"
+                                      + profile_of(*config).Print() + "\n\n",
+                                  print_reject);
+                config = configs.erase(config);
+            }
+            else
+                ++config;
+        }
+    }
+
+    // remove candidates with many more LDS bank conflicts than the
+    // fewest for their factorization
+    if(reject_lds_conflicts)
+    {
+        std::map<std::vector<size_t>, double> least_conflicts;
+        for(const auto& config : configs)
+        {
+            double degree = profile_of(config).lds_conflict_degree;
+            if(degree == 0.0)
+                continue;
+            auto least          = least_conflicts.emplace(config.factors, degree);
+            least.first->second = std::min(least.first->second, degree);
+        }
+        for(auto config = configs.begin(), last = configs.end(); config != last;)
+        {
+            double degree = profile_of(*config).lds_conflict_degree;
+            auto   least  = least_conflicts.find(config->factors);
+            if(least != least_conflicts.end() && degree > least->second * LDS_CONFLICT_TOLERANCE)
+            {
+                PrintRejectionMsg("reject: LDS bank conflicts of degree " + std::to_string(degree)
+                                      + ", other candidates have "
+                                      + std::to_string(least->second) + "\n" + config->Print()
+                                      + "\n" + profile_of(*config).Print() + "\n\n",
+                                  print_reject);
+                config = configs.erase(config);
+            }
+            else
+                ++config;
+        }
+    }
+
+    if(max_candidates > 0 && configs.size() > max_candidates)
+    {
+        std::vector<std::pair<double, const KernelConfig*>> ranked;
+        for(const auto& config : configs)
+        {
+            const auto& p = profile_of(config);
+            if(!p.empty())
+                ranked.emplace_back(EstimatedKernelCost(config, p), &config);
+        }
+        std::stable_sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        // candidates without a profile can't be ranked, so keep them
+        size_t unranked = configs.size() - ranked.size();
+        size_t keep     = max_candidates > unranked ? max_candidates - unranked : 0;
+
+        std::set<KernelConfig> rejected;
+        for(size_t i = keep; i < ranked.size(); ++i)
+        {
+            const auto& config = *ranked[i].second;
+            PrintRejectionMsg("reject: estimated cost " + std::to_string(ranked[i].first)
+                                  + " is not among the best " + std::to_string(max_candidates)
+                                  + "\n" + config.Print() + "\n" + profile_of(config).Print()
+                                  + "\n\n",
+                              print_reject);
+            rejected.insert(config);
+        }
+        for(const auto& config : rejected)
+            configs.erase(config);
+    }
+}
+
 std::set<KernelConfig> Supported2DKernelConfigs(size_t len0, size_t len1, size_t node_id)
 {
     std::set<KernelConfig> configs;
@@ -432,6 +613,13 @@ std::set<KernelConfig> Supported2DKernelConfigs(size_t len0, size_t len1, size_t
                     }
 
                     configs.insert(config);
+
+                    // also try split-radix butterflies, if there are any
+                    if(stockham_has_split_radix(config.factors))
+                    {
+                        config.split_radix = true;
+                        configs.insert(config);
+                    }
                 }
             }
         }
@@ -481,11 +669,15 @@ std::set<KernelConfig> SupportedKernelConfigs(size_t length,
     std::set<size_t> tpts_with_bad_util_rate;
     std::set<size_t> all_tpts;
 
-    bool        print_reject = !rocfft_getenv("PRINT_REJECT_REASON").empty();
-    std::string min_wgs_str  = rocfft_getenv("MIN_WGS");
-    std::string max_wgs_str  = rocfft_getenv("MAX_WGS");
-    size_t      min_wgs      = min_wgs_str.empty() ? 64 : std::atoi(min_wgs_str.c_str());
-    size_t      max_wgs      = max_wgs_str.empty() ? 512 : std::atoi(max_wgs_str.c_str());
+    bool        print_reject  = !rocfft_getenv("PRINT_REJECT_REASON").empty();
+    std::string min_wgs_str   = rocfft_getenv("MIN_WGS");
+    std::string max_wgs_str   = rocfft_getenv("MAX_WGS");
+    std::string max_cand_str  = rocfft_getenv("MAX_CANDIDATES");
+    bool        reject_spills = !rocfft_getenv("REJECT_SPILLS").empty();
+    bool        reject_lds    = !rocfft_getenv("REJECT_LDS_CONFLICTS").empty();
+    size_t      min_wgs       = min_wgs_str.empty() ? 64 : std::atoi(min_wgs_str.c_str());
+    size_t      max_wgs       = max_wgs_str.empty() ? 512 : std::atoi(max_wgs_str.c_str());
+    size_t      max_cand      = max_cand_str.empty() ? 0 : std::atoi(max_cand_str.c_str());
 
     // if min_wgs is greater than length, then we lower it.
     min_wgs = (length < min_wgs) ? length : min_wgs;
@@ -661,6 +853,12 @@ std::set<KernelConfig> SupportedKernelConfigs(size_t length,
                                             config.factors               = factorization;
 
                                             configs.insert(config);
+
+                                            if(stockham_has_split_radix(config.factors))
+                                            {
+                                                config.split_radix = true;
+                                                configs.insert(config);
+                                            }
                                         }
                                     }
                                 }
@@ -754,6 +952,16 @@ std::set<KernelConfig> SupportedKernelConfigs(size_t length,
         }
     }
 
+    ComputeScheme scheme = CS_KERNEL_STOCKHAM;
+    if(is_sbcc)
+        scheme = CS_KERNEL_STOCKHAM_BLOCK_CC;
+    else if(is_sbrc)
+        scheme = CS_KERNEL_STOCKHAM_BLOCK_RC;
+    else if(is_sbcr)
+        scheme = CS_KERNEL_STOCKHAM_BLOCK_CR;
+    ProfileKernelConfigs(
+        configs, scheme, is_single, max_cand, reject_spills, reject_lds, print_reject);
+
     return configs;
 }
 
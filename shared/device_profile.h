@@ -0,0 +1,188 @@
+// Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Read and write device profiles: text files describing the device
+// properties that plans depend on, so that plans can be built for a
+// device that is not present.
+//
+// A profile has one "key = value" line per property.  Blank lines
+// and anything after a '#' are ignored.  gcnArchName is required;
+// other properties default to values typical of current hardware:
+//
+//   gcnArchName = gfx90a:sramecc+:xnack-
+//   name = AMD Instinct MI210
+//   sharedMemPerBlock = 65536
+//   maxSharedMemoryPerMultiProcessor = 65536
+//   multiProcessorCount = 104
+//   warpSize = 64
+//   maxThreadsPerBlock = 1024
+//   maxThreadsDim = 1024 1024 1024
+//   maxGridSize = 2147483647 65536 65536
+//   totalGlobalMem = 68702699520
+
+#ifndef ROCFFT_DEVICE_PROFILE_H
+#define ROCFFT_DEVICE_PROFILE_H
+
+#include <cstring>
+#include <fstream>
+#include <hip/hip_runtime_api.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+static hipDeviceProp_t device_profile_defaults()
+{
+    hipDeviceProp_t prop                  = {};
+    prop.sharedMemPerBlock                = 64 * 1024;
+    prop.maxSharedMemoryPerMultiProcessor = 64 * 1024;
+    prop.multiProcessorCount              = 1;
+    prop.warpSize                         = 64;
+    prop.maxThreadsPerBlock               = 1024;
+    prop.maxThreadsDim[0]                 = 1024;
+    prop.maxThreadsDim[1]                 = 1024;
+    prop.maxThreadsDim[2]                 = 1024;
+    prop.maxGridSize[0]                   = 2147483647;
+    prop.maxGridSize[1]                   = 65536;
+    prop.maxGridSize[2]                   = 65536;
+    return prop;
+}
+
+// parse a device profile from a stream.  throws std::runtime_error
+// if the profile is malformed.
+static hipDeviceProp_t device_profile_parse(std::istream& is)
+{
+    hipDeviceProp_t prop    = device_profile_defaults();
+    bool            hasArch = false;
+
+    // copy a string property into a fixed-size char array
+    auto set_string = [](char* dest, size_t destSize, const std::string& value) {
+        if(value.size() >= destSize)
+            throw std::runtime_error("device profile value too long: " + value);
+        std::strncpy(dest, value.c_str(), destSize);
+    };
+
+    std::string line;
+    size_t      lineNum = 0;
+    while(std::getline(is, line))
+    {
+        ++lineNum;
+        auto comment = line.find('#');
+        if(comment != std::string::npos)
+            line.erase(comment);
+
+        auto eq = line.find('=');
+        if(eq == std::string::npos)
+        {
+            if(line.find_first_not_of(" \t\r") != std::string::npos)
+                throw std::runtime_error("device profile line " + std::to_string(lineNum)
+                                         + " is not of the form \"key = value\"");
+            continue;
+        }
+
+        std::istringstream keyStream(line.substr(0, eq));
+        std::string        key;
+        keyStream >> key;
+
+        // trim whitespace around the value
+        std::string value    = line.substr(eq + 1);
+        auto        valBegin = value.find_first_not_of(" \t\r");
+        auto        valEnd   = value.find_last_not_of(" \t\r");
+        value = valBegin == std::string::npos ? "" : value.substr(valBegin, valEnd - valBegin + 1);
+
+        if(key == "gcnArchName")
+        {
+            set_string(prop.gcnArchName, sizeof(prop.gcnArchName), value);
+            hasArch = !value.empty();
+            continue;
+        }
+        if(key == "name")
+        {
+            set_string(prop.name, sizeof(prop.name), value);
+            continue;
+        }
+
+        std::istringstream valStream(value);
+        bool               ok = true;
+        if(key == "sharedMemPerBlock")
+            ok = static_cast<bool>(valStream >> prop.sharedMemPerBlock);
+        else if(key == "maxSharedMemoryPerMultiProcessor")
+            ok = static_cast<bool>(valStream >> prop.maxSharedMemoryPerMultiProcessor);
+        else if(key == "multiProcessorCount")
+            ok = static_cast<bool>(valStream >> prop.multiProcessorCount);
+        else if(key == "warpSize")
+            ok = static_cast<bool>(valStream >> prop.warpSize);
+        else if(key == "maxThreadsPerBlock")
+            ok = static_cast<bool>(valStream >> prop.maxThreadsPerBlock);
+        else if(key == "maxThreadsDim")
+            ok = static_cast<bool>(valStream >> prop.maxThreadsDim[0] >> prop.maxThreadsDim[1]
+                                   >> prop.maxThreadsDim[2]);
+        else if(key == "maxGridSize")
+            ok = static_cast<bool>(valStream >> prop.maxGridSize[0] >> prop.maxGridSize[1]
+                                   >> prop.maxGridSize[2]);
+        else if(key == "totalGlobalMem")
+            ok = static_cast<bool>(valStream >> prop.totalGlobalMem);
+        else
+            throw std::runtime_error("unknown device profile key: " + key);
+
+        // numbers must make up the whole value
+        if(!ok || !(valStream >> std::ws).eof())
+            throw std::runtime_error("invalid value for device profile key " + key + ": "
+                                     + value);
+    }
+
+    if(!hasArch)
+        throw std::runtime_error("device profile does not specify gcnArchName");
+    return prop;
+}
+
+// read a device profile from a file
+static hipDeviceProp_t device_profile_read(const std::string& path)
+{
+    std::ifstream is(path);
+    if(!is)
+        throw std::runtime_error("unable to open device profile " + path);
+    try
+    {
+        return device_profile_parse(is);
+    }
+    catch(std::exception& e)
+    {
+        throw std::runtime_error(path + ": " + e.what());
+    }
+}
+
+// write the properties that device_profile_parse understands
+static void device_profile_write(std::ostream& os, const hipDeviceProp_t& prop)
+{
+    os << "gcnArchName = " << prop.gcnArchName << "\n";
+    os << "name = " << prop.name << "\n";
+    os << "sharedMemPerBlock = " << prop.sharedMemPerBlock << "\n";
+    os << "maxSharedMemoryPerMultiProcessor = " << prop.maxSharedMemoryPerMultiProcessor << "\n";
+    os << "multiProcessorCount = " << prop.multiProcessorCount << "\n";
+    os << "warpSize = " << prop.warpSize << "\n";
+    os << "maxThreadsPerBlock = " << prop.maxThreadsPerBlock << "\n";
+    os << "maxThreadsDim = " << prop.maxThreadsDim[0] << " " << prop.maxThreadsDim[1] << " "
+       << prop.maxThreadsDim[2] << "\n";
+    os << "maxGridSize = " << prop.maxGridSize[0] << " " << prop.maxGridSize[1] << " "
+       << prop.maxGridSize[2] << "\n";
+    os << "totalGlobalMem = " << prop.totalGlobalMem << "\n";
+}
+
+#endif